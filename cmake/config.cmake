@@ -199,6 +199,13 @@ if(OMR_THR_YIELD_ALG)
 		MESSAGE "OMR_THR_YIELD_ALG enabled, but not supported on current platform"
 	)
 endif()
+set(OMR_THR_FAST_TLS OFF CACHE BOOL "Use compiler-supported initial-exec TLS for omrthread_self")
+if(OMR_THR_FAST_TLS)
+	omr_assert(FATAL_ERROR
+		TEST OMR_OS_LINUX OR OMR_OS_OSX
+		MESSAGE "OMR_THR_FAST_TLS enabled, but not supported on current platform"
+	)
+endif()
 # TODO set to disabled. Stuff fails to compile when its on
 set(OMR_THR_MCS_LOCKS OFF CACHE BOOL "Enable the usage of the MCS lock in the OMR thread monitor.")
 
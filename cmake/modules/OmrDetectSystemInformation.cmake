@@ -73,6 +73,13 @@ function(omr_check_dladdr)
 	check_symbol_exists(dladdr "dlfcn.h" OMR_HAVE_DLADDR)
 endfunction()
 
+# io_uring headers new enough for IORING_OP_FALLOCATE (Linux 5.6)
+function(omr_check_io_uring)
+	if(OMR_OS_LINUX)
+		check_symbol_exists(IORING_FEAT_RW_CUR_POS "linux/io_uring.h" OMR_HAVE_LINUX_IO_URING)
+	endif()
+endfunction()
+
 # Translate from CMake's view of the system to the OMR view of the system.
 # Exports a number of variables indicating platform, os, endianness, etc.
 # - OMR_ARCH_{AARCH64,X86,ARM,S390,POWER}
@@ -232,6 +239,7 @@ macro(omr_detect_system_information)
 
 	omr_find_semaphore_implementation()
 	omr_check_dladdr()
+	omr_check_io_uring()
 
 	# Check if we are a multi config generator.
 	# CMake 3.10 adds GENERATOR_IS_MULTI_CONFIG property
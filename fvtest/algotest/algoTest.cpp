@@ -119,6 +119,8 @@ static const PoolInputData poolParams[] = {
 	{"POOL_ALWAYS_KEEP_SORTED flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ALWAYS_KEEP_SORTED},
 	{"POOL_ROUND_TO_PAGE_SIZE flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_ROUND_TO_PAGE_SIZE},
 	{"POOL_NEVER_FREE_PUDDLES flag",						32,		10,		sizeof(uintptr_t),		0,		POOL_NEVER_FREE_PUDDLES},
+	{"thread safe pool - with holes",						8,		100,	sizeof(uintptr_t),		0,		POOL_THREAD_SAFE},
+	{"thread safe pool",									12,		100,	sizeof(uintptr_t),		0,		POOL_THREAD_SAFE},
 };
 
 static const uintptr_t data1[] = {1, 2, 3, 4, 5, 6, 7, 17, 18, 19, 20, 21, 22, 23, 24, 25};
@@ -169,6 +171,16 @@ TEST_P(AVLTest, test)
 
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, AVLTest, ::testing::ValuesIn(avlParams));
 
+TEST(OmrAlgoTest, BTreeTest)
+{
+	ASSERT_EQ(0, verifyBTree(omrTestEnv->getPortLibrary()));
+}
+
+TEST(OmrAlgoTest, BTreeBenchmark)
+{
+	ASSERT_EQ(0, benchmarkBTree(omrTestEnv->getPortLibrary()));
+}
+
 class PoolTest: public ::testing::TestWithParam<PoolInputData>
 {
 };
@@ -187,6 +199,11 @@ TEST(OmrAlgoTest, PoolTestPuddleSharing)
 	ASSERT_EQ(0, testPoolPuddleListSharing(omrTestEnv->getPortLibrary()));
 }
 
+TEST(OmrAlgoTest, PoolTestThreadCaches)
+{
+	ASSERT_EQ(0, testPoolThreadCaches(omrTestEnv->getPortLibrary()));
+}
+
 TEST(OmrAlgoTest, hookabletest)
 {
 	uintptr_t passCount = 0;
@@ -199,6 +216,11 @@ TEST(OmrAlgoTest, hookabletest)
 	showResult(omrTestEnv->getPortLibrary(), passCount, failCount, numSuitesNotRun);
 }
 
+TEST(OmrAlgoTest, HookDispatchBenchmark)
+{
+	ASSERT_EQ(0, benchmarkHookDispatch(omrTestEnv->getPortLibrary()));
+}
+
 class HashtableTest: public ::testing::TestWithParam<HashtableInputData>
 {
 };
@@ -221,8 +243,33 @@ TEST_P(HashtableTest, NoForce)
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
 }
 
+TEST_P(HashtableTest, OpenAddressingForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(HashtableTest, OpenAddressingNoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+	params.collisionResistant = FALSE;
+	params.openAddressing = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, HashtableTest, ::testing::ValuesIn(hastableParams));
 
+TEST(OmrAlgoTest, OpenAddressingHashtableChurn)
+{
+	ASSERT_EQ(0, verifyOpenAddressingHashtableChurn(omrTestEnv->getPortLibrary()));
+}
+
 class CollisionResilientHashtableTest: public ::testing::TestWithParam< ::testing::tuple<HashtableInputData, uint32_t> >
 {
 };
@@ -50,6 +50,7 @@ typedef struct HashtableInputData {
 	uint32_t listToTreeThreshold;
 	BOOLEAN forceCollisions;
 	BOOLEAN collisionResistant;
+	BOOLEAN openAddressing;
 } HashtableInputData;
 
 /* ---------------- avltest.c ---------------- */
@@ -63,6 +64,22 @@ typedef struct HashtableInputData {
 int32_t
 buildAndVerifyAVLTree(OMRPortLibrary *portLib, const char *success, const char *testData);
 
+/**
+* @brief Exercise the B+-tree through random inserts, deletes and a bulk load.
+* @param *portLib
+* @return int32_t 0 on success
+*/
+int32_t
+verifyBTree(OMRPortLibrary *portLib);
+
+/**
+* @brief Compare address range lookups in a J9AVLTree and a B+-tree over 1M ranges.
+* @param *portLib
+* @return int32_t 0 on success
+*/
+int32_t
+benchmarkBTree(OMRPortLibrary *portLib);
+
 /* ---------------- pooltest.c ---------------- */
 
 /**
@@ -82,6 +99,14 @@ createAndVerifyPool(OMRPortLibrary *portLib, PoolInputData *input);
 int32_t
 testPoolPuddleListSharing(OMRPortLibrary *portLib);
 
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+testPoolThreadCaches(OMRPortLibrary *portLib);
+
 /* ---------------- hooktest.c ---------------- */
 
 /**
@@ -94,6 +119,14 @@ testPoolPuddleListSharing(OMRPortLibrary *portLib);
 int32_t
 verifyHookable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount);
 
+/**
+* @brief
+* @param *portLib
+* @return int32_t
+*/
+int32_t
+benchmarkHookDispatch(OMRPortLibrary *portLib);
+
 /* ---------------- hashtabletest.c ---------------- */
 
 /**
@@ -110,6 +143,9 @@ verifyHashtable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCo
 int32_t
 buildAndVerifyHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData);
 
+int32_t
+verifyOpenAddressingHashtableChurn(OMRPortLibrary *portLib);
+
 #ifdef __cplusplus
 }
 #endif
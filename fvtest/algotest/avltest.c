@@ -46,6 +46,32 @@ static uintptr_t get_datum_string(OMRPortLibrary *portlib, OMRAVLTestNode *walk,
 static void avl_get_string(OMRPortLibrary *portlib, J9AVLTree *tree, char *buffer, uintptr_t bufSize);
 static intptr_t testSearchComparator(J9AVLTree *tree, intptr_t search, OMRAVLTestNode *walkNode);
 static void freeAVLTree(OMRPortLibrary *portlib, J9AVLTreeNode *currentNode);
+static uint32_t btreeTestRandom(uint32_t *seed);
+static intptr_t verifyBTreeBlock(J9BTreeBlock *block, uintptr_t height, BOOLEAN isRoot, uintptr_t low, uintptr_t high);
+static BOOLEAN verifyBTreeShape(J9BTree *tree);
+static uintptr_t btreeWalkCheck(uintptr_t key, void *value, void *userData);
+static intptr_t benchSearchComparator(J9AVLTree *tree, uintptr_t address, J9AVLTreeNode *node);
+static intptr_t benchInsertionComparator(J9AVLTree *tree, J9AVLTreeNode *insertNode, J9AVLTreeNode *walkNode);
+
+#define BTREE_TEST_KEYS 20000
+#define BTREE_TEST_VALUE(key) ((void *)((key) + 1))
+#define BTREE_BENCH_RANGES (1024 * 1024)
+#define BTREE_BENCH_RANGE_SIZE 64
+#define BTREE_BENCH_LOOKUPS (256 * 1024)
+
+typedef struct BTreeWalkState {
+	uintptr_t visited;
+	uintptr_t lastKey;
+	BOOLEAN ordered;
+} BTreeWalkState;
+
+/* an address range as the JIT metadata and segment trees keep them */
+typedef struct BTreeBenchRange {
+	J9WSRP leftChild;
+	J9WSRP rightChild;
+	uintptr_t base;
+	uintptr_t size;
+} BTreeBenchRange;
 
 int32_t
 buildAndVerifyAVLTree(OMRPortLibrary *portLib, const char *success, const char *testData)
@@ -307,3 +333,395 @@ static uintptr_t get_node_string(OMRPortLibrary *portlib, J9AVLTree *tree, OMRAV
 	}
 	return len;
 }
+
+static uint32_t
+btreeTestRandom(uint32_t *seed)
+{
+	*seed = (*seed * 1103515245) + 12345;
+	return *seed >> 1;
+}
+
+/* check a block and everything below it, returning the number of keys or -1 */
+static intptr_t
+verifyBTreeBlock(J9BTreeBlock *block, uintptr_t height, BOOLEAN isRoot, uintptr_t low, uintptr_t high)
+{
+	intptr_t keys = 0;
+	uintptr_t i = 0;
+
+	if (0 != ((uintptr_t)block & (J9BTREE_BLOCK_SIZE - 1))) {
+		return -1;
+	}
+	if ((0 == block->count) || (block->count > J9BTREE_BLOCK_KEYS) || (!isRoot && (block->count < (J9BTREE_BLOCK_KEYS / 2)))) {
+		return -1;
+	}
+	if ((0 != block->isLeaf) != (1 == height)) {
+		return -1;
+	}
+	for (i = 0; i < block->count; i++) {
+		if ((block->keys[i] < low) || (block->keys[i] >= high)) {
+			return -1;
+		}
+		if ((0 != i) && (block->keys[i - 1] >= block->keys[i])) {
+			return -1;
+		}
+	}
+	if (block->isLeaf) {
+		return block->count;
+	}
+	for (i = 0; i <= block->count; i++) {
+		uintptr_t childLow = (0 == i) ? low : block->keys[i - 1];
+		uintptr_t childHigh = (block->count == i) ? high : block->keys[i];
+		intptr_t childKeys = verifyBTreeBlock(block->u.children[i], height - 1, FALSE, childLow, childHigh);
+
+		if (childKeys < 0) {
+			return -1;
+		}
+		keys += childKeys;
+	}
+	return keys;
+}
+
+static BOOLEAN
+verifyBTreeShape(J9BTree *tree)
+{
+	if (NULL == tree->rootBlock) {
+		return (0 == tree->height) && (0 == tree->count);
+	}
+	return (intptr_t)tree->count == verifyBTreeBlock(tree->rootBlock, tree->height, TRUE, 0, UINTPTR_MAX);
+}
+
+static uintptr_t
+btreeWalkCheck(uintptr_t key, void *value, void *userData)
+{
+	BTreeWalkState *state = (BTreeWalkState *)userData;
+
+	if (((0 != state->visited) && (key <= state->lastKey)) || (BTREE_TEST_VALUE(key) != value)) {
+		state->ordered = FALSE;
+	}
+	state->lastKey = key;
+	state->visited += 1;
+	return 0;
+}
+
+int32_t
+verifyBTree(OMRPortLibrary *portLib)
+{
+	static const uintptr_t bulkSizes[] = {1, J9BTREE_BLOCK_KEYS, J9BTREE_BLOCK_KEYS + 1, 1000, BTREE_TEST_KEYS};
+	J9BTree tree;
+	BTreeWalkState walkState = {0, 0, TRUE};
+	uintptr_t *keys = NULL;
+	void **values = NULL;
+	uint8_t *present = NULL;
+	uint32_t seed = 1;
+	uintptr_t i = 0;
+	uintptr_t b = 0;
+	uintptr_t foundKey = 0;
+	const char *failure = NULL;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	if (sizeof(J9BTreeBlock) != J9BTREE_BLOCK_SIZE) {
+		omrtty_printf("J9BTreeBlock is %zu bytes, expected %d\n", sizeof(J9BTreeBlock), J9BTREE_BLOCK_SIZE);
+		return -1;
+	}
+
+	btree_init(&tree, portLib, OMRMEM_CATEGORY_VM);
+	keys = omrmem_allocate_memory(BTREE_TEST_KEYS * sizeof(uintptr_t), OMRMEM_CATEGORY_VM);
+	values = omrmem_allocate_memory(BTREE_TEST_KEYS * sizeof(void *), OMRMEM_CATEGORY_VM);
+	present = omrmem_allocate_memory(BTREE_TEST_KEYS, OMRMEM_CATEGORY_VM);
+	if ((NULL == keys) || (NULL == values) || (NULL == present)) {
+		failure = "out of memory";
+		goto done;
+	}
+
+	/* keys 16 apart, inserted in random order; key k is present[k / 16 - 1] */
+	for (i = 0; i < BTREE_TEST_KEYS; i++) {
+		keys[i] = (i + 1) * 16;
+		present[i] = 1;
+	}
+	for (i = BTREE_TEST_KEYS - 1; i > 0; i--) {
+		uintptr_t j = btreeTestRandom(&seed) % (i + 1);
+		uintptr_t swap = keys[i];
+
+		keys[i] = keys[j];
+		keys[j] = swap;
+	}
+	for (i = 0; i < BTREE_TEST_KEYS; i++) {
+		if (BTREE_TEST_VALUE(keys[i]) != btree_insert(&tree, keys[i], BTREE_TEST_VALUE(keys[i]))) {
+			failure = "insert failed";
+			goto done;
+		}
+	}
+	if (BTREE_TEST_VALUE(keys[0]) != btree_insert(&tree, keys[0], (void *)1)) {
+		failure = "insert replaced an existing value";
+		goto done;
+	}
+	if (!verifyBTreeShape(&tree) || (BTREE_TEST_KEYS != tree.count)) {
+		failure = "bad shape after inserts";
+		goto done;
+	}
+	for (i = 0; i < BTREE_TEST_KEYS; i++) {
+		if ((BTREE_TEST_VALUE(keys[i]) != btree_search(&tree, keys[i])) || (NULL != btree_search(&tree, keys[i] + 1))) {
+			failure = "search failed";
+			goto done;
+		}
+		if ((BTREE_TEST_VALUE(keys[i]) != btree_searchFloor(&tree, keys[i] + 15, &foundKey)) || (keys[i] != foundKey)) {
+			failure = "floor search failed";
+			goto done;
+		}
+	}
+	if (NULL != btree_searchFloor(&tree, 15, NULL)) {
+		failure = "floor search below the smallest key found a key";
+		goto done;
+	}
+	btree_walk(&tree, btreeWalkCheck, &walkState);
+	if (!walkState.ordered || (BTREE_TEST_KEYS != walkState.visited)) {
+		failure = "walk out of order";
+		goto done;
+	}
+
+	/* delete half of the keys, so that separators go stale and floor searches must step left */
+	for (i = 0; i < BTREE_TEST_KEYS; i += 2) {
+		if (BTREE_TEST_VALUE(keys[i]) != btree_delete(&tree, keys[i])) {
+			failure = "delete failed";
+			goto done;
+		}
+		present[(keys[i] / 16) - 1] = 0;
+	}
+	if ((NULL != btree_delete(&tree, keys[0])) || !verifyBTreeShape(&tree) || ((BTREE_TEST_KEYS / 2) != tree.count)) {
+		failure = "bad shape after deletes";
+		goto done;
+	}
+	for (i = 0; i < BTREE_TEST_KEYS; i++) {
+		uintptr_t slot = (keys[i] / 16) - 1;
+		void *expected = NULL;
+
+		while (!present[slot] && (0 != slot)) {
+			slot -= 1;
+		}
+		if (present[slot]) {
+			expected = BTREE_TEST_VALUE((slot + 1) * 16);
+		}
+		if (expected != btree_searchFloor(&tree, keys[i], NULL)) {
+			failure = "floor search after deletes failed";
+			goto done;
+		}
+		if ((NULL != btree_search(&tree, keys[i])) != (0 == (i % 2) ? FALSE : TRUE)) {
+			failure = "search after deletes failed";
+			goto done;
+		}
+	}
+	for (i = 1; i < BTREE_TEST_KEYS; i += 2) {
+		if (BTREE_TEST_VALUE(keys[i]) != btree_delete(&tree, keys[i])) {
+			failure = "delete failed";
+			goto done;
+		}
+	}
+	if ((NULL != tree.rootBlock) || !verifyBTreeShape(&tree)) {
+		failure = "tree not empty after deleting every key";
+		goto done;
+	}
+
+	/* bulk loads of ascending keys, followed by updates */
+	for (i = 0; i < BTREE_TEST_KEYS; i++) {
+		keys[i] = (i + 1) * 16;
+		values[i] = BTREE_TEST_VALUE(keys[i]);
+	}
+	for (b = 0; b < sizeof(bulkSizes) / sizeof(bulkSizes[0]); b++) {
+		uintptr_t count = bulkSizes[b];
+
+		btree_free(&tree);
+		if ((0 != btree_bulkLoad(&tree, keys, values, count)) || !verifyBTreeShape(&tree) || (count != tree.count)) {
+			failure = "bulk load failed";
+			goto done;
+		}
+		if (-1 != btree_bulkLoad(&tree, keys, values, count)) {
+			failure = "bulk load into a non-empty tree succeeded";
+			goto done;
+		}
+		for (i = 0; i < count; i++) {
+			if (BTREE_TEST_VALUE(keys[i]) != btree_searchFloor(&tree, keys[i] + 8, NULL)) {
+				failure = "floor search after bulk load failed";
+				goto done;
+			}
+		}
+		for (i = 0; i < count; i += 3) {
+			if (BTREE_TEST_VALUE(keys[i] + 8) != btree_insert(&tree, keys[i] + 8, BTREE_TEST_VALUE(keys[i] + 8))) {
+				failure = "insert after bulk load failed";
+				goto done;
+			}
+		}
+		for (i = 1; i < count; i += 3) {
+			if (BTREE_TEST_VALUE(keys[i]) != btree_delete(&tree, keys[i])) {
+				failure = "delete after bulk load failed";
+				goto done;
+			}
+		}
+		if (!verifyBTreeShape(&tree)) {
+			failure = "bad shape after updating a bulk loaded tree";
+			goto done;
+		}
+	}
+	btree_free(&tree);
+	keys[1] = keys[0];
+	if (-1 != btree_bulkLoad(&tree, keys, values, 2)) {
+		failure = "bulk load of keys out of order succeeded";
+		goto done;
+	}
+
+done:
+	if (NULL != failure) {
+		omrtty_printf("B+-tree test: %s\n", failure);
+	}
+	btree_free(&tree);
+	omrmem_free_memory(present);
+	omrmem_free_memory(values);
+	omrmem_free_memory(keys);
+	return (NULL == failure) ? 0 : -1;
+}
+
+static intptr_t
+benchSearchComparator(J9AVLTree *tree, uintptr_t address, J9AVLTreeNode *node)
+{
+	BTreeBenchRange *range = (BTreeBenchRange *)node;
+
+	if (address < range->base) {
+		return -1;
+	}
+	if (address >= (range->base + range->size)) {
+		return 1;
+	}
+	return 0;
+}
+
+static intptr_t
+benchInsertionComparator(J9AVLTree *tree, J9AVLTreeNode *insertNode, J9AVLTreeNode *walkNode)
+{
+	uintptr_t insertBase = ((BTreeBenchRange *)insertNode)->base;
+	uintptr_t walkBase = ((BTreeBenchRange *)walkNode)->base;
+
+	return (insertBase < walkBase) ? -1 : ((insertBase > walkBase) ? 1 : 0);
+}
+
+/*
+ * Look up random addresses in 1M ranges, through a J9AVLTree with a range comparator and
+ * through B+-trees built by bulk load and by inserts, using btree_searchFloor.
+ */
+int32_t
+benchmarkBTree(OMRPortLibrary *portLib)
+{
+	J9AVLTree avlTree;
+	J9BTree bulkTree;
+	J9BTree insertTree;
+	BTreeBenchRange *ranges = NULL;
+	uintptr_t *keys = NULL;
+	void **values = NULL;
+	uintptr_t *addresses = NULL;
+	uintptr_t found = 0;
+	uint32_t seed = 7;
+	uint64_t start = 0;
+	uint64_t avlBuild = 0;
+	uint64_t bulkBuild = 0;
+	uint64_t insertBuild = 0;
+	uint64_t avlLookup = 0;
+	uint64_t bulkLookup = 0;
+	uint64_t insertLookup = 0;
+	uintptr_t i = 0;
+	int32_t rc = 0;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	memset(&avlTree, 0, sizeof(avlTree));
+	avlTree.insertionComparator = benchInsertionComparator;
+	avlTree.searchComparator = benchSearchComparator;
+	btree_init(&bulkTree, portLib, OMRMEM_CATEGORY_VM);
+	btree_init(&insertTree, portLib, OMRMEM_CATEGORY_VM);
+
+	ranges = omrmem_allocate_memory(BTREE_BENCH_RANGES * sizeof(BTreeBenchRange), OMRMEM_CATEGORY_VM);
+	keys = omrmem_allocate_memory(BTREE_BENCH_RANGES * sizeof(uintptr_t), OMRMEM_CATEGORY_VM);
+	values = omrmem_allocate_memory(BTREE_BENCH_RANGES * sizeof(void *), OMRMEM_CATEGORY_VM);
+	addresses = omrmem_allocate_memory(BTREE_BENCH_LOOKUPS * sizeof(uintptr_t), OMRMEM_CATEGORY_VM);
+	if ((NULL == ranges) || (NULL == keys) || (NULL == values) || (NULL == addresses)) {
+		rc = -1;
+		goto done;
+	}
+
+	/* ranges with gaps between them, and addresses inside random ranges */
+	memset(ranges, 0, BTREE_BENCH_RANGES * sizeof(BTreeBenchRange));
+	for (i = 0; i < BTREE_BENCH_RANGES; i++) {
+		ranges[i].base = 0x10000 + (i * BTREE_BENCH_RANGE_SIZE * 2);
+		ranges[i].size = BTREE_BENCH_RANGE_SIZE;
+		keys[i] = ranges[i].base;
+		values[i] = &ranges[i];
+	}
+	for (i = 0; i < BTREE_BENCH_LOOKUPS; i++) {
+		uintptr_t range = btreeTestRandom(&seed) % BTREE_BENCH_RANGES;
+
+		addresses[i] = ranges[range].base + (btreeTestRandom(&seed) % BTREE_BENCH_RANGE_SIZE);
+	}
+
+	start = omrtime_nano_time();
+	for (i = 0; i < BTREE_BENCH_RANGES; i++) {
+		if ((J9AVLTreeNode *)&ranges[i] != avl_insert(&avlTree, (J9AVLTreeNode *)&ranges[i])) {
+			rc = -2;
+			goto done;
+		}
+	}
+	avlBuild = omrtime_nano_time() - start;
+
+	start = omrtime_nano_time();
+	if (0 != btree_bulkLoad(&bulkTree, keys, values, BTREE_BENCH_RANGES)) {
+		rc = -3;
+		goto done;
+	}
+	bulkBuild = omrtime_nano_time() - start;
+
+	start = omrtime_nano_time();
+	for (i = 0; i < BTREE_BENCH_RANGES; i++) {
+		if (values[i] != btree_insert(&insertTree, keys[i], values[i])) {
+			rc = -4;
+			goto done;
+		}
+	}
+	insertBuild = omrtime_nano_time() - start;
+
+	start = omrtime_nano_time();
+	for (i = 0; i < BTREE_BENCH_LOOKUPS; i++) {
+		found += (uintptr_t)avl_search(&avlTree, addresses[i]);
+	}
+	avlLookup = omrtime_nano_time() - start;
+
+	start = omrtime_nano_time();
+	for (i = 0; i < BTREE_BENCH_LOOKUPS; i++) {
+		found -= (uintptr_t)btree_searchFloor(&bulkTree, addresses[i], NULL);
+	}
+	bulkLookup = omrtime_nano_time() - start;
+
+	start = omrtime_nano_time();
+	for (i = 0; i < BTREE_BENCH_LOOKUPS; i++) {
+		found += (uintptr_t)btree_searchFloor(&insertTree, addresses[i], NULL);
+	}
+	insertLookup = omrtime_nano_time() - start;
+
+	/* every tree found the same ranges */
+	for (i = 0; i < BTREE_BENCH_LOOKUPS; i++) {
+		found -= (uintptr_t)avl_search(&avlTree, addresses[i]);
+	}
+	if (0 != found) {
+		rc = -5;
+	}
+
+	omrtty_printf("Range lookups over %d ranges, in ns per lookup (build in ms):\n", BTREE_BENCH_RANGES);
+	omrtty_printf("  J9AVLTree:              %llu (%llu)\n", (unsigned long long)(avlLookup / BTREE_BENCH_LOOKUPS), (unsigned long long)(avlBuild / 1000000));
+	omrtty_printf("  B+-tree, bulk loaded:   %llu (%llu)\n", (unsigned long long)(bulkLookup / BTREE_BENCH_LOOKUPS), (unsigned long long)(bulkBuild / 1000000));
+	omrtty_printf("  B+-tree, inserted:      %llu (%llu)\n", (unsigned long long)(insertLookup / BTREE_BENCH_LOOKUPS), (unsigned long long)(insertBuild / 1000000));
+
+done:
+	btree_free(&insertTree);
+	btree_free(&bulkTree);
+	omrmem_free_memory(addresses);
+	omrmem_free_memory(values);
+	omrmem_free_memory(keys);
+	omrmem_free_memory(ranges);
+	return rc;
+}
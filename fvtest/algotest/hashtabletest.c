@@ -203,6 +203,10 @@ allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 	uint32_t flags = 0;
 	void *userData = (void *)(uintptr_t)inputData->forceCollisions;
 
+	if (TRUE == inputData->openAddressing) {
+		flags |= J9HASH_TABLE_OPEN_ADDRESSING;
+	}
+
 	if (TRUE == inputData->collisionResistant) {
 		hashtable = collisionResilientHashTableNew(portLib,
 				tableName,
@@ -259,3 +263,87 @@ fail:
 	hashTableFree(table);
 	return result;
 }
+
+static uintptr_t
+removeOddEntry(void *entry, void *userData)
+{
+	return *(uintptr_t *)entry & 1;
+}
+
+/*
+ * Grow an open addressing table well past its initial size, then remove and re-add entries
+ * through every removal path, so that tombstones are created, reused and cleared.
+ */
+int32_t
+verifyOpenAddressingHashtableChurn(OMRPortLibrary *portLib)
+{
+	const uintptr_t count = 20000;
+	J9HashTable *table = hashTableNew(portLib, "openAddressingChurn", 0, sizeof(uintptr_t), 0, J9HASH_TABLE_OPEN_ADDRESSING, OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, NULL);
+	uintptr_t i = 0;
+	uintptr_t round = 0;
+	uintptr_t entry = 0;
+	int32_t result = 0;
+
+	if (NULL == table) {
+		return -1;
+	}
+	/* more entries than the largest table can hold */
+	if (NULL != hashTableNew(portLib, "openAddressingTooLarge", UINT32_MAX, sizeof(uintptr_t), 0, J9HASH_TABLE_OPEN_ADDRESSING, OMRMEM_CATEGORY_VM, hashFn, hashEqualFn, NULL, NULL)) {
+		result = -9;
+		goto done;
+	}
+	for (i = 0; i < count; i++) {
+		entry = i;
+		if (NULL == hashTableAdd(table, &entry)) {
+			result = -2;
+			goto done;
+		}
+	}
+	for (round = 0; round < 4; round++) {
+		/* remove the odd entries during an iteration */
+		hashTableForEachDo(table, removeOddEntry, NULL);
+		if (hashTableGetCount(table) != (count / 2)) {
+			result = -3;
+			goto done;
+		}
+		if (1 == (round % 2)) {
+			hashTableRehash(table);
+		}
+		for (i = 0; i < count; i++) {
+			uintptr_t *node = NULL;
+			entry = i;
+			node = hashTableFind(table, &entry);
+			if ((0 == (i & 1)) != ((NULL != node) && (*node == i))) {
+				result = -4;
+				goto done;
+			}
+		}
+		/* re-add them, reusing the tombstones */
+		for (i = 1; i < count; i += 2) {
+			entry = i;
+			if (NULL == hashTableAdd(table, &entry)) {
+				result = -5;
+				goto done;
+			}
+		}
+		/* and remove a quarter of all entries by key */
+		for (i = 0; i < count; i += 4) {
+			entry = i;
+			if (0 != hashTableRemove(table, &entry)) {
+				result = -6;
+				goto done;
+			}
+			if (NULL == hashTableAdd(table, &entry)) {
+				result = -7;
+				goto done;
+			}
+		}
+		if (hashTableGetCount(table) != count) {
+			result = -8;
+			goto done;
+		}
+	}
+done:
+	hashTableFree(table);
+	return result;
+}
@@ -21,6 +21,7 @@
 
 #include <string.h>
 #include "omrport.h"
+#include "omrthread.h"
 #include "hookable_api.h"
 #include "hooksample_internal.h"
 
@@ -33,11 +34,27 @@ static void testRegisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount,
 static void testUnregister(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event);
 static void testUnregisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t userData);
 static void testDispatch(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t event, uintptr_t expectedResult);
+static void testFastPath(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t event, uintptr_t expectedValid);
 static uintptr_t testAllocateAgentID(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
 static void hookNormalEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
 static void hookOrderedEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
 
+static int J9THREAD_PROC dispatchBenchmarkThread(void *arg);
+static void hookCountEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
+
 static SampleHookInterface sampleHookInterface;
+static SampleHookInterface benchmarkHookInterface;
+
+#define DISPATCH_BENCHMARK_ITERATIONS 200000
+#define DISPATCH_BENCHMARK_MAX_THREADS 4
+#define DISPATCH_BENCHMARK_MAX_LISTENERS 4
+
+typedef struct DispatchBenchmarkData {
+	uintptr_t event;
+	uintptr_t received;
+	omrthread_monitor_t doneMonitor;
+	volatile uintptr_t *running;
+} DispatchBenchmarkData;
 
 int32_t
 verifyHookable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount)
@@ -163,6 +180,22 @@ testHookInterface(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *fail
 	testRegisterWithAgent(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, agent2, 3, 0);
 	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
 
+	/* the fast path is used only while the event has a single listener */
+	testFastPath(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, FALSE);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, 0);
+	testRegister(portLib, passCount, failCount, hookInterface, TESTHOOK_FAST_EVENT, 0);
+	testFastPath(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, TRUE);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, 1);
+	testRegisterWithAgent(portLib, passCount, failCount, hookInterface, TESTHOOK_FAST_EVENT, agent1, 1, 0);
+	testFastPath(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, FALSE);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, 2);
+	testUnregister(portLib, passCount, failCount, hookInterface, TESTHOOK_FAST_EVENT);
+	testFastPath(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, TRUE);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, 1);
+	testUnregisterWithAgent(portLib, passCount, failCount, hookInterface, TESTHOOK_FAST_EVENT, 1);
+	testFastPath(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, FALSE);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_FAST_EVENT, 0);
+
 	return rc;
 }
 
@@ -280,6 +313,9 @@ testDispatch(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount
 	case TESTHOOK_EVENT4:
 		TRIGGER_TESTHOOK_EVENT4(sampleHookInterface, 4, 5, 6, count, -1);
 		break;
+	case TESTHOOK_FAST_EVENT:
+		TRIGGER_TESTHOOK_FAST_EVENT(sampleHookInterface, count);
+		break;
 	}
 
 	if (count == expectedResult) {
@@ -290,6 +326,21 @@ testDispatch(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount
 	}
 }
 
+static void
+testFastPath(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t event, uintptr_t expectedValid)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t sequence = sampleHookInterface.fastPaths[event].sequence;
+	uintptr_t valid = (J9HOOK_FASTPATH_VALID == (sequence & (J9HOOK_FASTPATH_VALID | J9HOOK_FASTPATH_BUSY)));
+
+	if (valid == expectedValid) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("Fast path for 0x%zx is %s. It should be %s.\n", event, (valid ? "valid" : "invalid"), (expectedValid ? "valid" : "invalid"));
+		(*failCount)++;
+	}
+}
+
 static void
 hookNormalEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData)
 {
@@ -313,6 +364,9 @@ hookNormalEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData,
 	case TESTHOOK_EVENT4:
 		((TestHookEvent4 *)voidEventData)->count += increment;
 		break;
+	case TESTHOOK_FAST_EVENT:
+		((TestHookFastEvent *)voidEventData)->count += increment;
+		break;
 	}
 
 }
@@ -366,6 +420,155 @@ hookOrderedEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData
 	case TESTHOOK_EVENT4:
 		((TestHookEvent4 *)voidEventData)->count += increment;
 		break;
+	case TESTHOOK_FAST_EVENT:
+		((TestHookFastEvent *)voidEventData)->count += increment;
+		break;
+	}
+
+}
+
+static void
+hookCountEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData)
+{
+	if (TESTHOOK_SAMPLED_EVENT == eventNum) {
+		((TestHookSampledEvent *)voidEventData)->count += 1;
+	} else if (TESTHOOK_FAST_EVENT == eventNum) {
+		((TestHookFastEvent *)voidEventData)->count += 1;
+	} else {
+		((TestHookEvent4 *)voidEventData)->count += 1;
+	}
+}
+
+static int J9THREAD_PROC
+dispatchBenchmarkThread(void *arg)
+{
+	DispatchBenchmarkData *data = (DispatchBenchmarkData *)arg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < DISPATCH_BENCHMARK_ITERATIONS; i++) {
+		uintptr_t count = 0;
+
+		if (TESTHOOK_SAMPLED_EVENT == data->event) {
+			TRIGGER_TESTHOOK_SAMPLED_EVENT(benchmarkHookInterface, count);
+		} else if (TESTHOOK_FAST_EVENT == data->event) {
+			TRIGGER_TESTHOOK_FAST_EVENT(benchmarkHookInterface, count);
+		} else {
+			TRIGGER_TESTHOOK_EVENT4(benchmarkHookInterface, i, 0, 0, count, -1);
+		}
+		data->received += count;
 	}
 
+	omrthread_monitor_enter(data->doneMonitor);
+	*data->running -= 1;
+	omrthread_monitor_notify_all(data->doneMonitor);
+	omrthread_monitor_exit(data->doneMonitor);
+	return 0;
+}
+
+/*
+ * Measure the cost of triggering an event with 0, 1 and 4 listeners, from 1 and 4 threads.
+ * TESTHOOK_EVENT4 times every listener call; TESTHOOK_SAMPLED_EVENT times 1 in 100;
+ * TESTHOOK_FAST_EVENT calls a single listener directly, without counting or timing it.
+ */
+int32_t
+benchmarkHookDispatch(OMRPortLibrary *portLib)
+{
+	static const uintptr_t events[] = {TESTHOOK_EVENT4, TESTHOOK_SAMPLED_EVENT, TESTHOOK_FAST_EVENT};
+	static const char *eventNames[] = {"all timed", "1 in 100 timed", "fast dispatch"};
+	static const uintptr_t listenerCounts[] = {0, 1, 4};
+	static const uintptr_t threadCounts[] = {1, DISPATCH_BENCHMARK_MAX_THREADS};
+	J9HookInterface **hookInterface = J9_HOOK_INTERFACE(benchmarkHookInterface);
+	omrthread_monitor_t doneMonitor = NULL;
+	uintptr_t expectedCounts[] = {0, 0};
+	uintptr_t listeners = 0;
+	uintptr_t e = 0;
+	uintptr_t l = 0;
+	uintptr_t t = 0;
+	uintptr_t i = 0;
+	int32_t rc = 0;
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+
+	if (0 != J9HookInitializeInterface(hookInterface, portLib, sizeof(benchmarkHookInterface))) {
+		return -1;
+	}
+	if (0 != omrthread_monitor_init_with_name(&doneMonitor, 0, "benchmarkHookDispatch")) {
+		(*hookInterface)->J9HookShutdownInterface(hookInterface);
+		return -2;
+	}
+
+	for (l = 0; l < sizeof(listenerCounts) / sizeof(listenerCounts[0]); l++) {
+		while (listeners < listenerCounts[l]) {
+			/* distinct userData, so that each registration adds a listener */
+			listeners += 1;
+			for (e = 0; e < sizeof(events) / sizeof(events[0]); e++) {
+				if (0 != (*hookInterface)->J9HookRegisterWithCallSite(hookInterface, events[e], hookCountEvent, OMR_GET_CALLSITE(), (void *)listeners)) {
+					rc = -3;
+					goto done;
+				}
+			}
+		}
+
+		for (e = 0; e < sizeof(events) / sizeof(events[0]); e++) {
+			for (t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+				DispatchBenchmarkData data[DISPATCH_BENCHMARK_MAX_THREADS];
+				volatile uintptr_t running = threadCounts[t];
+				uintptr_t received = 0;
+				uint64_t start = omrtime_nano_time();
+				uint64_t elapsed = 0;
+
+				memset(data, 0, sizeof(data));
+				for (i = 0; i < threadCounts[t]; i++) {
+					data[i].event = events[e];
+					data[i].doneMonitor = doneMonitor;
+					data[i].running = &running;
+					if (J9THREAD_SUCCESS != omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, dispatchBenchmarkThread, &data[i])) {
+						omrthread_monitor_enter(doneMonitor);
+						running -= 1;
+						omrthread_monitor_exit(doneMonitor);
+						rc = -4;
+					}
+				}
+				omrthread_monitor_enter(doneMonitor);
+				while (0 != running) {
+					omrthread_monitor_wait(doneMonitor);
+				}
+				omrthread_monitor_exit(doneMonitor);
+				elapsed = omrtime_nano_time() - start;
+
+				for (i = 0; i < threadCounts[t]; i++) {
+					received += data[i].received;
+				}
+				if ((0 == rc) && (received != (threadCounts[t] * DISPATCH_BENCHMARK_ITERATIONS * listeners))) {
+					rc = -5;
+				}
+				if (e < sizeof(expectedCounts) / sizeof(expectedCounts[0])) {
+					expectedCounts[e] += received;
+				}
+
+				omrtty_printf("Hook dispatch: %zu listeners, %zu threads, %s: %llu ns per event\n",
+					listeners, threadCounts[t], eventNames[e], (unsigned long long)(elapsed / (threadCounts[t] * DISPATCH_BENCHMARK_ITERATIONS)));
+			}
+		}
+	}
+
+	/* dispatch has already folded the shards into the dump info, up to the calls since the last refresh */
+	for (e = 0; e < sizeof(expectedCounts) / sizeof(expectedCounts[0]); e++) {
+		uintptr_t dumpCount = benchmarkHookInterface.infos4Dump[events[e]].count;
+		if ((0 == rc) && ((0 == dumpCount) || (dumpCount > expectedCounts[e]))) {
+			rc = -7;
+		}
+	}
+
+	/* every listener call of the counted events was counted in some shard */
+	J9HookAggregateDumpInfo(hookInterface);
+	for (e = 0; e < sizeof(expectedCounts) / sizeof(expectedCounts[0]); e++) {
+		if ((0 == rc) && (benchmarkHookInterface.infos4Dump[events[e]].count != expectedCounts[e])) {
+			rc = -6;
+		}
+	}
+
+done:
+	omrthread_monitor_destroy(doneMonitor);
+	(*hookInterface)->J9HookShutdownInterface(hookInterface);
+	return rc;
 }
@@ -22,6 +22,8 @@
 #include <string.h>
 #include "omrport.h"
 #include "omrutil.h"
+#include "omrutilbase.h"
+#include "omrthread.h"
 #include "pool_api.h"
 #include "algorithm_test_internal.h"
 
@@ -37,12 +39,34 @@ static int32_t sharedPuddleListReferenceCount = 0;
 #define BYTE_MARKER 2
 #define LAST_BYTE_MARKER 4
 
+#define THREAD_CACHE_TEST_THREADS 4
+#define THREAD_CACHE_TEST_SLOTS 64
+#define THREAD_CACHE_TEST_EXCHANGE_SLOTS 32
+#define THREAD_CACHE_TEST_ITERATIONS 50000
+
+typedef struct PoolThreadCacheTestElement {
+	uintptr_t owner;
+	uintptr_t check;
+	uintptr_t padding;
+} PoolThreadCacheTestElement;
+
+typedef struct PoolThreadCacheTestData {
+	J9Pool *pool;
+	uintptr_t thread;
+	uintptr_t errors;
+	PoolThreadCacheTestElement *live[THREAD_CACHE_TEST_SLOTS];
+	volatile uintptr_t *exchange;
+	omrthread_monitor_t doneMonitor;
+	volatile uintptr_t *running;
+} PoolThreadCacheTestData;
+
 static J9Pool* createNewPool(OMRPortLibrary *portLib, PoolInputData *input);
 static int32_t testPoolNewElement(OMRPortLibrary *portLib, PoolInputData *inputData, J9Pool *currentPool);
 static int32_t testPoolWalkFunctions(OMRPortLibrary *portLib, PoolInputData *inputData, J9Pool *currentPool, uint32_t elementsAllocated);
 static int32_t testPoolClear(OMRPortLibrary *portLib, J9Pool *currentPool);
 static int32_t testPoolRemoveElement(OMRPortLibrary *portLib, J9Pool *currentPool);
 
+static int J9THREAD_PROC poolThreadCacheTestThread(void *arg);
 static void *sharedPuddleListAlloc(OMRPortLibrary *portLib, uint32_t size, const char *callSite, uint32_t memoryCategory, uint32_t type, uint32_t *doInit);
 static void sharedPuddleListFree(OMRPortLibrary *portLib, void *address, uint32_t type);
 
@@ -401,3 +425,171 @@ error:
 
 	return result;
 }
+
+static uint32_t
+nextTestRandom(uint32_t *state)
+{
+	*state = (*state * 1103515245) + 12345;
+	return *state >> 8;
+}
+
+/*
+ * Each thread allocates and frees elements at random, half through its thread cache and half
+ * through the pool, and trades elements with the other threads through a shared exchange so
+ * that elements are often freed by a thread other than the one that allocated them.
+ */
+static int J9THREAD_PROC
+poolThreadCacheTestThread(void *arg)
+{
+	PoolThreadCacheTestData *data = (PoolThreadCacheTestData *)arg;
+	J9PoolThreadCache *cache = pool_threadCacheNew(data->pool);
+	uint32_t random = (uint32_t)data->thread + 1;
+	uintptr_t i = 0;
+
+	if (NULL == cache) {
+		data->errors += 1;
+	} else {
+		for (i = 0; i < THREAD_CACHE_TEST_ITERATIONS; i++) {
+			uint32_t choice = nextTestRandom(&random);
+			uintptr_t slot = choice % THREAD_CACHE_TEST_SLOTS;
+			PoolThreadCacheTestElement *element = data->live[slot];
+
+			if (NULL == element) {
+				element = (PoolThreadCacheTestElement *)((0 == (choice & 0x100)) ? pool_newElementCached(cache) : pool_newElement(data->pool));
+				if ((NULL == element) || (0 != element->owner) || (0 != element->check)) {
+					data->errors += 1;
+				} else {
+					element->owner = data->thread + 1;
+					element->check = ~(uintptr_t)element;
+					data->live[slot] = element;
+				}
+			} else if (0 == (choice & 0x600)) {
+				/* Trade the element for whatever another thread left in the exchange. */
+				volatile uintptr_t *exchange = &data->exchange[choice % THREAD_CACHE_TEST_EXCHANGE_SLOTS];
+				uintptr_t old = *exchange;
+
+				while (old != compareAndSwapUDATA((uintptr_t *)exchange, old, (uintptr_t)element)) {
+					old = *exchange;
+				}
+				data->live[slot] = (PoolThreadCacheTestElement *)old;
+			} else {
+				if (element->check != ~(uintptr_t)element) {
+					data->errors += 1;
+				}
+				element->check = 0;
+				if (0 == (choice & 0x100)) {
+					pool_removeElementCached(cache, element);
+				} else {
+					pool_removeElement(data->pool, element);
+				}
+				data->live[slot] = NULL;
+			}
+		}
+		pool_threadCacheKill(cache);
+	}
+
+	omrthread_monitor_enter(data->doneMonitor);
+	*data->running -= 1;
+	omrthread_monitor_notify_all(data->doneMonitor);
+	omrthread_monitor_exit(data->doneMonitor);
+	return 0;
+}
+
+int32_t
+testPoolThreadCaches(OMRPortLibrary *portLib)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	PoolThreadCacheTestData data[THREAD_CACHE_TEST_THREADS];
+	uintptr_t exchange[THREAD_CACHE_TEST_EXCHANGE_SLOTS];
+	volatile uintptr_t running = THREAD_CACHE_TEST_THREADS;
+	omrthread_monitor_t doneMonitor = NULL;
+	J9PoolContentionStats stats;
+	uintptr_t expectedElements = 0;
+	uintptr_t walkCount = 0;
+	pool_state state;
+	PoolThreadCacheTestElement *element = NULL;
+	J9Pool *pool = NULL;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+	int32_t result = 0;
+
+	pool = pool_new(sizeof(PoolThreadCacheTestElement), 64, 0, POOL_THREAD_SAFE, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+	if (NULL == pool) {
+		return -1;
+	}
+	if (0 != omrthread_monitor_init_with_name(&doneMonitor, 0, "testPoolThreadCaches")) {
+		pool_kill(pool);
+		return -2;
+	}
+
+	memset(data, 0, sizeof(data));
+	memset(exchange, 0, sizeof(exchange));
+	for (i = 0; i < THREAD_CACHE_TEST_THREADS; i++) {
+		data[i].pool = pool;
+		data[i].thread = i;
+		data[i].exchange = exchange;
+		data[i].doneMonitor = doneMonitor;
+		data[i].running = &running;
+		if (J9THREAD_SUCCESS != omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, poolThreadCacheTestThread, &data[i])) {
+			omrthread_monitor_enter(doneMonitor);
+			running -= 1;
+			omrthread_monitor_exit(doneMonitor);
+			result = -3;
+		}
+	}
+	omrthread_monitor_enter(doneMonitor);
+	while (0 != running) {
+		omrthread_monitor_wait(doneMonitor);
+	}
+	omrthread_monitor_exit(doneMonitor);
+	omrthread_monitor_destroy(doneMonitor);
+
+	for (i = 0; i < THREAD_CACHE_TEST_THREADS; i++) {
+		if (0 != data[i].errors) {
+			result = -4;
+		}
+		for (j = 0; j < THREAD_CACHE_TEST_SLOTS; j++) {
+			if (NULL != data[i].live[j]) {
+				expectedElements += 1;
+			}
+		}
+	}
+	for (i = 0; i < THREAD_CACHE_TEST_EXCHANGE_SLOTS; i++) {
+		if (0 != exchange[i]) {
+			expectedElements += 1;
+		}
+	}
+
+	/* The pool is quiescent: iteration and the element count must see exactly the live elements. */
+	element = (PoolThreadCacheTestElement *)pool_startDo(pool, &state);
+	while (NULL != element) {
+		if ((element->check != ~(uintptr_t)element) || (0 == element->owner) || (element->owner > THREAD_CACHE_TEST_THREADS)) {
+			result = -5;
+		}
+		walkCount += 1;
+		element = (PoolThreadCacheTestElement *)pool_nextDo(&state);
+	}
+	if ((walkCount != expectedElements) || (pool_numElements(pool) != expectedElements)) {
+		result = -6;
+	}
+
+	pool_getContentionStats(pool, &stats);
+	omrtty_printf("Thread safe pool: %zu live elements in %zu puddles, %zu CAS retries, %zu refills, %zu puddle scans, %zu batch returns, %zu puddles added\n",
+		expectedElements, pool_capacity(pool) / pool->elementsPerPuddle,
+		stats.casRetries, stats.refills, stats.puddleScans, stats.batchReturns, stats.puddlesAdded);
+
+	for (i = 0; i < THREAD_CACHE_TEST_THREADS; i++) {
+		for (j = 0; j < THREAD_CACHE_TEST_SLOTS; j++) {
+			pool_removeElement(pool, data[i].live[j]);
+		}
+	}
+	for (i = 0; i < THREAD_CACHE_TEST_EXCHANGE_SLOTS; i++) {
+		pool_removeElement(pool, (void *)exchange[i]);
+	}
+	if ((0 == result) && (0 != pool_numElements(pool))) {
+		result = -7;
+	}
+
+	pool_kill(pool);
+	return result;
+}
@@ -0,0 +1,383 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup PortTest
+ * @brief Verify port library asynchronous file operations.
+ *
+ * Exercise the API for port library asynchronous file operations. These functions
+ * can be found in the file @ref omrfileasync.c
+ */
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "testHelpers.hpp"
+
+#define ASYNC_TEST_BLOCK_SIZE 4096
+#define ASYNC_TEST_BLOCKS 32
+#define ASYNC_TEST_QUEUE_DEPTH 8
+
+typedef struct AsyncTestState {
+	uintptr_t callbacks;
+	uintptr_t failures;
+} AsyncTestState;
+
+static void
+countCompletion(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncRequest *request)
+{
+	AsyncTestState *state = (AsyncTestState *)request->userData;
+
+	state->callbacks += 1;
+	if (request->result < 0) {
+		state->failures += 1;
+	}
+}
+
+/**
+ * Submit all requests, polling for completions whenever the queue is full, then wait
+ * for everything to complete.
+ */
+static void
+submitAndWait(struct OMRPortLibrary *portLibrary, const char *testName, struct OMRFileAsyncQueue *queue, OMRFileAsyncRequest **requests, uintptr_t count)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t submitted = 0;
+	uintptr_t completed = 0;
+
+	while (submitted < count) {
+		intptr_t rc = omrfile_async_submit(queue, requests + submitted, count - submitted);
+
+		if (OMRPORT_ERROR_FILE_WOULDBLOCK == rc) {
+			rc = omrfile_async_poll(queue, 1);
+			if (rc < 0) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_poll() returned %zd\n", rc);
+				return;
+			}
+			completed += rc;
+		} else if (rc < 0) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_submit() returned %zd\n", rc);
+			return;
+		} else {
+			submitted += rc;
+		}
+	}
+	while (completed < count) {
+		intptr_t rc = omrfile_async_poll(queue, count - completed);
+
+		if (rc <= 0) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_poll() returned %zd with %zu requests outstanding\n", rc, count - completed);
+			return;
+		}
+		completed += rc;
+	}
+}
+
+/**
+ * Write a file with positional and vectored writes, sync it, and read it back with
+ * positional and vectored reads.
+ */
+static void
+exerciseQueue(struct OMRPortLibrary *portLibrary, const char *testName, const char *fileName, uint32_t flags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	struct OMRFileAsyncQueue *queue = NULL;
+	OMRFileAsyncRequest requests[ASYNC_TEST_BLOCKS];
+	OMRFileAsyncRequest *requestPointers[ASYNC_TEST_BLOCKS];
+	OMRFileAsyncIOVec iov[2];
+	AsyncTestState state;
+	uint8_t *writeBuffer = NULL;
+	uint8_t *readBuffer = NULL;
+	uintptr_t bufferSize = ASYNC_TEST_BLOCK_SIZE * ASYNC_TEST_BLOCKS;
+	uintptr_t half = bufferSize / 2;
+	intptr_t fd = -1;
+	int32_t rc = 0;
+	uintptr_t i = 0;
+
+	memset(&state, 0, sizeof(state));
+	omrfile_unlink(fileName);
+	fd = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (fd < 0) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed\n");
+		return;
+	}
+	writeBuffer = (uint8_t *)omrmem_allocate_memory(bufferSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	readBuffer = (uint8_t *)omrmem_allocate_memory(bufferSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == writeBuffer) || (NULL == readBuffer)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_allocate_memory() failed\n");
+		goto done;
+	}
+	for (i = 0; i < bufferSize; i++) {
+		writeBuffer[i] = (uint8_t)(i * 7);
+	}
+
+	rc = omrfile_async_open(ASYNC_TEST_QUEUE_DEPTH, flags, &queue);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_open() returned %d\n", rc);
+		goto done;
+	}
+	portTestEnv->log("%s: backend %u\n", testName, omrfile_async_get_backend(queue));
+	if (OMR_ARE_ANY_BITS_SET(flags, OMRPORT_FILE_ASYNC_FORCE_THREAD_POOL)
+		&& (OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL != omrfile_async_get_backend(queue))
+	) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "OMRPORT_FILE_ASYNC_FORCE_THREAD_POOL was ignored\n");
+	}
+
+	/* reserve the space, then write the first half one block per request */
+	memset(requests, 0, sizeof(requests));
+	requests[0].operation = OMRPORT_FILE_ASYNC_OP_FALLOCATE;
+	requests[0].fd = fd;
+	requests[0].length = bufferSize;
+	requestPointers[0] = &requests[0];
+	submitAndWait(OMRPORTLIB, testName, queue, requestPointers, 1);
+	if (0 != requests[0].result) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "fallocate returned %zd\n", requests[0].result);
+	}
+	if (omrfile_flength(fd) != (int64_t)bufferSize) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "file length is %lld after fallocate, expected %zu\n", omrfile_flength(fd), bufferSize);
+	}
+
+	for (i = 0; i < ASYNC_TEST_BLOCKS / 2; i++) {
+		memset(&requests[i], 0, sizeof(requests[i]));
+		requests[i].operation = OMRPORT_FILE_ASYNC_OP_PWRITE;
+		requests[i].fd = fd;
+		requests[i].offset = i * ASYNC_TEST_BLOCK_SIZE;
+		requests[i].buffer = writeBuffer + (i * ASYNC_TEST_BLOCK_SIZE);
+		requests[i].length = ASYNC_TEST_BLOCK_SIZE;
+		requests[i].callback = countCompletion;
+		requests[i].userData = &state;
+		requestPointers[i] = &requests[i];
+	}
+	submitAndWait(OMRPORTLIB, testName, queue, requestPointers, ASYNC_TEST_BLOCKS / 2);
+	for (i = 0; i < ASYNC_TEST_BLOCKS / 2; i++) {
+		if (ASYNC_TEST_BLOCK_SIZE != requests[i].result) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "pwrite %zu returned %zd\n", i, requests[i].result);
+		}
+	}
+
+	/* the second half in one vectored write */
+	iov[0].base = writeBuffer + half;
+	iov[0].length = ASYNC_TEST_BLOCK_SIZE;
+	iov[1].base = writeBuffer + half + ASYNC_TEST_BLOCK_SIZE;
+	iov[1].length = half - ASYNC_TEST_BLOCK_SIZE;
+	memset(&requests[0], 0, sizeof(requests[0]));
+	requests[0].operation = OMRPORT_FILE_ASYNC_OP_PWRITEV;
+	requests[0].fd = fd;
+	requests[0].offset = half;
+	requests[0].iov = iov;
+	requests[0].iovCount = 2;
+	requests[0].callback = countCompletion;
+	requests[0].userData = &state;
+	submitAndWait(OMRPORTLIB, testName, queue, requestPointers, 1);
+	if ((intptr_t)half != requests[0].result) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "pwritev returned %zd, expected %zu\n", requests[0].result, half);
+	}
+
+	/* writes are complete, so the fsync covers them */
+	memset(&requests[0], 0, sizeof(requests[0]));
+	requests[0].operation = OMRPORT_FILE_ASYNC_OP_FSYNC;
+	requests[0].fd = fd;
+	requests[0].callback = countCompletion;
+	requests[0].userData = &state;
+	submitAndWait(OMRPORTLIB, testName, queue, requestPointers, 1);
+	if (0 != requests[0].result) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "fsync returned %zd\n", requests[0].result);
+	}
+
+	/* read the first half with preadv and the second half one block per request */
+	memset(readBuffer, 0, bufferSize);
+	iov[0].base = readBuffer;
+	iov[0].length = half - ASYNC_TEST_BLOCK_SIZE;
+	iov[1].base = readBuffer + half - ASYNC_TEST_BLOCK_SIZE;
+	iov[1].length = ASYNC_TEST_BLOCK_SIZE;
+	memset(&requests[0], 0, sizeof(requests[0]));
+	requests[0].operation = OMRPORT_FILE_ASYNC_OP_PREADV;
+	requests[0].fd = fd;
+	requests[0].iov = iov;
+	requests[0].iovCount = 2;
+	requests[0].callback = countCompletion;
+	requests[0].userData = &state;
+	for (i = 1; i <= ASYNC_TEST_BLOCKS / 2; i++) {
+		memset(&requests[i], 0, sizeof(requests[i]));
+		requests[i].operation = OMRPORT_FILE_ASYNC_OP_PREAD;
+		requests[i].fd = fd;
+		requests[i].offset = half + ((i - 1) * ASYNC_TEST_BLOCK_SIZE);
+		requests[i].buffer = readBuffer + half + ((i - 1) * ASYNC_TEST_BLOCK_SIZE);
+		requests[i].length = ASYNC_TEST_BLOCK_SIZE;
+		requests[i].callback = countCompletion;
+		requests[i].userData = &state;
+		requestPointers[i] = &requests[i];
+	}
+	submitAndWait(OMRPORTLIB, testName, queue, requestPointers, (ASYNC_TEST_BLOCKS / 2) + 1);
+	if (0 != memcmp(writeBuffer, readBuffer, bufferSize)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "data read back does not match data written\n");
+	}
+
+	/* reading past the end of the file transfers nothing */
+	memset(&requests[0], 0, sizeof(requests[0]));
+	requests[0].operation = OMRPORT_FILE_ASYNC_OP_PREAD;
+	requests[0].fd = fd;
+	requests[0].offset = bufferSize;
+	requests[0].buffer = readBuffer;
+	requests[0].length = ASYNC_TEST_BLOCK_SIZE;
+	submitAndWait(OMRPORTLIB, testName, queue, requestPointers, 1);
+	if (0 != requests[0].result) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "pread at end of file returned %zd, expected 0\n", requests[0].result);
+	}
+
+	if (((ASYNC_TEST_BLOCKS / 2) + 1 + 1 + (ASYNC_TEST_BLOCKS / 2) + 1) != state.callbacks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "%zu callbacks were called\n", state.callbacks);
+	}
+	if (0 != state.failures) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "%zu requests failed\n", state.failures);
+	}
+
+done:
+	omrfile_async_close(queue);
+	omrmem_free_memory(readBuffer);
+	omrmem_free_memory(writeBuffer);
+	omrfile_close(fd);
+	omrfile_unlink(fileName);
+}
+
+/**
+ * Verify port library asynchronous file operations function table.
+ */
+TEST(PortFileAsyncTest, omrfile_async_test_function_table)
+{
+	const char *testName = "omrfile_async_test_function_table";
+
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (NULL == OMRPORTLIB->file_async_open) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_open is NULL\n");
+	}
+	if (NULL == OMRPORTLIB->file_async_close) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_close is NULL\n");
+	}
+	if (NULL == OMRPORTLIB->file_async_submit) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_submit is NULL\n");
+	}
+	if (NULL == OMRPORTLIB->file_async_poll) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_poll is NULL\n");
+	}
+	if (NULL == OMRPORTLIB->file_async_get_backend) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->file_async_get_backend is NULL\n");
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify reads, writes, fsync and fallocate with the default backend, which is
+ * io_uring where the platform supports it.
+ */
+TEST(PortFileAsyncTest, omrfile_async_test_default_backend)
+{
+	const char *testName = "omrfile_async_test_default_backend";
+
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	reportTestEntry(OMRPORTLIB, testName);
+
+	exerciseQueue(OMRPORTLIB, testName, "omrfile_async_test_default_backend.tst", 0);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify reads, writes, fsync and fallocate with the thread pool backend.
+ */
+TEST(PortFileAsyncTest, omrfile_async_test_thread_pool)
+{
+	const char *testName = "omrfile_async_test_thread_pool";
+
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	reportTestEntry(OMRPORTLIB, testName);
+
+	exerciseQueue(OMRPORTLIB, testName, "omrfile_async_test_thread_pool.tst", OMRPORT_FILE_ASYNC_FORCE_THREAD_POOL);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify that invalid requests are rejected, that a full queue refuses more requests,
+ * and that failures are reported through the request result.
+ */
+TEST(PortFileAsyncTest, omrfile_async_test_errors)
+{
+	const char *testName = "omrfile_async_test_errors";
+	struct OMRFileAsyncQueue *queue = NULL;
+	OMRFileAsyncRequest requests[2];
+	OMRFileAsyncRequest *requestPointers[2] = { &requests[0], &requests[1] };
+	char buffer[16];
+	intptr_t rc = 0;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (OMRPORT_ERROR_FILE_INVAL != omrfile_async_open(0, 0, &queue)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_open() accepted a depth of 0\n");
+	}
+	rc = omrfile_async_open(1, 0, &queue);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_open() returned %zd\n", rc);
+		goto done;
+	}
+
+	memset(requests, 0, sizeof(requests));
+	requests[0].operation = 0;
+	rc = omrfile_async_submit(queue, requestPointers, 1);
+	if (OMRPORT_ERROR_FILE_INVAL != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "submitting an invalid operation returned %zd\n", rc);
+	}
+
+	/* a read from a file descriptor that isn't open fails when it runs */
+	requests[0].operation = OMRPORT_FILE_ASYNC_OP_PREAD;
+	requests[0].fd = 12345;
+	requests[0].buffer = buffer;
+	requests[0].length = sizeof(buffer);
+	requests[1] = requests[0];
+	rc = omrfile_async_submit(queue, requestPointers, 2);
+	if (1 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "submitting 2 requests to a queue of depth 1 returned %zd\n", rc);
+	}
+	rc = omrfile_async_submit(queue, requestPointers + 1, 1);
+	if (OMRPORT_ERROR_FILE_WOULDBLOCK != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "submitting to a full queue returned %zd\n", rc);
+	}
+	rc = omrfile_async_poll(queue, 1);
+	if (1 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_async_poll() returned %zd\n", rc);
+	}
+	if (OMRPORT_ERROR_FILE_BADF != requests[0].result) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "read from a bad file descriptor returned %zd\n", requests[0].result);
+	}
+	rc = omrfile_async_poll(queue, 1);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "polling an idle queue returned %zd\n", rc);
+	}
+
+done:
+	omrfile_async_close(queue);
+	reportTestExit(OMRPORTLIB, testName);
+}
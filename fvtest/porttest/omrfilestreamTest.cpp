@@ -2693,3 +2693,316 @@ TEST(PortFileStreamTest, omrfilestream_test_std_streams)
 
 	reportTestExit(OMRPORTLIB, testName);
 }
+
+#define LOG_STREAM_TEST_THREADS 4
+#define LOG_STREAM_TEST_RECORDS 20000
+
+typedef struct LogStreamTestData {
+	OMRPortLibrary *portLibrary;
+	struct OMRLogStream *logStream;
+	OMRFileStream *fileStream;
+	omrthread_monitor_t monitor;
+	uintptr_t nextId;
+	uintptr_t finished;
+} LogStreamTestData;
+
+static int J9THREAD_PROC
+logStreamTestThread(void *arg)
+{
+	LogStreamTestData *data = (LogStreamTestData *)arg;
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	uintptr_t id = 0;
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(data->monitor);
+	id = data->nextId;
+	data->nextId += 1;
+	omrthread_monitor_exit(data->monitor);
+
+	for (i = 0; i < LOG_STREAM_TEST_RECORDS; i++) {
+		if (NULL != data->logStream) {
+			omrfilestream_log_printf(data->logStream, "T%zu %zu record from a log stream writer\n", id, i);
+		} else {
+			omrfilestream_printf(data->fileStream, "T%zu %zu record from a log stream writer\n", id, i);
+		}
+	}
+
+	omrthread_monitor_enter(data->monitor);
+	data->finished += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+/**
+ * Run LOG_STREAM_TEST_THREADS writers against a log stream, or against a file stream if logStream is NULL.
+ *
+ * @return elapsed time in nanoseconds
+ */
+static uint64_t
+runLogStreamWriters(OMRPortLibrary *portLibrary, const char *testName, LogStreamTestData *data)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint64_t start = omrtime_nano_time();
+	uintptr_t created = 0;
+
+	data->nextId = 0;
+	data->finished = 0;
+	for (created = 0; created < LOG_STREAM_TEST_THREADS; created++) {
+		if (0 != omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, &logStreamTestThread, data)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrthread_create failed\n");
+			break;
+		}
+	}
+	omrthread_monitor_enter(data->monitor);
+	while (data->finished < created) {
+		omrthread_monitor_wait(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+	return omrtime_nano_time() - start;
+}
+
+/**
+ * Verify that records written concurrently to a log stream all reach the file intact, in order
+ * for each thread, and that a flush barrier makes them visible.
+ */
+TEST(PortFileStreamTest, omrfilestream_test_log_stream)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfilestream_test_log_stream";
+	const char *filename = "omrfilestream_test_log_stream.tst";
+	const char *compareFilename = "omrfilestream_test_log_stream_compare.tst";
+	LogStreamTestData data;
+	char bigRecord[10000];
+	uintptr_t nextRecord[LOG_STREAM_TEST_THREADS];
+	uintptr_t bigRecords = 0;
+	char *contents = NULL;
+	char *line = NULL;
+	int64_t length = 0;
+	uint64_t logElapsed = 0;
+	uint64_t fileStreamElapsed = 0;
+	intptr_t fd = -1;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(&data, 0, sizeof(data));
+	memset(nextRecord, 0, sizeof(nextRecord));
+	data.portLibrary = OMRPORTLIB;
+	if (0 != omrthread_monitor_init_with_name(&data.monitor, 0, "log stream test")) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrthread_monitor_init_with_name failed\n");
+		goto exit;
+	}
+
+	fd = omrfile_open(filename, EsOpenCreate | EsOpenWrite | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed\n");
+		goto exit;
+	}
+	/* Small staging buffers so that records regularly straddle a buffer boundary */
+	rc = omrfilestream_log_open(fd, 4096, 0, &data.logStream);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfilestream_log_open() returned %d\n", rc);
+		goto exit;
+	}
+
+	/* A record larger than a staging buffer */
+	memset(bigRecord, 'x', sizeof(bigRecord));
+	bigRecord[sizeof(bigRecord) - 1] = '\n';
+	if ((intptr_t)sizeof(bigRecord) != omrfilestream_log_write(data.logStream, bigRecord, sizeof(bigRecord))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfilestream_log_write() of a large record failed\n");
+	}
+	rc = omrfilestream_log_flush(data.logStream);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfilestream_log_flush() returned %d\n", rc);
+	}
+	length = omrfile_flength(fd);
+	if ((int64_t)sizeof(bigRecord) != length) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "file length after flush is %lld, expected %zu\n", (long long)length, sizeof(bigRecord));
+	}
+
+	logElapsed = runLogStreamWriters(OMRPORTLIB, testName, &data);
+	/* A short record left in this thread's staging buffer must be written by close */
+	omrfilestream_log_printf(data.logStream, "done\n");
+	rc = omrfilestream_log_close(data.logStream);
+	data.logStream = NULL;
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfilestream_log_close() returned %d\n", rc);
+	}
+	omrfile_close(fd);
+	fd = -1;
+
+	/* The same records through a stdio file stream, for comparison */
+	data.fileStream = omrfilestream_open(compareFilename, EsOpenCreate | EsOpenWrite | EsOpenTruncate, 0666);
+	if (NULL != data.fileStream) {
+		fileStreamElapsed = runLogStreamWriters(OMRPORTLIB, testName, &data);
+		omrfilestream_close(data.fileStream);
+		portTestEnv->log("%d threads x %d records: log stream %llu us, file stream %llu us\n",
+			LOG_STREAM_TEST_THREADS, LOG_STREAM_TEST_RECORDS,
+			(unsigned long long)(logElapsed / 1000), (unsigned long long)(fileStreamElapsed / 1000));
+	}
+	omrfile_unlink(compareFilename);
+
+	/* Check the records */
+	fd = omrfile_open(filename, EsOpenRead, 0);
+	length = omrfile_flength(fd);
+	contents = (char *)omrmem_allocate_memory((uintptr_t)length + 1, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == contents) || (length != omrfile_read(fd, contents, (intptr_t)length))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not read back %s\n", filename);
+		goto exit;
+	}
+	contents[length] = '\0';
+	line = contents;
+	while ('\0' != *line) {
+		char *end = strchr(line, '\n');
+		unsigned long id = 0;
+		unsigned long record = 0;
+
+		if (NULL == end) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "unterminated record at offset %zu\n", (size_t)(line - contents));
+			break;
+		}
+		*end = '\0';
+		if (2 == sscanf(line, "T%lu %lu record from a log stream writer", &id, &record)) {
+			if ((id >= LOG_STREAM_TEST_THREADS) || (record != nextRecord[id])) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "record %lu of thread %lu out of order\n", record, id);
+				break;
+			}
+			nextRecord[id] += 1;
+		} else if ((size_t)(end - line) == (sizeof(bigRecord) - 1)) {
+			bigRecords += 1;
+		} else if (0 != strcmp(line, "done")) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "corrupt record: %.80s\n", line);
+			break;
+		}
+		line = end + 1;
+	}
+	for (uintptr_t i = 0; i < LOG_STREAM_TEST_THREADS; i++) {
+		if (LOG_STREAM_TEST_RECORDS != nextRecord[i]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "thread %zu has %zu records, expected %d\n", i, nextRecord[i], LOG_STREAM_TEST_RECORDS);
+		}
+	}
+	if (1 != bigRecords) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "found %zu large records, expected 1\n", bigRecords);
+	}
+
+exit:
+	if (NULL != data.logStream) {
+		omrfilestream_log_close(data.logStream);
+	}
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	omrmem_free_memory(contents);
+	if (NULL != data.monitor) {
+		omrthread_monitor_destroy(data.monitor);
+	}
+	omrfile_unlink(filename);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+typedef struct LogStreamSweepTestData {
+	OMRPortLibrary *portLibrary;
+	struct OMRLogStream *logStream;
+	volatile uintptr_t stop;
+} LogStreamSweepTestData;
+
+static int J9THREAD_PROC
+logStreamBusyWriter(void *arg)
+{
+	LogStreamSweepTestData *data = (LogStreamSweepTestData *)arg;
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	uintptr_t i = 0;
+
+	while (0 == data->stop) {
+		omrfilestream_log_printf(data->logStream, "%zu record from a busy log stream writer\n", i);
+		i += 1;
+	}
+	return 0;
+}
+
+/**
+ * Verify that a record left in an idle thread's staging buffer is written by the periodic sweep
+ * while another thread keeps handing full buffers to the flusher.
+ */
+TEST(PortFileStreamTest, omrfilestream_test_log_stream_sweep)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrfilestream_test_log_stream_sweep";
+	const char *filename = "omrfilestream_test_log_stream_sweep.tst";
+	LogStreamSweepTestData data;
+	omrthread_t writer = NULL;
+	omrthread_attr_t attr = NULL;
+	char *contents = NULL;
+	BOOLEAN found = FALSE;
+	intptr_t fd = -1;
+	intptr_t readFd = -1;
+	uintptr_t attempt = 0;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(&data, 0, sizeof(data));
+	data.portLibrary = OMRPORTLIB;
+	fd = omrfile_open(filename, EsOpenCreate | EsOpenWrite | EsOpenTruncate, 0666);
+	readFd = omrfile_open(filename, EsOpenRead, 0);
+	if ((-1 == fd) || (-1 == readFd)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfile_open() failed\n");
+		goto exit;
+	}
+	rc = omrfilestream_log_open(fd, 4096, 20, &data.logStream);
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrfilestream_log_open() returned %d\n", rc);
+		goto exit;
+	}
+
+	omrfilestream_log_printf(data.logStream, "idle\n");
+	if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+		|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+		|| (J9THREAD_SUCCESS != omrthread_create_ex(&writer, &attr, 0, &logStreamBusyWriter, &data))
+	) {
+		writer = NULL;
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not create a joinable writer thread\n");
+		goto exit;
+	}
+
+	/* The sweep interval is 20ms: allow well over a hundred of them */
+	for (attempt = 0; (attempt < 100) && !found; attempt++) {
+		int64_t length = 0;
+
+		omrthread_sleep(50);
+		length = omrfile_flength(readFd);
+		omrmem_free_memory(contents);
+		contents = (char *)omrmem_allocate_memory((uintptr_t)length + 1, OMRMEM_CATEGORY_PORT_LIBRARY);
+		if ((NULL == contents) || (0 != omrfile_seek(readFd, 0, EsSeekSet)) || (length != omrfile_read(readFd, contents, (intptr_t)length))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "could not read back %s\n", filename);
+			break;
+		}
+		contents[length] = '\0';
+		found = (0 == strncmp(contents, "idle\n", 5)) || (NULL != strstr(contents, "\nidle\n"));
+	}
+	if (!found) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "record in an idle staging buffer was not swept while another thread was writing\n");
+	}
+
+exit:
+	data.stop = 1;
+	if (NULL != writer) {
+		omrthread_join(writer);
+	}
+	if (NULL != data.logStream) {
+		omrfilestream_log_close(data.logStream);
+	}
+	if (NULL != attr) {
+		omrthread_attr_destroy(&attr);
+	}
+	if (-1 != fd) {
+		omrfile_close(fd);
+	}
+	if (-1 != readFd) {
+		omrfile_close(readFd);
+	}
+	omrmem_free_memory(contents);
+	omrfile_unlink(filename);
+	reportTestExit(OMRPORTLIB, testName);
+}
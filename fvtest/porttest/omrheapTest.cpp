@@ -73,6 +73,7 @@ typedef struct AllocListElement {
 static const int32_t outputInterval = 10;
 
 static void walkHeap(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, const char *testName);
+static uintptr_t walkSegregatedFitHeap(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, const char *testName);
 static void verifySubAllocMem(struct OMRPortLibrary *portLibrary, void *subAllocMem, uintptr_t allocSize, J9Heap *heapBase, const char *testName);
 static void iteratePool(struct OMRPortLibrary *portLibrary, J9Pool *allocPool);
 static void *removeItemFromPool(struct OMRPortLibrary *portLibrary, J9Pool *allocPool, uintptr_t removeIndex);
@@ -1125,6 +1126,190 @@ exit:
 }
 
 
+/**
+ * Verify the segregated-fit heap.
+ *
+ * Perform random allocations, reallocations and frees, checking the blocks and free lists of the heap after each one
+ * and the contents of the allocations as they are freed. Freeing everything must leave a single free block, and growing
+ * the heap must extend it.
+ */
+TEST(PortHeapTest, heap_segregated_fit_test)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrheap_segregated_fit_test";
+	uintptr_t memAllocAmount = 2 * 1024 * 1024;
+	uintptr_t heapSize = 512 * 1024;
+	uintptr_t heapStartOffset = 50;
+	uint8_t *allocPtr = NULL;
+	J9Heap *heapBase = NULL;
+	void *blocks[256];
+	uintptr_t blockSizes[256];
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	allocPtr = (uint8_t *)omrmem_allocate_memory(memAllocAmount, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == allocPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Failed to allocate %zu bytes for the heap\n", memAllocAmount);
+		goto exit;
+	}
+	memset(allocPtr, 0xff, memAllocAmount);
+	memset(blocks, 0, sizeof(blocks));
+
+	if (NULL != omrheap_create(allocPtr + heapStartOffset, 200, OMRPORT_HEAP_SEGREGATED_FIT)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_create() succeeded for a segregated-fit heap too small for its free lists\n");
+	}
+	heapBase = omrheap_create(allocPtr + heapStartOffset, heapSize, OMRPORT_HEAP_SEGREGATED_FIT);
+	if (NULL == heapBase) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_create() failed!\n");
+		goto exit;
+	}
+	walkSegregatedFitHeap(OMRPORTLIB, heapBase, testName);
+
+	srand(7);
+	for (i = 0; i < 20000; i++) {
+		uintptr_t index = (uintptr_t)rand() % 256;
+		uintptr_t size = ((0 == (rand() % 16)) ? ((uintptr_t)rand() % 16384) : ((uintptr_t)rand() % 512));
+
+		if (NULL == blocks[index]) {
+			blocks[index] = omrheap_allocate(heapBase, size);
+			if (NULL != blocks[index]) {
+				blockSizes[index] = size;
+				memset(blocks[index], (int)index, size);
+			}
+		} else {
+			uintptr_t j = 0;
+			for (j = 0; j < blockSizes[index]; j++) {
+				if ((uint8_t)index != ((uint8_t *)blocks[index])[j]) {
+					outputErrorMessage(PORTTEST_ERROR_ARGS, "block %zu was overwritten at offset %zu\n", index, j);
+					goto exit;
+				}
+			}
+			if (0 == (rand() % 2)) {
+				void *newBlock = omrheap_reallocate(heapBase, blocks[index], size);
+				if (NULL != newBlock) {
+					if (size > blockSizes[index]) {
+						memset((uint8_t *)newBlock + blockSizes[index], (int)index, size - blockSizes[index]);
+					}
+					blocks[index] = newBlock;
+					blockSizes[index] = size;
+				}
+				if (omrheap_query_size(heapBase, blocks[index]) < blockSizes[index]) {
+					outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_query_size returned %zu for a block of %zu bytes\n",
+						omrheap_query_size(heapBase, blocks[index]), blockSizes[index]);
+				}
+			} else {
+				omrheap_free(heapBase, blocks[index]);
+				blocks[index] = NULL;
+			}
+		}
+		walkSegregatedFitHeap(OMRPORTLIB, heapBase, testName);
+	}
+
+	for (i = 0; i < 256; i++) {
+		omrheap_free(heapBase, blocks[i]);
+	}
+	if (1 != walkSegregatedFitHeap(OMRPORTLIB, heapBase, testName)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "the heap has more than one free block after everything was freed\n");
+	}
+
+	if (!omrheap_grow(heapBase, heapSize)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_grow() failed!\n");
+	}
+	if (1 != walkSegregatedFitHeap(OMRPORTLIB, heapBase, testName)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "growing the heap did not extend its free block\n");
+	}
+	if (NULL == omrheap_allocate(heapBase, heapSize + (heapSize / 2))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not allocate from the space added by omrheap_grow()\n");
+	}
+	walkSegregatedFitHeap(OMRPORTLIB, heapBase, testName);
+	verifyHeapOutofRegionWrite(OMRPORTLIB, allocPtr, allocPtr + heapStartOffset + (2 * heapSize), heapStartOffset, testName);
+
+exit:
+	omrmem_free_memory(allocPtr);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Compare the time taken by first-fit and segregated-fit heaps to allocate and free once the heap is fragmented.
+ *
+ * The heap is fragmented by allocating many small blocks and freeing every other one. Then each step
+ * allocates a block bigger than any of the holes and frees a random live block.
+ */
+TEST(PortHeapTest, heap_fragmentation_benchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrheap_fragmentation_benchmark";
+	const uintptr_t heapSize = 16 * 1024 * 1024;
+	const uintptr_t fragmentCount = 20000;
+	const uintptr_t stepCount = 20000;
+	const uint32_t heapFlags[] = {0, OMRPORT_HEAP_SEGREGATED_FIT};
+	const char *heapNames[] = {"first-fit", "segregated-fit"};
+	uint8_t *allocPtr = NULL;
+	void **live = NULL;
+	uint64_t elapsed[2] = {0, 0};
+	uintptr_t mode = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	allocPtr = (uint8_t *)omrmem_allocate_memory(heapSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	live = (void **)omrmem_allocate_memory(fragmentCount * sizeof(void *), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == allocPtr) || (NULL == live)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Failed to allocate memory for the benchmark\n");
+		goto exit;
+	}
+
+	for (mode = 0; mode < 2; mode++) {
+		J9Heap *heapBase = omrheap_create(allocPtr, heapSize, heapFlags[mode]);
+		uintptr_t liveCount = 0;
+		uintptr_t failures = 0;
+		uintptr_t i = 0;
+		uint64_t start = 0;
+
+		if (NULL == heapBase) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrheap_create() failed for the %s heap\n", heapNames[mode]);
+			goto exit;
+		}
+		srand(11);
+		for (i = 0; i < fragmentCount; i++) {
+			void *block = omrheap_allocate(heapBase, 16 + ((uintptr_t)rand() % 240));
+			if (0 == (i % 2)) {
+				live[liveCount] = block;
+				liveCount += 1;
+			} else {
+				omrheap_free(heapBase, block);
+			}
+		}
+
+		start = omrtime_nano_time();
+		for (i = 0; i < stepCount; i++) {
+			uintptr_t victim = (uintptr_t)rand() % liveCount;
+			void *block = omrheap_allocate(heapBase, 512 + ((uintptr_t)rand() % 512));
+			if (NULL == block) {
+				failures += 1;
+			} else {
+				omrheap_free(heapBase, live[victim]);
+				live[victim] = block;
+			}
+		}
+		elapsed[mode] = omrtime_nano_time() - start;
+
+		if (0 != failures) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "%zu allocations failed in the %s heap\n", failures, heapNames[mode]);
+		}
+		portTestEnv->log("%s: %zu allocations in %llu us (%llu ns each)\n", heapNames[mode], stepCount,
+			(unsigned long long)(elapsed[mode] / 1000), (unsigned long long)(elapsed[mode] / stepCount));
+	}
+	if (0 != elapsed[1]) {
+		portTestEnv->log("segregated-fit speedup: %.1fx\n", (double)elapsed[0] / (double)elapsed[1]);
+	}
+
+exit:
+	omrmem_free_memory(live);
+	omrmem_free_memory(allocPtr);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /**
  * Helper function that iterates all used elements in the pool and call heap_free to free each memory blocks, whose information is stored in a pool element.
  */
@@ -1370,6 +1555,85 @@ walkHeap(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, const char *testN
 	portTestEnv->changeIndent(-1);
 }
 
+/*
+ * Check the blocks and free lists of a segregated-fit heap: every free block must be on the list for its size,
+ * no two free blocks may be adjacent, and the bitmap must match the non-empty lists.
+ * The free lists are the payload of the first block: a bitmap followed by 64 list heads.
+ *
+ * Returns the number of free blocks.
+ */
+static uintptr_t
+walkSegregatedFitHeap(struct OMRPortLibrary *portLibrary, J9Heap *heapBase, const char *testName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	int64_t *basePtr = (int64_t *)heapBase;
+	uintptr_t heapSize = ((uintptr_t *)basePtr)[0];
+	uintptr_t firstSlot = SIZE_OF_J9HEAP_HEADER / sizeof(uint64_t);
+	uint64_t bitmap = (uint64_t)basePtr[firstSlot + 1];
+	int64_t *heads = &basePtr[firstSlot + 2];
+	uintptr_t slot = firstSlot;
+	uintptr_t freeBlocks = 0;
+	uintptr_t listedBlocks = 0;
+	uintptr_t bucket = 0;
+	BOOLEAN previousFree = FALSE;
+
+	if (basePtr[firstSlot] >= 0) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "the free lists are not in an occupied block\n");
+		return 0;
+	}
+	while (slot < (heapSize - 1)) {
+		int64_t size = basePtr[slot];
+		uintptr_t absSize = (uintptr_t)((size < 0) ? -size : size);
+
+		if ((0 == size) || ((slot + absSize + 1) >= heapSize) || (size != basePtr[slot + absSize + 1])) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "bad block padding at slot %zu\n", slot);
+			return 0;
+		}
+		if (size > 0) {
+			if (previousFree) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "free block at slot %zu was not coalesced\n", slot);
+			}
+			if (size < 2) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "free block at slot %zu is too small for its list links\n", slot);
+			}
+			freeBlocks += 1;
+		}
+		previousFree = (size > 0);
+		slot += absSize + 2;
+	}
+
+	for (bucket = 0; bucket < 64; bucket++) {
+		int64_t cursor = heads[bucket];
+		int64_t previous = 0;
+
+		if ((0 != cursor) != (0 != (bitmap & (((uint64_t)1) << bucket)))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "bitmap does not match the list for bucket %zu\n", bucket);
+		}
+		while (0 != cursor) {
+			int64_t size = basePtr[cursor];
+			if ((size < ((int64_t)1 << bucket)) || ((bucket < 63) && (size >= ((int64_t)2 << bucket)))) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "block at slot %lld of size %lld is in bucket %zu\n", (long long)cursor, (long long)size, bucket);
+				return freeBlocks;
+			}
+			if (previous != basePtr[cursor + 2]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "bad previous link in the block at slot %lld\n", (long long)cursor);
+				return freeBlocks;
+			}
+			listedBlocks += 1;
+			if (listedBlocks > freeBlocks) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "the free lists hold more blocks than the heap\n");
+				return freeBlocks;
+			}
+			previous = cursor;
+			cursor = basePtr[cursor + 1];
+		}
+	}
+	if (listedBlocks != freeBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "%zu free blocks but %zu blocks on the free lists\n", freeBlocks, listedBlocks);
+	}
+	return freeBlocks;
+}
+
 /**
  * Verify port library heap operations.
  *
@@ -31,6 +31,8 @@
 #include "omrport.h"
 #if defined(LINUX)
 #include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #endif /* defined(LINUX) */
 #include "testHelpers.hpp"
 
@@ -80,3 +82,103 @@ TEST(PortIntrospectTest, introspect_test_set_signal_offset)
 #endif /* defined(OMR_CONFIGURABLE_SUSPEND_SIGNAL) */
 	portTestEnv->changeIndent(-1);
 }
+
+typedef struct SamplerTestData {
+	uintptr_t threadId;
+	uintptr_t sampleCount;
+	uintptr_t badSamples;
+	uint64_t lastTime;
+} SamplerTestData;
+
+static void
+countSamples(struct OMRPortLibrary *portLibrary, const OMRIntrospectSample *samples, uintptr_t sampleCount, void *userData)
+{
+	SamplerTestData *data = (SamplerTestData *)userData;
+
+	for (uintptr_t i = 0; i < sampleCount; i++) {
+		if ((samples[i].threadId != data->threadId) || (0 == samples[i].frameCount) || (samples[i].timeNanos < data->lastTime)) {
+			data->badSamples += 1;
+		}
+		data->lastTime = samples[i].timeNanos;
+		data->sampleCount += 1;
+	}
+}
+
+/**
+ * Verify that a sampler records the stacks of the calling thread while it uses CPU, and that
+ * sampling stops when the thread is removed.
+ */
+TEST(PortIntrospectTest, introspect_test_sampler)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "introspect_test_sampler";
+	OMRIntrospectSamplerParams params = {1000000, 32, 0, 16};
+	struct OMRIntrospectSampler *sampler = NULL;
+	SamplerTestData data = {0, 0, 0, 0};
+	int32_t rc = 0;
+	portTestEnv->changeIndent(1);
+
+	reportTestEntry(OMRPORTLIB, testName);
+	rc = omrintrospect_sampler_open(&params, &sampler);
+#if defined(LINUX) && !defined(OMRZTPF)
+	if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrintrospect_sampler_open failed: %d\n", rc);
+		goto exit;
+	}
+	rc = omrintrospect_sampler_add_thread(sampler, 0);
+	if ((OMRPORT_ERROR_NOPERMISSION == rc) || (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM == rc)) {
+		portTestEnv->log("perf_event sampling is not available (%d), skipping\n", rc);
+	} else if (0 != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrintrospect_sampler_add_thread failed: %d\n", rc);
+	} else {
+		uint64_t start = omrtime_nano_time();
+		uint64_t end = 0;
+		volatile uintptr_t sink = 0;
+		intptr_t drained = 0;
+
+		data.threadId = (uintptr_t)syscall(SYS_gettid);
+		while ((omrtime_nano_time() - start) < J9CONST_U64(200000000)) {
+			for (uintptr_t i = 0; i < 10000; i++) {
+				sink += i;
+			}
+		}
+		end = omrtime_nano_time();
+
+		drained = omrintrospect_sampler_drain(sampler, countSamples, &data);
+		portTestEnv->log("drained %zd samples, last at %llu, burn from %llu to %llu\n",
+			drained, (unsigned long long)data.lastTime, (unsigned long long)start, (unsigned long long)end);
+		if ((drained <= 0) || ((uintptr_t)drained != data.sampleCount)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrintrospect_sampler_drain returned %zd for %zu samples\n", drained, data.sampleCount);
+		}
+		if (0 != data.badSamples) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "%zu samples had the wrong thread, no frames or out of order times\n", data.badSamples);
+		}
+		if ((data.lastTime < start) || (data.lastTime > end)) {
+			/* sample times are only on the omrtime_nano_time clock on kernels with perf_event clockid */
+			portTestEnv->log(LEVEL_ERROR, "last sample time %llu is outside the sampling interval\n", (unsigned long long)data.lastTime);
+		}
+
+		rc = omrintrospect_sampler_remove_thread(sampler, 0);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrintrospect_sampler_remove_thread failed: %d\n", rc);
+		}
+		rc = omrintrospect_sampler_remove_thread(sampler, 0);
+		if (OMRPORT_ERROR_INVALID_ARGUMENTS != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "removing an unsampled thread returned %d\n", rc);
+		}
+		data.sampleCount = 0;
+		drained = omrintrospect_sampler_drain(sampler, countSamples, &data);
+		if (0 != drained) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "drain with no threads returned %zd\n", drained);
+		}
+	}
+	omrintrospect_sampler_close(sampler);
+exit:
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrintrospect_sampler_open returned %d\n", rc);
+	}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+	reportTestExit(OMRPORTLIB, testName);
+	portTestEnv->changeIndent(-1);
+}
@@ -727,6 +727,11 @@ struct CategoriesState {
 #if defined(OMR_ENV_DATA64)
 	uintptr_t unused32bitSlabBytes;
 	uintptr_t unused32bitSlabBlocks;
+	BOOLEAN slabAllocatorWalked;
+	uintptr_t slabAllocatorBytes;
+	uintptr_t slabAllocatorBlocks;
+	uintptr_t slabAllocationsBytes;
+	uintptr_t slabAllocationsBlocks;
 #endif
 };
 
@@ -826,6 +831,17 @@ categoryWalkFunction(uint32_t categoryCode, const char *categoryName, uintptr_t
 		state->unused32bitSlabBytes = liveBytes;
 		state->unused32bitSlabBlocks = liveAllocations;
 		break;
+
+	case OMRMEM_CATEGORY_PORT_LIBRARY_SLAB_ALLOCATOR:
+		state->slabAllocatorWalked = TRUE;
+		state->slabAllocatorBytes = liveBytes;
+		state->slabAllocatorBlocks = liveAllocations;
+		break;
+
+	case OMRMEM_CATEGORY_PORT_LIBRARY_SLAB_ALLOCATIONS:
+		state->slabAllocationsBytes = liveBytes;
+		state->slabAllocationsBlocks = liveAllocations;
+		break;
 #endif
 
 	default:
@@ -1517,6 +1533,312 @@ TEST(PortMemTest, mem_test9_category_walk)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+#define CATEGORY_SCALING_MAX_THREADS 64
+#define CATEGORY_SCALING_ITERATIONS 20000
+#define CATEGORY_SCALING_ALLOC_SIZE 32
+
+typedef struct CategoryScalingData {
+	struct OMRPortLibrary *portLibrary;
+	omrthread_monitor_t monitor;
+	uintptr_t started;
+	uintptr_t finished;
+	BOOLEAN go;
+} CategoryScalingData;
+
+static int J9THREAD_PROC
+categoryScalingThread(void *arg)
+{
+	CategoryScalingData *data = (CategoryScalingData *)arg;
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(data->monitor);
+	data->started += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	while (!data->go) {
+		omrthread_monitor_wait(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+
+	for (i = 0; i < CATEGORY_SCALING_ITERATIONS; i++) {
+		void *memPtr = omrmem_allocate_memory(CATEGORY_SCALING_ALLOC_SIZE, DUMMY_CATEGORY_TWO);
+		omrmem_free_memory(memPtr);
+	}
+
+	omrthread_monitor_enter(data->monitor);
+	data->finished += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+/*
+ * Measures tagged allocate/free throughput in one category from 1 to CATEGORY_SCALING_MAX_THREADS
+ * threads, and checks that the sharded category counters still balance afterwards.
+ */
+TEST(PortMemTest, mem_test10_category_counter_scaling)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test10_category_counter_scaling";
+	struct CategoriesState categoriesState;
+	CategoryScalingData data;
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t threadCount = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, (uintptr_t) &dummyCategorySet);
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	initialBlocks = categoriesState.dummyCategoryTwoBlocks;
+	initialBytes = categoriesState.dummyCategoryTwoBytes;
+
+	memset(&data, 0, sizeof(data));
+	data.portLibrary = OMRPORTLIB;
+	if (0 != omrthread_monitor_init_with_name(&data.monitor, 0, "category scaling")) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrthread_monitor_init_with_name failed\n");
+		goto end;
+	}
+
+	for (threadCount = 1; threadCount <= CATEGORY_SCALING_MAX_THREADS; threadCount *= 2) {
+		uintptr_t created = 0;
+		uint64_t start = 0;
+		uint64_t elapsed = 0;
+
+		data.started = 0;
+		data.finished = 0;
+		data.go = FALSE;
+		for (created = 0; created < threadCount; created++) {
+			if (0 != omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, &categoryScalingThread, &data)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrthread_create failed\n");
+				break;
+			}
+		}
+
+		omrthread_monitor_enter(data.monitor);
+		while (data.started < created) {
+			omrthread_monitor_wait(data.monitor);
+		}
+		start = omrtime_nano_time();
+		data.go = TRUE;
+		omrthread_monitor_notify_all(data.monitor);
+		while (data.finished < created) {
+			omrthread_monitor_wait(data.monitor);
+		}
+		elapsed = omrtime_nano_time() - start;
+		omrthread_monitor_exit(data.monitor);
+
+		if (created < threadCount) {
+			break;
+		}
+		portTestEnv->log("%3zu threads: %llu allocate/free pairs per second\n", threadCount,
+			(unsigned long long)((threadCount * CATEGORY_SCALING_ITERATIONS * (uint64_t)1000000000) / OMR_MAX(elapsed, 1)));
+	}
+	omrthread_monitor_destroy(data.monitor);
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if (categoriesState.dummyCategoryTwoBlocks != initialBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of blocks. Expected %zu, got %zu.\n", initialBlocks, categoriesState.dummyCategoryTwoBlocks);
+	}
+	if (categoriesState.dummyCategoryTwoBytes != initialBytes) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of bytes. Expected %zu, got %zu.\n", initialBytes, categoriesState.dummyCategoryTwoBytes);
+	}
+
+end:
+	/* Reset categories to NULL */
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, 0);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+#if defined(OMR_ENV_DATA64)
+#define SLAB_TEST_BLOCKS 1000
+#define SLAB_TEST_MAX_SIZE 248
+#define SLAB_TEST_SLAB_SIZE (64 * 1024)
+#define SLAB_TEST_ITERATIONS 1000000
+
+static uint64_t
+timeAllocateFreePairs(struct OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint64_t start = omrtime_nano_time();
+	uintptr_t i = 0;
+
+	for (i = 0; i < SLAB_TEST_ITERATIONS; i++) {
+		void *memPtr = omrmem_allocate_memory(CATEGORY_SCALING_ALLOC_SIZE, DUMMY_CATEGORY_TWO);
+		omrmem_free_memory(memPtr);
+	}
+	return omrtime_nano_time() - start;
+}
+
+/*
+ * Verifies that small allocations are served by the slab allocator when it is enabled: the
+ * category is charged per slab, the allocator is reported by omrmem_walk_categories, reallocation
+ * moves blocks in and out of slabs, and disabling the allocator releases its empty slabs.
+ */
+TEST(PortMemTest, mem_test11_slab_allocator)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test11_slab_allocator";
+	struct CategoriesState categoriesState;
+	uint8_t *memPtrs[SLAB_TEST_BLOCKS];
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t slabs = 0;
+	uint64_t slabNanos = 0;
+	uint64_t taggedNanos = 0;
+	uint8_t *memPtr = NULL;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, (uintptr_t) &dummyCategorySet);
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	initialBlocks = categoriesState.dummyCategoryTwoBlocks;
+	initialBytes = categoriesState.dummyCategoryTwoBytes;
+
+	if (0 != omrport_control(OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR, OMRPORT_MEM_SLAB_ENABLED | OMRPORT_MEM_SLAB_CHECK_TAGS)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrport_control(OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR) failed\n");
+		goto end;
+	}
+
+	for (i = 0; i < SLAB_TEST_BLOCKS; i++) {
+		uintptr_t size = i % (SLAB_TEST_MAX_SIZE + 1);
+
+		memPtrs[i] = (uint8_t *)omrmem_allocate_memory(size, DUMMY_CATEGORY_TWO);
+		if (NULL == memPtrs[i]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_allocate_memory(%zu) returned NULL\n", size);
+			goto free;
+		}
+		memset(memPtrs[i], (int)(i & 0xFF), size);
+	}
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if (categoriesState.otherError) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Error walking categories\n");
+	}
+	slabs = categoriesState.dummyCategoryTwoBlocks - initialBlocks;
+	if ((0 == slabs) || ((categoriesState.dummyCategoryTwoBytes - initialBytes) != (slabs * SLAB_TEST_SLAB_SIZE))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Category should be charged per slab, got %zu blocks and %zu bytes\n",
+			slabs, categoriesState.dummyCategoryTwoBytes - initialBytes);
+	}
+	if (!categoriesState.slabAllocatorWalked || (categoriesState.slabAllocatorBlocks < slabs)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Slab allocator not reported by omrmem_walk_categories\n");
+	}
+	if (categoriesState.slabAllocationsBlocks < SLAB_TEST_BLOCKS) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Expected at least %d slab allocations, got %zu\n", SLAB_TEST_BLOCKS, categoriesState.slabAllocationsBlocks);
+	}
+	portTestEnv->log("%zu slabs, %zu free bytes in slabs\n", categoriesState.slabAllocatorBlocks, categoriesState.slabAllocatorBytes);
+
+	/* grow a slab block past the largest size class, then shrink it back into a slab */
+	memPtr = (uint8_t *)omrmem_reallocate_memory(memPtrs[SLAB_TEST_MAX_SIZE], 1024, DUMMY_CATEGORY_TWO);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_reallocate_memory returned NULL\n");
+		goto free;
+	}
+	memPtrs[SLAB_TEST_MAX_SIZE] = memPtr;
+	memPtr = (uint8_t *)omrmem_reallocate_memory(memPtrs[SLAB_TEST_MAX_SIZE], 16, DUMMY_CATEGORY_TWO);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_reallocate_memory returned NULL\n");
+		goto free;
+	}
+	memPtrs[SLAB_TEST_MAX_SIZE] = memPtr;
+	for (i = 0; i < 16; i++) {
+		if (SLAB_TEST_MAX_SIZE != memPtr[i]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Reallocated block lost its contents at offset %zu\n", i);
+			break;
+		}
+	}
+
+free:
+	for (i = 0; i < SLAB_TEST_BLOCKS; i++) {
+		omrmem_free_memory(memPtrs[i]);
+		memPtrs[i] = NULL;
+	}
+
+	slabNanos = timeAllocateFreePairs(OMRPORTLIB);
+	omrport_control(OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR, 0);
+	taggedNanos = timeAllocateFreePairs(OMRPORTLIB);
+	portTestEnv->log("slab allocator: %llu allocate/free pairs per second, tagged allocator: %llu\n",
+		(unsigned long long)((SLAB_TEST_ITERATIONS * (uint64_t)1000000000) / OMR_MAX(slabNanos, 1)),
+		(unsigned long long)((SLAB_TEST_ITERATIONS * (uint64_t)1000000000) / OMR_MAX(taggedNanos, 1)));
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if (categoriesState.dummyCategoryTwoBlocks != initialBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of blocks. Expected %zu, got %zu.\n", initialBlocks, categoriesState.dummyCategoryTwoBlocks);
+	}
+	if (categoriesState.dummyCategoryTwoBytes != initialBytes) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of bytes. Expected %zu, got %zu.\n", initialBytes, categoriesState.dummyCategoryTwoBytes);
+	}
+
+end:
+	/* Reset categories to NULL */
+	omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, 0);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/*
+ * Verifies that a slab block which is still live when its port library shuts down stays valid,
+ * and can be freed afterwards without being reported as corrupt.
+ */
+TEST(PortMemTest, mem_test12_slab_block_outlives_allocator)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test12_slab_block_outlives_allocator";
+	OMRPortLibrary *slabPortLibrary = NULL;
+	uint8_t *memPtrs[2] = {NULL, NULL};
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (0 != omrport_allocate_library(&slabPortLibrary)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrport_allocate_library() failed\n");
+		goto exit;
+	}
+	if (0 != omrport_startup_library(slabPortLibrary)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrport_startup_library() failed\n");
+		goto exit;
+	}
+	if (0 != slabPortLibrary->port_control(slabPortLibrary, OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR, OMRPORT_MEM_SLAB_ENABLED)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "port_control(OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR) failed\n");
+		goto exit;
+	}
+	for (i = 0; i < 2; i++) {
+		memPtrs[i] = (uint8_t *)slabPortLibrary->mem_allocate_memory(slabPortLibrary, 32, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == memPtrs[i]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "mem_allocate_memory returned NULL\n");
+			goto exit;
+		}
+		memset(memPtrs[i], 0x5A, 32);
+	}
+
+	slabPortLibrary->port_shutdown_library(slabPortLibrary);
+	slabPortLibrary = NULL;
+
+	for (i = 0; i < 32; i++) {
+		if ((0x5A != memPtrs[0][i]) || (0x5A != memPtrs[1][i])) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "Slab block changed after shutdown at offset %zu\n", i);
+			break;
+		}
+	}
+	/* the second free releases the retired slab */
+	omrmem_free_memory(memPtrs[0]);
+	omrmem_free_memory(memPtrs[1]);
+	memPtrs[0] = NULL;
+	memPtrs[1] = NULL;
+
+exit:
+	if (NULL != slabPortLibrary) {
+		for (i = 0; i < 2; i++) {
+			slabPortLibrary->mem_free_memory(slabPortLibrary, memPtrs[i]);
+		}
+		slabPortLibrary->port_shutdown_library(slabPortLibrary);
+	}
+	reportTestExit(OMRPORTLIB, testName);
+}
+#endif /* defined(OMR_ENV_DATA64) */
+
 /* attempt to free all mem pointers stored in memPtrs array with length */
 static void
 freeMemPointers(struct OMRPortLibrary *portLibrary, void **memPtrs, uintptr_t length)
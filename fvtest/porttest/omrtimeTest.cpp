@@ -760,3 +760,166 @@ TEST(PortTimeTest, time_test_hires_delta_rounding)
 exit:
 	reportTestExit(OMRPORTLIB, testName);
 }
+
+#define FAST_NANOS_TEST_DURATION_MILLIS 1500
+#define FAST_NANOS_TEST_THREADS 4
+#define FAST_NANOS_TEST_TOLERANCE_NANOS 1000000
+#define FAST_NANOS_BENCHMARK_CALLS 10000000
+
+/**
+ * Check that omrtime_fast_nanos agrees with omrtime_nano_time and moves forward, across its
+ * calibration and at least one re-sync, and report the cost per call of the clocks.
+ */
+TEST(PortTimeTest, time_fast_nanos)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrtime_fast_nanos";
+	int64_t testStart = omrtime_nano_time();
+	int64_t previous = 0;
+	int64_t worstError = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	while ((omrtime_nano_time() - testStart) < ((int64_t)FAST_NANOS_TEST_DURATION_MILLIS * 1000000)) {
+		int64_t before = omrtime_nano_time();
+		int64_t fast = omrtime_fast_nanos();
+		int64_t after = omrtime_nano_time();
+
+		if ((fast < (before - FAST_NANOS_TEST_TOLERANCE_NANOS)) || (fast > (after + FAST_NANOS_TEST_TOLERANCE_NANOS))) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_fast_nanos returned %lld, outside [%lld, %lld]\n",
+				(long long)fast, (long long)before, (long long)after);
+			break;
+		}
+		if (fast < previous) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_fast_nanos went backwards from %lld to %lld\n",
+				(long long)previous, (long long)fast);
+			break;
+		}
+		previous = fast;
+		worstError = OMR_MAX(worstError, OMR_MAX(before - fast, fast - after));
+		omrthread_sleep(1);
+	}
+	portTestEnv->log("largest difference from omrtime_nano_time: %lld ns\n", (long long)worstError);
+
+	{
+		uint64_t start = 0;
+		uint64_t nanoTimeCost = 0;
+		uint64_t hiresClockCost = 0;
+		uint64_t fastNanosCost = 0;
+		volatile int64_t sink = 0;
+
+		start = omrtime_nano_time();
+		for (i = 0; i < FAST_NANOS_BENCHMARK_CALLS; i++) {
+			sink = omrtime_nano_time();
+		}
+		nanoTimeCost = omrtime_nano_time() - start;
+
+		start = omrtime_nano_time();
+		for (i = 0; i < FAST_NANOS_BENCHMARK_CALLS; i++) {
+			sink = (int64_t)omrtime_hires_clock();
+		}
+		hiresClockCost = omrtime_nano_time() - start;
+
+		start = omrtime_nano_time();
+		for (i = 0; i < FAST_NANOS_BENCHMARK_CALLS; i++) {
+			sink = omrtime_fast_nanos();
+		}
+		fastNanosCost = omrtime_nano_time() - start;
+		(void)sink;
+
+		portTestEnv->log("cost per call: omrtime_nano_time %.1f ns, omrtime_hires_clock %.1f ns, omrtime_fast_nanos %.1f ns\n",
+			(double)nanoTimeCost / FAST_NANOS_BENCHMARK_CALLS,
+			(double)hiresClockCost / FAST_NANOS_BENCHMARK_CALLS,
+			(double)fastNanosCost / FAST_NANOS_BENCHMARK_CALLS);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+typedef struct FastNanosThreadData {
+	struct OMRPortLibrary *portLibrary;
+	omrthread_monitor_t monitor;
+	uintptr_t finished;
+	volatile int64_t latest[FAST_NANOS_TEST_THREADS]; /**< the last value each thread got */
+	volatile uintptr_t failures;
+	uintptr_t index;
+} FastNanosThreadData;
+
+static int J9THREAD_PROC
+fastNanosThread(void *arg)
+{
+	FastNanosThreadData *data = (FastNanosThreadData *)arg;
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	uintptr_t self = 0;
+	uintptr_t other = 0;
+	int64_t testStart = omrtime_nano_time();
+	int64_t previous = 0;
+
+	omrthread_monitor_enter(data->monitor);
+	self = data->index;
+	data->index += 1;
+	omrthread_monitor_exit(data->monitor);
+	other = (self + 1) % FAST_NANOS_TEST_THREADS;
+
+	while ((omrtime_nano_time() - testStart) < ((int64_t)FAST_NANOS_TEST_DURATION_MILLIS * 1000000)) {
+		/* a value another thread has already got was returned before this call started */
+		int64_t seen = data->latest[other];
+		int64_t fast = omrtime_fast_nanos();
+
+		if ((fast < previous) || (fast < seen)) {
+			data->failures += 1;
+			portTestEnv->log(LEVEL_ERROR, "omrtime_fast_nanos returned %lld after %lld on this thread and %lld on another\n",
+				(long long)fast, (long long)previous, (long long)seen);
+			break;
+		}
+		previous = fast;
+		data->latest[self] = fast;
+	}
+
+	omrthread_monitor_enter(data->monitor);
+	data->finished += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+/**
+ * Check that omrtime_fast_nanos never goes backwards on any thread, or behind a value another thread
+ * has already seen, while several threads call it across at least one re-sync.
+ */
+TEST(PortTimeTest, time_fast_nanos_threads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrtime_fast_nanos_threads";
+	FastNanosThreadData data;
+	uintptr_t created = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(&data, 0, sizeof(data));
+	data.portLibrary = OMRPORTLIB;
+	if (0 != omrthread_monitor_init_with_name(&data.monitor, 0, "fast nanos threads")) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrthread_monitor_init_with_name failed\n");
+		goto exit;
+	}
+	for (created = 0; created < FAST_NANOS_TEST_THREADS; created++) {
+		if (0 != omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, &fastNanosThread, &data)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrthread_create failed\n");
+			break;
+		}
+	}
+	omrthread_monitor_enter(data.monitor);
+	while (data.finished < created) {
+		omrthread_monitor_wait(data.monitor);
+	}
+	omrthread_monitor_exit(data.monitor);
+	omrthread_monitor_destroy(data.monitor);
+
+	if (0 != data.failures) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_fast_nanos went backwards on %zu threads\n", (size_t)data.failures);
+	}
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
@@ -4514,6 +4514,166 @@ TEST(PortVmemTest, vmem_testGetProcessMemorySize)
 	EXPECT_EQ(0u, size) << "value updated when query invalid";
 }
 
+/**
+ * Reserve and commit memory under each huge page policy and check the coverage
+ * reported by omrvmem_get_hugepage_coverage.
+ *
+ * @ref omrvmem.c
+ */
+TEST(PortVmemTest, vmem_testHugepagePolicy)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testHugepagePolicy";
+	const uintptr_t policies[] = {
+		OMRPORT_VMEM_HUGEPAGE_POLICY_DEFAULT,
+		OMRPORT_VMEM_HUGEPAGE_POLICY_NEVER,
+		OMRPORT_VMEM_HUGEPAGE_POLICY_MADVISE,
+		OMRPORT_VMEM_HUGEPAGE_POLICY_EAGER,
+		OMRPORT_VMEM_HUGEPAGE_POLICY_HUGETLBFS
+	};
+	const uintptr_t byteAmount = 8 * 1024 * 1024;
+	J9PortVmemIdentifier vmemID;
+	uintptr_t hugePageBytes = 0;
+	uintptr_t residentBytes = 0;
+	int32_t result = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(&vmemID, 0, sizeof(vmemID));
+	result = omrvmem_get_hugepage_coverage(&vmemID, &hugePageBytes, &residentBytes);
+	EXPECT_TRUE(result < 0) << "coverage of an empty identifier did not fail";
+
+	for (i = 0; i < sizeof(policies) / sizeof(policies[0]); i++) {
+		J9PortVmemParams params;
+		char *memPtr = NULL;
+
+		omrvmem_vmem_params_init(&params);
+		params.byteAmount = byteAmount;
+		params.alignmentInBytes = 2 * 1024 * 1024;
+		params.mode |= OMRPORT_VMEM_MEMORY_MODE_VIRTUAL;
+		params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+		params.hugePagePolicy = policies[i];
+
+		memPtr = (char *)omrvmem_reserve_memory_ex(&vmemID, &params);
+		if (NULL == memPtr) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve 0x%zx bytes with huge page policy %zu\n", (size_t)byteAmount, (size_t)policies[i]);
+			continue;
+		}
+#if defined(LINUX)
+		if (OMRPORT_VMEM_HUGEPAGE_POLICY_HUGETLBFS == policies[i]) {
+			/* Either the hugetlbfs pool satisfied the request or the reservation fell back to transparent huge pages */
+			EXPECT_TRUE((OMRPORT_VMEM_HUGEPAGE_POLICY_HUGETLBFS == vmemID.hugePagePolicy) || (OMRPORT_VMEM_HUGEPAGE_POLICY_MADVISE == vmemID.hugePagePolicy));
+		} else {
+			EXPECT_EQ(policies[i], vmemID.hugePagePolicy);
+		}
+#endif /* defined(LINUX) */
+
+		if (NULL == omrvmem_commit_memory(memPtr, byteAmount, &vmemID)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to commit 0x%zx bytes with huge page policy %zu\n", (size_t)byteAmount, (size_t)policies[i]);
+		} else {
+			result = omrvmem_get_hugepage_coverage(&vmemID, &hugePageBytes, &residentBytes);
+#if defined(LINUX)
+			EXPECT_EQ(0, result) << "omrvmem_get_hugepage_coverage failed";
+			if (OMRPORT_VMEM_HUGEPAGE_POLICY_EAGER == policies[i]) {
+				/* Eager commits are prefaulted */
+				EXPECT_GE(residentBytes, byteAmount) << "eager commit was not prefaulted";
+			}
+			memset(memPtr, 0x5A, byteAmount);
+			result = omrvmem_get_hugepage_coverage(&vmemID, &hugePageBytes, &residentBytes);
+			EXPECT_EQ(0, result) << "omrvmem_get_hugepage_coverage failed";
+			EXPECT_GT(residentBytes, (uintptr_t)0) << "touched memory is not resident";
+			EXPECT_LE(hugePageBytes, residentBytes);
+			if (OMRPORT_VMEM_HUGEPAGE_POLICY_NEVER == policies[i]) {
+				EXPECT_EQ((uintptr_t)0, hugePageBytes) << "huge pages used despite OMRPORT_VMEM_HUGEPAGE_POLICY_NEVER";
+			}
+			portTestEnv->log("policy %zu: pageSize=0x%zx resident=0x%zx huge=0x%zx\n",
+				(size_t)policies[i], (size_t)vmemID.pageSize, (size_t)residentBytes, (size_t)hugePageBytes);
+#else /* defined(LINUX) */
+			EXPECT_EQ(OMRPORT_ERROR_VMEM_NOT_SUPPORTED, result);
+#endif /* defined(LINUX) */
+		}
+		omrvmem_free_memory(memPtr, byteAmount, &vmemID);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Measure time-to-first-touch of a freshly committed heap-sized range, committed lazily
+ * and committed with omrvmem_commit_memory_ex pre-faulting in parallel.
+ *
+ * @ref omrvmem.c
+ */
+TEST(PortVmemTest, vmem_testCommitPrefault)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testCommitPrefault";
+	const uintptr_t byteAmount = 64 * 1024 * 1024;
+	const uintptr_t numaPolicies[] = {
+		OMRPORT_VMEM_NUMA_POLICY_NONE,
+		OMRPORT_VMEM_NUMA_POLICY_INTERLEAVE,
+		OMRPORT_VMEM_NUMA_POLICY_LOCAL
+	};
+	uintptr_t prefaultThreads = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	for (prefaultThreads = 0; prefaultThreads <= 4; prefaultThreads += 2) {
+		for (i = 0; i < sizeof(numaPolicies) / sizeof(numaPolicies[0]); i++) {
+			J9PortVmemIdentifier vmemID;
+			J9PortVmemParams params;
+			J9PortVmemCommitParams commitParams;
+			char *memPtr = NULL;
+			uint64_t start = 0;
+			uint64_t committed = 0;
+			uint64_t touched = 0;
+
+			if ((0 == prefaultThreads) && (OMRPORT_VMEM_NUMA_POLICY_NONE != numaPolicies[i])) {
+				continue;
+			}
+
+			omrvmem_vmem_params_init(&params);
+			params.byteAmount = byteAmount;
+			params.mode |= OMRPORT_VMEM_MEMORY_MODE_VIRTUAL;
+			params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+			memPtr = (char *)omrvmem_reserve_memory_ex(&vmemID, &params);
+			if (NULL == memPtr) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve 0x%zx bytes\n", (size_t)byteAmount);
+				break;
+			}
+
+			memset(&commitParams, 0, sizeof(commitParams));
+			commitParams.prefaultThreads = prefaultThreads;
+			commitParams.numaPolicy = numaPolicies[i];
+
+			start = omrtime_nano_time();
+			if (NULL == omrvmem_commit_memory_ex(memPtr, byteAmount, &vmemID, &commitParams)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_commit_memory_ex failed\n");
+			} else {
+				committed = omrtime_nano_time();
+#if defined(LINUX)
+				if (0 != prefaultThreads) {
+					uintptr_t hugePageBytes = 0;
+					uintptr_t residentBytes = 0;
+					EXPECT_EQ(0, omrvmem_get_hugepage_coverage(&vmemID, &hugePageBytes, &residentBytes));
+					EXPECT_GE(residentBytes, byteAmount) << "committed range was not pre-faulted";
+				}
+#endif /* defined(LINUX) */
+				/* First pass over the heap, as a GC would make after expansion */
+				memset(memPtr, 0, byteAmount);
+				touched = omrtime_nano_time();
+				portTestEnv->log("prefaultThreads=%zu numaPolicy=%zu: commit %" OMR_PRIu64 "us, first touch %" OMR_PRIu64 "us\n",
+					(size_t)prefaultThreads, (size_t)numaPolicies[i], (committed - start) / 1000, (touched - committed) / 1000);
+			}
+			omrvmem_free_memory(memPtr, byteAmount, &vmemID);
+		}
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /**
  * Sanity test of function to obtain available physical memory.
  */
@@ -3216,3 +3216,116 @@ TEST(PortSysinfoTest, NumberOfContextSwitchesIncreasesMonotonically)
 	ASSERT_EQ(omrsysinfo_get_number_context_switches(&switches), OMRPORT_ERROR_SYSINFO_NOT_SUPPORTED);
 #endif /* defined(LINUX) */
 }
+
+#if defined(LINUX)
+typedef struct MemoryPressureTestState {
+	volatile uint32_t seenEvents;
+	volatile uint64_t stallTotal;
+	volatile uint64_t maxCount;
+} MemoryPressureTestState;
+
+static void
+memoryPressureTestCallback(struct OMRPortLibrary *portLibrary, const OMRMemoryPressureEvent *event, void *userData)
+{
+	MemoryPressureTestState *state = (MemoryPressureTestState *)userData;
+
+	if (OMRPORT_MEMORY_PRESSURE_EVENT_STALL == event->type) {
+		state->stallTotal = event->count;
+	} else if (OMRPORT_MEMORY_PRESSURE_EVENT_MAX == event->type) {
+		state->maxCount = event->count;
+	}
+	__sync_fetch_and_or(&state->seenEvents, (uint32_t)1 << event->type);
+}
+
+static void
+writeMemoryPressureTestFile(const std::string &path, const char *contents)
+{
+	std::ofstream file(path.c_str(), std::ios::trunc);
+	file << contents;
+}
+#endif /* defined(LINUX) */
+
+/**
+ * Test omrsysinfo_memory_pressure_subscribe with a stand-in cgroup directory, where rewriting
+ * memory.pressure and memory.events stands in for the kernel reporting pressure.
+ */
+TEST(PortSysinfoTest, sysinfo_memory_pressure_synthetic)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrsysinfo_memory_pressure_synthetic";
+	OMRMemoryPressureParams params;
+	struct OMRMemoryPressureMonitor *monitor = NULL;
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+	memset(&params, 0, sizeof(params));
+	params.stallType = OMRPORT_MEMORY_PRESSURE_STALL_SOME;
+	params.stallThresholdMicros = 150000;
+	params.stallWindowMicros = 2000000;
+	params.watchEvents = TRUE;
+#if defined(LINUX) && !defined(OMRZTPF)
+	{
+		MemoryPressureTestState state;
+		char dirTemplate[] = "/tmp/omrsysinfo_memory_pressure_XXXXXX";
+		const char *dir = mkdtemp(dirTemplate);
+		uint32_t expected = ((uint32_t)1 << OMRPORT_MEMORY_PRESSURE_EVENT_STALL) | ((uint32_t)1 << OMRPORT_MEMORY_PRESSURE_EVENT_MAX);
+
+		ASSERT_TRUE(NULL != dir);
+		std::string pressurePath = std::string(dir) + "/memory.pressure";
+		std::string eventsPath = std::string(dir) + "/memory.events";
+		writeMemoryPressureTestFile(pressurePath,
+				"some avg10=0.00 avg60=0.00 avg300=0.00 total=0\nfull avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+		writeMemoryPressureTestFile(eventsPath, "low 0\nhigh 0\nmax 2\noom 0\noom_kill 0\n");
+
+		memset(&state, 0, sizeof(state));
+		params.cgroupDirectory = dir;
+		params.callback = memoryPressureTestCallback;
+		params.userData = &state;
+		rc = omrsysinfo_memory_pressure_subscribe(&params, &monitor);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_memory_pressure_subscribe returned %d\n", rc);
+		} else {
+			writeMemoryPressureTestFile(pressurePath,
+					"some avg10=1.50 avg60=0.30 avg300=0.10 total=180000\nfull avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+			writeMemoryPressureTestFile(eventsPath, "low 0\nhigh 0\nmax 5\noom 0\noom_kill 0\n");
+			for (int i = 0; (i < 500) && (expected != (state.seenEvents & expected)); i++) {
+				usleep(10000);
+			}
+			omrsysinfo_memory_pressure_unsubscribe(monitor);
+
+			if (expected != (state.seenEvents & expected)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "expected events 0x%x, saw 0x%x\n", expected, state.seenEvents);
+			}
+			if (0 != (state.seenEvents & ((uint32_t)1 << OMRPORT_MEMORY_PRESSURE_EVENT_HIGH))) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "unchanged high counter was reported\n");
+			}
+			if (180000 != state.stallTotal) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "stall total %llu, expected 180000\n", (unsigned long long)state.stallTotal);
+			}
+			if (5 != state.maxCount) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "max count %llu, expected 5\n", (unsigned long long)state.maxCount);
+			}
+		}
+		unlink(pressurePath.c_str());
+		unlink(eventsPath.c_str());
+		rmdir(dir);
+
+		/* The memory cgroup of this process is only usable under cgroup v2 */
+		memset(&state, 0, sizeof(state));
+		params.cgroupDirectory = NULL;
+		rc = omrsysinfo_memory_pressure_subscribe(&params, &monitor);
+		portTestEnv->log("omrsysinfo_memory_pressure_subscribe on the process cgroup returned %d\n", rc);
+		if (0 == rc) {
+			omrsysinfo_memory_pressure_unsubscribe(monitor);
+		} else if (rc > 0) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_memory_pressure_subscribe returned %d\n", rc);
+		}
+	}
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+	rc = omrsysinfo_memory_pressure_subscribe(&params, &monitor);
+	if (OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM != rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrsysinfo_memory_pressure_subscribe returned %d\n", rc);
+	}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+	reportTestExit(OMRPORTLIB, testName);
+}
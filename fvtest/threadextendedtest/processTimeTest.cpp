@@ -115,6 +115,57 @@ TEST_F(CpuTimeTest, increasesMonotonically)
 	}
 }
 
+static const omrthread_sample_t *
+findSample(const omrthread_sample_t *samples, uintptr_t count, omrthread_t thread)
+{
+	for (uintptr_t i = 0; i < count; i++) {
+		if (thread == samples[i].thread) {
+			return &samples[i];
+		}
+	}
+	return NULL;
+}
+
+TEST_F(CpuTimeTest, samplerCollectsAllThreadsInOnePass)
+{
+	omrthread_sampler_t sampler = NULL;
+	omrthread_sample_t samples[64];
+	uintptr_t threadCount = 0;
+	J9ThreadsCpuUsage prevCpuUsage;
+	J9ThreadsCpuUsage cpuUsage;
+	int64_t prevCpuTime = 0;
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_sampler_create(&sampler, J9THREAD_SAMPLER_CONTEXT_SWITCHES | J9THREAD_SAMPLER_LAST_CPU));
+	ASSERT_EQ(0, omrthread_get_jvm_cpu_usage_info(&prevCpuUsage));
+
+	/* a buffer that is too small still reports the number of threads */
+	ASSERT_EQ(0, omrthread_sampler_sample(sampler, NULL, 0, &threadCount, NULL));
+	ASSERT_LE((uintptr_t)1, threadCount);
+
+	for (unsigned int i = 0; i < 10; i += 1) {
+		userTimeCpuBurn();
+		ASSERT_EQ(0, omrthread_sampler_sample(sampler, samples, 64, &threadCount, &cpuUsage));
+		ASSERT_GE((uintptr_t)64, threadCount);
+
+		const omrthread_sample_t *self = findSample(samples, threadCount, omrthread_self());
+		ASSERT_TRUE(NULL != self);
+		ASSERT_EQ(omrthread_get_osId(omrthread_self()), self->tid);
+		ASSERT_LT(0, self->cpuTime);
+		ASSERT_GE(self->cpuTime, prevCpuTime);
+#if defined(LINUX)
+		ASSERT_LE(0, self->lastCpu);
+		ASSERT_LE(0, self->voluntaryContextSwitches);
+		ASSERT_LE(0, self->involuntaryContextSwitches);
+#endif /* defined(LINUX) */
+		prevCpuTime = self->cpuTime;
+
+		ASSERT_GE(cpuUsage.systemJvmCpuTime, prevCpuUsage.systemJvmCpuTime);
+		ASSERT_GE(cpuUsage.timestamp, prevCpuUsage.timestamp);
+		prevCpuUsage = cpuUsage;
+	}
+	omrthread_sampler_destroy(sampler);
+}
+
 class ApplicationCpuTimeTest : public CpuTimeTest
 {
 protected:
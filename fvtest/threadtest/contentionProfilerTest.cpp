@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <string.h>
+#include <string>
+
+#include "AtomicSupport.hpp"
+#include "omrTest.h"
+#include "thread_api.h"
+#include "testHelper.hpp"
+
+#define CONTENTION_TEST_THREADS 4
+#define CONTENTION_TEST_FRAME ((void *)(uintptr_t)0x1234)
+
+typedef struct ContentionTestData {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t started;
+	volatile uintptr_t finished;
+} ContentionTestData;
+
+static int J9THREAD_PROC
+enterMonitorProc(void *arg)
+{
+	ContentionTestData *data = (ContentionTestData *)arg;
+	VM_AtomicSupport::add(&data->started, 1);
+	omrthread_monitor_enter(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	VM_AtomicSupport::add(&data->finished, 1);
+	return 0;
+}
+
+static uintptr_t
+fixedBacktrace(void *userData, void **frames, uintptr_t maxFrames)
+{
+	frames[0] = CONTENTION_TEST_FRAME;
+	return 1;
+}
+
+static uintptr_t
+symbolizeFrame(void *userData, void *address, char *buffer, uintptr_t bufferLength)
+{
+	if (CONTENTION_TEST_FRAME == address) {
+		strncpy(buffer, "contended site", bufferLength);
+		return 1;
+	}
+	return 0;
+}
+
+static void
+appendText(void *userData, const char *text, uintptr_t length)
+{
+	((std::string *)userData)->append(text, length);
+}
+
+/* hold the monitor while CONTENTION_TEST_THREADS threads try to enter it */
+static void
+contendMonitor(omrthread_monitor_t monitor)
+{
+	ContentionTestData data = {monitor, 0, 0};
+
+	omrthread_monitor_enter(monitor);
+	for (uintptr_t i = 0; i < CONTENTION_TEST_THREADS; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, enterMonitorProc, &data));
+	}
+	while (CONTENTION_TEST_THREADS != data.started) {
+		omrthread_sleep(1);
+	}
+	omrthread_sleep(50);
+	omrthread_monitor_exit(monitor);
+	while (CONTENTION_TEST_THREADS != data.finished) {
+		omrthread_sleep(1);
+	}
+}
+
+TEST(ContentionProfilerTest, recordsContendedEnters)
+{
+	omrthread_monitor_t monitor = NULL;
+	omrthread_contention_stats_t stats;
+	std::string profile;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, 0, "contention test monitor"));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_contention_profiler_start(1, 0, fixedBacktrace, NULL));
+	ASSERT_NO_FATAL_FAILURE(contendMonitor(monitor));
+	omrthread_contention_profiler_stop();
+
+	omrthread_contention_profiler_get_stats(&stats);
+	ASSERT_EQ((uintptr_t)0, stats.sampleInterval);
+	ASSERT_LT((uint64_t)0, stats.samples);
+	ASSERT_EQ((uint64_t)0, stats.droppedSamples);
+	ASSERT_EQ((uintptr_t)1, stats.sites);
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_contention_profiler_dump(symbolizeFrame, appendText, &profile));
+	/* separators inside symbol names are replaced so that the line stays foldable */
+	ASSERT_EQ(0u, profile.find("contended_site;contention_test_monitor ")) << profile;
+	ASSERT_EQ('\n', profile[profile.size() - 1]);
+	ASSERT_EQ(profile.size() - 1, profile.find('\n')) << profile;
+
+	ASSERT_EQ(0, omrthread_monitor_destroy(monitor));
+}
+
+TEST(ContentionProfilerTest, stoppedProfilerRecordsNothing)
+{
+	omrthread_monitor_t monitor = NULL;
+	omrthread_contention_stats_t before;
+	omrthread_contention_stats_t after;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, 0, "contention test monitor"));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_contention_profiler_start(1, 16, NULL, NULL));
+	omrthread_contention_profiler_stop();
+	omrthread_contention_profiler_get_stats(&before);
+	ASSERT_NO_FATAL_FAILURE(contendMonitor(monitor));
+	omrthread_contention_profiler_get_stats(&after);
+	ASSERT_EQ(before.samples, after.samples);
+	ASSERT_EQ(before.sites, after.sites);
+
+	ASSERT_EQ(0, omrthread_monitor_destroy(monitor));
+}
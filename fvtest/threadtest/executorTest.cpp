@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "AtomicSupport.hpp"
+#include "omrTest.h"
+#include "thread_api.h"
+#include "testHelper.hpp"
+
+#define EXECUTOR_TEST_WORKERS 4
+
+typedef struct ExecutorTestData {
+	omrthread_executor_t executor;
+	volatile uintptr_t counter;
+	volatile uintptr_t *hits;
+	uintptr_t hitCount;
+} ExecutorTestData;
+
+static void
+incrementTask(void *arg)
+{
+	ExecutorTestData *data = (ExecutorTestData *)arg;
+	VM_AtomicSupport::add(&data->counter, 1);
+}
+
+static void
+markRange(void *arg, uintptr_t start, uintptr_t end)
+{
+	ExecutorTestData *data = (ExecutorTestData *)arg;
+	for (uintptr_t i = start; i < end; i++) {
+		VM_AtomicSupport::add(&data->hits[i], 1);
+	}
+}
+
+static void
+countRange(void *arg, uintptr_t start, uintptr_t end)
+{
+	ExecutorTestData *data = (ExecutorTestData *)arg;
+	VM_AtomicSupport::add(&data->counter, end - start);
+}
+
+static void
+nestedParallelForTask(void *arg)
+{
+	ExecutorTestData *data = (ExecutorTestData *)arg;
+	omrthread_executor_parallel_for(data->executor, 0, 1000, 7, countRange, data, J9THREAD_EXECUTOR_CATEGORY_INHERIT);
+}
+
+static void
+busyTask(void *arg)
+{
+	int64_t start = omrthread_get_self_cpu_time(omrthread_self());
+	volatile uintptr_t sink = 0;
+	/* burn at least 20ms of CPU so that the accounting has something to measure */
+	while ((omrthread_get_self_cpu_time(omrthread_self()) - start) < 20000000) {
+		for (uintptr_t i = 0; i < 10000; i++) {
+			sink += i;
+		}
+	}
+	incrementTask(arg);
+}
+
+static void
+createExecutor(omrthread_executor_t *executor, uint32_t flags, uintptr_t dequeCapacity)
+{
+	omrthread_executor_params_t params;
+	omrthread_executor_params_init(&params);
+	params.name = "executor test";
+	params.workerCount = EXECUTOR_TEST_WORKERS;
+	params.flags = flags;
+	params.dequeCapacity = dequeCapacity;
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_create(executor, &params));
+}
+
+TEST(ExecutorTest, invalidParams)
+{
+	omrthread_executor_t executor = NULL;
+	omrthread_executor_params_t params;
+	omrthread_executor_params_init(&params);
+	ASSERT_EQ(J9THREAD_ERR_INVALID_VALUE, omrthread_executor_create(&executor, &params));
+	ASSERT_TRUE(NULL == executor);
+}
+
+TEST(ExecutorTest, submitAndJoin)
+{
+	const uintptr_t taskCount = 1000;
+	ExecutorTestData data = {NULL, 0, NULL, 0};
+	omrthread_executor_task_t tasks[taskCount];
+
+	ASSERT_NO_FATAL_FAILURE(createExecutor(&data.executor, 0, J9THREAD_EXECUTOR_DEFAULT_DEQUE_CAPACITY));
+	for (uintptr_t i = 0; i < taskCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_submit(data.executor, incrementTask, &data, J9THREAD_EXECUTOR_CATEGORY_INHERIT, &tasks[i]));
+	}
+	for (uintptr_t i = 0; i < taskCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_join(tasks[i]));
+	}
+	ASSERT_EQ(taskCount, data.counter);
+
+	omrthread_executor_stats_t stats;
+	omrthread_executor_get_stats(data.executor, &stats);
+	ASSERT_EQ(taskCount, stats.tasksSubmitted);
+	ASSERT_EQ(taskCount, stats.tasksExecuted);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_destroy(data.executor));
+}
+
+TEST(ExecutorTest, detachedTasksRunBeforeDestroy)
+{
+	const uintptr_t taskCount = 500;
+	ExecutorTestData data = {NULL, 0, NULL, 0};
+
+	ASSERT_NO_FATAL_FAILURE(createExecutor(&data.executor, 0, J9THREAD_EXECUTOR_DEFAULT_DEQUE_CAPACITY));
+	for (uintptr_t i = 0; i < taskCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_submit(data.executor, incrementTask, &data, J9THREAD_EXECUTOR_CATEGORY_INHERIT, NULL));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_destroy(data.executor));
+	ASSERT_EQ(taskCount, data.counter);
+}
+
+TEST(ExecutorTest, parallelForCoversRangeOnce)
+{
+	const uintptr_t count = 100003;
+	ExecutorTestData data = {NULL, 0, NULL, count};
+	data.hits = (volatile uintptr_t *)calloc(count, sizeof(uintptr_t));
+	ASSERT_TRUE(NULL != data.hits);
+
+	ASSERT_NO_FATAL_FAILURE(createExecutor(&data.executor, 0, J9THREAD_EXECUTOR_DEFAULT_DEQUE_CAPACITY));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_parallel_for(data.executor, 0, count, 0, markRange, &data, J9THREAD_EXECUTOR_CATEGORY_INHERIT));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_parallel_for(data.executor, 5, 5, 1, markRange, &data, J9THREAD_EXECUTOR_CATEGORY_INHERIT));
+	for (uintptr_t i = 0; i < count; i++) {
+		ASSERT_EQ((uintptr_t)1, data.hits[i]) << "index " << i;
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_destroy(data.executor));
+	free((void *)data.hits);
+}
+
+TEST(ExecutorTest, nestedParallelForInTasks)
+{
+	const uintptr_t taskCount = 2 * EXECUTOR_TEST_WORKERS;
+	ExecutorTestData data = {NULL, 0, NULL, 0};
+	omrthread_executor_task_t tasks[taskCount];
+
+	/* a tiny deque forces pushes from workers to overflow to the shared queue */
+	ASSERT_NO_FATAL_FAILURE(createExecutor(&data.executor, 0, 2));
+	for (uintptr_t i = 0; i < taskCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_submit(data.executor, nestedParallelForTask, &data, J9THREAD_EXECUTOR_CATEGORY_INHERIT, &tasks[i]));
+	}
+	for (uintptr_t i = 0; i < taskCount; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_join(tasks[i]));
+	}
+	ASSERT_EQ(taskCount * 1000, data.counter);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_destroy(data.executor));
+}
+
+TEST(ExecutorTest, cpuAccountingByCategory)
+{
+	ExecutorTestData data = {NULL, 0, NULL, 0};
+	omrthread_executor_task_t gcTask = NULL;
+	omrthread_executor_task_t jitTask = NULL;
+
+	if (omrthread_get_self_cpu_time(omrthread_self()) < 0) {
+		/* thread CPU times are not supported on this platform */
+		return;
+	}
+	ASSERT_NO_FATAL_FAILURE(createExecutor(&data.executor, J9THREAD_EXECUTOR_FLAG_ACCOUNT_CPU, J9THREAD_EXECUTOR_DEFAULT_DEQUE_CAPACITY));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_submit(data.executor, busyTask, &data, J9THREAD_CATEGORY_SYSTEM_GC_THREAD, &gcTask));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_submit(data.executor, busyTask, &data, J9THREAD_CATEGORY_SYSTEM_JIT_THREAD, &jitTask));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_join(gcTask));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_join(jitTask));
+
+	omrthread_executor_stats_t stats;
+	omrthread_executor_get_stats(data.executor, &stats);
+	ASSERT_LT(0, stats.cpuUsage.gcCpuTime);
+	ASSERT_LT(0, stats.cpuUsage.jitCpuTime);
+	ASSERT_LE(stats.cpuUsage.gcCpuTime + stats.cpuUsage.jitCpuTime, stats.cpuUsage.systemJvmCpuTime);
+	ASSERT_EQ(0, stats.cpuUsage.applicationCpuTime);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_executor_destroy(data.executor));
+}
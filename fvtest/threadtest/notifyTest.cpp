@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "AtomicSupport.hpp"
+#include "omrTest.h"
+#include "thread_api.h"
+#include "testHelper.hpp"
+
+#define NOTIFY_TEST_WAITERS 4
+#define NOTIFY_TEST_ROUNDS 50
+
+typedef struct NotifyTestData {
+	omrthread_monitor_t monitor;
+	volatile uintptr_t waiting;
+	volatile uintptr_t woken;
+	volatile uintptr_t finished;
+	uintptr_t rounds;
+} NotifyTestData;
+
+static int J9THREAD_PROC
+waitProc(void *arg)
+{
+	NotifyTestData *data = (NotifyTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	for (uintptr_t i = 0; i < data->rounds; i++) {
+		data->waiting += 1;
+		omrthread_monitor_wait(data->monitor);
+		data->woken += 1;
+	}
+	omrthread_monitor_exit(data->monitor);
+	VM_AtomicSupport::add(&data->finished, 1);
+	return 0;
+}
+
+class NotifyTest : public ::testing::TestWithParam<bool>
+{
+protected:
+	virtual void
+	SetUp()
+	{
+		_fastNotify = (0 != (omrthread_lib_get_flags() & J9THREAD_LIB_FLAG_FAST_NOTIFY));
+		if (GetParam()) {
+			omrthread_lib_set_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+		} else {
+			omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+		}
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (_fastNotify) {
+			omrthread_lib_set_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+		} else {
+			omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+		}
+	}
+
+	/* start NOTIFY_TEST_WAITERS threads and return, owning the monitor, once they are all waiting */
+	void
+	startWaiters(NotifyTestData *data)
+	{
+		for (uintptr_t i = 0; i < NOTIFY_TEST_WAITERS; i++) {
+			ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, waitProc, data));
+		}
+		omrthread_monitor_enter(data->monitor);
+		while (NOTIFY_TEST_WAITERS != omrthread_monitor_num_waiting(data->monitor)) {
+			omrthread_monitor_exit(data->monitor);
+			omrthread_sleep(1);
+			omrthread_monitor_enter(data->monitor);
+		}
+	}
+
+	/* release the monitor until woken reaches expected, then give any extra wakeups time to show */
+	void
+	awaitWoken(NotifyTestData *data, uintptr_t expected)
+	{
+		for (uintptr_t i = 0; (i < 5000) && (data->woken < expected); i++) {
+			omrthread_monitor_exit(data->monitor);
+			omrthread_sleep(1);
+			omrthread_monitor_enter(data->monitor);
+		}
+		omrthread_monitor_exit(data->monitor);
+		omrthread_sleep(50);
+		omrthread_monitor_enter(data->monitor);
+	}
+
+private:
+	bool _fastNotify;
+};
+
+TEST_P(NotifyTest, notifyNWakesRequestedWaiters)
+{
+	NotifyTestData data = {NULL, 0, 0, 0, 1};
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, 0, "notify_n test monitor"));
+	ASSERT_NO_FATAL_FAILURE(startWaiters(&data));
+
+	ASSERT_EQ(0, omrthread_monitor_notify_n(data.monitor, 0));
+	ASSERT_NO_FATAL_FAILURE(awaitWoken(&data, 0));
+	ASSERT_EQ((uintptr_t)0, data.woken);
+
+	ASSERT_EQ(0, omrthread_monitor_notify_n(data.monitor, 3));
+	ASSERT_NO_FATAL_FAILURE(awaitWoken(&data, 3));
+	ASSERT_EQ((uintptr_t)3, data.woken);
+	ASSERT_EQ((uintptr_t)1, omrthread_monitor_num_waiting(data.monitor));
+
+	/* asking for more threads than are waiting notifies the ones there are */
+	ASSERT_EQ(0, omrthread_monitor_notify_n(data.monitor, NOTIFY_TEST_WAITERS));
+	ASSERT_NO_FATAL_FAILURE(awaitWoken(&data, NOTIFY_TEST_WAITERS));
+	ASSERT_EQ((uintptr_t)NOTIFY_TEST_WAITERS, data.woken);
+	omrthread_monitor_exit(data.monitor);
+
+	while (NOTIFY_TEST_WAITERS != data.finished) {
+		omrthread_sleep(1);
+	}
+	ASSERT_EQ(0, omrthread_monitor_destroy(data.monitor));
+}
+
+TEST_P(NotifyTest, notifyNRequiresOwnership)
+{
+	omrthread_monitor_t monitor = NULL;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, 0, "notify_n ownership test monitor"));
+	ASSERT_EQ(J9THREAD_ILLEGAL_MONITOR_STATE, omrthread_monitor_notify_n(monitor, 1));
+	ASSERT_EQ(0, omrthread_monitor_destroy(monitor));
+}
+
+/* every round, all waiters are notified at once and must each get the monitor back */
+TEST_P(NotifyTest, notifyAllWakesEveryWaiter)
+{
+	NotifyTestData data = {NULL, 0, 0, 0, NOTIFY_TEST_ROUNDS};
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, 0, "notify_all test monitor"));
+	ASSERT_NO_FATAL_FAILURE(startWaiters(&data));
+	for (uintptr_t round = 1; round <= NOTIFY_TEST_ROUNDS; round++) {
+		uintptr_t expected = round * NOTIFY_TEST_WAITERS;
+
+		ASSERT_EQ(0, omrthread_monitor_notify_all(data.monitor));
+		while (data.woken < expected) {
+			omrthread_monitor_exit(data.monitor);
+			omrthread_yield();
+			omrthread_monitor_enter(data.monitor);
+		}
+		while ((round < NOTIFY_TEST_ROUNDS) && (data.waiting < (expected + NOTIFY_TEST_WAITERS))) {
+			omrthread_monitor_exit(data.monitor);
+			omrthread_yield();
+			omrthread_monitor_enter(data.monitor);
+		}
+	}
+	omrthread_monitor_exit(data.monitor);
+
+	while (NOTIFY_TEST_WAITERS != data.finished) {
+		omrthread_sleep(1);
+	}
+	ASSERT_EQ((uintptr_t)(NOTIFY_TEST_ROUNDS * NOTIFY_TEST_WAITERS), data.woken);
+	ASSERT_EQ(0, omrthread_monitor_destroy(data.monitor));
+}
+
+INSTANTIATE_TEST_CASE_P(FastNotify, NotifyTest, ::testing::Bool());
@@ -0,0 +1,292 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#if defined(LINUX)
+#include <sys/prctl.h>
+#endif /* defined(LINUX) */
+#include <string.h>
+
+#include "omrTest.h"
+#include "thread_api.h"
+#include "testHelper.hpp"
+
+#define THREAD_CACHE_TEST_SIZE 4
+#define THREAD_CACHE_BENCHMARK_CYCLES 500
+#define THREAD_CACHE_POLL_MILLIS 10
+#define THREAD_CACHE_POLL_LIMIT 500
+#define THREAD_CACHE_OTHER_STACK_SIZE 0x10000
+
+typedef struct ThreadCacheTestData {
+	omrthread_monitor_t monitor;
+	uintptr_t finished;
+} ThreadCacheTestData;
+
+static int J9THREAD_PROC
+finishProc(void *arg)
+{
+	ThreadCacheTestData *data = (ThreadCacheTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	data->finished += 1;
+	omrthread_monitor_notify_all(data->monitor);
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+#if defined(LINUX)
+static char reusedThreadName[16];
+
+static int J9THREAD_PROC
+recordNameProc(void *arg)
+{
+	prctl(PR_GET_NAME, reusedThreadName);
+	return finishProc(arg);
+}
+#endif /* defined(LINUX) */
+
+class ThreadCacheTest : public ::testing::Test
+{
+protected:
+	ThreadCacheTestData _data;
+
+	virtual void
+	SetUp()
+	{
+		_data.finished = 0;
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&_data.monitor, 0, "ThreadCacheTest"));
+	}
+
+	virtual void
+	TearDown()
+	{
+		omrthread_lib_set_thread_cache(0, 0);
+		omrthread_monitor_destroy(_data.monitor);
+	}
+
+	/* create a thread running proc (finishProc by default) and wait until its entrypoint has returned */
+	omrthread_t
+	runThread(omrthread_attr_t *attr, omrthread_entrypoint_t proc = finishProc)
+	{
+		omrthread_t thread = NULL;
+
+		omrthread_monitor_enter(_data.monitor);
+		uintptr_t expected = _data.finished + 1;
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&thread, attr, 0, proc, &_data));
+		while (_data.finished < expected) {
+			omrthread_monitor_wait(_data.monitor);
+		}
+		omrthread_monitor_exit(_data.monitor);
+		return thread;
+	}
+
+	/* poll the cache counters until at least count threads are parked */
+	static void
+	waitForParked(uintptr_t count, omrthread_thread_cache_stats_t *stats)
+	{
+		for (uintptr_t i = 0; i < THREAD_CACHE_POLL_LIMIT; i++) {
+			omrthread_lib_get_thread_cache_stats(stats);
+			if (stats->parkedThreads >= count) {
+				return;
+			}
+			omrthread_sleep(THREAD_CACHE_POLL_MILLIS);
+		}
+	}
+};
+
+TEST_F(ThreadCacheTest, disabledByDefault)
+{
+	omrthread_thread_cache_stats_t stats;
+
+	omrthread_lib_get_thread_cache_stats(&stats);
+	ASSERT_EQ((uintptr_t)0, stats.maxThreads);
+	ASSERT_EQ((uintptr_t)0, stats.parkedThreads);
+}
+
+TEST_F(ThreadCacheTest, reusesParkedThread)
+{
+	omrthread_thread_cache_stats_t stats;
+	omrthread_lib_set_thread_cache(THREAD_CACHE_TEST_SIZE, 0);
+
+	omrthread_t first = runThread(NULL);
+	waitForParked(1, &stats);
+	ASSERT_EQ((uintptr_t)1, stats.parkedThreads);
+	uint64_t hits = stats.hits;
+
+	omrthread_t second = runThread(NULL);
+	ASSERT_EQ(first, second);
+	waitForParked(1, &stats);
+	ASSERT_EQ(hits + 1, stats.hits);
+	ASSERT_EQ((uintptr_t)1, stats.parkedThreads);
+}
+
+TEST_F(ThreadCacheTest, incompatibleAttributesMiss)
+{
+	omrthread_thread_cache_stats_t stats;
+	omrthread_attr_t attr = NULL;
+	omrthread_lib_set_thread_cache(THREAD_CACHE_TEST_SIZE, 0);
+
+	omrthread_t first = runThread(NULL);
+	waitForParked(1, &stats);
+	ASSERT_EQ((uintptr_t)1, stats.parkedThreads);
+	uint64_t misses = stats.misses;
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_stacksize(&attr, THREAD_CACHE_OTHER_STACK_SIZE));
+	omrthread_t second = runThread(&attr);
+	ASSERT_NE(first, second);
+	waitForParked(2, &stats);
+	ASSERT_EQ(misses + 1, stats.misses);
+	ASSERT_EQ((uintptr_t)2, stats.parkedThreads);
+
+	/* joinable threads are never parked */
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	omrthread_t third = runThread(&attr);
+	ASSERT_NE(first, third);
+	ASSERT_NE(second, third);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(third));
+	omrthread_lib_get_thread_cache_stats(&stats);
+	ASSERT_EQ((uintptr_t)2, stats.parkedThreads);
+	omrthread_attr_destroy(&attr);
+
+	/* shrinking the cache releases the excess */
+	omrthread_lib_set_thread_cache(1, 0);
+	omrthread_lib_get_thread_cache_stats(&stats);
+	ASSERT_EQ((uintptr_t)1, stats.parkedThreads);
+}
+
+TEST_F(ThreadCacheTest, idleThreadsExpire)
+{
+	omrthread_thread_cache_stats_t stats;
+	omrthread_lib_set_thread_cache(THREAD_CACHE_TEST_SIZE, THREAD_CACHE_POLL_MILLIS);
+
+	omrthread_lib_get_thread_cache_stats(&stats);
+	uint64_t parks = stats.parks;
+	uint64_t expired = stats.expired;
+	runThread(NULL);
+	for (uintptr_t i = 0; i < THREAD_CACHE_POLL_LIMIT; i++) {
+		omrthread_lib_get_thread_cache_stats(&stats);
+		if (expired != stats.expired) {
+			break;
+		}
+		omrthread_sleep(THREAD_CACHE_POLL_MILLIS);
+	}
+	ASSERT_EQ((uintptr_t)0, stats.parkedThreads);
+	ASSERT_EQ(parks + 1, stats.parks);
+	ASSERT_EQ(expired + 1, stats.expired);
+}
+
+/* with a 1ms idle timeout, creators regularly take threads that are timing out */
+TEST_F(ThreadCacheTest, reuseRacesIdleTimeout)
+{
+	omrthread_thread_cache_stats_t before;
+	omrthread_thread_cache_stats_t stats;
+	omrthread_lib_set_thread_cache(THREAD_CACHE_TEST_SIZE, 1);
+
+	omrthread_lib_get_thread_cache_stats(&before);
+	for (uintptr_t i = 0; i < THREAD_CACHE_BENCHMARK_CYCLES; i++) {
+		runThread(NULL);
+		if (0 == (i % 16)) {
+			omrthread_sleep(1);
+		}
+	}
+	omrthread_lib_get_thread_cache_stats(&stats);
+	/* every park ended in a reuse or an expiry, or is still parked */
+	ASSERT_EQ(stats.parks - before.parks,
+		(stats.hits - before.hits) + (stats.expired - before.expired) + (stats.parkedThreads - before.parkedThreads));
+}
+
+#if defined(LINUX)
+TEST_F(ThreadCacheTest, reusedThreadTakesAttrName)
+{
+	omrthread_thread_cache_stats_t stats;
+	omrthread_attr_t attr = NULL;
+	omrthread_lib_set_thread_cache(THREAD_CACHE_TEST_SIZE, 0);
+
+	runThread(NULL);
+	waitForParked(1, &stats);
+	ASSERT_LE((uintptr_t)1, stats.parkedThreads);
+	uint64_t hits = stats.hits;
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	omrthread_attr_set_name(&attr, "cachedWorker");
+	runThread(&attr, recordNameProc);
+	omrthread_attr_destroy(&attr);
+	omrthread_lib_get_thread_cache_stats(&stats);
+	ASSERT_EQ(hits + 1, stats.hits);
+	ASSERT_STREQ("cachedWorker", reusedThreadName);
+}
+
+TEST_F(ThreadCacheTest, reusedThreadWithoutNameTakesCreatorName)
+{
+	omrthread_thread_cache_stats_t stats;
+	omrthread_attr_t attr = NULL;
+	char creatorName[16];
+	omrthread_lib_set_thread_cache(THREAD_CACHE_TEST_SIZE, 0);
+	prctl(PR_GET_NAME, creatorName);
+
+	/* park a thread which has been renamed by a reuse */
+	runThread(NULL);
+	waitForParked(1, &stats);
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	omrthread_attr_set_name(&attr, "cachedWorker");
+	runThread(&attr);
+	omrthread_attr_destroy(&attr);
+	waitForParked(1, &stats);
+	ASSERT_LE((uintptr_t)1, stats.parkedThreads);
+	uint64_t hits = stats.hits;
+
+	/* a new thread would inherit the name of the thread creating it */
+	runThread(NULL, recordNameProc);
+	omrthread_lib_get_thread_cache_stats(&stats);
+	ASSERT_EQ(hits + 1, stats.hits);
+	ASSERT_STREQ(creatorName, reusedThreadName);
+}
+#endif /* defined(LINUX) */
+
+TEST_F(ThreadCacheTest, createLatencyBenchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_thread_cache_stats_t stats;
+	uint64_t elapsed[2];
+
+	for (uintptr_t cached = 0; cached < 2; cached++) {
+		omrthread_lib_set_thread_cache(cached ? THREAD_CACHE_TEST_SIZE : 0, 0);
+		if (cached) {
+			/* warm the cache so every timed creation can hit */
+			runThread(NULL);
+			waitForParked(1, &stats);
+		}
+		uint64_t start = omrtime_nano_time();
+		for (uintptr_t i = 0; i < THREAD_CACHE_BENCHMARK_CYCLES; i++) {
+			runThread(NULL);
+		}
+		elapsed[cached] = omrtime_nano_time() - start;
+	}
+
+	omrthread_lib_get_thread_cache_stats(&stats);
+	omrTestEnv->log("create and run %d threads: %llu ns/thread uncached, %llu ns/thread cached (hits %llu, misses %llu)\n",
+		THREAD_CACHE_BENCHMARK_CYCLES,
+		(unsigned long long)(elapsed[0] / THREAD_CACHE_BENCHMARK_CYCLES),
+		(unsigned long long)(elapsed[1] / THREAD_CACHE_BENCHMARK_CYCLES),
+		(unsigned long long)stats.hits, (unsigned long long)stats.misses);
+	ASSERT_LT((uint64_t)0, stats.hits);
+}
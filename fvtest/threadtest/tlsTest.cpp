@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <set>
+
+#include "AtomicSupport.hpp"
+#include "omrTest.h"
+#include "thread_api.h"
+#include "testHelper.hpp"
+
+/* enough keys to spill past the inline tls[] array into two chunks */
+#define TLS_TEST_KEYS (J9THREAD_MAX_TLS_KEYS + J9THREAD_TLS_CHUNK_SIZE + 10)
+#define TLS_TEST_THREADS 4
+#define TLS_TEST_KEYS_PER_THREAD 100
+
+typedef struct TlsTestData {
+	omrthread_tls_key_t key;
+	volatile uintptr_t finalized;
+	volatile uintptr_t done;
+	omrthread_tls_key_t keys[TLS_TEST_THREADS][TLS_TEST_KEYS_PER_THREAD];
+	volatile uintptr_t failures;
+} TlsTestData;
+
+static TlsTestData *finalizerData = NULL;
+
+static void J9THREAD_PROC
+countingFinalizer(void *value)
+{
+	VM_AtomicSupport::add(&finalizerData->finalized, (uintptr_t)value);
+}
+
+static int J9THREAD_PROC
+setExtendedKeyProc(void *arg)
+{
+	TlsTestData *data = (TlsTestData *)arg;
+	if (0 != omrthread_tls_set(omrthread_self(), data->key, (void *)(uintptr_t)3)) {
+		VM_AtomicSupport::add(&data->failures, 1);
+	}
+	return 0;
+}
+
+static int J9THREAD_PROC
+allocKeysProc(void *arg)
+{
+	TlsTestData *data = (TlsTestData *)arg;
+	uintptr_t slot = VM_AtomicSupport::add(&data->done, 1) - 1;
+	for (uintptr_t i = 0; i < TLS_TEST_KEYS_PER_THREAD; i++) {
+		if (0 != omrthread_tls_alloc(&data->keys[slot][i])) {
+			VM_AtomicSupport::add(&data->failures, 1);
+		}
+	}
+	VM_AtomicSupport::add(&data->finalized, 1);
+	return 0;
+}
+
+TEST(TlsTest, extendedKeys)
+{
+	omrthread_t self = omrthread_self();
+	omrthread_tls_key_t keys[TLS_TEST_KEYS];
+
+	ASSERT_TRUE(self == J9THREAD_SELF());
+	for (uintptr_t i = 0; i < TLS_TEST_KEYS; i++) {
+		ASSERT_EQ(0, omrthread_tls_alloc(&keys[i])) << "key " << i;
+		ASSERT_TRUE(NULL == omrthread_tls_get(self, keys[i]));
+		ASSERT_EQ(0, omrthread_tls_set(self, keys[i], (void *)(i + 1)));
+	}
+	ASSERT_LT((omrthread_tls_key_t)J9THREAD_MAX_TLS_KEYS, keys[TLS_TEST_KEYS - 1]);
+	for (uintptr_t i = 0; i < TLS_TEST_KEYS; i++) {
+		ASSERT_EQ((void *)(i + 1), omrthread_tls_get(self, keys[i])) << "key " << keys[i];
+		ASSERT_EQ((void *)(i + 1), J9THREAD_TLS_GET(self, keys[i])) << "key " << keys[i];
+	}
+	for (uintptr_t i = 0; i < TLS_TEST_KEYS; i++) {
+		ASSERT_EQ(0, omrthread_tls_free(keys[i]));
+		ASSERT_TRUE(NULL == omrthread_tls_get(self, keys[i]));
+	}
+}
+
+TEST(TlsTest, finalizerRunsForExtendedKey)
+{
+	TlsTestData data = {0, 0, 0, {{0}}, 0};
+	omrthread_tls_key_t fillers[J9THREAD_MAX_TLS_KEYS];
+	uintptr_t fillerCount = 0;
+	omrthread_t thread = NULL;
+
+	finalizerData = &data;
+	/* use up the inline keys so that the key under test lives in a chunk */
+	do {
+		ASSERT_EQ(0, omrthread_tls_alloc(&fillers[fillerCount]));
+		fillerCount += 1;
+	} while (fillers[fillerCount - 1] < J9THREAD_MAX_TLS_KEYS);
+	ASSERT_EQ(0, omrthread_tls_alloc_with_finalizer(&data.key, countingFinalizer));
+	ASSERT_LT((omrthread_tls_key_t)J9THREAD_MAX_TLS_KEYS, data.key);
+
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, FALSE, setExtendedKeyProc, &data));
+	for (uintptr_t i = 0; (i < 10000) && (3 != data.finalized); i++) {
+		omrthread_sleep(1);
+	}
+	ASSERT_EQ((uintptr_t)0, data.failures);
+	ASSERT_EQ((uintptr_t)3, data.finalized);
+
+	ASSERT_EQ(0, omrthread_tls_free(data.key));
+	for (uintptr_t i = 0; i < fillerCount; i++) {
+		ASSERT_EQ(0, omrthread_tls_free(fillers[i]));
+	}
+	finalizerData = NULL;
+}
+
+TEST(TlsTest, concurrentAlloc)
+{
+	TlsTestData *data = (TlsTestData *)calloc(1, sizeof(TlsTestData));
+	std::set<omrthread_tls_key_t> keys;
+
+	ASSERT_TRUE(NULL != data);
+	for (uintptr_t i = 0; i < TLS_TEST_THREADS; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, allocKeysProc, data));
+	}
+	while (TLS_TEST_THREADS != data->finalized) {
+		omrthread_sleep(1);
+	}
+	ASSERT_EQ((uintptr_t)0, data->failures);
+	for (uintptr_t i = 0; i < TLS_TEST_THREADS; i++) {
+		for (uintptr_t j = 0; j < TLS_TEST_KEYS_PER_THREAD; j++) {
+			ASSERT_TRUE(keys.insert(data->keys[i][j]).second) << "key " << data->keys[i][j] << " handed out twice";
+		}
+	}
+	for (std::set<omrthread_tls_key_t>::iterator it = keys.begin(); it != keys.end(); ++it) {
+		ASSERT_EQ(0, omrthread_tls_free(*it));
+	}
+	free(data);
+}
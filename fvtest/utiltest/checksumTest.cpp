@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrTest.h"
+#include "omrutil.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+#define CHECKSUM_FUZZ_BUFFER_SIZE 1100
+
+static uint32_t
+nextRandom(uint32_t *state)
+{
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/* Bit-at-a-time reference for a reflected CRC-32 polynomial */
+static uint32_t
+referenceCrc(uint32_t polynomial, uint32_t crc, const uint8_t *bytes, uintptr_t len)
+{
+	crc = ~crc;
+	while (len-- > 0) {
+		crc ^= *bytes++;
+		for (uintptr_t bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ ((0 != (crc & 1)) ? polynomial : 0);
+		}
+	}
+	return ~crc;
+}
+
+/* Compare the current omrcrc32 and omrcrc32c against the reference over every length and alignment */
+static void
+fuzzChecksums(const uint8_t *buffer)
+{
+	for (uintptr_t offset = 0; offset < 16; offset++) {
+		for (uintptr_t len = 0; len <= (CHECKSUM_FUZZ_BUFFER_SIZE - 16); len += ((len < 300) ? 1 : 37)) {
+			uint8_t *bytes = (uint8_t *)buffer + offset;
+			uint32_t seed = (uint32_t)(len * 0x9E3779B1);
+
+			ASSERT_EQ(referenceCrc(0xEDB88320, seed, bytes, len), omrcrc32(seed, bytes, (U_32)len))
+				<< "offset " << offset << " length " << len;
+			ASSERT_EQ(referenceCrc(0x82F63B78, seed, bytes, len), omrcrc32c(seed, bytes, (U_32)len))
+				<< "offset " << offset << " length " << len;
+		}
+	}
+}
+
+TEST(ChecksumTest, crcKnownValues)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uint8_t check[] = "123456789";
+
+	for (uintptr_t accelerated = 0; accelerated < 2; accelerated++) {
+		omrcrc32SelectImplementation((0 != accelerated) ? OMRPORTLIB : NULL);
+		ASSERT_EQ((U_32)0xCBF43926, omrcrc32(0, check, 9));
+		ASSERT_EQ((U_32)0xE3069283, omrcrc32c(0, check, 9));
+		/* a checksum can be continued across calls */
+		ASSERT_EQ((U_32)0xCBF43926, omrcrc32(omrcrc32(0, check, 4), check + 4, 5));
+		ASSERT_EQ((U_32)0xE3069283, omrcrc32c(omrcrc32c(0, check, 4), check + 4, 5));
+		ASSERT_EQ((U_32)0, omrcrc32(0, NULL, 9));
+	}
+}
+
+TEST(ChecksumTest, crcFuzz)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uint8_t buffer[CHECKSUM_FUZZ_BUFFER_SIZE];
+	uint32_t state = 0x2545F491;
+
+	for (uintptr_t i = 0; i < sizeof(buffer); i++) {
+		buffer[i] = (uint8_t)nextRandom(&state);
+	}
+	omrcrc32SelectImplementation(NULL);
+	fuzzChecksums(buffer);
+	omrcrc32SelectImplementation(OMRPORTLIB);
+	fuzzChecksums(buffer);
+}
+
+TEST(ChecksumTest, hash64KnownValues)
+{
+	const char *spam = "Nobody inspects the spammish repetition";
+	uint8_t buffer[100];
+	uint8_t shifted[116];
+
+	for (uintptr_t i = 0; i < sizeof(buffer); i++) {
+		buffer[i] = (uint8_t)i;
+	}
+	ASSERT_EQ(J9CONST_U64(0xEF46DB3751D8E999), omrhash64("", 0, 0));
+	ASSERT_EQ(J9CONST_U64(0x44BC2CF5AD770999), omrhash64("abc", 3, 0));
+	ASSERT_EQ(J9CONST_U64(0xFBCEA83C8A378BF1), omrhash64(spam, strlen(spam), 0));
+	ASSERT_EQ(J9CONST_U64(0x3B97D91EBA03E785), omrhash64(buffer, sizeof(buffer), J9CONST_U64(0x9E3779B97F4A7C15)));
+
+	/* the hash does not depend on alignment */
+	for (uintptr_t offset = 1; offset < 16; offset++) {
+		memcpy(shifted + offset, buffer, sizeof(buffer));
+		ASSERT_EQ(omrhash64(buffer, sizeof(buffer), 7), omrhash64(shifted + offset, sizeof(buffer), 7));
+	}
+}
+
+/**
+ * Report throughput of the original byte-at-a-time CRC, the portable and
+ * accelerated CRC-32 and CRC-32C paths, and omrhash64.
+ */
+TEST(ChecksumTest, throughputBenchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	const uintptr_t size = 256 * 1024;
+	const uintptr_t iterations = 64;
+	uint8_t *buffer = (uint8_t *)omrmem_allocate_memory(size, OMRMEM_CATEGORY_UNKNOWN);
+	uint32_t state = 0x9E3779B9;
+	uint64_t sink = 0;
+
+	ASSERT_TRUE(NULL != buffer);
+	for (uintptr_t i = 0; i < size; i++) {
+		buffer[i] = (uint8_t)nextRandom(&state);
+	}
+
+	for (uintptr_t kind = 0; kind < 6; kind++) {
+		static const char * const names[] = {
+			"crc32 byte table", "crc32 slicing-by-8", "crc32 selected", "crc32c slicing-by-8", "crc32c selected", "hash64"
+		};
+		uint64_t start = 0;
+		uint64_t elapsed = 0;
+
+		omrcrc32SelectImplementation(((2 == kind) || (4 == kind)) ? OMRPORTLIB : NULL);
+		start = omrtime_nano_time();
+		for (uintptr_t i = 0; i < iterations; i++) {
+			switch (kind) {
+			case 0:
+				/* omrcrcSparse32 with a step of one is the original byte-at-a-time loop */
+				sink += omrcrcSparse32((U_32)i, buffer, (U_32)size, 1);
+				break;
+			case 1:
+			case 2:
+				sink += omrcrc32((U_32)i, buffer, (U_32)size);
+				break;
+			case 3:
+			case 4:
+				sink += omrcrc32c((U_32)i, buffer, (U_32)size);
+				break;
+			default:
+				sink += omrhash64(buffer, size, i);
+				break;
+			}
+		}
+		elapsed = omrtime_nano_time() - start;
+		if (0 == elapsed) {
+			elapsed = 1;
+		}
+		omrTestEnv->log("%-20s %6llu MB/s\n", names[kind],
+			(unsigned long long)(((uint64_t)size * iterations * 1000) / elapsed));
+	}
+	ASSERT_NE((uint64_t)0, sink);
+
+	omrcrc32SelectImplementation(OMRPORTLIB);
+	omrmem_free_memory(buffer);
+}
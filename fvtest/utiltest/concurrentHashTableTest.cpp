@@ -0,0 +1,347 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "hashtable_api.h"
+#include "omrthread.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+typedef struct TestEntry {
+	uintptr_t key;
+	uintptr_t value;
+} TestEntry;
+
+/* Deliberately weak, so the table has to spread keys itself */
+static uintptr_t
+testHash(void *entry, void *userData)
+{
+	return ((TestEntry *)entry)->key;
+}
+
+static uintptr_t
+testEqual(void *left, void *right, void *userData)
+{
+	return ((TestEntry *)left)->key == ((TestEntry *)right)->key;
+}
+
+static uintptr_t
+countEntry(void *entry, void *userData)
+{
+	TestEntry *testEntry = (TestEntry *)entry;
+	uintptr_t *counts = (uintptr_t *)userData;
+
+	counts[0] += 1;
+	if (testEntry->value != (testEntry->key * 3)) {
+		counts[1] += 1;
+	}
+	return FALSE;
+}
+
+static uint32_t
+nextRandom(uint32_t *state)
+{
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+TEST(ConcurrentHashTableTest, addFindRemove)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	const uintptr_t count = 100000;
+	J9ConcurrentHashTable *table = concurrentHashTableNew(OMRPORTLIB, "test", 0, sizeof(TestEntry), 0, OMRMEM_CATEGORY_UNKNOWN, testHash, testEqual, NULL);
+	uintptr_t counts[2] = {0, 0};
+	TestEntry entry;
+	uintptr_t i = 0;
+
+	ASSERT_TRUE(NULL != table);
+	for (i = 0; i < count; i++) {
+		entry.key = i;
+		entry.value = i * 3;
+		TestEntry *added = (TestEntry *)concurrentHashTableAdd(table, &entry);
+		ASSERT_TRUE(NULL != added);
+		ASSERT_EQ(i, added->key);
+	}
+	ASSERT_EQ(count, concurrentHashTableGetCount(table));
+
+	/* adding an equal entry returns the existing one */
+	entry.key = 7;
+	entry.value = 0;
+	ASSERT_EQ((uintptr_t)21, ((TestEntry *)concurrentHashTableAdd(table, &entry))->value);
+	ASSERT_EQ(count, concurrentHashTableGetCount(table));
+
+	for (i = 0; i < count; i += 2) {
+		entry.key = i;
+		ASSERT_EQ((uint32_t)0, concurrentHashTableRemove(table, &entry));
+	}
+	entry.key = 0;
+	ASSERT_EQ((uint32_t)1, concurrentHashTableRemove(table, &entry));
+	ASSERT_EQ(count / 2, concurrentHashTableGetCount(table));
+
+	for (i = 0; i < count; i++) {
+		entry.key = i;
+		TestEntry *found = (TestEntry *)concurrentHashTableFind(table, &entry);
+		if (0 == (i % 2)) {
+			ASSERT_TRUE(NULL == found) << "removed key " << i << " was found";
+		} else {
+			ASSERT_TRUE(NULL != found) << "key " << i << " was not found";
+			ASSERT_EQ(i * 3, found->value);
+		}
+	}
+
+	concurrentHashTableForEachDo(table, countEntry, counts);
+	ASSERT_EQ(count / 2, counts[0]);
+	ASSERT_EQ((uintptr_t)0, counts[1]);
+
+	concurrentHashTableFree(table);
+}
+
+typedef struct ConcurrentTestData {
+	J9ConcurrentHashTable *table;
+	J9HashTable *lockedTable;
+	omrthread_monitor_t lock;
+	uintptr_t thread;
+	uintptr_t threadCount;
+	uintptr_t keysPerThread;
+	uintptr_t operations;
+	uintptr_t writePercent;
+	uintptr_t errors;
+	omrthread_monitor_t doneMonitor;
+	volatile uintptr_t *running;
+} ConcurrentTestData;
+
+static void
+finishThread(ConcurrentTestData *data)
+{
+	omrthread_monitor_enter(data->doneMonitor);
+	*data->running -= 1;
+	omrthread_monitor_notify_all(data->doneMonitor);
+	omrthread_monitor_exit(data->doneMonitor);
+}
+
+/*
+ * Each thread adds its own keys, removes the even ones, and checks every key of the other threads it finds meanwhile.
+ */
+static int J9THREAD_PROC
+addRemoveThread(void *arg)
+{
+	ConcurrentTestData *data = (ConcurrentTestData *)arg;
+	uintptr_t first = data->thread * data->keysPerThread;
+	uint32_t random = (uint32_t)data->thread + 1;
+	TestEntry entry;
+	uintptr_t i = 0;
+
+	for (i = first; i < (first + data->keysPerThread); i++) {
+		entry.key = i;
+		entry.value = i * 3;
+		if (NULL == concurrentHashTableAdd(data->table, &entry)) {
+			data->errors += 1;
+		}
+		entry.key = nextRandom(&random) % (data->threadCount * data->keysPerThread);
+		uintptr_t token = concurrentHashTableEnterReader(data->table);
+		TestEntry *found = (TestEntry *)concurrentHashTableFind(data->table, &entry);
+		if ((NULL != found) && (found->value != (entry.key * 3))) {
+			data->errors += 1;
+		}
+		concurrentHashTableExitReader(data->table, token);
+	}
+	for (i = first; i < (first + data->keysPerThread); i += 2) {
+		entry.key = i;
+		if (0 != concurrentHashTableRemove(data->table, &entry)) {
+			data->errors += 1;
+		}
+		entry.key = i + 1;
+		if (NULL == concurrentHashTableFind(data->table, &entry)) {
+			data->errors += 1;
+		}
+	}
+	finishThread(data);
+	return 0;
+}
+
+static void
+runThreads(ConcurrentTestData *data, uintptr_t threadCount, omrthread_entrypoint_t entry)
+{
+	volatile uintptr_t running = threadCount;
+	omrthread_monitor_t doneMonitor = NULL;
+	uintptr_t i = 0;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&doneMonitor, 0, "concurrentHashTableTest"));
+	for (i = 0; i < threadCount; i++) {
+		data[i].thread = i;
+		data[i].threadCount = threadCount;
+		data[i].doneMonitor = doneMonitor;
+		data[i].running = &running;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, entry, &data[i]));
+	}
+	omrthread_monitor_enter(doneMonitor);
+	while (0 != running) {
+		omrthread_monitor_wait(doneMonitor);
+	}
+	omrthread_monitor_exit(doneMonitor);
+	omrthread_monitor_destroy(doneMonitor);
+}
+
+TEST(ConcurrentHashTableTest, concurrentAddRemove)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	const uintptr_t threadCount = 4;
+	const uintptr_t keysPerThread = 50000;
+	ConcurrentTestData data[threadCount];
+	uintptr_t counts[2] = {0, 0};
+	uintptr_t i = 0;
+
+	memset(data, 0, sizeof(data));
+	data[0].table = concurrentHashTableNew(OMRPORTLIB, "test", 0, sizeof(TestEntry), 0, OMRMEM_CATEGORY_UNKNOWN, testHash, testEqual, NULL);
+	ASSERT_TRUE(NULL != data[0].table);
+	for (i = 0; i < threadCount; i++) {
+		data[i].table = data[0].table;
+		data[i].keysPerThread = keysPerThread;
+	}
+
+	runThreads(data, threadCount, addRemoveThread);
+
+	for (i = 0; i < threadCount; i++) {
+		ASSERT_EQ((uintptr_t)0, data[i].errors) << "thread " << i;
+	}
+	ASSERT_EQ(threadCount * keysPerThread / 2, concurrentHashTableGetCount(data[0].table));
+	concurrentHashTableForEachDo(data[0].table, countEntry, counts);
+	ASSERT_EQ(threadCount * keysPerThread / 2, counts[0]);
+	ASSERT_EQ((uintptr_t)0, counts[1]);
+
+	concurrentHashTableFree(data[0].table);
+}
+
+/*
+ * Find random keys, and with writePercent probability remove and re-add one instead.
+ * With a lockedTable the J9HashTable is used under a monitor, as its users do today.
+ */
+static int J9THREAD_PROC
+benchmarkThread(void *arg)
+{
+	ConcurrentTestData *data = (ConcurrentTestData *)arg;
+	uintptr_t keyCount = data->keysPerThread;
+	uint32_t random = (uint32_t)data->thread * 7919 + 1;
+	TestEntry entry;
+	uintptr_t i = 0;
+
+	for (i = 0; i < data->operations; i++) {
+		uint32_t r = nextRandom(&random);
+		entry.key = r % keyCount;
+		entry.value = entry.key * 3;
+		if ((r >> 25) < ((128 * data->writePercent) / 100)) {
+			if (NULL != data->lockedTable) {
+				omrthread_monitor_enter(data->lock);
+				hashTableRemove(data->lockedTable, &entry);
+				hashTableAdd(data->lockedTable, &entry);
+				omrthread_monitor_exit(data->lock);
+			} else {
+				concurrentHashTableRemove(data->table, &entry);
+				concurrentHashTableAdd(data->table, &entry);
+			}
+		} else if (NULL != data->lockedTable) {
+			omrthread_monitor_enter(data->lock);
+			TestEntry *found = (TestEntry *)hashTableFind(data->lockedTable, &entry);
+			if ((NULL != found) && (found->value != (entry.key * 3))) {
+				data->errors += 1;
+			}
+			omrthread_monitor_exit(data->lock);
+		} else {
+			uintptr_t token = concurrentHashTableEnterReader(data->table);
+			TestEntry *found = (TestEntry *)concurrentHashTableFind(data->table, &entry);
+			if ((NULL != found) && (found->value != (entry.key * 3))) {
+				data->errors += 1;
+			}
+			concurrentHashTableExitReader(data->table, token);
+		}
+	}
+	finishThread(data);
+	return 0;
+}
+
+/**
+ * Compare the throughput of the concurrent table with a J9HashTable guarded by a monitor,
+ * for lookups only and for a mix with 10% writes, at increasing thread counts.
+ */
+TEST(ConcurrentHashTableTest, scalingBenchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	const uintptr_t keyCount = 1 << 16;
+	const uintptr_t operations = 400000;
+	const uintptr_t threadCounts[] = {1, 2, 4, 8};
+	const uintptr_t writePercents[] = {0, 10};
+	ConcurrentTestData data[8];
+	J9ConcurrentHashTable *table = concurrentHashTableNew(OMRPORTLIB, "benchmark", 0, sizeof(TestEntry), 0, OMRMEM_CATEGORY_UNKNOWN, testHash, testEqual, NULL);
+	J9HashTable *lockedTable = hashTableNew(OMRPORTLIB, "benchmark", 0, sizeof(TestEntry), 0, 0, OMRMEM_CATEGORY_UNKNOWN, testHash, testEqual, NULL, NULL);
+	omrthread_monitor_t lock = NULL;
+	TestEntry entry;
+	uintptr_t i = 0;
+
+	ASSERT_TRUE(NULL != table);
+	ASSERT_TRUE(NULL != lockedTable);
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&lock, 0, "concurrentHashTableTest lock"));
+	for (i = 0; i < keyCount; i++) {
+		entry.key = i;
+		entry.value = i * 3;
+		concurrentHashTableAdd(table, &entry);
+		hashTableAdd(lockedTable, &entry);
+	}
+
+	for (uintptr_t w = 0; w < (sizeof(writePercents) / sizeof(writePercents[0])); w++) {
+		for (uintptr_t t = 0; t < (sizeof(threadCounts) / sizeof(threadCounts[0])); t++) {
+			uint64_t elapsed[2] = {0, 0};
+
+			for (uintptr_t locked = 0; locked < 2; locked++) {
+				uint64_t start = 0;
+
+				memset(data, 0, sizeof(data));
+				for (i = 0; i < threadCounts[t]; i++) {
+					data[i].table = table;
+					data[i].lockedTable = (0 != locked) ? lockedTable : NULL;
+					data[i].lock = lock;
+					data[i].keysPerThread = keyCount;
+					data[i].operations = operations / threadCounts[t];
+					data[i].writePercent = writePercents[w];
+				}
+				start = omrtime_nano_time();
+				runThreads(data, threadCounts[t], benchmarkThread);
+				elapsed[locked] = omrtime_nano_time() - start;
+				for (i = 0; i < threadCounts[t]; i++) {
+					ASSERT_EQ((uintptr_t)0, data[i].errors);
+				}
+			}
+			omrTestEnv->log("%2zu%% writes, %zu threads: concurrent %llu ns/op, monitor-locked %llu ns/op\n",
+				writePercents[w], threadCounts[t],
+				(unsigned long long)(elapsed[0] / operations), (unsigned long long)(elapsed[1] / operations));
+		}
+	}
+	ASSERT_EQ(keyCount, concurrentHashTableGetCount(table));
+
+	omrthread_monitor_destroy(lock);
+	hashTableFree(lockedTable);
+	concurrentHashTableFree(table);
+}
@@ -0,0 +1,338 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "countminsketch.h"
+#include "omrthread.h"
+#include "spacesaving.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+#define SKETCH_TEST_KEYS 2000
+#define SKETCH_TEST_SHARDS 4
+
+#define SKETCH_TEST_KEY(i) ((void *)(((uintptr_t)(i) + 1) * 8))
+
+typedef struct ShardUpdateData {
+	OMRSpaceSaving *shard;
+	OMRCountMinSketch *sketch;
+	const uint32_t *stream;
+	uintptr_t length;
+	omrthread_monitor_t doneMonitor;
+	volatile uintptr_t *running;
+} ShardUpdateData;
+
+static uint32_t
+nextRandom(uint32_t *state)
+{
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/* A skewed stream: key i occurs about 20000 / (i + 1) times, in random order. */
+static uint32_t *
+buildStream(OMRPortLibrary *portLibrary, uintptr_t *trueCounts, uintptr_t *length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t total = 0;
+	uint32_t *stream = NULL;
+	uint32_t state = 12345;
+	uintptr_t i = 0;
+	uintptr_t next = 0;
+
+	for (i = 0; i < SKETCH_TEST_KEYS; i++) {
+		trueCounts[i] = (20000 / (i + 1)) + 1;
+		total += trueCounts[i];
+	}
+	stream = (uint32_t *)omrmem_allocate_memory(total * sizeof(uint32_t), OMRMEM_CATEGORY_UNKNOWN);
+	if (NULL != stream) {
+		for (i = 0; i < SKETCH_TEST_KEYS; i++) {
+			uintptr_t j = 0;
+
+			for (j = 0; j < trueCounts[i]; j++) {
+				stream[next++] = (uint32_t)i;
+			}
+		}
+		for (i = total - 1; i > 0; i--) {
+			uintptr_t j = nextRandom(&state) % (i + 1);
+			uint32_t swap = stream[i];
+
+			stream[i] = stream[j];
+			stream[j] = swap;
+		}
+	}
+	*length = total;
+	return stream;
+}
+
+static int J9THREAD_PROC
+updateShard(void *arg)
+{
+	ShardUpdateData *data = (ShardUpdateData *)arg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < data->length; i++) {
+		spaceSavingUpdate(data->shard, SKETCH_TEST_KEY(data->stream[i]), 1);
+		countMinSketchUpdate(data->sketch, SKETCH_TEST_KEY(data->stream[i]), 1);
+	}
+
+	omrthread_monitor_enter(data->doneMonitor);
+	*data->running -= 1;
+	omrthread_monitor_notify_all(data->doneMonitor);
+	omrthread_monitor_exit(data->doneMonitor);
+	return 0;
+}
+
+/* Check the Space-Saving guarantees of a structure against the true counts */
+static void
+checkSpaceSavingBounds(OMRSpaceSaving *spaceSaving, const uintptr_t *trueCounts, uintptr_t total, uintptr_t size)
+{
+	uintptr_t bound = spaceSavingGetErrorBound(spaceSaving);
+	uint8_t listed[SKETCH_TEST_KEYS];
+	uintptr_t k = 0;
+	uintptr_t i = 0;
+
+	ASSERT_LE(bound, total / size);
+	memset(listed, 0, sizeof(listed));
+	for (k = 1; k <= spaceSavingGetCurSize(spaceSaving); k++) {
+		uintptr_t key = ((uintptr_t)spaceSavingGetKthMostFreq(spaceSaving, k) / 8) - 1;
+		uintptr_t count = spaceSavingGetKthMostFreqCount(spaceSaving, k);
+
+		ASSERT_LT(key, (uintptr_t)SKETCH_TEST_KEYS);
+		ASSERT_GE(count, trueCounts[key]) << "key " << key;
+		ASSERT_LE(count, trueCounts[key] + bound) << "key " << key;
+		listed[key] = 1;
+	}
+	for (i = 0; i < SKETCH_TEST_KEYS; i++) {
+		if (!listed[i]) {
+			ASSERT_LE(trueCounts[i], bound) << "key " << i << " is missing";
+		}
+	}
+}
+
+TEST(SpaceSavingTest, singleThreadBounds)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uintptr_t trueCounts[SKETCH_TEST_KEYS];
+	uintptr_t length = 0;
+	uint32_t *stream = buildStream(OMRPORTLIB, trueCounts, &length);
+	OMRSpaceSaving *spaceSaving = spaceSavingNew(OMRPORTLIB, 64);
+	uintptr_t i = 0;
+
+	ASSERT_TRUE(NULL != stream);
+	ASSERT_TRUE(NULL != spaceSaving);
+	for (i = 0; i < length; i++) {
+		spaceSavingUpdate(spaceSaving, SKETCH_TEST_KEY(stream[i]), 1);
+	}
+	checkSpaceSavingBounds(spaceSaving, trueCounts, length, 64);
+	/* the heaviest key is far above the error bound, so it must rank first */
+	ASSERT_EQ(SKETCH_TEST_KEY(0), spaceSavingGetKthMostFreq(spaceSaving, 1));
+
+	spaceSavingFree(spaceSaving);
+	omrmem_free_memory(stream);
+}
+
+TEST(SpaceSavingTest, mergeEmptyAndPartial)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	OMRSpaceSaving *left = spaceSavingNew(OMRPORTLIB, 4);
+	OMRSpaceSaving *right = spaceSavingNew(OMRPORTLIB, 4);
+	uintptr_t count = 0;
+
+	ASSERT_TRUE(NULL != left);
+	ASSERT_TRUE(NULL != right);
+
+	/* neither side is full, so counts stay exact */
+	spaceSavingUpdate(left, SKETCH_TEST_KEY(1), 5);
+	spaceSavingUpdate(left, SKETCH_TEST_KEY(2), 3);
+	spaceSavingUpdate(right, SKETCH_TEST_KEY(2), 4);
+	spaceSavingUpdate(right, SKETCH_TEST_KEY(3), 1);
+	ASSERT_TRUE(spaceSavingMerge(left, right));
+	ASSERT_EQ((uintptr_t)3, spaceSavingGetCurSize(left));
+	ASSERT_EQ((uintptr_t)0, spaceSavingGetErrorBound(left));
+	ASSERT_EQ(SKETCH_TEST_KEY(2), spaceSavingGetKthMostFreq(left, 1));
+	ASSERT_EQ((uintptr_t)7, spaceSavingGetKthMostFreqCount(left, 1));
+	ASSERT_TRUE(rankingFindEntry(left->ranking, SKETCH_TEST_KEY(3), &count));
+	ASSERT_EQ((uintptr_t)1, count);
+
+	/* merging an empty structure changes nothing */
+	spaceSavingClear(right);
+	ASSERT_TRUE(spaceSavingMerge(left, right));
+	ASSERT_EQ((uintptr_t)3, spaceSavingGetCurSize(left));
+
+	spaceSavingFree(right);
+	spaceSavingFree(left);
+}
+
+TEST(SpaceSavingTest, errorBoundTracksEvictionsAndMerges)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	OMRSpaceSaving *small = spaceSavingNew(OMRPORTLIB, 2);
+	OMRSpaceSaving *large = spaceSavingNew(OMRPORTLIB, 8);
+	OMRSpaceSaving *other = spaceSavingNew(OMRPORTLIB, 2);
+
+	ASSERT_TRUE(NULL != small);
+	ASSERT_TRUE(NULL != large);
+	ASSERT_TRUE(NULL != other);
+
+	/* a full structure that has not evicted anything is still exact */
+	spaceSavingUpdate(small, SKETCH_TEST_KEY(1), 5);
+	spaceSavingUpdate(small, SKETCH_TEST_KEY(2), 3);
+	ASSERT_EQ((uintptr_t)0, spaceSavingGetErrorBound(small));
+
+	/* key 3 evicts key 2 and inherits its count */
+	spaceSavingUpdate(small, SKETCH_TEST_KEY(3), 1);
+	ASSERT_EQ((uintptr_t)3, spaceSavingGetErrorBound(small));
+	ASSERT_EQ((uintptr_t)4, spaceSavingGetKthMostFreqCount(small, 2));
+
+	/* the merged structure is not full, but key 2 is still missing with a true count of 3 */
+	ASSERT_TRUE(spaceSavingMerge(large, small));
+	ASSERT_EQ((uintptr_t)2, spaceSavingGetCurSize(large));
+	ASSERT_EQ((uintptr_t)3, spaceSavingGetErrorBound(large));
+
+	/* bounds add up on merge */
+	spaceSavingUpdate(other, SKETCH_TEST_KEY(4), 2);
+	spaceSavingUpdate(other, SKETCH_TEST_KEY(5), 2);
+	spaceSavingUpdate(other, SKETCH_TEST_KEY(6), 1);
+	ASSERT_EQ((uintptr_t)2, spaceSavingGetErrorBound(other));
+	ASSERT_TRUE(spaceSavingMerge(large, other));
+	ASSERT_EQ((uintptr_t)5, spaceSavingGetErrorBound(large));
+
+	/* candidates that do not fit are evicted, so the bound covers the smallest count kept */
+	spaceSavingClear(small);
+	spaceSavingClear(other);
+	ASSERT_EQ((uintptr_t)0, spaceSavingGetErrorBound(small));
+	spaceSavingUpdate(small, SKETCH_TEST_KEY(1), 10);
+	spaceSavingUpdate(small, SKETCH_TEST_KEY(2), 10);
+	spaceSavingUpdate(other, SKETCH_TEST_KEY(3), 5);
+	ASSERT_TRUE(spaceSavingMerge(small, other));
+	ASSERT_EQ((uintptr_t)2, spaceSavingGetCurSize(small));
+	ASSERT_EQ((uintptr_t)10, spaceSavingGetErrorBound(small));
+
+	spaceSavingFree(other);
+	spaceSavingFree(large);
+	spaceSavingFree(small);
+}
+
+TEST(SpaceSavingTest, shardedThreadsMerge)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	const uintptr_t size = 64;
+	uintptr_t trueCounts[SKETCH_TEST_KEYS];
+	uintptr_t length = 0;
+	uint32_t *stream = buildStream(OMRPORTLIB, trueCounts, &length);
+	OMRShardedSpaceSaving *sharded = shardedSpaceSavingNew(OMRPORTLIB, (uint32_t)size, SKETCH_TEST_SHARDS);
+	OMRSpaceSaving *result = spaceSavingNew(OMRPORTLIB, (uint32_t)size);
+	OMRCountMinSketch *sketches[SKETCH_TEST_SHARDS];
+	ShardUpdateData data[SKETCH_TEST_SHARDS];
+	omrthread_monitor_t doneMonitor = NULL;
+	volatile uintptr_t running = SKETCH_TEST_SHARDS;
+	uintptr_t i = 0;
+
+	ASSERT_TRUE(NULL != stream);
+	ASSERT_TRUE(NULL != sharded);
+	ASSERT_TRUE(NULL != result);
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&doneMonitor, 0, "shardedThreadsMerge"));
+
+	/* each thread counts a slice of the stream in its own shard and sketch */
+	for (i = 0; i < SKETCH_TEST_SHARDS; i++) {
+		uintptr_t start = (length * i) / SKETCH_TEST_SHARDS;
+		uintptr_t end = (length * (i + 1)) / SKETCH_TEST_SHARDS;
+
+		sketches[i] = countMinSketchNew(OMRPORTLIB, 1024, 4);
+		ASSERT_TRUE(NULL != sketches[i]);
+		data[i].shard = shardedSpaceSavingGetShard(sharded, i);
+		data[i].sketch = sketches[i];
+		data[i].stream = &stream[start];
+		data[i].length = end - start;
+		data[i].doneMonitor = doneMonitor;
+		data[i].running = &running;
+	}
+	for (i = 0; i < SKETCH_TEST_SHARDS; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create(NULL, 0, J9THREAD_PRIORITY_NORMAL, 0, updateShard, &data[i]));
+	}
+	omrthread_monitor_enter(doneMonitor);
+	while (0 != running) {
+		omrthread_monitor_wait(doneMonitor);
+	}
+	omrthread_monitor_exit(doneMonitor);
+
+	ASSERT_TRUE(shardedSpaceSavingMerge(sharded, result));
+	checkSpaceSavingBounds(result, trueCounts, length, size);
+	ASSERT_EQ(SKETCH_TEST_KEY(0), spaceSavingGetKthMostFreq(result, 1));
+
+	/* merged sketches never undercount, and rarely overcount by more than e / width of the total */
+	for (i = 1; i < SKETCH_TEST_SHARDS; i++) {
+		ASSERT_TRUE(countMinSketchMerge(sketches[0], sketches[i]));
+	}
+	ASSERT_EQ(length, countMinSketchGetTotal(sketches[0]));
+	{
+		uintptr_t slack = (length * 272) / (100 * 1024);
+		uintptr_t overBound = 0;
+
+		for (i = 0; i < SKETCH_TEST_KEYS; i++) {
+			uintptr_t estimate = countMinSketchEstimate(sketches[0], SKETCH_TEST_KEY(i));
+
+			ASSERT_GE(estimate, trueCounts[i]) << "key " << i;
+			if (estimate > (trueCounts[i] + slack)) {
+				overBound += 1;
+			}
+		}
+		/* e^-4 is under 2% */
+		ASSERT_LE(overBound, (uintptr_t)(SKETCH_TEST_KEYS / 50));
+	}
+
+	for (i = 0; i < SKETCH_TEST_SHARDS; i++) {
+		countMinSketchFree(sketches[i]);
+	}
+	omrthread_monitor_destroy(doneMonitor);
+	spaceSavingFree(result);
+	shardedSpaceSavingFree(sharded);
+	omrmem_free_memory(stream);
+}
+
+TEST(SpaceSavingTest, countMinSketchMergeDimensions)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	OMRCountMinSketch *sketch = countMinSketchNew(OMRPORTLIB, 100, 3);
+	OMRCountMinSketch *other = countMinSketchNew(OMRPORTLIB, 128, 4);
+
+	ASSERT_TRUE(NULL != sketch);
+	ASSERT_TRUE(NULL != other);
+	/* width rounds up to a power of two */
+	ASSERT_EQ((uint32_t)128, sketch->width);
+	ASSERT_FALSE(countMinSketchMerge(sketch, other));
+
+	countMinSketchUpdate(sketch, SKETCH_TEST_KEY(1), 10);
+	ASSERT_EQ((uintptr_t)10, countMinSketchEstimate(sketch, SKETCH_TEST_KEY(1)));
+	countMinSketchClear(sketch);
+	ASSERT_EQ((uintptr_t)0, countMinSketchEstimate(sketch, SKETCH_TEST_KEY(1)));
+	ASSERT_EQ((uintptr_t)0, countMinSketchGetTotal(sketch));
+
+	countMinSketchFree(other);
+	countMinSketchFree(sketch);
+}
@@ -0,0 +1,267 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrTest.h"
+#include "omrutil.h"
+#include "testEnvironment.hpp"
+
+extern PortEnvironment *omrTestEnv;
+
+#define UTF8_FUZZ_UNITS 600
+#define UTF8_FUZZ_ITERATIONS 400
+
+static uint32_t
+nextRandom(uint32_t *state)
+{
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/* Fill units with ASCII runs broken up by NULs, two byte and three byte characters */
+static uintptr_t
+randomText(uint32_t *state, uint16_t *units, uintptr_t maximum)
+{
+	uintptr_t length = nextRandom(state) % (maximum + 1);
+
+	for (uintptr_t i = 0; i < length; i++) {
+		uint32_t pick = nextRandom(state) % 64;
+
+		if (pick < 56) {
+			units[i] = (uint16_t)(0x20 + (nextRandom(state) % 0x5F));
+		} else if (pick < 57) {
+			units[i] = 0;
+		} else if (pick < 61) {
+			units[i] = (uint16_t)(0x80 + (nextRandom(state) % 0x780));
+		} else {
+			units[i] = (uint16_t)(0x800 + (nextRandom(state) % 0xF800));
+		}
+	}
+	return length;
+}
+
+/* Per-character reference for decodeUTF8String; NULL output only validates */
+static intptr_t
+referenceDecode(const uint8_t *input, uintptr_t length, uint16_t *output)
+{
+	uintptr_t units = 0;
+
+	while (length > 0) {
+		uint16_t unicode = 0;
+		uint32_t consumed = decodeUTF8CharN(input, &unicode, length);
+
+		if (0 == consumed) {
+			return -1;
+		}
+		if (NULL != output) {
+			output[units] = unicode;
+		}
+		units += 1;
+		input += consumed;
+		length -= consumed;
+	}
+	return (intptr_t)units;
+}
+
+static uintptr_t
+referenceEncode(const uint16_t *input, uintptr_t length, uint8_t *output)
+{
+	uintptr_t written = 0;
+
+	for (uintptr_t i = 0; i < length; i++) {
+		written += encodeUTF8Char(input[i], output + written);
+	}
+	return written;
+}
+
+static void
+fuzzTranscoding(uint32_t seed)
+{
+	uint16_t units[UTF8_FUZZ_UNITS + 8];
+	uint16_t decoded[UTF8_FUZZ_UNITS + 8];
+	uint16_t expected[UTF8_FUZZ_UNITS + 8];
+	uint8_t encoded[(3 * UTF8_FUZZ_UNITS) + 8];
+	uint8_t bytes[(3 * UTF8_FUZZ_UNITS) + 8];
+	uint32_t state = seed;
+
+	for (uintptr_t iteration = 0; iteration < UTF8_FUZZ_ITERATIONS; iteration++) {
+		uintptr_t offset = nextRandom(&state) % 8;
+		uint16_t *text = units + offset;
+		uintptr_t length = randomText(&state, text, UTF8_FUZZ_UNITS);
+		uintptr_t size = referenceEncode(text, length, encoded);
+		uint8_t *input = bytes + offset;
+		intptr_t result = 0;
+
+		/* round trip of well-formed text */
+		ASSERT_EQ((intptr_t)size, encodeUTF8String(text, length, NULL, 0));
+		ASSERT_EQ((intptr_t)size, encodeUTF8String(text, length, input, size));
+		ASSERT_EQ(0, memcmp(encoded, input, size));
+		if (size > 0) {
+			ASSERT_EQ(-1, encodeUTF8String(text, length, input, size - 1));
+		}
+		ASSERT_EQ((intptr_t)length, validateUTF8String(input, size));
+		ASSERT_EQ((intptr_t)length, decodeUTF8String(input, size, decoded, length));
+		ASSERT_EQ(0, memcmp(text, decoded, length * sizeof(uint16_t)));
+		if (length > 0) {
+			ASSERT_EQ(-1, decodeUTF8String(input, size, decoded, length - 1));
+		}
+
+		/* damaged input must be accepted or rejected exactly as decodeUTF8CharN would */
+		if (size > 0) {
+			uintptr_t damage = 1 + (nextRandom(&state) % 3);
+
+			for (uintptr_t i = 0; i < damage; i++) {
+				uint32_t where = nextRandom(&state) % (uint32_t)size;
+
+				switch (nextRandom(&state) % 4) {
+				case 0:
+					input[where] = 0;
+					break;
+				case 1:
+					input[where] ^= 0x80;
+					break;
+				case 2:
+					input[where] = (uint8_t)nextRandom(&state);
+					break;
+				default:
+					size = where;
+					break;
+				}
+			}
+			result = referenceDecode(input, size, expected);
+			ASSERT_EQ(result, validateUTF8String(input, size)) << "iteration " << iteration;
+			ASSERT_EQ(result, decodeUTF8String(input, size, decoded, UTF8_FUZZ_UNITS + 8)) << "iteration " << iteration;
+			if (result > 0) {
+				ASSERT_EQ(0, memcmp(expected, decoded, result * sizeof(uint16_t)));
+			}
+		}
+	}
+}
+
+TEST(UTF8TranscodeTest, edgeCases)
+{
+	const uint8_t nul[] = {0xC0, 0x80};
+	const uint8_t tooLarge[] = {0xF0, 0x90, 0x80, 0x80};
+	const uint16_t nulUnit = 0;
+	uint16_t decoded[4];
+	uint8_t encoded[4];
+
+	ASSERT_EQ(0, validateUTF8String(NULL, 0));
+	ASSERT_EQ(0, decodeUTF8String(NULL, 0, NULL, 0));
+	ASSERT_EQ(0, encodeUTF8String(NULL, 0, NULL, 0));
+
+	/* NUL is encoded in two bytes, and a raw zero byte is rejected */
+	ASSERT_EQ(1, validateUTF8String(nul, sizeof(nul)));
+	ASSERT_EQ(-1, validateUTF8String((const uint8_t *)"a\0b", 3));
+	ASSERT_EQ(2, encodeUTF8String(&nulUnit, 1, encoded, sizeof(encoded)));
+	ASSERT_EQ(0, memcmp(nul, encoded, sizeof(nul)));
+
+	/* four byte forms and truncated characters are rejected */
+	ASSERT_EQ(-1, validateUTF8String(tooLarge, sizeof(tooLarge)));
+	ASSERT_EQ(-1, decodeUTF8String((const uint8_t *)"ab\xE2\x82", 4, decoded, 4));
+	ASSERT_EQ(3, decodeUTF8String((const uint8_t *)"ab\xE2\x82\xAC", 5, decoded, 4));
+	ASSERT_EQ((uint16_t)0x20AC, decoded[2]);
+}
+
+TEST(UTF8TranscodeTest, fuzz)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+
+	selectUTF8StringImplementation(NULL);
+	fuzzTranscoding(0x1234567);
+	selectUTF8StringImplementation(OMRPORTLIB);
+	fuzzTranscoding(0x7654321);
+}
+
+/**
+ * Compare a decodeUTF8CharN / encodeUTF8CharN loop with the bulk routines on
+ * pure ASCII, mostly ASCII and CJK text.
+ */
+TEST(UTF8TranscodeTest, throughputBenchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	const uintptr_t unitCount = 32 * 1024;
+	const uintptr_t iterations = 64;
+	const char * const textNames[] = {"ascii", "mostly ascii", "cjk"};
+	uint16_t *units = (uint16_t *)omrmem_allocate_memory(2 * unitCount * sizeof(uint16_t), OMRMEM_CATEGORY_UNKNOWN);
+	uint8_t *bytes = (uint8_t *)omrmem_allocate_memory(3 * unitCount, OMRMEM_CATEGORY_UNKNOWN);
+	uint16_t *decoded = units + unitCount;
+	uint32_t state = 0x9E3779B9;
+
+	ASSERT_TRUE(NULL != units);
+	ASSERT_TRUE(NULL != bytes);
+
+	for (uintptr_t text = 0; text < 3; text++) {
+		uint64_t elapsed[3][2];
+		uintptr_t size = 0;
+
+		for (uintptr_t i = 0; i < unitCount; i++) {
+			uint16_t unit = (uint16_t)(0x20 + (nextRandom(&state) % 0x5F));
+
+			if ((2 == text) || ((1 == text) && (0 == (nextRandom(&state) % 64)))) {
+				unit = (uint16_t)(((2 == text) ? 0x4E00 : 0xC0) + (nextRandom(&state) % 0x40));
+			}
+			units[i] = unit;
+		}
+		size = referenceEncode(units, unitCount, bytes);
+
+		for (uintptr_t kind = 0; kind < 3; kind++) {
+			uint64_t start = 0;
+
+			selectUTF8StringImplementation((2 == kind) ? OMRPORTLIB : NULL);
+			start = omrtime_nano_time();
+			for (uintptr_t i = 0; i < iterations; i++) {
+				if (0 == kind) {
+					ASSERT_EQ((intptr_t)unitCount, referenceDecode(bytes, size, decoded));
+				} else {
+					ASSERT_EQ((intptr_t)unitCount, decodeUTF8String(bytes, size, decoded, unitCount));
+				}
+			}
+			elapsed[kind][0] = omrtime_nano_time() - start + 1;
+			start = omrtime_nano_time();
+			for (uintptr_t i = 0; i < iterations; i++) {
+				if (0 == kind) {
+					ASSERT_EQ(size, referenceEncode(units, unitCount, bytes));
+				} else {
+					ASSERT_EQ((intptr_t)size, encodeUTF8String(units, unitCount, bytes, size));
+				}
+			}
+			elapsed[kind][1] = omrtime_nano_time() - start + 1;
+		}
+		for (uintptr_t direction = 0; direction < 2; direction++) {
+			omrTestEnv->log("%-12s %s: per-character %5llu MB/s, bulk baseline %5llu MB/s, bulk selected %5llu MB/s\n",
+				textNames[text], (0 == direction) ? "decode" : "encode",
+				(unsigned long long)(((uint64_t)size * iterations * 1000) / elapsed[0][direction]),
+				(unsigned long long)(((uint64_t)size * iterations * 1000) / elapsed[1][direction]),
+				(unsigned long long)(((uint64_t)size * iterations * 1000) / elapsed[2][direction]));
+		}
+	}
+
+	selectUTF8StringImplementation(OMRPORTLIB);
+	omrmem_free_memory(bytes);
+	omrmem_free_memory(units);
+}
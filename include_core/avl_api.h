@@ -72,6 +72,93 @@ J9AVLTreeNode *
 avl_search(J9AVLTree *tree, uintptr_t searchValue);
 
 
+/* ---------------- btree.c ---------------- */
+
+/**
+* @brief Prepare an empty B+-tree. Blocks are allocated from portLibrary on demand.
+* @param *tree
+* @param *portLibrary
+* @param memoryCategory
+* @return void
+*/
+void
+btree_init(J9BTree *tree, struct OMRPortLibrary *portLibrary, uint32_t memoryCategory);
+
+
+/**
+* @brief Free every block of the tree, leaving it empty.
+* @param *tree
+* @return void
+*/
+void
+btree_free(J9BTree *tree);
+
+
+/**
+* @brief Map key to value unless key is already in the tree. Values must not be NULL.
+* @param *tree
+* @param key
+* @param *value
+* @return void * The value in the tree, which is the existing value if there was one, or NULL on allocation failure
+*/
+void *
+btree_insert(J9BTree *tree, uintptr_t key, void *value);
+
+
+/**
+* @brief Remove key from the tree.
+* @param *tree
+* @param key
+* @return void * The value key was mapped to, or NULL if key is not in the tree
+*/
+void *
+btree_delete(J9BTree *tree, uintptr_t key);
+
+
+/**
+* @brief
+* @param *tree
+* @param key
+* @return void * The value key is mapped to, or NULL if key is not in the tree
+*/
+void *
+btree_search(J9BTree *tree, uintptr_t key);
+
+
+/**
+* @brief Find the greatest key less than or equal to key, e.g. the base of the range containing an address.
+* @param *tree
+* @param key
+* @param *foundKey If not NULL, receives the key found
+* @return void * The value of the key found, or NULL if every key is greater than key
+*/
+void *
+btree_searchFloor(J9BTree *tree, uintptr_t key, uintptr_t *foundKey);
+
+
+/**
+* @brief Build the tree from count strictly ascending keys, filling its blocks.
+* @param *tree Must be empty
+* @param *keys
+* @param *values
+* @param count
+* @return intptr_t 0 on success, -1 if the tree is not empty, the keys are not ascending or memory is exhausted
+*/
+intptr_t
+btree_bulkLoad(J9BTree *tree, const uintptr_t *keys, void * const *values, uintptr_t count);
+
+
+/**
+* @brief Call doFn on each key in ascending order until it returns non-zero.
+* @param *tree
+* @param doFn
+* @param *userData
+* @return uintptr_t The last value returned by doFn, or 0 if the tree is empty
+*/
+uintptr_t
+btree_walk(J9BTree *tree, uintptr_t (*doFn)(uintptr_t key, void *value, void *userData), void *userData);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(COUNTMINSKETCH_H_)
+#define COUNTMINSKETCH_H_
+
+/*
+ * @ddr_namespace: default
+ */
+
+#include "omrport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Count-Min sketch: depth rows of width counters, each key adding its count to one counter
+ * per row. An estimate is the smallest of the key's counters, so it never undercounts, and
+ * it overcounts by more than (e / width) * N with probability at most e^-depth after N updates.
+ * Unlike OMRSpaceSaving it estimates the count of any key, not just the most frequent ones.
+ */
+typedef struct {
+	uint32_t width;
+	uint32_t depth;
+	uintptr_t total;
+	uintptr_t *counters;
+	OMRPortLibrary *portLib;
+} OMRCountMinSketch;
+
+/*
+ * @param portLibrary the port library
+ * @param width counters per row, rounded up to a power of two
+ * @param depth number of rows
+ * @return pointer to new sketch, or NULL on failure
+ */
+OMRCountMinSketch *countMinSketchNew(OMRPortLibrary *portLibrary, uint32_t width, uint32_t depth);
+void countMinSketchFree(OMRCountMinSketch *sketch);
+void countMinSketchClear(OMRCountMinSketch *sketch);
+void countMinSketchUpdate(OMRCountMinSketch *sketch, void *key, uintptr_t count);
+uintptr_t countMinSketchEstimate(OMRCountMinSketch *sketch, void *key);
+
+/* Sum of all counts added */
+uintptr_t countMinSketchGetTotal(OMRCountMinSketch *sketch);
+
+/* Add the counters of other, e.g. a sketch updated by another thread, into sketch.
+ * @return TRUE on success, FALSE if the sketches have different dimensions
+ */
+uintptr_t countMinSketchMerge(OMRCountMinSketch *sketch, OMRCountMinSketch *other);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COUNTMINSKETCH_H_ */
@@ -201,6 +201,121 @@ hashTableStartDo(J9HashTable *table,  J9HashTableState *handle);
 
 
 
+/* ---------------- concurrenthashtable.c ---------------- */
+
+/**
+* @brief Create a hash table that threads can use without locking.
+* @param portLibrary
+* @param tableName
+* @param tableSize Initial number of buckets
+* @param entrySize
+* @param entryAlignment
+* @param memoryCategory
+* @param hashFn
+* @param hashEqualFn
+* @param functionUserData Passed to hashFn and hashEqualFn
+* @return J9ConcurrentHashTable *, or NULL on failure
+*/
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t entryAlignment,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	void *functionUserData);
+
+
+/**
+* @brief Free the table and its entries. No other thread may be using the table.
+* @param *table
+* @return void
+*/
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief Add a copy of entry unless an equal entry is already present.
+* May wait for every reader section to end, so it must not be called inside one.
+* @param *table
+* @param *entry
+* @return void * The entry in the table, which is the existing entry if there was one, or NULL on allocation failure
+*/
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief Find the entry equal to entry.
+* The entry may be freed by a concurrent concurrentHashTableRemove as soon as no reader section
+* is active, so the returned pointer may only be dereferenced inside a section started with
+* concurrentHashTableEnterReader before the call and ended after the last use of the entry.
+* @param *table
+* @param *entry
+* @return void * The entry in the table, or NULL if there is none
+*/
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief Remove the entry equal to entry.
+* May wait for every reader section to end, so it must not be called inside one.
+* @param *table
+* @param *entry
+* @return uint32_t 0 if the entry was removed, 1 if it was not found
+*/
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief
+* @param *table
+* @return uintptr_t The number of entries, which may be stale if other threads are adding or removing entries
+*/
+uintptr_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief Call doFn on each entry. Entries added or removed during the walk may or may not be visited.
+* The walk is a reader section, so doFn must not add or remove entries.
+* @param *table
+* @param doFn Its return value is ignored
+* @param *opaque
+* @return void
+*/
+void
+concurrentHashTableForEachDo(J9ConcurrentHashTable *table, J9HashTableDoFn doFn, void *opaque);
+
+
+/**
+* @brief Start a section in which entries found in the table will not be freed by concurrent removes.
+* Sections may nest. A thread must not call concurrentHashTableAdd or concurrentHashTableRemove
+* until it has ended all of its sections: they may wait for every reader to finish, including
+* the caller, and would deadlock.
+* @param *table
+* @return uintptr_t A token to be passed to concurrentHashTableExitReader
+*/
+uintptr_t
+concurrentHashTableEnterReader(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief End a section started by concurrentHashTableEnterReader.
+* @param *table
+* @param token
+* @return void
+*/
+void
+concurrentHashTableExitReader(J9ConcurrentHashTable *table, uintptr_t token);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -52,6 +52,16 @@ struct J9HookInterface;
 intptr_t
 J9HookInitializeInterface(struct J9HookInterface **hookInterface, OMRPortLibrary *portLib, size_t interfaceSize);
 
+/**
+* @brief Fold the sharded dispatch counters of every event into the count and totalTime fields of its OMREventInfo4Dump.
+* Dispatch only refreshes those fields every J9HOOK_COUNTER_REFRESH_INTERVAL calls of a shard; call this before
+* reading them to get exact values.
+* @param hookInterface
+* @return void
+*/
+void
+J9HookAggregateDumpInfo(struct J9HookInterface **hookInterface);
+
 #ifdef __cplusplus
 }
 #endif
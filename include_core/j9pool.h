@@ -57,12 +57,25 @@ typedef struct J9PoolPuddle {
 	J9WSRP nextAvailablePuddle;
 	uintptr_t userData;
 	uintptr_t flags;
+	uint64_t freeSlotStack;
 } J9PoolPuddle;
 
 
 #define PUDDLE_KILLED  4
 #define PUDDLE_ACTIVE  2
 
+/*
+ * @ddr_namespace: map_to_type=J9PoolContentionStats
+ */
+
+typedef struct J9PoolContentionStats {
+	uintptr_t casRetries;
+	uintptr_t refills;
+	uintptr_t puddleScans;
+	uintptr_t batchReturns;
+	uintptr_t puddlesAdded;
+} J9PoolContentionStats;
+
 /*
  * @ddr_namespace: map_to_type=J9Pool
  */
@@ -79,6 +92,7 @@ typedef struct J9Pool {
 	uint16_t alignment;
 	uint16_t flags;
 	uint32_t memoryCategory;
+	J9PoolContentionStats contentionStats;
 } J9Pool;
 
 #define POOL_NO_ZERO  8
@@ -89,6 +103,30 @@ typedef struct J9Pool {
 #define POOL_ALWAYS_KEEP_SORTED  4
 #define POOL_ALLOC_TYPE_PUDDLE_LIST  2
 #define POOL_ALLOC_TYPE_POOL  0
+#define POOL_THREAD_SAFE  64
+#define POOL_ALLOC_TYPE_THREAD_CACHE  3
+
+#define POOL_THREAD_CACHE_RETURN_PUDDLES  4
+#define POOL_THREAD_CACHE_BATCH_SIZE  32
+
+/*
+ * @ddr_namespace: map_to_type=J9PoolThreadCache
+ */
+
+typedef struct J9PoolReturnBatch {
+	struct J9PoolPuddle *puddle;
+	uint32_t firstSlot;
+	uint32_t lastSlot;
+	uintptr_t count;
+} J9PoolReturnBatch;
+
+typedef struct J9PoolThreadCache {
+	struct J9Pool *pool;
+	struct J9PoolPuddle *puddle;
+	uint32_t freeSlots;
+	uint32_t nextBatchToFlush;
+	J9PoolReturnBatch batches[POOL_THREAD_CACHE_RETURN_PUDDLES];
+} J9PoolThreadCache;
 
 /*
  * @ddr_namespace: map_to_type=J9PoolState
@@ -224,7 +224,8 @@ typedef struct OMR_VMThread {
 
 /**
  * Perform basic structural initialization of the OMR runtime
- * (allocating monitors, etc).
+ * (allocating monitors, selecting processor specific CRC-32 and UTF-8 routines, etc).
+ * Must not be called while another thread may be in omrcrc32() or omrcrc32c().
  *
  * @param[in] *runtime the runtime to initialize
  *
@@ -37,6 +37,38 @@ extern "C" {
 
 
 #include "j9nongenerated.h"
+#include "omravldefines.h"
+
+/*
+ * A B+-tree block fills J9BTREE_BLOCK_SIZE bytes and is aligned to its size. Leaves hold
+ * sorted keys with their values and are linked in key order. Inner blocks hold count
+ * separator keys and count + 1 children; every key under children[i + 1] is >= keys[i]
+ * and every key under children[i] is < keys[i].
+ */
+typedef struct J9BTreeBlock {
+	uint16_t count;
+	uint16_t isLeaf;
+	uintptr_t keys[J9BTREE_BLOCK_KEYS];
+	union {
+		struct {
+			void *values[J9BTREE_BLOCK_KEYS];
+			struct J9BTreeBlock *next;
+		} leaf;
+		struct J9BTreeBlock *children[J9BTREE_BLOCK_KEYS + 1];
+	} u;
+} J9BTreeBlock;
+
+typedef struct J9BTree {
+	struct J9BTreeBlock *rootBlock;
+	uintptr_t height;
+	uintptr_t count;
+	struct J9BTreeBlock *freeBlocks;
+	uintptr_t freeBlockCount;
+	void *chunks;
+	uint32_t memoryCategory;
+	struct OMRPortLibrary *portLibrary;
+	void *userData;
+} J9BTree;
 
 #ifdef __cplusplus
 }
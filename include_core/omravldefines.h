@@ -66,4 +66,7 @@
 #define J9AVLTREE_TEST_INTERNAVL  8
 #define J9AVLTREE_DO_VERIFY_TREE_STRUCT_AND_ACCESS  16
 
+#define J9BTREE_BLOCK_SIZE  256
+#define J9BTREE_BLOCK_KEYS  (((J9BTREE_BLOCK_SIZE / sizeof(uintptr_t)) - 2) / 2)
+
 #endif /* omravldefines_h */
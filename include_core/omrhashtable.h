@@ -51,6 +51,7 @@ extern "C" {
 #define J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32	0x00000004	/*!< Allocate table elements using the malloc32 function */
 #define J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION	0x00000008	/*!< Allow space optimized hashTable, some functions not supported */
 #define J9HASH_TABLE_DO_NOT_REHASH	0x00000010	/*!< Do not rehash the table while set */
+#define J9HASH_TABLE_OPEN_ADDRESSING	0x00000020	/*!< Store entries inline in a probed slot array instead of in chained nodes */
 
 /*
  * This used to include a cast to uintptr_t, but ddrgen doesn't
@@ -86,7 +87,8 @@ extern "C" {
 /**
 * Hash table state queries
 */
-#define hashTableIsSpaceOptimized(table) (NULL == table->listNodePool)
+#define hashTableIsSpaceOptimized(table) ((NULL == (table)->listNodePool) && (NULL == (table)->controlBytes))
+#define hashTableIsOpenAddressing(table) (NULL != (table)->controlBytes)
 
 
 struct J9HashTable; /* Forward struct declaration */
@@ -120,8 +122,69 @@ typedef struct J9HashTable {
 	void *equalFnUserData;
 	void *hashFnUserData;
 	struct J9HashTable *previous;
+	uint8_t *controlBytes;
+	void *slots;
+	uint32_t slotSize;
+	uint32_t numberOfDeletedSlots;
 } J9HashTable;
 
+/**
+ * Concurrent hash table constants
+ */
+#define J9CONCURRENT_HASH_TABLE_STRIPES 64 /*!< Number of insert/remove locks, and the minimum number of buckets */
+#define J9CONCURRENT_HASH_TABLE_READER_SLOTS 32 /*!< Number of reader counters that threads are spread across */
+#define J9CONCURRENT_HASH_TABLE_LINE_SIZE 64
+
+/**
+ * Each node is linked into a chain of the current bucket array through next[generation & 1].
+ * A resize links nodes into the chains of the larger array through the other slot, leaving the
+ * chains that readers of the smaller array are walking intact. The entry follows the node.
+ */
+typedef struct J9ConcurrentHashTableNode {
+	struct J9ConcurrentHashTableNode *next[2];
+	struct J9ConcurrentHashTableNode *nextRetired; /* readers may still follow both links of a removed node */
+	uintptr_t hash;
+} J9ConcurrentHashTableNode;
+
+typedef struct J9ConcurrentHashTableBuckets {
+	uintptr_t size;
+	uintptr_t generation;
+	struct J9ConcurrentHashTableBuckets *next; /* the array this one is being migrated to */
+	volatile uintptr_t migrateCursor; /* next bucket to be claimed by a thread helping the migration */
+	volatile uintptr_t migratedBuckets;
+	struct J9ConcurrentHashTableNode **heads;
+} J9ConcurrentHashTableBuckets;
+
+typedef struct J9ConcurrentHashTableStripe {
+	struct J9ThreadMonitor *lock;
+	uintptr_t count; /* entries in the buckets of this stripe */
+	struct J9ConcurrentHashTableNode *retired; /* removed nodes waiting for readers to finish */
+	uintptr_t retiredCount;
+	uint8_t padding[J9CONCURRENT_HASH_TABLE_LINE_SIZE - (4 * sizeof(uintptr_t))];
+} J9ConcurrentHashTableStripe;
+
+typedef struct J9ConcurrentHashTableReaderSlot {
+	volatile uintptr_t readers[2]; /* readers in each of the two reader phases */
+	uint8_t padding[J9CONCURRENT_HASH_TABLE_LINE_SIZE - (2 * sizeof(uintptr_t))];
+} J9ConcurrentHashTableReaderSlot;
+
+typedef struct J9ConcurrentHashTable {
+	const char *tableName;
+	uint32_t entrySize;
+	uint32_t entryOffset;
+	uint32_t memoryCategory;
+	struct J9ConcurrentHashTableBuckets *volatile buckets;
+	volatile uintptr_t resizing;
+	volatile uintptr_t readerPhase;
+	struct J9ThreadMonitor *reclaimLock;
+	uintptr_t (*hashFn)(void *key, void *userData) ;
+	uintptr_t (*hashEqualFn)(void *leftKey, void *rightKey, void *userData) ;
+	struct OMRPortLibrary *portLibrary;
+	void *functionUserData;
+	J9ConcurrentHashTableStripe stripes[J9CONCURRENT_HASH_TABLE_STRIPES];
+	J9ConcurrentHashTableReaderSlot readerSlots[J9CONCURRENT_HASH_TABLE_READER_SLOTS];
+} J9ConcurrentHashTable;
+
 typedef struct J9HashTableState {
 	struct J9HashTable *table;
 	uint32_t bucketIndex;
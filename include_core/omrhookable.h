@@ -100,6 +100,25 @@ typedef struct OMREventInfo4Dump {
 	volatile uintptr_t totalTime;
 }OMREventInfo4Dump;
 
+/* Number of dispatch counter shards in each hook interface. Must be a power of 2. */
+#define J9HOOK_COUNTER_SHARDS 8
+#define J9HOOK_COUNTER_SHARD_ALIGNMENT 64
+/* Calls of an event between refreshes of its dump totals, per shard. Must be a power of 2. */
+#define J9HOOK_COUNTER_REFRESH_INTERVAL 64
+
+/*
+ * J9HookDispatch counts listener calls and sampled listener time in one of several shards of
+ * per-event counters, each shard on its own cache lines, rather than in the shared count and
+ * totalTime of OMREventInfo4Dump. Dispatch folds the shards into infos4Dump every
+ * J9HOOK_COUNTER_REFRESH_INTERVAL calls of a shard, sampled or not, so readers of a dump see
+ * totals that trail the shards by less than that many calls per shard and the time of those
+ * calls. J9HookAggregateDumpInfo gives exact totals.
+ */
+typedef struct OMREventCounter4Dump {
+	volatile uintptr_t count;
+	volatile uintptr_t totalTime;
+} OMREventCounter4Dump;
+
 typedef struct J9CommonHookInterface {
 	struct J9HookInterface *hookInterface;
 	uintptr_t size;
@@ -109,6 +128,9 @@ typedef struct J9CommonHookInterface {
 	struct OMRPortLibrary *portLib;		/* for accessing PortLibrary  */
 	uint64_t threshold4Trace;			/* the threshold for triggering tracepoint */
 	uintptr_t eventSize;				/* how many events supported by this hook interface */
+	struct OMREventCounter4Dump *counterShards;	/* J9HOOK_COUNTER_SHARDS blocks of per-event counters */
+	uintptr_t counterShardStride;		/* number of counters from one shard to the next */
+	void *counterShardMemory;			/* unaligned allocation holding counterShards */
 } J9CommonHookInterface;
 
 
@@ -127,6 +149,54 @@ typedef struct J9HookRecord {
 	uintptr_t agentID;
 } J9HookRecord;
 
+/*
+ * Direct dispatch slot of an event, kept by the hook library in every hookgen interface.
+ * While the event has exactly one listener, function and userData name it and sequence has
+ * J9HOOK_FASTPATH_VALID set. Writers hold the interface lock and set J9HOOK_FASTPATH_BUSY in
+ * sequence while they update the slot; readers retry through J9HookDispatch if sequence
+ * changed while they read function and userData.
+ */
+typedef struct J9HookFastPath {
+	volatile uintptr_t sequence;
+	J9HookFunction function;
+	void *userData;
+} J9HookFastPath;
+
+#define J9HOOK_FASTPATH_BUSY  1
+#define J9HOOK_FASTPATH_VALID  2
+#define J9HOOK_FASTPATH_GENERATION  4
+
+#if defined(__GNUC__) || defined(__clang__)
+#define J9HOOK_FASTPATH_READ_BARRIER() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#else /* defined(__GNUC__) || defined(__clang__) */
+#include "omrutilbase.h"
+#define J9HOOK_FASTPATH_READ_BARRIER() issueReadBarrier()
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+/*
+ * Report an event to its only listener with a single indirect call if the event's fast path
+ * slot is valid, or through J9HookDispatch otherwise. Generated by hookgen for events marked
+ * with <fast-dispatch>. Fast dispatches are not counted or timed in infos4Dump.
+ */
+#define J9HOOK_FAST_DISPATCH(interface, event, taggedEvent, eventData) \
+	do { \
+		J9HookFastPath *j9hookFastPath = &(interface).fastPaths[event]; \
+		uintptr_t j9hookSequence = j9hookFastPath->sequence; \
+		if (J9HOOK_FASTPATH_VALID == (j9hookSequence & (J9HOOK_FASTPATH_VALID | J9HOOK_FASTPATH_BUSY))) { \
+			J9HookFunction j9hookFunction = NULL; \
+			void *j9hookUserData = NULL; \
+			J9HOOK_FASTPATH_READ_BARRIER(); \
+			j9hookFunction = j9hookFastPath->function; \
+			j9hookUserData = j9hookFastPath->userData; \
+			J9HOOK_FASTPATH_READ_BARRIER(); \
+			if (j9hookFastPath->sequence == j9hookSequence) { \
+				j9hookFunction(J9_HOOK_INTERFACE(interface), (event), (eventData), j9hookUserData); \
+				break; \
+			} \
+		} \
+		(*J9_HOOK_INTERFACE(interface))->J9HookDispatch(J9_HOOK_INTERFACE(interface), (taggedEvent), (eventData)); \
+	} while (0)
+
 
 /* magic hooks supported by every hook interface */
 
@@ -31,6 +31,28 @@
 
 #include "omrcfg.h"
 
+/* Number of counter shards in each category. Must be a power of 2. */
+#define OMRMEM_CATEGORY_COUNTER_SHARDS 8
+#define OMRMEM_CATEGORY_COUNTER_SHARD_SIZE 64
+
+/*
+ * Port library allocations are counted in one of several shards, each on its own cache line,
+ * so that threads allocating in the same category don't contend on one counter. The live
+ * totals are the sum of the category's own counters and every shard.
+ *
+ * Categories are static or copied into port library memory, so their alignment isn't known:
+ * the shards used are the OMRMEM_CATEGORY_COUNTER_SHARDS cache lines starting at the first line
+ * boundary inside the shards array, which has one spare entry for this. None of them then
+ * shares a line with another shard or with the category's own liveBytes and liveAllocations,
+ * which the thread library updates directly. This costs about 600 bytes per category, and
+ * there are only a few dozen categories in a process.
+ */
+typedef struct OMRMemCategoryCounterShard {
+	uintptr_t liveBytes;
+	uintptr_t liveAllocations;
+	uint8_t padding[OMRMEM_CATEGORY_COUNTER_SHARD_SIZE - (2 * sizeof(uintptr_t))];
+} OMRMemCategoryCounterShard;
+
 typedef struct OMRMemCategory {
 	const char *const name;
 	const uint32_t categoryCode;
@@ -38,6 +60,7 @@ typedef struct OMRMemCategory {
 	uintptr_t liveAllocations;
 	const uint32_t numberOfChildren;
 	const uint32_t *const children;
+	OMRMemCategoryCounterShard shards[OMRMEM_CATEGORY_COUNTER_SHARDS + 1];
 } OMRMemCategory;
 
 typedef struct OMRMemCategorySet {
@@ -90,6 +113,10 @@ typedef struct OMRMemCategorySet {
 #define OMRMEM_CATEGORY_CLASSES_SHC_CACHE 0x80000012
 #endif /* OMR_SHARED_CACHE */
 
+/* Reported by omrmem_walk_categories when the slab allocator is in use */
+#define OMRMEM_CATEGORY_PORT_LIBRARY_SLAB_ALLOCATOR 0x80000013
+#define OMRMEM_CATEGORY_PORT_LIBRARY_SLAB_ALLOCATIONS 0x80000014
+
 /* Helper macro to convert the category codes to indices starting from 0 */
 #define OMRMEM_LANGUAGE_CATEGORY_LIMIT 0x7FFFFFFF
 #define OMRMEM_OMR_CATEGORY_INDEX_FROM_CODE(code) (((uint32_t)0x7FFFFFFF) & (code))
@@ -461,12 +461,74 @@ typedef struct J9FileStatFilesystem {
 	uint64_t totalSizeBytes;
 } J9FileStatFilesystem;
 
+/* omrfile_async operations */
+#define OMRPORT_FILE_ASYNC_OP_PREAD 1
+#define OMRPORT_FILE_ASYNC_OP_PWRITE 2
+#define OMRPORT_FILE_ASYNC_OP_PREADV 3
+#define OMRPORT_FILE_ASYNC_OP_PWRITEV 4
+#define OMRPORT_FILE_ASYNC_OP_FSYNC 5
+#define OMRPORT_FILE_ASYNC_OP_FALLOCATE 6
+
+/* omrfile_async_open flags */
+#define OMRPORT_FILE_ASYNC_FORCE_THREAD_POOL 0x1
+
+/* omrfile_async_get_backend return values */
+#define OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL 1
+#define OMRPORT_FILE_ASYNC_BACKEND_IO_URING 2
+
+/**
+ * A buffer for OMRPORT_FILE_ASYNC_OP_PREADV and OMRPORT_FILE_ASYNC_OP_PWRITEV.
+ * Has the same layout as struct iovec on POSIX platforms.
+ */
+typedef struct OMRFileAsyncIOVec {
+	void *base;
+	uintptr_t length;
+} OMRFileAsyncIOVec;
+
+struct OMRPortLibrary;
+struct OMRFileAsyncRequest;
+typedef void (*omrfile_async_callback_t)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncRequest *request);
+
+/**
+ * An asynchronous file operation. The storage belongs to the caller and must
+ * remain valid, along with any buffers it refers to, until the request completes.
+ *
+ * For reads and writes, result is the number of bytes transferred, which may be
+ * short. For OMRPORT_FILE_ASYNC_OP_FSYNC and OMRPORT_FILE_ASYNC_OP_FALLOCATE it
+ * is 0. On failure it is a negative portable error code.
+ */
+typedef struct OMRFileAsyncRequest {
+	uint32_t operation; /* OMRPORT_FILE_ASYNC_OP_xxx */
+	intptr_t fd;
+	uint64_t offset;
+	void *buffer; /* PREAD and PWRITE */
+	uintptr_t length; /* PREAD, PWRITE and FALLOCATE */
+	OMRFileAsyncIOVec *iov; /* PREADV and PWRITEV */
+	uintptr_t iovCount;
+	omrfile_async_callback_t callback; /* optional, called from omrfile_async_poll */
+	void *userData;
+	intptr_t result;
+	struct OMRFileAsyncRequest *next; /* private to the port library */
+} OMRFileAsyncRequest;
+
+/**
+ * A queue of asynchronous file operations.
+ * Private, platform specific implementation.
+ */
+struct OMRFileAsyncQueue;
+
 /**
  * A handle to a filestream.
  * Private, platform specific implementation.
  */
 typedef FILE OMRFileStream;
 
+/**
+ * A buffered log stream that many threads may write to concurrently.
+ * Private, see @ref omrfilestreamlog.c::omrfilestream_log_open "omrfilestream_log_open".
+ */
+struct OMRLogStream;
+
 /* It is the responsibility of the user to create the storage for J9PortVMemParams.
  * The structure is only needed for the lifetime of the call to omrvmem_reserve_memory_ex
  * This structure must be initialized using @ref omrvmem_vmem_params_init
@@ -531,8 +593,48 @@ typedef struct J9PortVmemParams {
 
 	/* the lowest common multiple of alignmentInBytes and pageSize should be used to determine the base address */
 	uintptr_t alignmentInBytes;
+
+	/* [Optional] Huge page policy for default page size reservations. Expected values:
+	 * \arg OMRPORT_VMEM_HUGEPAGE_POLICY_DEFAULT advise the OS when transparent huge pages are in madvise mode
+	 * \arg OMRPORT_VMEM_HUGEPAGE_POLICY_NEVER never back the reservation with transparent huge pages
+	 * \arg OMRPORT_VMEM_HUGEPAGE_POLICY_MADVISE advise transparent huge pages for each committed range
+	 * \arg OMRPORT_VMEM_HUGEPAGE_POLICY_EAGER advise and prefault each committed range so huge pages are installed immediately
+	 * \arg OMRPORT_VMEM_HUGEPAGE_POLICY_HUGETLBFS reserve from the hugetlbfs pool, falling back to OMRPORT_VMEM_HUGEPAGE_POLICY_MADVISE
+	 * Only Linux honours the policy; other platforms ignore it.
+	 */
+	uintptr_t hugePagePolicy;
 } J9PortVmemParams;
 
+/* Options for omrvmem_commit_memory_ex. A zero-initialized structure requests a plain commit. */
+typedef struct J9PortVmemCommitParams {
+	/* Number of threads, including the caller, used to fault in the committed range before returning.
+	 * 0 leaves the range to be faulted on first touch. Ignored for ranges that are not writable.
+	 */
+	uintptr_t prefaultThreads;
+
+	/* NUMA placement applied to the range before it is faulted in. Expected values:
+	 * \arg OMRPORT_VMEM_NUMA_POLICY_NONE keep the placement of the reservation
+	 * \arg OMRPORT_VMEM_NUMA_POLICY_INTERLEAVE interleave pages across the nodes the process may allocate from
+	 * \arg OMRPORT_VMEM_NUMA_POLICY_LOCAL place each page on the node of the thread that faults it
+	 * \arg OMRPORT_VMEM_NUMA_POLICY_PREFERRED prefer numaNode, as with omrvmem_numa_set_affinity
+	 * Policies are advisory and are ignored where NUMA is unavailable.
+	 */
+	uintptr_t numaPolicy;
+
+	/* 1-based node index for OMRPORT_VMEM_NUMA_POLICY_PREFERRED */
+	uintptr_t numaNode;
+} J9PortVmemCommitParams;
+
+/**
+ * @name Virtual Memory NUMA Policies
+ * See J9PortVmemCommitParams.numaPolicy
+ *
+ */
+#define OMRPORT_VMEM_NUMA_POLICY_NONE	0
+#define OMRPORT_VMEM_NUMA_POLICY_INTERLEAVE	1
+#define OMRPORT_VMEM_NUMA_POLICY_LOCAL	2
+#define OMRPORT_VMEM_NUMA_POLICY_PREFERRED	3
+
 typedef enum J9VMemMemoryQuery {
 	OMRPORT_VMEM_PROCESS_PHYSICAL,
 	OMRPORT_VMEM_PROCESS_PRIVATE,
@@ -565,6 +667,47 @@ typedef struct OMRCgroupMetricIteratorState {
 	char *fileContent;
 } OMRCgroupMetricIteratorState;
 
+/**
+ * @name Memory Pressure Events
+ * Values of OMRMemoryPressureEvent.type
+ *
+ */
+#define OMRPORT_MEMORY_PRESSURE_EVENT_STALL	1 /**< the pressure stall trigger fired */
+#define OMRPORT_MEMORY_PRESSURE_EVENT_HIGH	2 /**< usage went over memory.high and is being throttled */
+#define OMRPORT_MEMORY_PRESSURE_EVENT_MAX	3 /**< usage hit memory.max and reclaim is running */
+#define OMRPORT_MEMORY_PRESSURE_EVENT_OOM	4 /**< an allocation failed at memory.max */
+#define OMRPORT_MEMORY_PRESSURE_EVENT_OOM_KILL	5 /**< a process in the cgroup was OOM-killed */
+
+/**
+ * @name Memory Pressure Stall Types
+ * Values of OMRMemoryPressureParams.stallType
+ *
+ */
+#define OMRPORT_MEMORY_PRESSURE_STALL_NONE	0
+#define OMRPORT_MEMORY_PRESSURE_STALL_SOME	1 /**< at least one task is stalled on memory */
+#define OMRPORT_MEMORY_PRESSURE_STALL_FULL	2 /**< all non-idle tasks are stalled on memory */
+
+typedef struct OMRMemoryPressureEvent {
+	uint32_t type; /**< one of OMRPORT_MEMORY_PRESSURE_EVENT_* */
+	uint64_t count; /**< total stall time in microseconds for STALL, otherwise the memory.events counter */
+} OMRMemoryPressureEvent;
+
+typedef void (*OMRMemoryPressureCallback)(struct OMRPortLibrary *portLibrary, const OMRMemoryPressureEvent *event, void *userData);
+
+typedef struct OMRMemoryPressureParams {
+	uint32_t stallType; /**< OMRPORT_MEMORY_PRESSURE_STALL_* stall to trigger on, or OMRPORT_MEMORY_PRESSURE_STALL_NONE */
+	uint64_t stallThresholdMicros; /**< stall time within the window that fires the trigger */
+	uint64_t stallWindowMicros; /**< trigger window; unprivileged processes need a multiple of 2 seconds */
+	BOOLEAN watchEvents; /**< report increases of the memory.events high, max, oom and oom_kill counters */
+	const char *cgroupDirectory; /**< NULL for the memory cgroup of this process. A directory that is not on cgroup2fs is a stand-in:
+								   * each rewrite of its memory.pressure file fires the stall trigger and rewrites of its memory.events
+								   * file are reported like kernel updates. */
+	OMRMemoryPressureCallback callback; /**< called on the port library's notification thread */
+	void *userData;
+} OMRMemoryPressureParams;
+
+struct OMRMemoryPressureMonitor;
+
 
 
 /**
@@ -582,6 +725,17 @@ typedef struct OMRCgroupMetricIteratorState {
 #define OMRPORT_VMEM_ZTPF_USE_31BIT_MALLOC 64
 #define OMRPORT_VMEM_ADDRESS_HINT 128
 
+/**
+ * @name Virtual Memory Huge Page Policies
+ * See J9PortVmemParams.hugePagePolicy
+ *
+ */
+#define OMRPORT_VMEM_HUGEPAGE_POLICY_DEFAULT	0
+#define OMRPORT_VMEM_HUGEPAGE_POLICY_NEVER	1
+#define OMRPORT_VMEM_HUGEPAGE_POLICY_MADVISE	2
+#define OMRPORT_VMEM_HUGEPAGE_POLICY_EAGER	3
+#define OMRPORT_VMEM_HUGEPAGE_POLICY_HUGETLBFS	4
+
 /**
  * @name Virtual Memory Address
  * highest memory address on platform
@@ -888,10 +1042,16 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_CTLDATA_VMEM_HUGE_PAGES_MMAP_ENABLED "VMEM_HUGE_PAGES_MMAP_ENABLED"
 #define OMRPORT_CTLDATA_CRIU_SUPPORT_FLAGS "CRIU_SUPPORT_FLAGS"
 #define OMRPORT_CTLDATA_MEM_32BIT "MEM_32BIT_FLAGS"
+#define OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR "MEM_SLAB_ALLOCATOR"
 
 /* OMRPORT_CTLDATA_MEM_32BIT Flags */
 #define OMRPORT_MEM_32BIT_FLAGS_TMP_FILE_BACKED_VMEM 0x1
 
+/* OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR Flags, 0 disables the slab allocator */
+#define OMRPORT_MEM_SLAB_ENABLED 0x1
+/* Validate slab block headers when they are freed */
+#define OMRPORT_MEM_SLAB_CHECK_TAGS 0x2
+
 /* CRIU support is enabled, a checkpoint could be taken
  * if current VM is not from a final restoration.
  */
@@ -1241,6 +1401,7 @@ typedef struct J9PortVmemIdentifier {
 	uintptr_t allocator;
 	int fd;
 	OMRMemCategory *category;
+	uintptr_t hugePagePolicy;
 } J9PortVmemIdentifier;
 
 typedef struct J9MmapHandle {
@@ -1337,6 +1498,30 @@ typedef struct J9ThreadWalkState {
  */
 #define OMR_BACKTRACE_SYMBOLS_BASIC 1
 
+/*
+ * Parameters for introspect_sampler_open(). A field left 0 takes its default.
+ */
+typedef struct OMRIntrospectSamplerParams {
+	uint64_t periodNanos; /**< CPU time a thread runs between samples, default 10ms */
+	uintptr_t maxFrames; /**< frames kept per sample, default 64 */
+	uintptr_t bufferPages; /**< ring buffer pages per thread, rounded up to a power of 2, default 8 */
+	uintptr_t batchSize; /**< most samples passed to one callback, default 64 */
+} OMRIntrospectSamplerParams;
+
+/*
+ * A stack sample passed to an OMRIntrospectSampleCallback. The sampler owns the memory,
+ * which is only valid during the callback.
+ */
+typedef struct OMRIntrospectSample {
+	uint64_t timeNanos; /**< when the sample was taken, on the omrtime_nano_time clock */
+	uintptr_t threadId; /**< operating system thread ID */
+	uintptr_t frameCount;
+	void **frames; /**< return addresses, innermost first */
+} OMRIntrospectSample;
+
+struct OMRIntrospectSampler;
+typedef void (*OMRIntrospectSampleCallback)(struct OMRPortLibrary *portLibrary, const OMRIntrospectSample *samples, uintptr_t sampleCount, void *userData);
+
 typedef struct J9PortSysInfoLoadData {
 	double oneMinuteAverage;
 	double fiveMinuteAverage;
@@ -2004,6 +2189,9 @@ struct omrshmem_handle;
 struct OMRPortLibrary;
 typedef struct J9Heap J9Heap;
 
+/* heapFlags for omrheap_create */
+#define OMRPORT_HEAP_SEGREGATED_FIT 0x1
+
 typedef uintptr_t (*omrsig_protected_fn)(struct OMRPortLibrary *portLib, void *handler_arg);
 typedef uintptr_t (*omrsig_handler_fn)(struct OMRPortLibrary *portLib, uint32_t gpType, void *gpInfo, void *handler_arg);
 typedef uintptr_t (*OMRLibraryInfoCallback)(const char *name, void *addressLow, void *addressHigh, void *userData);
@@ -2052,6 +2240,8 @@ typedef struct OMRPortLibrary {
 	uint64_t (*time_hires_frequency)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrtime.c::omrtime_hires_delta "omrtime_hires_delta"*/
 	uint64_t (*time_hires_delta)(struct OMRPortLibrary *portLibrary, uint64_t startTime, uint64_t endTime, uint64_t requiredResolution) ;
+	/** see @ref omrtime.c::omrtime_fast_nanos "omrtime_fast_nanos"*/
+	int64_t (*time_fast_nanos)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_startup "omrsysinfo_startup"*/
 	int32_t (*sysinfo_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_shutdown "omrsysinfo_shutdown"*/
@@ -2210,6 +2400,18 @@ typedef struct OMRPortLibrary {
 	OMRFileStream *( *filestream_fdopen)(struct OMRPortLibrary *portLibrary, intptr_t fd, int32_t flags) ;
 	/** see @ref omrfilestream::omrfilestream_fileno "filestream_fileno"*/
 	intptr_t ( *filestream_fileno)(struct OMRPortLibrary *portLibrary, OMRFileStream *stream) ;
+	/** see @ref omrfilestreamlog.c::omrfilestream_log_open "filestream_log_open"*/
+	int32_t ( *filestream_log_open)(struct OMRPortLibrary *portLibrary, intptr_t fd, uintptr_t bufferSize, uintptr_t flushIntervalMillis, struct OMRLogStream **logStream) ;
+	/** see @ref omrfilestreamlog.c::omrfilestream_log_write "filestream_log_write"*/
+	intptr_t ( *filestream_log_write)(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *buf, intptr_t nbytes) ;
+	/** see @ref omrfilestreamlog.c::omrfilestream_log_vprintf "filestream_log_vprintf"*/
+	void ( *filestream_log_vprintf)(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *format, va_list args) ;
+	/** see @ref omrfilestreamlog.c::omrfilestream_log_printf "filestream_log_printf"*/
+	void ( *filestream_log_printf)(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *format, ...) ;
+	/** see @ref omrfilestreamlog.c::omrfilestream_log_flush "filestream_log_flush"*/
+	int32_t ( *filestream_log_flush)(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream) ;
+	/** see @ref omrfilestreamlog.c::omrfilestream_log_close "filestream_log_close"*/
+	int32_t ( *filestream_log_close)(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream) ;
 	/** see @ref omrsl.c::omrsl_startup "omrsl_startup"*/
 	int32_t (*sl_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrsl.c::omrsl_shutdown "omrsl_shutdown"*/
@@ -2316,6 +2518,10 @@ typedef struct OMRPortLibrary {
 	int32_t (*vmem_get_available_physical_memory)(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 	/** see @ref omrvmem.c::omrvmem_get_process_memory_size "omrvmem_get_process_memory_size"*/
 	int32_t (*vmem_get_process_memory_size)(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+	/** see @ref omrvmem.c::omrvmem_get_hugepage_coverage "omrvmem_get_hugepage_coverage"*/
+	int32_t (*vmem_get_hugepage_coverage)(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBytes, uintptr_t *residentBytes);
+	/** see @ref omrvmemprefault.c::omrvmem_commit_memory_ex "omrvmem_commit_memory_ex"*/
+	void *(*vmem_commit_memory_ex)(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, struct J9PortVmemCommitParams *params);
 	/** see @ref omrstr.c::omrstr_startup "omrstr_startup"*/
 	int32_t (*str_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_shutdown "omrstr_shutdown"*/
@@ -2606,6 +2812,10 @@ typedef struct OMRPortLibrary {
 	int32_t (*sysinfo_get_process_start_time)(struct OMRPortLibrary *portLibrary, uintptr_t pid, uint64_t *processStartTimeInNanoseconds);
 	/** see @ref omrsysinfo.c::omrsysinfo_get_number_context_switches "omrsysinfo_get_number_context_switches"*/
 	int32_t  (*sysinfo_get_number_context_switches)(struct OMRPortLibrary *portLibrary, uint64_t *numSwitches) ;
+	/** see @ref omrsysinfo.c::omrsysinfo_memory_pressure_subscribe "omrsysinfo_memory_pressure_subscribe"*/
+	int32_t (*sysinfo_memory_pressure_subscribe)(struct OMRPortLibrary *portLibrary, const struct OMRMemoryPressureParams *params, struct OMRMemoryPressureMonitor **monitor);
+	/** see @ref omrsysinfo.c::omrsysinfo_memory_pressure_unsubscribe "omrsysinfo_memory_pressure_unsubscribe"*/
+	void (*sysinfo_memory_pressure_unsubscribe)(struct OMRPortLibrary *portLibrary, struct OMRMemoryPressureMonitor *monitor);
 	/** see @ref omrport.c::omrport_init_library "omrport_init_library"*/
 	int32_t (*port_init_library)(struct OMRPortLibrary *portLibrary, uintptr_t size) ;
 	/** see @ref omrport.c::omrport_startup_library "omrport_startup_library"*/
@@ -2632,6 +2842,16 @@ typedef struct OMRPortLibrary {
 	uintptr_t (*introspect_backtrace_symbols)(struct OMRPortLibrary *portLibrary, J9PlatformThread *thread, J9Heap *heap) ;
 	/** see @ref omrintrospect.c::omrintrospect_backtrace_symbols_ex "omrintrospect_backtrace_symbols_ex"*/
 	uintptr_t (*introspect_backtrace_symbols_ex)(struct OMRPortLibrary *portLibrary, J9PlatformThread *thread, J9Heap *heap, uint32_t options);
+	/** see @ref omrintrospectsampler.c::omrintrospect_sampler_open "omrintrospect_sampler_open"*/
+	int32_t (*introspect_sampler_open)(struct OMRPortLibrary *portLibrary, const OMRIntrospectSamplerParams *params, struct OMRIntrospectSampler **sampler);
+	/** see @ref omrintrospectsampler.c::omrintrospect_sampler_add_thread "omrintrospect_sampler_add_thread"*/
+	int32_t (*introspect_sampler_add_thread)(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, uintptr_t threadId);
+	/** see @ref omrintrospectsampler.c::omrintrospect_sampler_remove_thread "omrintrospect_sampler_remove_thread"*/
+	int32_t (*introspect_sampler_remove_thread)(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, uintptr_t threadId);
+	/** see @ref omrintrospectsampler.c::omrintrospect_sampler_drain "omrintrospect_sampler_drain"*/
+	intptr_t (*introspect_sampler_drain)(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, OMRIntrospectSampleCallback callback, void *userData);
+	/** see @ref omrintrospectsampler.c::omrintrospect_sampler_close "omrintrospect_sampler_close"*/
+	void (*introspect_sampler_close)(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler);
 	/** see @ref omrsyslog.c::omrsyslog_query "omrsyslog_query"*/
 	uintptr_t (*syslog_query)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrsyslog.c::omrsyslog_set "omrsyslog_set"*/
@@ -2734,6 +2954,16 @@ typedef struct OMRPortLibrary {
 	int32_t (*sock_getsockopt_linger)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval) ;
 	/** see @ref omrsock.c::omrsock_getsockopt_timeval "omrsock_getsockopt_timeval"*/
 	int32_t (*sock_getsockopt_timeval)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval) ;
+	/** see @ref omrfileasync.c::omrfile_async_open "omrfile_async_open"*/
+	int32_t (*file_async_open)(struct OMRPortLibrary *portLibrary, uintptr_t queueDepth, uint32_t flags, struct OMRFileAsyncQueue **queue) ;
+	/** see @ref omrfileasync.c::omrfile_async_close "omrfile_async_close"*/
+	void (*file_async_close)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue) ;
+	/** see @ref omrfileasync.c::omrfile_async_submit "omrfile_async_submit"*/
+	intptr_t (*file_async_submit)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue, struct OMRFileAsyncRequest **requests, uintptr_t count) ;
+	/** see @ref omrfileasync.c::omrfile_async_poll "omrfile_async_poll"*/
+	intptr_t (*file_async_poll)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue, uintptr_t minCompletions) ;
+	/** see @ref omrfileasync.c::omrfile_async_get_backend "omrfile_async_get_backend"*/
+	uint32_t (*file_async_get_backend)(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue) ;
 #if defined(OMR_OPT_CUDA)
 	/** CUDA configuration data */
 	J9CudaConfig *cuda_configData;
@@ -2977,6 +3207,7 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrtime_hires_clock() privateOmrPortLibrary->time_hires_clock(privateOmrPortLibrary)
 #define omrtime_hires_frequency() privateOmrPortLibrary->time_hires_frequency(privateOmrPortLibrary)
 #define omrtime_hires_delta(param1,param2,param3) privateOmrPortLibrary->time_hires_delta(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrtime_fast_nanos() privateOmrPortLibrary->time_fast_nanos(privateOmrPortLibrary)
 #define omrsysinfo_startup() privateOmrPortLibrary->sysinfo_startup(privateOmrPortLibrary)
 #define omrsysinfo_shutdown() privateOmrPortLibrary->sysinfo_shutdown(privateOmrPortLibrary)
 #define omrsysinfo_process_exists(param1) privateOmrPortLibrary->sysinfo_process_exists(privateOmrPortLibrary, (param1))
@@ -3058,6 +3289,12 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrfilestream_setbuffer(param1, param2, param3, param4) privateOmrPortLibrary->filestream_setbuffer(privateOmrPortLibrary, param1, param2, param3, param4)
 #define omrfilestream_fdopen(param1, param2) privateOmrPortLibrary->filestream_fdopen(privateOmrPortLibrary, param1, param2)
 #define omrfilestream_fileno(param1) privateOmrPortLibrary->filestream_fileno(privateOmrPortLibrary, param1)
+#define omrfilestream_log_open(param1, param2, param3, param4) privateOmrPortLibrary->filestream_log_open(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfilestream_log_write(param1, param2, param3) privateOmrPortLibrary->filestream_log_write(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfilestream_log_vprintf(param1, param2, param3) privateOmrPortLibrary->filestream_log_vprintf(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfilestream_log_printf(...) privateOmrPortLibrary->filestream_log_printf(privateOmrPortLibrary, __VA_ARGS__)
+#define omrfilestream_log_flush(param1) privateOmrPortLibrary->filestream_log_flush(privateOmrPortLibrary, (param1))
+#define omrfilestream_log_close(param1) privateOmrPortLibrary->filestream_log_close(privateOmrPortLibrary, (param1))
 #define omrsl_startup() privateOmrPortLibrary->sl_startup(privateOmrPortLibrary)
 #define omrsl_shutdown() privateOmrPortLibrary->sl_shutdown(privateOmrPortLibrary)
 #define omrsl_close_shared_library(param1) privateOmrPortLibrary->sl_close_shared_library(privateOmrPortLibrary, (param1))
@@ -3111,6 +3348,8 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrvmem_numa_get_node_details(param1,param2) privateOmrPortLibrary->vmem_numa_get_node_details(privateOmrPortLibrary, (param1), (param2))
 #define omrvmem_get_available_physical_memory(param1) privateOmrPortLibrary->vmem_get_available_physical_memory(privateOmrPortLibrary, (param1))
 #define omrvmem_get_process_memory_size(param1,param2) privateOmrPortLibrary->vmem_get_process_memory_size(privateOmrPortLibrary, (param1), (param2))
+#define omrvmem_get_hugepage_coverage(param1,param2,param3) privateOmrPortLibrary->vmem_get_hugepage_coverage(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrvmem_commit_memory_ex(param1,param2,param3,param4) privateOmrPortLibrary->vmem_commit_memory_ex(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrstr_startup() privateOmrPortLibrary->str_startup(privateOmrPortLibrary)
 #define omrstr_shutdown() privateOmrPortLibrary->str_shutdown(privateOmrPortLibrary)
 #define omrstr_printf(...) privateOmrPortLibrary->str_printf(privateOmrPortLibrary, __VA_ARGS__)
@@ -3253,6 +3492,8 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsysinfo_cgroup_subsystem_iterator_destroy(param1) privateOmrPortLibrary->sysinfo_cgroup_subsystem_iterator_destroy(privateOmrPortLibrary, param1)
 #define omrsysinfo_get_process_start_time(param1, param2) privateOmrPortLibrary->sysinfo_get_process_start_time(privateOmrPortLibrary, param1, param2)
 #define omrsysinfo_get_number_context_switches(param1) privateOmrPortLibrary->sysinfo_get_number_context_switches(privateOmrPortLibrary, param1)
+#define omrsysinfo_memory_pressure_subscribe(param1, param2) privateOmrPortLibrary->sysinfo_memory_pressure_subscribe(privateOmrPortLibrary, param1, param2)
+#define omrsysinfo_memory_pressure_unsubscribe(param1) privateOmrPortLibrary->sysinfo_memory_pressure_unsubscribe(privateOmrPortLibrary, param1)
 #define omrintrospect_startup() privateOmrPortLibrary->introspect_startup(privateOmrPortLibrary)
 #define omrintrospect_shutdown() privateOmrPortLibrary->introspect_shutdown(privateOmrPortLibrary)
 #define omrintrospect_set_suspend_signal_offset(param1) privateOmrPortLibrary->introspect_set_suspend_signal_offset(privateOmrPortLibrary, param1)
@@ -3262,6 +3503,11 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrintrospect_backtrace_thread(param1,param2,param3) privateOmrPortLibrary->introspect_backtrace_thread(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrintrospect_backtrace_symbols(param1,param2) privateOmrPortLibrary->introspect_backtrace_symbols_ex(privateOmrPortLibrary, (param1), (param2), 0)
 #define omrintrospect_backtrace_symbols_ex(param1,param2,param3) privateOmrPortLibrary->introspect_backtrace_symbols_ex(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrintrospect_sampler_open(param1,param2) privateOmrPortLibrary->introspect_sampler_open(privateOmrPortLibrary, (param1), (param2))
+#define omrintrospect_sampler_add_thread(param1,param2) privateOmrPortLibrary->introspect_sampler_add_thread(privateOmrPortLibrary, (param1), (param2))
+#define omrintrospect_sampler_remove_thread(param1,param2) privateOmrPortLibrary->introspect_sampler_remove_thread(privateOmrPortLibrary, (param1), (param2))
+#define omrintrospect_sampler_drain(param1,param2,param3) privateOmrPortLibrary->introspect_sampler_drain(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrintrospect_sampler_close(param1) privateOmrPortLibrary->introspect_sampler_close(privateOmrPortLibrary, (param1))
 #define omrsyslog_query() privateOmrPortLibrary->syslog_query(privateOmrPortLibrary)
 #define omrsyslog_set(param1) privateOmrPortLibrary->syslog_set(privateOmrPortLibrary, (param1))
 #define omrmem_walk_categories(param1) privateOmrPortLibrary->mem_walk_categories(privateOmrPortLibrary, (param1))
@@ -3313,6 +3559,11 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsock_getsockopt_int(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_int(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_linger(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_linger(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_timeval(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_timeval(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_async_open(param1,param2,param3) privateOmrPortLibrary->file_async_open(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_async_close(param1) privateOmrPortLibrary->file_async_close(privateOmrPortLibrary, (param1))
+#define omrfile_async_submit(param1,param2,param3) privateOmrPortLibrary->file_async_submit(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_async_poll(param1,param2) privateOmrPortLibrary->file_async_poll(privateOmrPortLibrary, (param1), (param2))
+#define omrfile_async_get_backend(param1) privateOmrPortLibrary->file_async_get_backend(privateOmrPortLibrary, (param1))
 
 #if defined(OMR_OPT_CUDA)
 #define omrcuda_startup() \
@@ -127,6 +127,35 @@ void omr_ras_sampleStackTraceContinue(OMR_VMThread *omrVMThread, const void *met
  */
 BOOLEAN omr_ras_sampleStackEnabled(void);
 
+/**
+ * @brief Map a native code address to a method dictionary key.
+ *
+ * @param[in] omrVMThread The OMR VM thread passed to omr_ras_processStackSamples().
+ * @param[in] pc A return address from a stack sample.
+ * @param[in] userData The userData passed to omr_ras_processStackSamples().
+ * @return The key of the method containing pc, or NULL if pc is not in a known method.
+ */
+typedef const void *(*OMR_SampleFrameResolver)(OMR_VMThread *omrVMThread, void *pc, void *userData);
+
+/**
+ * @brief Trace stack samples collected by omrintrospect_sampler_drain().
+ *
+ * Each sample is traced as a native sample tracepoint followed by the method sample
+ * tracepoints for the frames that resolver maps to a method, top-most frame first,
+ * so the samples can be formatted with the method dictionary like those traced with
+ * omr_ras_sampleStackTraceStart().
+ *
+ * @pre The current thread must be attached to the OMR VM.
+ *
+ * @param[in] omrVMThread The current OMR VM thread. Must not be NULL.
+ * @param[in] samples The samples.
+ * @param[in] sampleCount The number of samples.
+ * @param[in] resolver Maps frame addresses to method keys.
+ * @param[in] userData Passed to resolver.
+ * @return The number of samples with at least one frame in a known method.
+ */
+uintptr_t omr_ras_processStackSamples(OMR_VMThread *omrVMThread, const OMRIntrospectSample *samples, uintptr_t sampleCount, OMR_SampleFrameResolver resolver, void *userData);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
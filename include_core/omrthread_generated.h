@@ -37,6 +37,11 @@
 #define J9THREAD_MAX_TLS_KEYS 124
 #endif /* !J9ZOS390 */
 
+/* Keys beyond J9THREAD_MAX_TLS_KEYS are stored in chunks allocated on first use */
+#define J9THREAD_TLS_CHUNK_SIZE 128
+#define J9THREAD_TLS_MAX_CHUNKS 31
+#define J9THREAD_MAX_EXTENDED_TLS_KEYS (J9THREAD_MAX_TLS_KEYS + (J9THREAD_TLS_CHUNK_SIZE * J9THREAD_TLS_MAX_CHUNKS))
+
 #define J9THREAD_CATEGORY_SYSTEM_THREAD				0x1
 /* GC and JIT are also SYSTEM threads, so they have the SYSTEM bit set */
 #define J9THREAD_CATEGORY_SYSTEM_GC_THREAD			(0x2 | J9THREAD_CATEGORY_SYSTEM_THREAD)
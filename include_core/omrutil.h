@@ -104,6 +104,55 @@ encodeUTF8Char(uintptr_t unicode, uint8_t *result);
 uint32_t
 encodeUTF8CharN(uintptr_t unicode, uint8_t *result, uint32_t bytesRemaining);
 
+/* ---------------- utf8transcode.c ---------------- */
+
+/**
+* @brief Choose the fastest block routines for the bulk UTF-8 functions on
+* the current processor. Until this is called the baseline vector or
+* word-at-a-time routines are used; passing NULL restores them. Results are
+* identical on every path.
+*
+* This is called by omr_initialize_runtime(). It updates the routines without
+* synchronization, so it must not be called while another thread may be in
+* validateUTF8String(), decodeUTF8String() or encodeUTF8String().
+* @param portLibrary
+* @return void
+*/
+void
+selectUTF8StringImplementation(OMRPortLibrary *portLibrary);
+
+/**
+* @brief Validate a buffer of modified UTF-8 and count the UTF-16 units it decodes to.
+* @param input The UTF-8 bytes
+* @param inputLength The number of bytes in input
+* @return intptr_t The number of UTF-16 units, or -1 if any character would be rejected by decodeUTF8CharN
+*/
+intptr_t
+validateUTF8String(const uint8_t *input, uintptr_t inputLength);
+
+/**
+* @brief Decode a buffer of modified UTF-8 into UTF-16.
+* @param input The UTF-8 bytes
+* @param inputLength The number of bytes in input
+* @param output Buffer for the UTF-16 units, whose contents are undefined on failure
+* @param outputLength The number of units available in output
+* @return intptr_t The number of UTF-16 units written, or -1 if the input is not valid or output is too small
+*/
+intptr_t
+decodeUTF8String(const uint8_t *input, uintptr_t inputLength, uint16_t *output, uintptr_t outputLength);
+
+/**
+* @brief Encode a buffer of UTF-16 as modified UTF-8.
+* @param input The UTF-16 units
+* @param inputLength The number of units in input
+* @param output Buffer for the UTF-8 bytes, whose contents are undefined on failure; if NULL, nothing is
+* written and outputLength is ignored
+* @param outputLength The number of bytes available in output
+* @return intptr_t The number of bytes written, or required if output is NULL, or -1 if output is too small
+*/
+intptr_t
+encodeUTF8String(const uint16_t *input, uintptr_t inputLength, uint8_t *output, uintptr_t outputLength);
+
 
 
 /* ---------------- xml.c ---------------- */
@@ -431,6 +480,42 @@ U_32 omrcrc32(U_32 crc, U_8 *bytes, U_32 len);
 */
 U_32 omrcrcSparse32(U_32 crc, U_8 *bytes, U_32 len, U_32 step);
 
+/**
+* @brief Compute a CRC-32C (Castagnoli) checksum, continuing from crc
+* @param crc
+* @param *bytes
+* @param len
+* @return U_32
+*/
+U_32 omrcrc32c(U_32 crc, U_8 *bytes, U_32 len);
+
+/**
+* @brief Choose the fastest omrcrc32 and omrcrc32c implementations for the
+* current processor. Until this is called both use a portable slicing-by-8
+* table walk. Passing NULL restores the portable implementations. Results are
+* identical on every path.
+*
+* This is called by omr_initialize_runtime(). It updates the implementations
+* without synchronization, so it must not be called while another thread may
+* be in omrcrc32() or omrcrc32c().
+* @param portLibrary
+* @return void
+*/
+void omrcrc32SelectImplementation(OMRPortLibrary *portLibrary);
+
+/* ---------------- omrhash64.c ---------------- */
+
+/**
+* @brief Compute a fast, non-cryptographic 64-bit hash of a byte range.
+* The result is the xxHash64 value of the bytes and does not depend on the
+* alignment or the byte order of the platform.
+* @param data
+* @param len
+* @param seed
+* @return uint64_t
+*/
+uint64_t omrhash64(const void *data, uintptr_t len, uint64_t seed);
+
 /* ---------------- archinfo.c ---------------- */
 /**
  * @brief
@@ -549,6 +634,29 @@ intptr_t
 createThreadWithCategory(omrthread_t *handle, uintptr_t stacksize, uintptr_t priority, uintptr_t suspend,
 	omrthread_entrypoint_t entrypoint, void *entryarg, uint32_t category);
 
+/**
+ * Helper function to create a joinable thread with a specific thread category.
+ * The thread must be reclaimed with omrthread_join once it has been started.
+ *
+ * @param[out] handle a pointer to a omrthread_t which will point to the thread (if successfully created)
+ * @param[in] stacksize the size of the new thread's stack (bytes)<br>
+ *			0 indicates use default size
+ * @param[in] priority priorities range from J9THREAD_PRIORITY_MIN to J9THREAD_PRIORITY_MAX (inclusive)
+ * @param[in] suspend set to non-zero to create the thread in a suspended state.
+ * @param[in] entrypoint pointer to the function which the thread will run
+ * @param[in] entryarg a value to pass to the entrypoint function
+ * @param[in] category category of the thread to be created
+ *
+ * @return success or error code
+ * @retval J9THREAD_SUCCESS success
+ * @retval J9THREAD_ERR_xxx failure
+ *
+ * @see omrthread_create, omrthread_join
+ */
+intptr_t
+createJoinableThreadWithCategory(omrthread_t *handle, uintptr_t stacksize, uintptr_t priority, uintptr_t suspend,
+	omrthread_entrypoint_t entrypoint, void *entryarg, uint32_t category);
+
 /**
  * Helper function to attach a thread with a specific category.
  *
@@ -199,6 +199,63 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity);
 uintptr_t
 pool_includesElement(J9Pool *aPool, void *anElement);
 
+/* ---------------- pool_concurrent.cpp ---------------- */
+
+/**
+* @brief Create a per-thread element cache for a POOL_THREAD_SAFE pool. A cache may only be used by one thread at a time.
+* @param *aPool
+* @return J9PoolThreadCache *, or NULL if the pool is not thread safe or the cache could not be allocated
+*/
+J9PoolThreadCache *
+pool_threadCacheNew(J9Pool *aPool);
+
+
+/**
+* @brief Return all free elements held by a thread cache to their puddles. Caches must be flushed before pool_clear.
+* @param *cache
+* @return void
+*/
+void
+pool_threadCacheFlush(J9PoolThreadCache *cache);
+
+
+/**
+* @brief Flush and free a thread cache. Caches must be killed before their pool.
+* @param *cache
+* @return void
+*/
+void
+pool_threadCacheKill(J9PoolThreadCache *cache);
+
+
+/**
+* @brief pool_newElement through a thread cache
+* @param *cache
+* @return void *
+*/
+void *
+pool_newElementCached(J9PoolThreadCache *cache);
+
+
+/**
+* @brief pool_removeElement through a thread cache. The element may come from any puddle of the cache's pool.
+* @param *cache
+* @param *anElement
+* @return void
+*/
+void
+pool_removeElementCached(J9PoolThreadCache *cache, void *anElement);
+
+
+/**
+* @brief Snapshot the contention counters of a POOL_THREAD_SAFE pool
+* @param *aPool
+* @param *stats
+* @return void
+*/
+void
+pool_getContentionStats(J9Pool *aPool, J9PoolContentionStats *stats);
+
 #ifdef __cplusplus
 }
 #endif
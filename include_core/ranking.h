@@ -73,6 +73,13 @@ void rankingUpdateLowest(OMRRanking *ranking, void *key, uintptr_t count);
  * */
 uintptr_t rankingIncrementEntry(OMRRanking *ranking, void *key, uintptr_t count);
 
+/* Look up the count of an entry
+ * @param key the entry to look up
+ * @param count receives the entry's count if it exists
+ * @return returns TRUE if an entry with the given key exists, false otherwise
+ * */
+uintptr_t rankingFindEntry(OMRRanking *ranking, void *key, uintptr_t *count);
+
 /* get the key at rank k
  * @param k the kth highest count we're enquiring about
  * @return the key at rank k
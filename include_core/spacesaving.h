@@ -35,6 +35,7 @@ extern "C" {
 typedef struct {
 	OMRRanking *ranking;
 	OMRPortLibrary *portLib;
+	uintptr_t errorBound; /* see spaceSavingGetErrorBound() */
 } OMRSpaceSaving;
 
 OMRSpaceSaving *spaceSavingNew(OMRPortLibrary *portLibrary, uint32_t size);
@@ -45,6 +46,40 @@ void *spaceSavingGetKthMostFreq(OMRSpaceSaving *spaceSaving, uintptr_t k);
 uintptr_t spaceSavingGetKthMostFreqCount(OMRSpaceSaving *spaceSaving, uintptr_t k);
 uintptr_t spaceSavingGetCurSize(OMRSpaceSaving *spaceSaving);
 
+/* Largest amount by which any count overestimates its key's true count, which is also the
+ * largest true count a key missing from the structure can have. At most N/size after N updates.
+ */
+uintptr_t spaceSavingGetErrorBound(OMRSpaceSaving *spaceSaving);
+
+/* Merge the counts of other into spaceSaving, keeping spaceSaving's size. Every merged count
+ * still overestimates by at most spaceSavingGetErrorBound(), which becomes the sum of the two
+ * bounds, or the smallest count kept if that is larger and some keys did not fit.
+ * @return TRUE on success, FALSE if temporary memory could not be allocated
+ */
+uintptr_t spaceSavingMerge(OMRSpaceSaving *spaceSaving, OMRSpaceSaving *other);
+
+/*
+ * A set of Space-Saving structures of the same size, one per updating thread, so that threads
+ * can count without synchronization and merge their counts at the end.
+ */
+typedef struct {
+	OMRSpaceSaving **shards;
+	uint32_t shardCount;
+	OMRPortLibrary *portLib;
+} OMRShardedSpaceSaving;
+
+OMRShardedSpaceSaving *shardedSpaceSavingNew(OMRPortLibrary *portLibrary, uint32_t size, uint32_t shardCount);
+void shardedSpaceSavingFree(OMRShardedSpaceSaving *sharded);
+void shardedSpaceSavingClear(OMRShardedSpaceSaving *sharded);
+
+/* The shard for a thread, e.g. a GC worker ID. A shard must only be updated by one thread at a time. */
+OMRSpaceSaving *shardedSpaceSavingGetShard(OMRShardedSpaceSaving *sharded, uintptr_t shardIndex);
+
+/* Merge every shard into result, once no thread is updating the shards.
+ * @return TRUE on success, FALSE if temporary memory could not be allocated
+ */
+uintptr_t shardedSpaceSavingMerge(OMRShardedSpaceSaving *sharded, OMRSpaceSaving *result);
+
 #ifdef __cplusplus
 }
 #endif
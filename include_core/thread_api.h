@@ -659,6 +659,39 @@ omrthread_lib_clear_flags(uintptr_t flags);
 intptr_t
 omrthread_lib_control(const char *key, uintptr_t value);
 
+typedef struct omrthread_thread_cache_stats_t {
+	uintptr_t maxThreads; /* 0 when the cache is disabled */
+	uintptr_t idleMillis;
+	uintptr_t parkedThreads;
+	uint64_t hits; /* creations served by a parked thread */
+	uint64_t misses; /* creations that found no compatible parked thread */
+	uint64_t parks;
+	uint64_t expired; /* parked threads that exited after idling for idleMillis */
+} omrthread_thread_cache_stats_t;
+
+/**
+* @brief Configure the cache of exited threads reused by omrthread_create_ex.
+*
+* While the cache is enabled, a detached thread whose entrypoint returns is parked instead of
+* exiting, and a later omrthread_create_ex with the same stack size, priority and category
+* runs on it. Joinable threads and threads with a real-time scheduling policy are never cached.
+* The cache is disabled by default.
+*
+* @param[in] maxThreads maximum number of parked threads, or 0 to disable the cache
+* @param[in] idleMillis how long a thread stays parked before exiting, or 0 to wait indefinitely
+* @return void
+*/
+void
+omrthread_lib_set_thread_cache(uintptr_t maxThreads, uintptr_t idleMillis);
+
+/**
+* @brief Get the thread cache's configuration and counters.
+* @param[out] stats the counters
+* @return void
+*/
+void
+omrthread_lib_get_thread_cache_stats(omrthread_thread_cache_stats_t *stats);
+
 /**
 * @brief
 * @param self
@@ -825,6 +858,16 @@ intptr_t
 omrthread_monitor_notify_all(omrthread_monitor_t monitor);
 
 
+/**
+* @brief
+* @param monitor
+* @param count
+* @return intptr_t
+*/
+intptr_t
+omrthread_monitor_notify_n(omrthread_monitor_t monitor, uintptr_t count);
+
+
 /**
 * @brief
 * @param monitor
@@ -1069,6 +1112,24 @@ omrthread_tls_free(omrthread_tls_key_t key);
 intptr_t
 omrthread_tls_set(omrthread_t thread, omrthread_tls_key_t key, void *value);
 
+#if defined(OMR_THR_FAST_TLS)
+/* the current thread, kept alongside the library's TLS key; NULL if the thread is not attached */
+extern __thread omrthread_t omrthread_current_thread __attribute__((tls_model("initial-exec")));
+
+#define J9THREAD_SELF() (omrthread_current_thread)
+#else /* defined(OMR_THR_FAST_TLS) */
+#define J9THREAD_SELF() omrthread_self()
+#endif /* defined(OMR_THR_FAST_TLS) */
+
+/**
+ * Inline form of omrthread_tls_get. The first J9THREAD_MAX_TLS_KEYS keys handed out are
+ * stored in the thread itself and read without a call; later keys go through omrthread_tls_get.
+ */
+#define J9THREAD_TLS_GET(thread, key) \
+	(((key) <= J9THREAD_MAX_TLS_KEYS) \
+		? ((J9AbstractThread *)(thread))->tls[(key) - 1] \
+		: omrthread_tls_get((thread), (key)))
+
 
 /**
 * @brief
@@ -1254,6 +1315,59 @@ omrthread_get_jvm_cpu_usage_info_error_recovery(void);
 intptr_t
 omrthread_get_thread_times(omrthread_thread_time_t *threadTime);
 
+/* omrthread_sampler_create flags */
+#define J9THREAD_SAMPLER_CONTEXT_SWITCHES 0x1 /* collect voluntary and involuntary context switch counts */
+#define J9THREAD_SAMPLER_LAST_CPU 0x2 /* collect the CPU each thread last ran on */
+
+typedef struct OMRThreadSampler *omrthread_sampler_t;
+
+typedef struct omrthread_sample_t {
+	omrthread_t thread;
+	uintptr_t tid; /* OS thread id, as returned by omrthread_get_osId */
+	uint32_t category; /* effective category */
+	int64_t cpuTime; /* nanoseconds, -1 if not available */
+	int64_t voluntaryContextSwitches; /* -1 if not requested or not available */
+	int64_t involuntaryContextSwitches; /* -1 if not requested or not available */
+	intptr_t lastCpu; /* -1 if not requested or not available */
+} omrthread_sample_t;
+
+/**
+ * Create a sampler which collects per-thread statistics for all attached threads in one pass.
+ *
+ * On Linux CPU time is read from each thread's CPU-time clock and the other statistics from
+ * /proc/self/task, whose file descriptors are kept open between calls to omrthread_sampler_sample.
+ * A sampler must not be used by more than one thread at a time.
+ *
+ * @param[out] sampler the new sampler
+ * @param[in] flags J9THREAD_SAMPLER_xxx flags selecting the statistics to collect in addition to CPU time
+ * @return J9THREAD_SUCCESS on success, J9THREAD_ERR_NOMEMORY if the sampler could not be allocated
+ */
+intptr_t
+omrthread_sampler_create(omrthread_sampler_t *sampler, uint32_t flags);
+
+/**
+ * Destroy a sampler, closing any file descriptors it holds.
+ * @param[in] sampler the sampler
+ * @return void
+ */
+void
+omrthread_sampler_destroy(omrthread_sampler_t sampler);
+
+/**
+ * Sample all attached threads.
+ *
+ * @param[in] sampler the sampler
+ * @param[out] samples array receiving one entry per thread; may be NULL if maxSamples is 0
+ * @param[in] maxSamples capacity of samples
+ * @param[out] threadCount the number of threads sampled; entries beyond maxSamples are not stored
+ * @param[out] cpuUsage if not NULL, receives the CPU usage per thread category in the same form as
+ * omrthread_get_jvm_cpu_usage_info, which requires CPU monitoring to be enabled
+ * @return 0 on success, -J9THREAD_ERR_NOMEMORY if the sampler's tables could not be grown,
+ * or one of the negative error codes of omrthread_get_jvm_cpu_usage_info if cpuUsage could not be computed
+ */
+intptr_t
+omrthread_sampler_sample(omrthread_sampler_t sampler, omrthread_sample_t *samples, uintptr_t maxSamples, uintptr_t *threadCount, J9ThreadsCpuUsage *cpuUsage);
+
 /* ---------------- omrthreadattr.c ---------------- */
 
 /**
@@ -1438,6 +1552,199 @@ omrthread_monitor_pin(omrthread_monitor_t monitor, omrthread_t self);
 void
 omrthread_monitor_unpin(omrthread_monitor_t monitor, omrthread_t self);
 
+/* -------------- omrthreadcontention.cpp ------------------- */
+
+/* maximum number of native frames recorded per contention sample */
+#define J9THREAD_CONTENTION_MAX_FRAMES 16
+
+/* default number of distinct (monitor, call site) pairs the profiler can hold */
+#define J9THREAD_CONTENTION_DEFAULT_TABLE_SIZE 4096
+
+/**
+ * Capture a native backtrace of the calling thread, innermost frame first.
+ * @return the number of frames stored in frames
+ */
+typedef uintptr_t (*omrthread_contention_backtrace_t)(void *userData, void **frames, uintptr_t maxFrames);
+
+/**
+ * Write a NUL-terminated symbolic name for address into buffer.
+ * @return non-zero if a name was written, 0 to fall back to the hex address
+ */
+typedef uintptr_t (*omrthread_contention_symbolize_t)(void *userData, void *address, char *buffer, uintptr_t bufferLength);
+
+/**
+ * Receive a chunk of the profile text.
+ */
+typedef void (*omrthread_contention_write_t)(void *userData, const char *text, uintptr_t length);
+
+typedef struct omrthread_contention_stats_t {
+	uintptr_t sampleInterval; /* 0 when the profiler is not running */
+	uint64_t samples;
+	uint64_t droppedSamples; /* samples lost because the table was full */
+	uintptr_t sites;
+} omrthread_contention_stats_t;
+
+/**
+ * Start sampling slow-path monitor acquisitions, discarding any previous profile.
+ * @param[in] sampleInterval record one of every sampleInterval slow-path acquisitions per thread (0 is treated as 1)
+ * @param[in] tableSize number of distinct (monitor, call site) pairs to track, or 0 for the default
+ * @param[in] backtrace function used to capture the backtrace of a sample, or NULL for the platform default
+ * @param[in] userData passed to backtrace
+ * @return J9THREAD_SUCCESS on success, a J9THREAD_ERR_xxx code otherwise
+ */
+intptr_t
+omrthread_contention_profiler_start(uintptr_t sampleInterval, uintptr_t tableSize, omrthread_contention_backtrace_t backtrace, void *userData);
+
+/**
+ * Stop sampling. The profile collected so far remains available to omrthread_contention_profiler_dump.
+ * @return void
+ */
+void
+omrthread_contention_profiler_stop(void);
+
+/**
+ * Write the profile in folded-stack format, one "frame;frame;...;monitor waitNanos" line per
+ * (monitor, call site) pair with the outermost frame first, as consumed by flamegraph.pl.
+ * @param[in] symbolize function used to name frames, or NULL to print addresses
+ * @param[in] write function receiving the text
+ * @param[in] userData passed to symbolize and write
+ * @return J9THREAD_SUCCESS on success, J9THREAD_ERR if no profile has been collected
+ */
+intptr_t
+omrthread_contention_profiler_dump(omrthread_contention_symbolize_t symbolize, omrthread_contention_write_t write, void *userData);
+
+/**
+ * Get the profiler's counters.
+ * @param[out] stats the counters
+ * @return void
+ */
+void
+omrthread_contention_profiler_get_stats(omrthread_contention_stats_t *stats);
+
+/* -------------- omrthreadexecutor.cpp ------------------- */
+
+/**
+* @struct
+*/
+struct OMRThreadExecutor;
+
+/**
+* @typedef
+*/
+typedef struct OMRThreadExecutor *omrthread_executor_t;
+
+/**
+* @struct
+*/
+struct OMRThreadExecutorTask;
+
+/**
+* @typedef
+*/
+typedef struct OMRThreadExecutorTask *omrthread_executor_task_t;
+
+typedef void (*omrthread_executor_task_fn_t)(void *arg);
+typedef void (*omrthread_executor_range_fn_t)(void *arg, uintptr_t start, uintptr_t end);
+
+/* accumulate the CPU time spent in tasks, by task category */
+#define J9THREAD_EXECUTOR_FLAG_ACCOUNT_CPU 0x1
+
+/* default capacity of each worker's work-stealing deque (must be a power of 2) */
+#define J9THREAD_EXECUTOR_DEFAULT_DEQUE_CAPACITY 1024
+
+/* run the task with the category of the executing worker */
+#define J9THREAD_EXECUTOR_CATEGORY_INHERIT 0
+
+typedef struct omrthread_executor_params_t {
+	const char *name;
+	uintptr_t workerCount;
+	uintptr_t dequeCapacity;
+	uintptr_t stackSize;
+	uintptr_t priority;
+	uint32_t category;
+	uint32_t flags;
+	const uintptr_t *numaNodes;
+	uintptr_t numaNodeCount;
+} omrthread_executor_params_t;
+
+typedef struct omrthread_executor_stats_t {
+	uint64_t tasksSubmitted;
+	uint64_t tasksExecuted;
+	uint64_t tasksStolen;
+	uint64_t tasksOverflowed;
+	J9ThreadsCpuUsage cpuUsage;
+} omrthread_executor_stats_t;
+
+/**
+ * Initialize executor creation parameters to their defaults.
+ * @param[out] params the parameters to initialize
+ * @return void
+ */
+void
+omrthread_executor_params_init(omrthread_executor_params_t *params);
+
+/**
+ * Create a fixed pool of worker threads with per-worker work-stealing deques.
+ * @param[out] executor where to store the new executor
+ * @param[in] params creation parameters, or NULL for the defaults
+ * @return J9THREAD_SUCCESS on success, a J9THREAD_ERR_xxx code otherwise
+ */
+intptr_t
+omrthread_executor_create(omrthread_executor_t *executor, const omrthread_executor_params_t *params);
+
+/**
+ * Run all queued tasks, stop the workers and free the executor.
+ * @param[in] executor the executor to destroy
+ * @return J9THREAD_SUCCESS on success, J9THREAD_INVALID_ARGUMENT if called from one of its workers
+ */
+intptr_t
+omrthread_executor_destroy(omrthread_executor_t executor);
+
+/**
+ * Queue a task for execution.
+ * @param[in] executor the executor
+ * @param[in] function the function to run
+ * @param[in] arg the argument to pass to function
+ * @param[in] category the thread category to run the task in, or J9THREAD_EXECUTOR_CATEGORY_INHERIT
+ * @param[out] task where to store a handle to pass to omrthread_executor_join, or NULL for a detached task
+ * @return J9THREAD_SUCCESS on success, a J9THREAD_ERR_xxx code otherwise
+ */
+intptr_t
+omrthread_executor_submit(omrthread_executor_t executor, omrthread_executor_task_fn_t function, void *arg, uint32_t category, omrthread_executor_task_t *task);
+
+/**
+ * Wait for a task to complete and release it. Workers of the owning executor
+ * run other queued tasks while they wait.
+ * @param[in] task the task returned by omrthread_executor_submit
+ * @return J9THREAD_SUCCESS
+ */
+intptr_t
+omrthread_executor_join(omrthread_executor_task_t task);
+
+/**
+ * Run function over [start, end) in chunks of at most grain indices, in parallel,
+ * and return when every chunk has completed. The calling thread participates.
+ * @param[in] executor the executor
+ * @param[in] start first index
+ * @param[in] end one past the last index
+ * @param[in] grain maximum chunk size, or 0 to pick one
+ * @param[in] function the function to run on each chunk
+ * @param[in] arg the argument to pass to function
+ * @param[in] category the thread category to run the chunks in, or J9THREAD_EXECUTOR_CATEGORY_INHERIT
+ * @return J9THREAD_SUCCESS on success, a J9THREAD_ERR_xxx code otherwise
+ */
+intptr_t
+omrthread_executor_parallel_for(omrthread_executor_t executor, uintptr_t start, uintptr_t end, uintptr_t grain, omrthread_executor_range_fn_t function, void *arg, uint32_t category);
+
+/**
+ * Get a snapshot of the executor's counters.
+ * @param[in] executor the executor
+ * @param[out] stats the counters
+ * @return void
+ */
+void
+omrthread_executor_get_stats(omrthread_executor_t executor, omrthread_executor_stats_t *stats);
+
 /* forward struct definition */
 struct J9ThreadLibrary;
 
@@ -31,6 +31,9 @@ extern "C" {
 #include "omrmemcategories.h"
 #include "thrdsup.h"
 
+/* longest name, including the terminator, handed to a thread reused from the thread cache */
+#define J9THREAD_CACHE_NAME_LENGTH 64
+
 typedef struct J9Thread {
 	J9_ABSTRACT_THREAD_FIELDS
 	OSTHREAD handle;
@@ -54,6 +57,12 @@ typedef struct J9Thread {
 #if !defined(OMR_OS_WINDOWS)
 	uintptr_t key_deletion_attempts;
 #endif /* !OMR_OS_WINDOWS */
+	uintptr_t contentionSampleCountdown;
+	void **volatile tls_chunks[J9THREAD_TLS_MAX_CHUNKS];
+	uintptr_t cacheable;
+	uintptr_t cacheTaken;
+	struct J9Thread *cacheNext;
+	char cacheName[J9THREAD_CACHE_NAME_LENGTH];
 } J9Thread;
 
 /*
@@ -64,6 +73,9 @@ typedef struct J9ThreadMonitor {
 	J9_ABSTRACT_MONITOR_FIELDS
 	J9OSMutex mutex;
 	struct J9Thread *notifyAllWaiting;
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+	uintptr_t notifiedBlockingCount;
+#endif /* OMR_THR_THREE_TIER_LOCKING */
 } J9ThreadMonitor;
 
 
@@ -89,6 +101,19 @@ typedef struct J9ThreadGlobal {
 	uintptr_t data;
 } J9ThreadGlobal;
 
+/* Exited threads parked for reuse by omrthread_create_ex. Protected by the library global mutex. */
+typedef struct J9ThreadCache {
+	struct J9Thread *parked;
+	uintptr_t parkedCount;
+	uintptr_t maxThreads;
+	uintptr_t idleMillis;
+	uintptr_t exiting;
+	uint64_t hits;
+	uint64_t misses;
+	uint64_t parks;
+	uint64_t expired;
+} J9ThreadCache;
+
 typedef struct J9ThreadLibrary {
 	uintptr_t spinlock;
 	struct J9ThreadMonitorPool *monitor_pool;
@@ -106,6 +131,7 @@ typedef struct J9ThreadLibrary {
 	J9OSMutex monitor_mutex;
 	J9OSMutex tls_mutex;
 	omrthread_tls_finalizer_t tls_finalizers[J9THREAD_MAX_TLS_KEYS];
+	omrthread_tls_finalizer_t *volatile tls_finalizer_chunks[J9THREAD_TLS_MAX_CHUNKS];
 	char *thread_weight;
 #if defined(OMR_THR_JLM)
 	struct J9Pool *monitor_tracing_pool;
@@ -148,6 +174,10 @@ typedef struct J9ThreadLibrary {
 	struct J9Pool *rwmutexPool;
 #endif /* defined(OMR_THR_FORK_SUPPORT) */
 	omrthread_attr_t systemThreadAttr;
+	volatile uintptr_t contentionSampleInterval;
+	struct OMRThreadContentionProfiler *volatile contentionProfiler;
+	volatile uintptr_t contentionProfilerUsers;
+	J9ThreadCache threadCache;
 #if defined(OSX)
 	clock_serv_t clockService;
 #endif /* defined(OSX) */
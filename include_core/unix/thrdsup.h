@@ -89,6 +89,7 @@ int linux_pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex, c
 intptr_t init_thread_library(void);
 intptr_t set_pthread_priority(pthread_t handle, omrthread_prio_t j9ThreadPriority);
 intptr_t set_pthread_name(pthread_t self, pthread_t thread, const char *name);
+intptr_t get_pthread_name(char *name, size_t length);
 intptr_t sem_init_zos(j9sem_t s, int pShared, int initValue);
 intptr_t sem_destroy_zos(j9sem_t s);
 intptr_t sem_getvalue_zos(j9sem_t s);
@@ -317,6 +318,13 @@ extern pthread_condattr_t *defaultCondAttr;
 #define THREAD_SET_NAME(self, thread, name) 0 /* not implemented */
 #endif /* defined(LINUX) || defined(OSX) */
 
+/* THREAD_GET_NAME: the OS name of the current thread */
+#if defined(LINUX) || defined(OSX)
+#define THREAD_GET_NAME(name, length) get_pthread_name((name), (length))
+#else /* defined(LINUX) || defined(OSX) */
+#define THREAD_GET_NAME(name, length) -1 /* not implemented */
+#endif /* defined(LINUX) || defined(OSX) */
+
 /* THREAD_SET_PRIORITY */
 #define THREAD_SET_PRIORITY(thread, priority) set_pthread_priority((thread), (priority))
 
@@ -131,6 +131,10 @@ extern struct J9ThreadLibrary default_library;
 
 #define THREAD_SET_NAME(self, thread, name) 0 /* not implemented */
 
+/* THREAD_GET_NAME: the OS name of the current thread */
+
+#define THREAD_GET_NAME(name, length) -1 /* not implemented */
+
 /* THREAD_SET_PRIORITY */
 
 #define THREAD_SET_PRIORITY(thread, priority) (!SetThreadPriority((thread), omrthread_get_mapped_priority(priority)))
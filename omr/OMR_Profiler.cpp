@@ -40,3 +40,31 @@ omr_ras_sampleStackEnabled(void)
 {
 	return (TrcEnabled_Trc_OMRPROF_MethodSampleStart || TrcEnabled_Trc_OMRPROF_MethodSampleContinue);
 }
+
+uintptr_t
+omr_ras_processStackSamples(OMR_VMThread *omrVMThread, const OMRIntrospectSample *samples, uintptr_t sampleCount, OMR_SampleFrameResolver resolver, void *userData)
+{
+	uintptr_t resolvedSamples = 0;
+
+	for (uintptr_t i = 0; i < sampleCount; i++) {
+		const OMRIntrospectSample *sample = &samples[i];
+		bool started = false;
+
+		Trc_OMRPROF_NativeSample(omrVMThread, sample->threadId, sample->timeNanos, sample->frameCount);
+		for (uintptr_t j = 0; j < sample->frameCount; j++) {
+			const void *methodKey = resolver(omrVMThread, sample->frames[j], userData);
+			if (NULL != methodKey) {
+				if (started) {
+					Trc_OMRPROF_MethodSampleContinue(omrVMThread, methodKey);
+				} else {
+					Trc_OMRPROF_MethodSampleStart(omrVMThread, methodKey);
+					started = true;
+				}
+			}
+		}
+		if (started) {
+			resolvedSamples += 1;
+		}
+	}
+	return resolvedSamples;
+}
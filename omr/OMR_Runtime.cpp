@@ -23,6 +23,7 @@
 #define linkNext _linkNext
 #define linkPrevious _linkPrevious
 #include "omrlinkedlist.h"
+#include "omrutil.h"
 #include "OMR_Runtime.hpp"
 #include "OMR_VM.hpp"
 #include "OMR_VMThread.hpp"
@@ -37,6 +38,11 @@ omr_initialize_runtime(OMR_Runtime *runtime)
 
 	if (0 == omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT)) {
 		if (0 == omrthread_monitor_init_with_name(&runtime->_vmListMutex, 0, "OMR VM list mutex")) {
+			/* No VM exists yet, so nothing can be computing a CRC or transcoding UTF-8 while the implementations are switched */
+			if (NULL != runtime->_portLibrary) {
+				omrcrc32SelectImplementation(runtime->_portLibrary);
+				selectUTF8StringImplementation(runtime->_portLibrary);
+			}
 			runtime->_initialized = TRUE;
 		} else {
 			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
@@ -1549,3 +1549,9 @@ omrvmem_create_double_mapped_region(struct OMRPortLibrary *portLibrary, void* re
 	portLibrary->error_set_last_error(portLibrary, errno, OMRPORT_ERROR_VMEM_NOT_SUPPORTED);
 	return NULL;
 }
+
+int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBytes, uintptr_t *residentBytes)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
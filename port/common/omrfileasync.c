@@ -0,0 +1,770 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Asynchronous file operations
+ */
+
+/*
+ * Requests are queued on an OMRFileAsyncQueue and completed by one of two backends:
+ *
+ * - io_uring, on Linux when the headers and the running kernel support it. Requests
+ *   become submission queue entries, and completions are reaped from the completion
+ *   queue by omrfile_async_poll.
+ * - a pool of port library threads, which perform the operations with positional
+ *   system calls. This backend is used everywhere else, and when io_uring is
+ *   unavailable at runtime (old kernel, seccomp filters) or explicitly not wanted.
+ *
+ * A queue never has more than its depth of requests outstanding, so neither io_uring
+ * ring can overflow.
+ */
+#include <string.h>
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrthread.h"
+#include "omrutil.h"
+
+#if defined(OMR_OS_WINDOWS)
+#include <windows.h>
+#else /* defined(OMR_OS_WINDOWS) */
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif /* defined(OMR_OS_WINDOWS) */
+
+#if defined(OMR_HAVE_LINUX_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+
+#define OMRFILE_ASYNC_MAX_POOL_THREADS 4
+#define OMRFILE_ASYNC_POOL_STACK_SIZE (64 * 1024)
+/* largest transfer Linux performs in one read or write */
+#define OMRFILE_ASYNC_MAX_TRANSFER ((uintptr_t)0x7FFFF000)
+
+typedef struct OMRFileAsyncQueue {
+	struct OMRPortLibrary *portLibrary;
+	uint32_t backend;
+	uintptr_t depth;
+	omrthread_monitor_t monitor;
+	/* requests submitted but not yet returned by omrfile_async_poll */
+	uintptr_t inFlight;
+	/* thread pool */
+	OMRFileAsyncRequest *pendingHead;
+	OMRFileAsyncRequest *pendingTail;
+	OMRFileAsyncRequest *completedHead;
+	OMRFileAsyncRequest *completedTail;
+	omrthread_t workers[OMRFILE_ASYNC_MAX_POOL_THREADS];
+	uintptr_t workerCount;
+	BOOLEAN shutdown;
+#if defined(OMR_HAVE_LINUX_IO_URING)
+	int ringFd;
+	void *sqRing;
+	size_t sqRingSize;
+	void *cqRing;
+	size_t cqRingSize;
+	struct io_uring_sqe *sqes;
+	size_t sqesSize;
+	uint32_t *sqHead;
+	uint32_t *sqTail;
+	uint32_t *sqMask;
+	uint32_t *sqArray;
+	uint32_t *cqHead;
+	uint32_t *cqTail;
+	uint32_t *cqMask;
+	struct io_uring_cqe *cqes;
+	/* entries filled in but not yet published to the kernel */
+	uint32_t unsubmitted;
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+} OMRFileAsyncQueue;
+
+static BOOLEAN isValidRequest(OMRFileAsyncRequest *request);
+static intptr_t performRequest(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *request);
+static int32_t startThreadPool(OMRFileAsyncQueue *queue);
+static void stopThreadPool(OMRFileAsyncQueue *queue);
+static int J9THREAD_PROC threadPoolWorker(void *arg);
+#if defined(OMR_HAVE_LINUX_IO_URING)
+static BOOLEAN startRing(OMRFileAsyncQueue *queue);
+static void stopRing(OMRFileAsyncQueue *queue);
+static void prepareRingEntry(OMRFileAsyncQueue *queue, OMRFileAsyncRequest *request);
+static int32_t enterRing(OMRFileAsyncQueue *queue, uint32_t minComplete);
+static uintptr_t reapRing(OMRFileAsyncQueue *queue, OMRFileAsyncRequest **head, OMRFileAsyncRequest **tail);
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+
+#if !defined(OMR_OS_WINDOWS)
+static intptr_t
+translateErrno(int errorCode)
+{
+	switch (errorCode) {
+	case EACCES:
+	case EPERM:
+		return OMRPORT_ERROR_FILE_NOPERMISSION;
+	case EBADF:
+		return OMRPORT_ERROR_FILE_BADF;
+	case ENOSPC:
+	case EFBIG:
+		return OMRPORT_ERROR_FILE_DISKFULL;
+	case EINVAL:
+		return OMRPORT_ERROR_FILE_INVAL;
+	case EISDIR:
+		return OMRPORT_ERROR_FILE_ISDIR;
+	case EAGAIN:
+		return OMRPORT_ERROR_FILE_EAGAIN;
+	case EFAULT:
+		return OMRPORT_ERROR_FILE_EFAULT;
+	case EINTR:
+		return OMRPORT_ERROR_FILE_EINTR;
+	case EIO:
+		return OMRPORT_ERROR_FILE_IO;
+	case EOVERFLOW:
+		return OMRPORT_ERROR_FILE_OVERFLOW;
+	case ESPIPE:
+		return OMRPORT_ERROR_FILE_SPIPE;
+	default:
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+}
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+static BOOLEAN
+isValidRequest(OMRFileAsyncRequest *request)
+{
+	switch (request->operation) {
+	case OMRPORT_FILE_ASYNC_OP_PREAD:
+	case OMRPORT_FILE_ASYNC_OP_PWRITE:
+		return (NULL != request->buffer) || (0 == request->length);
+	case OMRPORT_FILE_ASYNC_OP_PREADV:
+	case OMRPORT_FILE_ASYNC_OP_PWRITEV:
+		return (NULL != request->iov) || (0 == request->iovCount);
+	case OMRPORT_FILE_ASYNC_OP_FSYNC:
+		return TRUE;
+	case OMRPORT_FILE_ASYNC_OP_FALLOCATE:
+		return 0 != request->length;
+	default:
+		return FALSE;
+	}
+}
+
+/* Perform a request synchronously on the calling thread, returning its result. */
+static intptr_t
+performRequest(struct OMRPortLibrary *portLibrary, OMRFileAsyncRequest *request)
+{
+	intptr_t nativeFd = portLibrary->file_convert_omrfile_fd_to_native_fd(portLibrary, request->fd);
+	OMRFileAsyncIOVec single;
+	OMRFileAsyncIOVec *iov = request->iov;
+	uintptr_t iovCount = request->iovCount;
+	BOOLEAN isRead = FALSE;
+	uint64_t offset = request->offset;
+	intptr_t transferred = 0;
+	uintptr_t i = 0;
+
+	switch (request->operation) {
+	case OMRPORT_FILE_ASYNC_OP_PREAD:
+		isRead = TRUE;
+		/* FALLTHROUGH */
+	case OMRPORT_FILE_ASYNC_OP_PWRITE:
+		single.base = request->buffer;
+		single.length = request->length;
+		iov = &single;
+		iovCount = 1;
+		break;
+	case OMRPORT_FILE_ASYNC_OP_PREADV:
+		isRead = TRUE;
+		break;
+	case OMRPORT_FILE_ASYNC_OP_PWRITEV:
+		break;
+	case OMRPORT_FILE_ASYNC_OP_FSYNC:
+#if defined(OMR_OS_WINDOWS)
+		return FlushFileBuffers((HANDLE)nativeFd) ? 0 : OMRPORT_ERROR_FILE_OPFAILED;
+#else /* defined(OMR_OS_WINDOWS) */
+		return (0 == fsync((int)nativeFd)) ? 0 : translateErrno(errno);
+#endif /* defined(OMR_OS_WINDOWS) */
+	case OMRPORT_FILE_ASYNC_OP_FALLOCATE:
+	{
+#if defined(OMR_OS_WINDOWS)
+		FILE_ALLOCATION_INFO allocationInfo;
+
+		allocationInfo.AllocationSize.QuadPart = (LONGLONG)(request->offset + request->length);
+		return SetFileInformationByHandle((HANDLE)nativeFd, FileAllocationInfo, &allocationInfo, sizeof(allocationInfo)) ? 0 : OMRPORT_ERROR_FILE_OPFAILED;
+#elif defined(OSX) || defined(J9ZOS390) /* defined(OMR_OS_WINDOWS) */
+		/* no posix_fallocate: extend the file, as fallocate would */
+		struct stat statBuf;
+		off_t end = (off_t)(request->offset + request->length);
+
+		if (0 != fstat((int)nativeFd, &statBuf)) {
+			return translateErrno(errno);
+		}
+		if ((statBuf.st_size < end) && (0 != ftruncate((int)nativeFd, end))) {
+			return translateErrno(errno);
+		}
+		return 0;
+#else /* defined(OMR_OS_WINDOWS) */
+		int rc = posix_fallocate((int)nativeFd, (off_t)request->offset, (off_t)request->length);
+
+		return (0 == rc) ? 0 : translateErrno(rc);
+#endif /* defined(OMR_OS_WINDOWS) */
+	}
+	default:
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+
+	/* Vectored transfers are done one buffer at a time, stopping at the first short transfer. */
+	for (i = 0; i < iovCount; i++) {
+		uintptr_t length = OMR_MIN(iov[i].length, OMRFILE_ASYNC_MAX_TRANSFER);
+		intptr_t rc = 0;
+#if defined(OMR_OS_WINDOWS)
+		OVERLAPPED overlapped;
+		DWORD count = 0;
+		BOOL success = FALSE;
+
+		memset(&overlapped, 0, sizeof(overlapped));
+		overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+		overlapped.OffsetHigh = (DWORD)(offset >> 32);
+		if (isRead) {
+			success = ReadFile((HANDLE)nativeFd, iov[i].base, (DWORD)length, &count, &overlapped);
+			if (!success && (ERROR_HANDLE_EOF == GetLastError())) {
+				success = TRUE;
+				count = 0;
+			}
+		} else {
+			success = WriteFile((HANDLE)nativeFd, iov[i].base, (DWORD)length, &count, &overlapped);
+		}
+		rc = success ? (intptr_t)count : OMRPORT_ERROR_FILE_OPFAILED;
+#else /* defined(OMR_OS_WINDOWS) */
+		do {
+			if (isRead) {
+				rc = (intptr_t)pread((int)nativeFd, iov[i].base, (size_t)length, (off_t)offset);
+			} else {
+				rc = (intptr_t)pwrite((int)nativeFd, iov[i].base, (size_t)length, (off_t)offset);
+			}
+		} while ((-1 == rc) && (EINTR == errno));
+		if (-1 == rc) {
+			rc = translateErrno(errno);
+		}
+#endif /* defined(OMR_OS_WINDOWS) */
+		if (rc < 0) {
+			/* report the error only if nothing was transferred */
+			return (0 == transferred) ? rc : transferred;
+		}
+		transferred += rc;
+		offset += rc;
+		if ((uintptr_t)rc != iov[i].length) {
+			break;
+		}
+	}
+	return transferred;
+}
+
+static int J9THREAD_PROC
+threadPoolWorker(void *arg)
+{
+	OMRFileAsyncQueue *queue = (OMRFileAsyncQueue *)arg;
+
+	omrthread_monitor_enter(queue->monitor);
+	for (;;) {
+		OMRFileAsyncRequest *request = queue->pendingHead;
+
+		if (NULL == request) {
+			if (queue->shutdown) {
+				break;
+			}
+			omrthread_monitor_wait(queue->monitor);
+			continue;
+		}
+		queue->pendingHead = request->next;
+		if (NULL == queue->pendingHead) {
+			queue->pendingTail = NULL;
+		}
+		omrthread_monitor_exit(queue->monitor);
+
+		request->result = performRequest(queue->portLibrary, request);
+
+		omrthread_monitor_enter(queue->monitor);
+		request->next = NULL;
+		if (NULL == queue->completedTail) {
+			queue->completedHead = request;
+		} else {
+			queue->completedTail->next = request;
+		}
+		queue->completedTail = request;
+		omrthread_monitor_notify_all(queue->monitor);
+	}
+	/* stopThreadPool joins the workers before the monitor is destroyed */
+	omrthread_monitor_exit(queue->monitor);
+
+	return 0;
+}
+
+static int32_t
+startThreadPool(OMRFileAsyncQueue *queue)
+{
+	uintptr_t threads = OMR_MIN(queue->depth, OMRFILE_ASYNC_MAX_POOL_THREADS);
+	uintptr_t i = 0;
+
+	queue->backend = OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL;
+	for (i = 0; i < threads; i++) {
+		if (J9THREAD_SUCCESS != createJoinableThreadWithCategory(&queue->workers[i], OMRFILE_ASYNC_POOL_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0,
+				&threadPoolWorker, queue, J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			break;
+		}
+		queue->workerCount += 1;
+	}
+	return (0 == i) ? OMRPORT_ERROR_FILE_OPFAILED : 0;
+}
+
+static void
+stopThreadPool(OMRFileAsyncQueue *queue)
+{
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(queue->monitor);
+	queue->shutdown = TRUE;
+	omrthread_monitor_notify_all(queue->monitor);
+	omrthread_monitor_exit(queue->monitor);
+	for (i = 0; i < queue->workerCount; i++) {
+		omrthread_join(queue->workers[i]);
+	}
+	queue->workerCount = 0;
+}
+
+#if defined(OMR_HAVE_LINUX_IO_URING)
+/* Set up an io_uring for the queue. Returns FALSE if io_uring can't be used. */
+static BOOLEAN
+startRing(OMRFileAsyncQueue *queue)
+{
+	struct io_uring_params params;
+	uint8_t *sqRing = NULL;
+	uint8_t *cqRing = NULL;
+	int ringFd = -1;
+
+	memset(&params, 0, sizeof(params));
+	ringFd = (int)syscall(__NR_io_uring_setup, (unsigned int)queue->depth, &params);
+	if (ringFd < 0) {
+		return FALSE;
+	}
+	/* IORING_FEAT_RW_CUR_POS came with IORING_OP_READ, IORING_OP_WRITE and IORING_OP_FALLOCATE */
+	if (OMR_ARE_NO_BITS_SET(params.features, IORING_FEAT_RW_CUR_POS)) {
+		close(ringFd);
+		return FALSE;
+	}
+
+	queue->ringFd = ringFd;
+	queue->sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+	queue->cqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+	if (OMR_ARE_ANY_BITS_SET(params.features, IORING_FEAT_SINGLE_MMAP)) {
+		queue->sqRingSize = OMR_MAX(queue->sqRingSize, queue->cqRingSize);
+		queue->cqRingSize = queue->sqRingSize;
+	}
+	sqRing = mmap(NULL, queue->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+	if (MAP_FAILED == sqRing) {
+		close(ringFd);
+		return FALSE;
+	}
+	if (OMR_ARE_ANY_BITS_SET(params.features, IORING_FEAT_SINGLE_MMAP)) {
+		cqRing = sqRing;
+	} else {
+		cqRing = mmap(NULL, queue->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+		if (MAP_FAILED == cqRing) {
+			munmap(sqRing, queue->sqRingSize);
+			close(ringFd);
+			return FALSE;
+		}
+	}
+	queue->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	queue->sqes = mmap(NULL, queue->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+	if (MAP_FAILED == (void *)queue->sqes) {
+		if (cqRing != sqRing) {
+			munmap(cqRing, queue->cqRingSize);
+		}
+		munmap(sqRing, queue->sqRingSize);
+		close(ringFd);
+		return FALSE;
+	}
+
+	queue->sqRing = sqRing;
+	queue->cqRing = cqRing;
+	queue->sqHead = (uint32_t *)(sqRing + params.sq_off.head);
+	queue->sqTail = (uint32_t *)(sqRing + params.sq_off.tail);
+	queue->sqMask = (uint32_t *)(sqRing + params.sq_off.ring_mask);
+	queue->sqArray = (uint32_t *)(sqRing + params.sq_off.array);
+	queue->cqHead = (uint32_t *)(cqRing + params.cq_off.head);
+	queue->cqTail = (uint32_t *)(cqRing + params.cq_off.tail);
+	queue->cqMask = (uint32_t *)(cqRing + params.cq_off.ring_mask);
+	queue->cqes = (struct io_uring_cqe *)(cqRing + params.cq_off.cqes);
+	queue->backend = OMRPORT_FILE_ASYNC_BACKEND_IO_URING;
+	return TRUE;
+}
+
+static void
+stopRing(OMRFileAsyncQueue *queue)
+{
+	munmap(queue->sqes, queue->sqesSize);
+	if (queue->cqRing != queue->sqRing) {
+		munmap(queue->cqRing, queue->cqRingSize);
+	}
+	munmap(queue->sqRing, queue->sqRingSize);
+	close(queue->ringFd);
+}
+
+/* Fill the next submission queue entry. Caller holds the queue monitor. */
+static void
+prepareRingEntry(OMRFileAsyncQueue *queue, OMRFileAsyncRequest *request)
+{
+	uint32_t tail = *queue->sqTail + queue->unsubmitted;
+	uint32_t index = tail & *queue->sqMask;
+	struct io_uring_sqe *sqe = &queue->sqes[index];
+
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->fd = (int32_t)queue->portLibrary->file_convert_omrfile_fd_to_native_fd(queue->portLibrary, request->fd);
+	sqe->off = request->offset;
+	sqe->user_data = (uint64_t)(uintptr_t)request;
+	switch (request->operation) {
+	case OMRPORT_FILE_ASYNC_OP_PREAD:
+		sqe->opcode = IORING_OP_READ;
+		sqe->addr = (uint64_t)(uintptr_t)request->buffer;
+		sqe->len = (uint32_t)OMR_MIN(request->length, OMRFILE_ASYNC_MAX_TRANSFER);
+		break;
+	case OMRPORT_FILE_ASYNC_OP_PWRITE:
+		sqe->opcode = IORING_OP_WRITE;
+		sqe->addr = (uint64_t)(uintptr_t)request->buffer;
+		sqe->len = (uint32_t)OMR_MIN(request->length, OMRFILE_ASYNC_MAX_TRANSFER);
+		break;
+	case OMRPORT_FILE_ASYNC_OP_PREADV:
+		/* OMRFileAsyncIOVec has the layout of struct iovec */
+		sqe->opcode = IORING_OP_READV;
+		sqe->addr = (uint64_t)(uintptr_t)request->iov;
+		sqe->len = (uint32_t)request->iovCount;
+		break;
+	case OMRPORT_FILE_ASYNC_OP_PWRITEV:
+		sqe->opcode = IORING_OP_WRITEV;
+		sqe->addr = (uint64_t)(uintptr_t)request->iov;
+		sqe->len = (uint32_t)request->iovCount;
+		break;
+	case OMRPORT_FILE_ASYNC_OP_FSYNC:
+		sqe->opcode = IORING_OP_FSYNC;
+		break;
+	case OMRPORT_FILE_ASYNC_OP_FALLOCATE:
+		/* the length is passed in addr and the mode in len */
+		sqe->opcode = IORING_OP_FALLOCATE;
+		sqe->addr = request->length;
+		break;
+	}
+	queue->sqArray[index] = index;
+	queue->unsubmitted += 1;
+}
+
+/*
+ * Enter the kernel to submit all published entries it hasn't consumed yet, including
+ * any left over from an earlier failed enter, and if minComplete is non-zero, wait
+ * for completions. Returns 0, or a negative portable error code.
+ */
+static int32_t
+enterRing(OMRFileAsyncQueue *queue, uint32_t minComplete)
+{
+	uint32_t flags = (0 == minComplete) ? 0 : IORING_ENTER_GETEVENTS;
+	uint32_t toSubmit = __atomic_load_n(queue->sqTail, __ATOMIC_ACQUIRE) - __atomic_load_n(queue->sqHead, __ATOMIC_ACQUIRE);
+	long rc = 0;
+
+	do {
+		rc = syscall(__NR_io_uring_enter, queue->ringFd, toSubmit, minComplete, flags, NULL, 0);
+	} while ((rc < 0) && (EINTR == errno));
+	return (rc < 0) ? (int32_t)translateErrno(errno) : 0;
+}
+
+/* Move completed requests from the completion queue onto a list. Only the polling thread reaps. */
+static uintptr_t
+reapRing(OMRFileAsyncQueue *queue, OMRFileAsyncRequest **head, OMRFileAsyncRequest **tail)
+{
+	uint32_t cqHead = *queue->cqHead;
+	uint32_t cqTail = __atomic_load_n(queue->cqTail, __ATOMIC_ACQUIRE);
+	uintptr_t count = 0;
+
+	while (cqHead != cqTail) {
+		struct io_uring_cqe *cqe = &queue->cqes[cqHead & *queue->cqMask];
+		OMRFileAsyncRequest *request = (OMRFileAsyncRequest *)(uintptr_t)cqe->user_data;
+
+		request->result = (cqe->res < 0) ? translateErrno(-cqe->res) : (intptr_t)cqe->res;
+		request->next = NULL;
+		if (NULL == *tail) {
+			*head = request;
+		} else {
+			(*tail)->next = request;
+		}
+		*tail = request;
+		cqHead += 1;
+		count += 1;
+	}
+	__atomic_store_n(queue->cqHead, cqHead, __ATOMIC_RELEASE);
+	return count;
+}
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+
+/**
+ * Open a queue for asynchronous file operations.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queueDepth The maximum number of requests that may be outstanding on the queue
+ * @param[in] flags OMRPORT_FILE_ASYNC_FORCE_THREAD_POOL to use the thread pool backend even where io_uring is available
+ * @param[out] queue The new queue
+ *
+ * @return 0 on success, otherwise a negative portable error code
+ */
+int32_t
+omrfile_async_open(struct OMRPortLibrary *portLibrary, uintptr_t queueDepth, uint32_t flags, struct OMRFileAsyncQueue **queue)
+{
+	OMRFileAsyncQueue *newQueue = NULL;
+	int32_t rc = 0;
+
+	*queue = NULL;
+	if ((0 == queueDepth) || (queueDepth > U_32_MAX)) {
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+	newQueue = portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRFileAsyncQueue), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newQueue) {
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	memset(newQueue, 0, sizeof(OMRFileAsyncQueue));
+	newQueue->portLibrary = portLibrary;
+	newQueue->depth = queueDepth;
+	if (0 != omrthread_monitor_init_with_name(&newQueue->monitor, 0, "omrfile async queue")) {
+		portLibrary->mem_free_memory(portLibrary, newQueue);
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+
+#if defined(OMR_HAVE_LINUX_IO_URING)
+	if (OMR_ARE_NO_BITS_SET(flags, OMRPORT_FILE_ASYNC_FORCE_THREAD_POOL) && startRing(newQueue)) {
+		*queue = newQueue;
+		return 0;
+	}
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+
+	rc = startThreadPool(newQueue);
+	if (0 != rc) {
+		stopThreadPool(newQueue);
+		omrthread_monitor_destroy(newQueue->monitor);
+		portLibrary->mem_free_memory(portLibrary, newQueue);
+		return rc;
+	}
+	*queue = newQueue;
+	return 0;
+}
+
+/**
+ * Close a queue, first waiting for its outstanding requests. Callbacks of the
+ * outstanding requests are called from this function.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queue The queue to close, may be NULL
+ */
+void
+omrfile_async_close(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue)
+{
+	if (NULL != queue) {
+		while (0 != queue->inFlight) {
+			if (omrfile_async_poll(portLibrary, queue, queue->inFlight) < 0) {
+				break;
+			}
+		}
+#if defined(OMR_HAVE_LINUX_IO_URING)
+		if (OMRPORT_FILE_ASYNC_BACKEND_IO_URING == queue->backend) {
+			stopRing(queue);
+		} else
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+		{
+			stopThreadPool(queue);
+		}
+		omrthread_monitor_destroy(queue->monitor);
+		portLibrary->mem_free_memory(portLibrary, queue);
+	}
+}
+
+/**
+ * Submit requests to a queue. Requests are started in order, but may complete in
+ * any order: requests that depend on each other, such as a write and a following
+ * fsync, must not be outstanding at the same time.
+ *
+ * May be called from any thread.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queue The queue
+ * @param[in] requests The requests to submit
+ * @param[in] count The number of requests
+ *
+ * @return the number of requests submitted, which is less than count if the queue
+ * is full or a request is invalid; or a negative portable error code if none were
+ * submitted: OMRPORT_ERROR_FILE_WOULDBLOCK when the queue is full, and
+ * OMRPORT_ERROR_FILE_INVAL when the first request is invalid.
+ */
+intptr_t
+omrfile_async_submit(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue, struct OMRFileAsyncRequest **requests, uintptr_t count)
+{
+	intptr_t rc = 0;
+	uintptr_t submitted = 0;
+
+	omrthread_monitor_enter(queue->monitor);
+	count = OMR_MIN(count, queue->depth - queue->inFlight);
+	while ((submitted < count) && isValidRequest(requests[submitted])) {
+		OMRFileAsyncRequest *request = requests[submitted];
+
+		request->result = 0;
+		request->next = NULL;
+#if defined(OMR_HAVE_LINUX_IO_URING)
+		if (OMRPORT_FILE_ASYNC_BACKEND_IO_URING == queue->backend) {
+			prepareRingEntry(queue, request);
+		} else
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+		{
+			if (NULL == queue->pendingTail) {
+				queue->pendingHead = request;
+			} else {
+				queue->pendingTail->next = request;
+			}
+			queue->pendingTail = request;
+		}
+		submitted += 1;
+	}
+	queue->inFlight += submitted;
+
+#if defined(OMR_HAVE_LINUX_IO_URING)
+	if ((OMRPORT_FILE_ASYNC_BACKEND_IO_URING == queue->backend) && (0 != queue->unsubmitted)) {
+		__atomic_store_n(queue->sqTail, *queue->sqTail + queue->unsubmitted, __ATOMIC_RELEASE);
+		queue->unsubmitted = 0;
+		/* entries the kernel doesn't take now are submitted by the next enter */
+		enterRing(queue, 0);
+	} else
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+	if (0 != submitted) {
+		omrthread_monitor_notify_all(queue->monitor);
+	}
+	omrthread_monitor_exit(queue->monitor);
+
+	if (0 != submitted) {
+		rc = (intptr_t)submitted;
+	} else if (0 == count) {
+		rc = OMRPORT_ERROR_FILE_WOULDBLOCK;
+	} else {
+		rc = OMRPORT_ERROR_FILE_INVAL;
+	}
+	return rc;
+}
+
+/**
+ * Collect completed requests, calling their callbacks on this thread.
+ *
+ * Only one thread at a time may poll a queue.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queue The queue
+ * @param[in] minCompletions The number of completions to wait for, limited to the
+ * number of outstanding requests. 0 collects what has already completed without waiting.
+ *
+ * @return the number of requests completed, or a negative portable error code
+ */
+intptr_t
+omrfile_async_poll(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue, uintptr_t minCompletions)
+{
+	OMRFileAsyncRequest *head = NULL;
+	OMRFileAsyncRequest *tail = NULL;
+	uintptr_t completed = 0;
+
+	omrthread_monitor_enter(queue->monitor);
+	minCompletions = OMR_MIN(minCompletions, queue->inFlight);
+#if defined(OMR_HAVE_LINUX_IO_URING)
+	if (OMRPORT_FILE_ASYNC_BACKEND_IO_URING == queue->backend) {
+		omrthread_monitor_exit(queue->monitor);
+		for (;;) {
+			int32_t rc = 0;
+
+			completed += reapRing(queue, &head, &tail);
+			if (completed >= minCompletions) {
+				break;
+			}
+			rc = enterRing(queue, 1);
+			if ((0 != rc) && (OMRPORT_ERROR_FILE_EAGAIN != rc)) {
+				if (0 == completed) {
+					return rc;
+				}
+				break;
+			}
+		}
+		omrthread_monitor_enter(queue->monitor);
+	} else
+#endif /* defined(OMR_HAVE_LINUX_IO_URING) */
+	{
+		for (;;) {
+			OMRFileAsyncRequest *request = queue->completedHead;
+
+			for (; NULL != request; request = request->next) {
+				completed += 1;
+			}
+			if (NULL != queue->completedHead) {
+				if (NULL == tail) {
+					head = queue->completedHead;
+				} else {
+					tail->next = queue->completedHead;
+				}
+				tail = queue->completedTail;
+				queue->completedHead = NULL;
+				queue->completedTail = NULL;
+			}
+			if (completed >= minCompletions) {
+				break;
+			}
+			omrthread_monitor_wait(queue->monitor);
+		}
+	}
+	queue->inFlight -= completed;
+	omrthread_monitor_exit(queue->monitor);
+
+	while (NULL != head) {
+		OMRFileAsyncRequest *request = head;
+
+		/* the callback may reuse or free the request */
+		head = request->next;
+		request->next = NULL;
+		if (NULL != request->callback) {
+			request->callback(portLibrary, request);
+		}
+	}
+	return (intptr_t)completed;
+}
+
+/**
+ * Get the backend used by a queue.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queue The queue
+ *
+ * @return OMRPORT_FILE_ASYNC_BACKEND_IO_URING or OMRPORT_FILE_ASYNC_BACKEND_THREAD_POOL
+ */
+uint32_t
+omrfile_async_get_backend(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue)
+{
+	return queue->backend;
+}
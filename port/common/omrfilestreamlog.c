@@ -0,0 +1,701 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Buffered multi-producer log streams
+ */
+
+/*
+ * A log stream lets many threads append records to one file without serializing on a
+ * lock. Each thread formats into a staging buffer of its own. Full buffers are pushed
+ * onto a lock-free stack, and a flusher thread takes the whole stack at once and
+ * writes the buffers with as few writev calls as possible.
+ *
+ * A staging slot is guarded by a state word instead of a lock. Its owner moves it
+ * from IDLE to WRITING for the length of one record. The flusher moves it from IDLE
+ * to STEALING when it needs to pick up a partly filled buffer, for a flush barrier,
+ * on the periodic sweep, or on close. Because every hand-off from a slot happens in
+ * one of these states, the records of one thread reach the file in the order they
+ * were written. Records of different threads are interleaved at buffer granularity,
+ * and a record is never split across buffers.
+ */
+
+#include <string.h>
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrstdarg.h"
+#include "omrthread.h"
+#include "omrutil.h"
+#include "omrutilbase.h"
+
+#if !defined(OMR_OS_WINDOWS)
+#include <errno.h>
+#include <sys/uio.h>
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+#define LOG_STREAM_DEFAULT_BUFFER_SIZE ((uintptr_t)64 * 1024)
+#define LOG_STREAM_DEFAULT_FLUSH_INTERVAL_MILLIS 1000
+#define LOG_STREAM_MAX_IOV 64
+#define LOG_STREAM_FLUSHER_STACK_SIZE ((uintptr_t)64 * 1024)
+
+#define LOG_STAGING_IDLE 0
+#define LOG_STAGING_WRITING 1
+#define LOG_STAGING_STEALING 2
+
+struct OMRLogStaging;
+
+typedef struct OMRLogBuffer {
+	struct OMRLogBuffer *next;
+	struct OMRLogStaging *owner; /**< slot the buffer is recycled to, NULL for an oversized buffer */
+	uintptr_t size;
+	uintptr_t used;
+	char *data;
+} OMRLogBuffer;
+
+typedef struct OMRLogStaging {
+	struct OMRLogStaging *next; /**< all slots of the stream, newest first */
+	struct OMRLogStream *stream;
+	volatile uintptr_t state;
+	volatile uintptr_t owned; /**< non-zero while a thread has the slot */
+	OMRLogBuffer *current;
+	OMRLogBuffer *volatile spare; /**< a written buffer handed back by the flusher */
+} OMRLogStaging;
+
+typedef struct OMRLogStream {
+	struct OMRPortLibrary *portLibrary;
+	intptr_t fd;
+	uintptr_t bufferSize;
+	uintptr_t flushIntervalMillis;
+	omrthread_tls_key_t key;
+	OMRLogBuffer *volatile pending; /**< handed off buffers, newest first */
+	OMRLogStaging *stagingList; /**< guarded by monitor; slots are only added, never removed */
+	OMRLogStaging sharedStaging; /**< used by threads that are not attached to the thread library */
+	omrthread_monitor_t monitor;
+	omrthread_t flusher; /**< joined by omrfilestream_log_close */
+	uintptr_t flushRequested;
+	uintptr_t flushCompleted;
+	BOOLEAN shutdown;
+	BOOLEAN flusherExited;
+	int32_t writeError; /**< first write failure, reported by flush and close */
+} OMRLogStream;
+
+static void
+releaseStaging(void *value)
+{
+	OMRLogStaging *staging = (OMRLogStaging *)value;
+
+	/* The thread is exiting; the slot and any data in it are picked up by the next thread or sweep */
+	issueWriteBarrier();
+	staging->owned = 0;
+}
+
+static OMRLogStaging *
+getStaging(OMRLogStream *stream)
+{
+	omrthread_t self = omrthread_self();
+	OMRLogStaging *staging = NULL;
+
+	if (NULL == self) {
+		return &stream->sharedStaging;
+	}
+	staging = (OMRLogStaging *)J9THREAD_TLS_GET(self, stream->key);
+	if (NULL == staging) {
+		struct OMRPortLibrary *portLibrary = stream->portLibrary;
+
+		omrthread_monitor_enter(stream->monitor);
+		for (staging = stream->stagingList; NULL != staging; staging = staging->next) {
+			if (0 == staging->owned) {
+				break;
+			}
+		}
+		if (NULL == staging) {
+			staging = (OMRLogStaging *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRLogStaging), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+			if (NULL != staging) {
+				memset(staging, 0, sizeof(OMRLogStaging));
+				staging->stream = stream;
+				staging->next = stream->stagingList;
+				stream->stagingList = staging;
+			}
+		}
+		if (NULL != staging) {
+			staging->owned = 1;
+		}
+		omrthread_monitor_exit(stream->monitor);
+
+		if ((NULL == staging) || (0 != omrthread_tls_set(self, stream->key, staging))) {
+			if (NULL != staging) {
+				staging->owned = 0;
+			}
+			staging = &stream->sharedStaging;
+		}
+	}
+	return staging;
+}
+
+static void
+acquireStaging(OMRLogStaging *staging)
+{
+	/* Only contended by a flusher sweep or by threads sharing the unattached slot */
+	while (LOG_STAGING_IDLE != compareAndSwapUDATA((uintptr_t *)&staging->state, LOG_STAGING_IDLE, LOG_STAGING_WRITING)) {
+		omrthread_yield();
+	}
+}
+
+static void
+releaseStagingState(OMRLogStaging *staging)
+{
+	issueWriteBarrier();
+	staging->state = LOG_STAGING_IDLE;
+}
+
+/**
+ * Push a buffer onto the pending stack. Buffers are only ever removed by taking the whole
+ * stack, so the push cannot suffer from ABA.
+ *
+ * @return TRUE if the stack was empty and the flusher may need waking
+ */
+static BOOLEAN
+pushPending(OMRLogStream *stream, OMRLogBuffer *buffer)
+{
+	OMRLogBuffer *head = NULL;
+
+	do {
+		head = stream->pending;
+		buffer->next = head;
+		issueWriteBarrier();
+	} while ((uintptr_t)head != compareAndSwapUDATA((uintptr_t *)&stream->pending, (uintptr_t)head, (uintptr_t)buffer));
+	return NULL == head;
+}
+
+static void
+handOff(OMRLogStream *stream, OMRLogBuffer *buffer)
+{
+	if (pushPending(stream, buffer)) {
+		omrthread_monitor_enter(stream->monitor);
+		omrthread_monitor_notify(stream->monitor);
+		omrthread_monitor_exit(stream->monitor);
+	}
+}
+
+/**
+ * Get an empty buffer with room for at least minimumSize bytes, preferring the slot's spare.
+ */
+static OMRLogBuffer *
+newBuffer(OMRLogStream *stream, OMRLogStaging *staging, uintptr_t minimumSize)
+{
+	struct OMRPortLibrary *portLibrary = stream->portLibrary;
+	OMRLogBuffer *buffer = NULL;
+	uintptr_t size = stream->bufferSize;
+
+	if (minimumSize <= size) {
+		buffer = staging->spare;
+		if (NULL != buffer) {
+			/* The flusher only replaces a NULL spare, so this cannot fail */
+			compareAndSwapUDATA((uintptr_t *)&staging->spare, (uintptr_t)buffer, 0);
+			return buffer;
+		}
+	} else {
+		size = minimumSize;
+	}
+	buffer = (OMRLogBuffer *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRLogBuffer) + size, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL != buffer) {
+		buffer->next = NULL;
+		buffer->owner = (size == stream->bufferSize) ? staging : NULL;
+		buffer->size = size;
+		buffer->used = 0;
+		buffer->data = (char *)(buffer + 1);
+	}
+	return buffer;
+}
+
+/**
+ * Return the slot's buffer with at least byteCount bytes free, handing off the current
+ * buffer if the record does not fit in it. The slot must be held.
+ */
+static OMRLogBuffer *
+reserveSpace(OMRLogStream *stream, OMRLogStaging *staging, uintptr_t byteCount)
+{
+	OMRLogBuffer *buffer = staging->current;
+
+	if ((NULL != buffer) && ((buffer->size - buffer->used) < byteCount)) {
+		handOff(stream, buffer);
+		buffer = NULL;
+	}
+	if (NULL == buffer) {
+		buffer = newBuffer(stream, staging, byteCount);
+	}
+	staging->current = buffer;
+	return buffer;
+}
+
+/**
+ * Finish a record. A buffer that was allocated for one oversized record is handed off at once.
+ */
+static void
+commitSpace(OMRLogStream *stream, OMRLogStaging *staging, OMRLogBuffer *buffer)
+{
+	if (NULL == buffer->owner) {
+		staging->current = NULL;
+		handOff(stream, buffer);
+	}
+}
+
+/**
+ * Hand off the partly filled buffer of a slot. Writers hold their slot only for the length
+ * of one record, so waiting for a busy slot is short.
+ */
+static void
+sweepStaging(OMRLogStream *stream, OMRLogStaging *staging)
+{
+	OMRLogBuffer *buffer = NULL;
+
+	while (LOG_STAGING_IDLE != compareAndSwapUDATA((uintptr_t *)&staging->state, LOG_STAGING_IDLE, LOG_STAGING_STEALING)) {
+		omrthread_yield();
+	}
+	buffer = staging->current;
+	if ((NULL != buffer) && (0 != buffer->used)) {
+		staging->current = NULL;
+		pushPending(stream, buffer);
+	}
+	releaseStagingState(staging);
+}
+
+/**
+ * Write count buffers to the stream's file, retrying short writes.
+ */
+static void
+writeBuffers(OMRLogStream *stream, OMRLogBuffer **buffers, uintptr_t count)
+{
+#if defined(OMR_OS_WINDOWS)
+	struct OMRPortLibrary *portLibrary = stream->portLibrary;
+	uintptr_t i = 0;
+
+	for (i = 0; i < count; i++) {
+		intptr_t rc = portLibrary->file_write(portLibrary, stream->fd, buffers[i]->data, (intptr_t)buffers[i]->used);
+		if ((rc < 0) && (0 == stream->writeError)) {
+			stream->writeError = (int32_t)rc;
+		}
+	}
+#else /* defined(OMR_OS_WINDOWS) */
+	struct iovec iov[LOG_STREAM_MAX_IOV];
+	struct iovec *next = iov;
+	int nativeFd = (int)((stream->fd < FD_BIAS) ? stream->fd : (stream->fd - FD_BIAS));
+	uintptr_t i = 0;
+
+	for (i = 0; i < count; i++) {
+		iov[i].iov_base = buffers[i]->data;
+		iov[i].iov_len = buffers[i]->used;
+	}
+	while (count > 0) {
+		ssize_t written = writev(nativeFd, next, (int)count);
+		if (written < 0) {
+			if (EINTR == errno) {
+				continue;
+			}
+			if (0 == stream->writeError) {
+				stream->writeError = OMRPORT_ERROR_FILE_IO;
+			}
+			break;
+		}
+		while ((count > 0) && ((size_t)written >= next->iov_len)) {
+			written -= next->iov_len;
+			next += 1;
+			count -= 1;
+		}
+		if (count > 0) {
+			next->iov_base = (char *)next->iov_base + written;
+			next->iov_len -= written;
+		}
+	}
+#endif /* defined(OMR_OS_WINDOWS) */
+}
+
+static void
+recycleBuffer(OMRLogStream *stream, OMRLogBuffer *buffer)
+{
+	struct OMRPortLibrary *portLibrary = stream->portLibrary;
+
+	buffer->used = 0;
+	buffer->next = NULL;
+	if ((NULL == buffer->owner)
+		|| (0 != compareAndSwapUDATA((uintptr_t *)&buffer->owner->spare, 0, (uintptr_t)buffer))
+	) {
+		portLibrary->mem_free_memory(portLibrary, buffer);
+	}
+}
+
+/**
+ * Write every handed off buffer in hand-off order.
+ */
+static void
+writePending(OMRLogStream *stream)
+{
+	OMRLogBuffer *list = NULL;
+	OMRLogBuffer *ordered = NULL;
+
+	do {
+		list = stream->pending;
+	} while ((uintptr_t)list != compareAndSwapUDATA((uintptr_t *)&stream->pending, (uintptr_t)list, 0));
+	issueReadBarrier();
+
+	while (NULL != list) {
+		OMRLogBuffer *next = list->next;
+		list->next = ordered;
+		ordered = list;
+		list = next;
+	}
+
+	while (NULL != ordered) {
+		OMRLogBuffer *batch[LOG_STREAM_MAX_IOV];
+		uintptr_t count = 0;
+		uintptr_t i = 0;
+
+		while ((NULL != ordered) && (count < LOG_STREAM_MAX_IOV)) {
+			batch[count] = ordered;
+			ordered = ordered->next;
+			count += 1;
+		}
+		writeBuffers(stream, batch, count);
+		for (i = 0; i < count; i++) {
+			recycleBuffer(stream, batch[i]);
+		}
+	}
+}
+
+static int J9THREAD_PROC
+logFlusherThread(void *arg)
+{
+	OMRLogStream *stream = (OMRLogStream *)arg;
+	struct OMRPortLibrary *portLibrary = stream->portLibrary;
+	uint64_t intervalNanos = (uint64_t)stream->flushIntervalMillis * 1000000;
+	uint64_t lastSweep = portLibrary->time_nano_time(portLibrary);
+
+	omrthread_monitor_enter(stream->monitor);
+	for (;;) {
+		BOOLEAN sweep = FALSE;
+		BOOLEAN shutdown = FALSE;
+		uintptr_t flushTarget = 0;
+		OMRLogStaging *stagingList = NULL;
+		uint64_t now = portLibrary->time_nano_time(portLibrary);
+
+		if ((NULL == stream->pending) && (stream->flushRequested == stream->flushCompleted) && !stream->shutdown
+			&& ((now - lastSweep) < intervalNanos)
+		) {
+			/* Wait no longer than the rest of the interval since the last sweep */
+			uint64_t remainingNanos = intervalNanos - (now - lastSweep);
+			omrthread_monitor_wait_timed(stream->monitor, (int64_t)(remainingNanos / 1000000), (intptr_t)(remainingNanos % 1000000));
+			now = portLibrary->time_nano_time(portLibrary);
+		}
+		/* Data that sits in a slot for a whole interval is written by the periodic sweep, which is
+		 * timed from the last sweep rather than from the wait so that a steady stream of hand-offs
+		 * from busy writers cannot hold off the data of idle ones
+		 */
+		sweep = ((now - lastSweep) >= intervalNanos);
+		flushTarget = stream->flushRequested;
+		shutdown = stream->shutdown;
+		stagingList = stream->stagingList;
+		omrthread_monitor_exit(stream->monitor);
+
+		if (sweep || shutdown || (flushTarget != stream->flushCompleted)) {
+			OMRLogStaging *staging = NULL;
+			for (staging = stagingList; NULL != staging; staging = staging->next) {
+				sweepStaging(stream, staging);
+			}
+			sweepStaging(stream, &stream->sharedStaging);
+			lastSweep = now;
+		}
+		writePending(stream);
+
+		omrthread_monitor_enter(stream->monitor);
+		if (flushTarget != stream->flushCompleted) {
+			stream->flushCompleted = flushTarget;
+			omrthread_monitor_notify_all(stream->monitor);
+		}
+		if (shutdown) {
+			break;
+		}
+	}
+	stream->flusherExited = TRUE;
+	omrthread_monitor_notify_all(stream->monitor);
+	omrthread_monitor_exit(stream->monitor);
+
+	return 0;
+}
+
+/**
+ * Open a log stream that appends to a file opened with @ref omrfile_open.
+ *
+ * Any number of threads may write to a log stream concurrently. Each thread fills a staging buffer
+ * of its own, and a flusher thread writes full buffers to the file with vectored writes, so writers
+ * do not wait for each other or for the file. Records written by one thread appear in the file in
+ * order and are never split; records of different threads are interleaved in buffer-sized runs.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] fd The file to write to. The stream does not close it.
+ * @param[in] bufferSize Size of each staging buffer, or 0 for the default of 64KB.
+ * @param[in] flushIntervalMillis Longest time data may stay in a staging buffer before it is
+ * written, or 0 for the default of one second.
+ * @param[out] logStream On success, the new log stream.
+ *
+ * @return 0 on success, negative error code on failure.
+ */
+int32_t
+omrfilestream_log_open(struct OMRPortLibrary *portLibrary, intptr_t fd, uintptr_t bufferSize, uintptr_t flushIntervalMillis, struct OMRLogStream **logStream)
+{
+	OMRLogStream *stream = NULL;
+
+	if ((NULL == logStream) || (-1 == fd)) {
+		return OMRPORT_ERROR_FILE_BADF;
+	}
+	*logStream = NULL;
+
+	stream = (OMRLogStream *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRLogStream), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == stream) {
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+	memset(stream, 0, sizeof(OMRLogStream));
+	stream->portLibrary = portLibrary;
+	stream->fd = fd;
+	stream->bufferSize = (0 == bufferSize) ? LOG_STREAM_DEFAULT_BUFFER_SIZE : bufferSize;
+	stream->flushIntervalMillis = (0 == flushIntervalMillis) ? LOG_STREAM_DEFAULT_FLUSH_INTERVAL_MILLIS : flushIntervalMillis;
+	stream->sharedStaging.stream = stream;
+	stream->sharedStaging.owned = 1;
+
+	if (0 != omrthread_tls_alloc_with_finalizer(&stream->key, releaseStaging)) {
+		goto fail;
+	}
+	if (0 != omrthread_monitor_init_with_name(&stream->monitor, 0, "omrfilestream log")) {
+		stream->monitor = NULL;
+		goto fail;
+	}
+	if (J9THREAD_SUCCESS != createJoinableThreadWithCategory(&stream->flusher, LOG_STREAM_FLUSHER_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0,
+			&logFlusherThread, stream, J9THREAD_CATEGORY_SYSTEM_THREAD)
+	) {
+		goto fail;
+	}
+
+	*logStream = stream;
+	return 0;
+
+fail:
+	if (NULL != stream->monitor) {
+		omrthread_monitor_destroy(stream->monitor);
+	}
+	if (0 != stream->key) {
+		omrthread_tls_free(stream->key);
+	}
+	portLibrary->mem_free_memory(portLibrary, stream);
+	return OMRPORT_ERROR_FILE_OPFAILED;
+}
+
+/**
+ * Append a record to a log stream. The record is copied into the calling thread's staging buffer
+ * and written to the file later; use @ref omrfilestream_log_flush to wait for it.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] logStream The log stream.
+ * @param[in] buf The bytes to write.
+ * @param[in] nbytes Number of bytes to write.
+ *
+ * @return nbytes on success, negative error code on failure.
+ */
+intptr_t
+omrfilestream_log_write(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *buf, intptr_t nbytes)
+{
+	OMRLogStaging *staging = NULL;
+	OMRLogBuffer *buffer = NULL;
+
+	if ((NULL == logStream) || (NULL == buf) || (nbytes < 0)) {
+		return OMRPORT_ERROR_FILE_BADF;
+	}
+	if (0 == nbytes) {
+		return 0;
+	}
+
+	staging = getStaging(logStream);
+	acquireStaging(staging);
+	buffer = reserveSpace(logStream, staging, (uintptr_t)nbytes);
+	if (NULL != buffer) {
+		memcpy(buffer->data + buffer->used, buf, (size_t)nbytes);
+		buffer->used += (uintptr_t)nbytes;
+		commitSpace(logStream, staging, buffer);
+	}
+	releaseStagingState(staging);
+
+	return (NULL == buffer) ? OMRPORT_ERROR_FILE_OPFAILED : nbytes;
+}
+
+/**
+ * Format a record into a log stream. Formatting happens on the calling thread, directly into its
+ * staging buffer.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] logStream The log stream.
+ * @param[in] format The format string.
+ * @param[in] args The arguments for format.
+ */
+void
+omrfilestream_log_vprintf(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *format, va_list args)
+{
+	OMRLogStaging *staging = NULL;
+	OMRLogBuffer *buffer = NULL;
+	uintptr_t available = 0;
+	uintptr_t length = 0;
+	va_list argsCopy;
+
+	if ((NULL == logStream) || (NULL == format)) {
+		return;
+	}
+
+	staging = getStaging(logStream);
+	acquireStaging(staging);
+	buffer = staging->current;
+	if (NULL != buffer) {
+		available = buffer->size - buffer->used;
+	}
+	if (available > 1) {
+		COPY_VA_LIST(argsCopy, args);
+		length = portLibrary->str_vprintf(portLibrary, buffer->data + buffer->used, available, format, argsCopy);
+		END_VA_LIST_COPY(argsCopy);
+	}
+	if ((length + 1) >= available) {
+		/* No current buffer, or the record may have been truncated: size it exactly */
+		uintptr_t required = 0;
+		COPY_VA_LIST(argsCopy, args);
+		required = portLibrary->str_vprintf(portLibrary, NULL, 0, format, argsCopy);
+		END_VA_LIST_COPY(argsCopy);
+		if (0 == required) {
+			buffer = NULL;
+		} else if (required > available) {
+			buffer = reserveSpace(logStream, staging, required);
+			if (NULL != buffer) {
+				COPY_VA_LIST(argsCopy, args);
+				length = portLibrary->str_vprintf(portLibrary, buffer->data + buffer->used, required, format, argsCopy);
+				END_VA_LIST_COPY(argsCopy);
+			}
+		}
+	}
+	if (NULL != buffer) {
+		/* the NUL terminator is overwritten by the next record */
+		buffer->used += length;
+		commitSpace(logStream, staging, buffer);
+	}
+	releaseStagingState(staging);
+}
+
+/**
+ * Format a record into a log stream.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] logStream The log stream.
+ * @param[in] format The format string.
+ * @param[in] ... The arguments for format.
+ */
+void
+omrfilestream_log_printf(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *format, ...)
+{
+	va_list args;
+
+	va_start(args, format);
+	portLibrary->filestream_log_vprintf(portLibrary, logStream, format, args);
+	va_end(args);
+}
+
+/**
+ * Flush barrier: wait until every record written to the log stream before the call, by any thread,
+ * has been written to the file. This does not sync the file to storage.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] logStream The log stream.
+ *
+ * @return 0 on success, or the error of the first write to the file that failed.
+ */
+int32_t
+omrfilestream_log_flush(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream)
+{
+	uintptr_t target = 0;
+	int32_t rc = 0;
+
+	if (NULL == logStream) {
+		return OMRPORT_ERROR_FILE_BADF;
+	}
+	omrthread_monitor_enter(logStream->monitor);
+	logStream->flushRequested += 1;
+	target = logStream->flushRequested;
+	omrthread_monitor_notify(logStream->monitor);
+	while (((intptr_t)(logStream->flushCompleted - target) < 0) && !logStream->flusherExited) {
+		omrthread_monitor_wait(logStream->monitor);
+	}
+	rc = logStream->writeError;
+	omrthread_monitor_exit(logStream->monitor);
+
+	return rc;
+}
+
+/**
+ * Write out everything in a log stream and release it. No thread may write to the stream
+ * during or after the call. The file is not closed.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] logStream The log stream.
+ *
+ * @return 0 on success, or the error of the first write to the file that failed.
+ */
+int32_t
+omrfilestream_log_close(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream)
+{
+	OMRLogStaging *staging = NULL;
+	int32_t rc = 0;
+
+	if (NULL == logStream) {
+		return OMRPORT_ERROR_FILE_BADF;
+	}
+
+	omrthread_monitor_enter(logStream->monitor);
+	logStream->shutdown = TRUE;
+	omrthread_monitor_notify(logStream->monitor);
+	omrthread_monitor_exit(logStream->monitor);
+	/* The flusher may still be leaving the monitor after it sets flusherExited, so wait for it to terminate */
+	omrthread_join(logStream->flusher);
+
+	/* Clears the slot of every thread before the slots are freed */
+	omrthread_tls_free(logStream->key);
+
+	rc = logStream->writeError;
+	staging = logStream->stagingList;
+	while (NULL != staging) {
+		OMRLogStaging *next = staging->next;
+		portLibrary->mem_free_memory(portLibrary, staging->current);
+		portLibrary->mem_free_memory(portLibrary, staging->spare);
+		portLibrary->mem_free_memory(portLibrary, staging);
+		staging = next;
+	}
+	portLibrary->mem_free_memory(portLibrary, logStream->sharedStaging.current);
+	portLibrary->mem_free_memory(portLibrary, logStream->sharedStaging.spare);
+	omrthread_monitor_destroy(logStream->monitor);
+	portLibrary->mem_free_memory(portLibrary, logStream);
+
+	return rc;
+}
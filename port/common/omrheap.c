@@ -34,9 +34,9 @@
 
 struct J9Heap {
 	uintptr_t heapSize; /* total size of the heap in number of slots */
-	uintptr_t firstFreeBlock; /* slot number of the first free block within the heap */
+	uintptr_t firstFreeBlock; /* slot number of the first free block within the heap, unused (0) in a segregated-fit heap */
 	uintptr_t lastAllocSlot; /* slot number for the last allocation */
-	uintptr_t largestAllocSizeVisited; /* largest free list entry visited while performing the last allocation */
+	uintptr_t largestAllocSizeVisited; /* largest free list entry visited while performing the last allocation, SEGREGATED_FIT_TAG in a segregated-fit heap */
 };
 
 #define ALIGNMENT_ROUND_DOWN(value) (((uintptr_t) value) & (~(sizeof(uint64_t) - 1)))
@@ -49,13 +49,249 @@ struct J9Heap {
  */
 #define HEAP_MANAGEMENT_OVERHEAD (sizeof(J9Heap)+2*sizeof(uint64_t))
 
+/*
+ * A segregated-fit heap uses the same blocks as a first-fit heap, but keeps its free blocks in
+ * doubly linked lists, one for each power of 2 block size, with a bitmap of the non-empty lists.
+ * The list heads and bitmap are the payload of the first block of the heap, which is never freed,
+ * so anything that walks the blocks of a heap works unchanged. The first two payload slots of a
+ * free block hold the slot numbers of the next and previous blocks in its list (0 for none), so
+ * blocks are never smaller than 2 slots.
+ */
+#define SEGREGATED_FIT_TAG UDATA_MAX
+#define SEGREGATED_FIT_BUCKETS 64
+/* payload of the first block: the bitmap and the list heads */
+#define SEGREGATED_FIT_INDEX_SLOTS (1 + SEGREGATED_FIT_BUCKETS)
+#define SEGREGATED_FIT_MIN_BLOCK 2
+/* free blocks examined in the list for the size of a request before moving to a larger list */
+#define SEGREGATED_FIT_SCAN_LIMIT 8
+
+#define FIRST_BLOCK_SLOT (sizeof(J9Heap) / sizeof(uint64_t))
+#define IS_SEGREGATED_FIT(heap) (SEGREGATED_FIT_TAG == (heap)->largestAllocSizeVisited)
+#define SEGREGATED_FIT_BITMAP(baseSlot) (&(baseSlot)[FIRST_BLOCK_SLOT + 1])
+#define SEGREGATED_FIT_HEADS(baseSlot) (&(baseSlot)[FIRST_BLOCK_SLOT + 2])
+#define FREE_BLOCK_NEXT(baseSlot, slot) ((baseSlot)[(slot) + 1])
+#define FREE_BLOCK_PREVIOUS(baseSlot, slot) ((baseSlot)[(slot) + 2])
+
+/* Index of the most significant bit set in value, which must not be 0 */
+static uintptr_t
+highestBit(uint64_t value)
+{
+#if defined(__GNUC__)
+	return 63 - (uintptr_t)__builtin_clzll(value);
+#else /* defined(__GNUC__) */
+	uintptr_t bit = 0;
+	while (value > 1) {
+		value >>= 1;
+		bit += 1;
+	}
+	return bit;
+#endif /* defined(__GNUC__) */
+}
+
+/* Index of the least significant bit set in value, which must not be 0 */
+static uintptr_t
+lowestBit(uint64_t value)
+{
+#if defined(__GNUC__)
+	return (uintptr_t)__builtin_ctzll(value);
+#else /* defined(__GNUC__) */
+	return highestBit(value & (~value + 1));
+#endif /* defined(__GNUC__) */
+}
+
+/* Add the free block whose top padding is at slot to the list for its size */
+static void
+segregatedFitInsert(int64_t *baseSlot, uintptr_t slot)
+{
+	uint64_t *bitmap = (uint64_t *)SEGREGATED_FIT_BITMAP(baseSlot);
+	int64_t *heads = SEGREGATED_FIT_HEADS(baseSlot);
+	uintptr_t bucket = highestBit((uint64_t)baseSlot[slot]);
+	int64_t head = heads[bucket];
+
+	FREE_BLOCK_NEXT(baseSlot, slot) = head;
+	FREE_BLOCK_PREVIOUS(baseSlot, slot) = 0;
+	if (0 != head) {
+		FREE_BLOCK_PREVIOUS(baseSlot, head) = (int64_t)slot;
+	}
+	heads[bucket] = (int64_t)slot;
+	*bitmap |= ((uint64_t)1) << bucket;
+}
+
+/* Remove the free block whose top padding is at slot from the list for its size */
+static void
+segregatedFitRemove(int64_t *baseSlot, uintptr_t slot)
+{
+	uint64_t *bitmap = (uint64_t *)SEGREGATED_FIT_BITMAP(baseSlot);
+	int64_t *heads = SEGREGATED_FIT_HEADS(baseSlot);
+	uintptr_t bucket = highestBit((uint64_t)baseSlot[slot]);
+	int64_t next = FREE_BLOCK_NEXT(baseSlot, slot);
+	int64_t previous = FREE_BLOCK_PREVIOUS(baseSlot, slot);
+
+	if (0 != previous) {
+		FREE_BLOCK_NEXT(baseSlot, previous) = next;
+	} else {
+		heads[bucket] = next;
+		if (0 == next) {
+			*bitmap &= ~(((uint64_t)1) << bucket);
+		}
+	}
+	if (0 != next) {
+		FREE_BLOCK_PREVIOUS(baseSlot, next) = previous;
+	}
+}
+
+/*
+ * Mark the first requestSize slots of the block at slot, which has been taken off its free list and
+ * has chunkSize slots, as occupied. The rest of the block becomes a new free block if it is big enough.
+ */
+static void
+segregatedFitSplit(int64_t *baseSlot, uintptr_t slot, int64_t chunkSize, int64_t requestSize)
+{
+	int64_t *blockPaddingCursor = &baseSlot[slot];
+	int64_t residualSize = chunkSize - requestSize;
+
+	if (residualSize >= (SEGREGATED_FIT_MIN_BLOCK + 2)) {
+		blockPaddingCursor[0] = -requestSize;
+		blockPaddingCursor[requestSize + 1] = -requestSize;
+		residualSize -= 2;
+		blockPaddingCursor[requestSize + 2] = residualSize;
+		blockPaddingCursor[chunkSize + 1] = residualSize;
+		segregatedFitInsert(baseSlot, slot + requestSize + 2);
+	} else {
+		blockPaddingCursor[0] = -chunkSize;
+		blockPaddingCursor[chunkSize + 1] = -chunkSize;
+	}
+}
+
+static void *
+segregatedFitAllocate(struct J9Heap *heap, uintptr_t requestSize)
+{
+	int64_t *baseSlot = (int64_t *)heap;
+	uint64_t bitmap = *(uint64_t *)SEGREGATED_FIT_BITMAP(baseSlot);
+	int64_t *heads = SEGREGATED_FIT_HEADS(baseSlot);
+	uintptr_t bucket = 0;
+	uintptr_t scanned = 0;
+	int64_t slot = 0;
+	uint64_t largerBuckets = 0;
+
+	if (requestSize < SEGREGATED_FIT_MIN_BLOCK) {
+		requestSize = SEGREGATED_FIT_MIN_BLOCK;
+	}
+	if (requestSize > heap->heapSize) {
+		return NULL;
+	}
+	bucket = highestBit(requestSize);
+
+	/* Blocks in the list for this size may be too small, so examine only the first few of them... */
+	for (slot = heads[bucket]; (0 != slot) && (scanned < SEGREGATED_FIT_SCAN_LIMIT); slot = FREE_BLOCK_NEXT(baseSlot, slot)) {
+		if ((uintptr_t)baseSlot[slot] >= requestSize) {
+			break;
+		}
+		scanned += 1;
+	}
+	if ((0 == slot) || ((uintptr_t)baseSlot[slot] < requestSize)) {
+		/* ...before taking the first block of the next non-empty list, which is certain to fit... */
+		largerBuckets = (bucket < (SEGREGATED_FIT_BUCKETS - 1)) ? (bitmap & ~((((uint64_t)2) << bucket) - 1)) : 0;
+		if (0 != largerBuckets) {
+			slot = heads[lowestBit(largerBuckets)];
+		} else {
+			/* ...or, failing that, finishing the walk of the list for this size */
+			for (; 0 != slot; slot = FREE_BLOCK_NEXT(baseSlot, slot)) {
+				if ((uintptr_t)baseSlot[slot] >= requestSize) {
+					break;
+				}
+			}
+			if (0 == slot) {
+				return NULL;
+			}
+		}
+	}
+
+	segregatedFitRemove(baseSlot, (uintptr_t)slot);
+	segregatedFitSplit(baseSlot, (uintptr_t)slot, baseSlot[slot], (int64_t)requestSize);
+	return &baseSlot[slot + 1];
+}
+
+static void
+segregatedFitFree(struct J9Heap *heap, void *address)
+{
+	int64_t *baseSlot = (int64_t *)heap;
+	int64_t *thisBlockTopPadding = ((int64_t *)address) - 1;
+	int64_t thisBlockSize = -thisBlockTopPadding[0];
+	uintptr_t blockTopSlot = GET_SLOT_NUMBER_FROM(heap, thisBlockTopPadding);
+
+	Assert_PRT_true(thisBlockSize > 0);
+
+	/* the first block holds the free lists and is never free, so every block has a previous block */
+	if (thisBlockTopPadding[-1] > 0) {
+		int64_t previousBlockSize = thisBlockTopPadding[-1];
+		blockTopSlot -= (uintptr_t)(previousBlockSize + 2);
+		segregatedFitRemove(baseSlot, blockTopSlot);
+		thisBlockSize += previousBlockSize + 2;
+	}
+	if ((blockTopSlot + thisBlockSize + 1) != (heap->heapSize - 1)) {
+		uintptr_t nextBlockSlot = blockTopSlot + (uintptr_t)thisBlockSize + 2;
+		int64_t nextBlockSize = baseSlot[nextBlockSlot];
+		if (nextBlockSize > 0) {
+			segregatedFitRemove(baseSlot, nextBlockSlot);
+			thisBlockSize += nextBlockSize + 2;
+		}
+	}
+	baseSlot[blockTopSlot] = thisBlockSize;
+	baseSlot[blockTopSlot + thisBlockSize + 1] = thisBlockSize;
+	segregatedFitInsert(baseSlot, blockTopSlot);
+}
+
+static void *
+segregatedFitReallocate(struct J9Heap *heap, void *address, int64_t requestSize)
+{
+	int64_t *baseSlot = (int64_t *)heap;
+	int64_t *thisBlockTopPadding = ((int64_t *)address) - 1;
+	int64_t thisBlockSize = -thisBlockTopPadding[0];
+	uintptr_t blockTopSlot = GET_SLOT_NUMBER_FROM(heap, thisBlockTopPadding);
+	uintptr_t nextBlockSlot = blockTopSlot + (uintptr_t)thisBlockSize + 2;
+	int64_t nextBlockSize = (nextBlockSlot < heap->heapSize) ? baseSlot[nextBlockSlot] : -1;
+
+	if (requestSize < SEGREGATED_FIT_MIN_BLOCK) {
+		requestSize = SEGREGATED_FIT_MIN_BLOCK;
+	}
+	if (requestSize > thisBlockSize) {
+		if ((nextBlockSize > 0) && ((thisBlockSize + nextBlockSize + 2) >= requestSize)) {
+			Trc_PRT_heap_port_omrheap_reallocate_grow(requestSize - thisBlockSize, thisBlockSize + nextBlockSize + 2 - requestSize);
+			segregatedFitRemove(baseSlot, nextBlockSlot);
+			segregatedFitSplit(baseSlot, blockTopSlot, thisBlockSize + nextBlockSize + 2, requestSize);
+		} else {
+			void *newAddress = NULL;
+
+			Trc_PRT_heap_port_omrheap_reallocate_relocating();
+			newAddress = segregatedFitAllocate(heap, (uintptr_t)requestSize);
+			if (NULL != newAddress) {
+				memcpy(newAddress, address, (size_t)(thisBlockSize * sizeof(uint64_t)));
+				segregatedFitFree(heap, address);
+			}
+			address = newAddress;
+		}
+	} else if (requestSize < thisBlockSize) {
+		Trc_PRT_heap_port_omrheap_reallocate_shrink(requestSize - thisBlockSize);
+		if (nextBlockSize > 0) {
+			/* give the space to the free block that follows */
+			segregatedFitRemove(baseSlot, nextBlockSlot);
+			segregatedFitSplit(baseSlot, blockTopSlot, thisBlockSize + nextBlockSize + 2, requestSize);
+		} else {
+			segregatedFitSplit(baseSlot, blockTopSlot, thisBlockSize, requestSize);
+		}
+	}
+	return address;
+}
+
 /**
 * Initialize a contiguous region of memory at heapBase as a heap. The size of the heap is bounded by heapSize.
 *
 * @param[in] portLibrary The port library
 * @param[in] heapBase Base address of memory region.
 * @param[in] heapSize The size of the memory region to be used as a heap in bytes.
-* @param[in] heapFlags Flags that can affect the heap. Currently, this is not used and is there for future use, for example, to zero out memory. User must pass in zero.
+* @param[in] heapFlags Flags that can affect the heap. Pass OMRPORT_HEAP_SEGREGATED_FIT for a heap whose allocation cost does not
+* grow with fragmentation, or zero for a first-fit heap.
 *
 * @return pointer to an opaque struct representing the heap on success, NULL on failure.
 *
@@ -65,6 +301,10 @@ struct J9Heap {
 *
 * @note the algorithm used in this suballocator is based on the first-fit method in KNUTH, D. E. The Art of Computer Programming. Vol. 1: Fundamental Algorithms. (2nd edition). Addison-Wesley, Reading, Mass., 1973, Sect. 2.5.
 *
+* @note in a segregated-fit heap (OMRPORT_HEAP_SEGREGATED_FIT), free blocks are kept in lists by power of 2 size, and a
+* bitmap of the non-empty lists finds a block that fits in constant time. The lists take 536 bytes at the start of the heap,
+* and allocations are at least 16 bytes.
+*
 * @note due to the overhead of heap management, the actual available space consumed by the user is less than the size of the heap.
 */
 struct J9Heap *
@@ -116,6 +356,28 @@ omrheap_create(struct OMRPortLibrary *portLibrary, void *heapBase, uintptr_t hea
 	adjustedHeapBase->lastAllocSlot = adjustedHeapBase->firstFreeBlock;
 	adjustedHeapBase->largestAllocSizeVisited = blockSize;
 
+	if (OMR_ARE_ANY_BITS_SET(heapFlags, OMRPORT_HEAP_SEGREGATED_FIT)) {
+		uintptr_t freeBlockSlot = FIRST_BLOCK_SLOT + SEGREGATED_FIT_INDEX_SLOTS + 2;
+
+		/* the free lists must fit with a free block of the minimum size */
+		if (blockSize < (SEGREGATED_FIT_INDEX_SLOTS + 2 + SEGREGATED_FIT_MIN_BLOCK)) {
+			Trc_PRT_heap_port_omrheap_create_insufficient_heapSize_exit();
+			return NULL;
+		}
+		blockSize -= SEGREGATED_FIT_INDEX_SLOTS + 2;
+		/* the block holding the free lists is marked occupied */
+		baseSlot[FIRST_BLOCK_SLOT] = (uint64_t)-(int64_t)SEGREGATED_FIT_INDEX_SLOTS;
+		baseSlot[FIRST_BLOCK_SLOT + SEGREGATED_FIT_INDEX_SLOTS + 1] = (uint64_t)-(int64_t)SEGREGATED_FIT_INDEX_SLOTS;
+		memset(&baseSlot[FIRST_BLOCK_SLOT + 1], 0, SEGREGATED_FIT_INDEX_SLOTS * sizeof(uint64_t));
+		baseSlot[freeBlockSlot] = blockSize;
+		baseSlot[numSlots - 1] = blockSize;
+		segregatedFitInsert((int64_t *)baseSlot, freeBlockSlot);
+
+		adjustedHeapBase->firstFreeBlock = 0;
+		adjustedHeapBase->lastAllocSlot = 0;
+		adjustedHeapBase->largestAllocSizeVisited = SEGREGATED_FIT_TAG;
+	}
+
 	Trc_PRT_heap_port_omrheap_create_exit(adjustedHeapBase);
 
 	return adjustedHeapBase;
@@ -152,12 +414,6 @@ omrheap_allocate(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, uintpt
 
 	Trc_PRT_heap_port_omrheap_allocate_entry(heap, byteAmount);
 
-	/* firstFreeBlock is 0 means no free space left on the heap */
-	if (0 == firstFreeBlock) {
-		Trc_PRT_heap_port_omrheap_allocate_heap_full_exit();
-		return NULL;
-	}
-
 	if (0 == byteAmount) {
 		/* if 0 size requested, return just 1 slot */
 		adjustedRequestSize = 1;
@@ -172,6 +428,22 @@ omrheap_allocate(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, uintpt
 		}
 	}
 
+	if (IS_SEGREGATED_FIT(heap)) {
+		candidateBlock = (int64_t *)segregatedFitAllocate(heap, adjustedRequestSize);
+		if (NULL == candidateBlock) {
+			Trc_PRT_heap_port_omrheap_allocate_cannot_satisfy_reuqest_exit();
+		} else {
+			Trc_PRT_heap_port_omrheap_allocate_exit(candidateBlock);
+		}
+		return candidateBlock;
+	}
+
+	/* firstFreeBlock is 0 means no free space left on the heap */
+	if (0 == firstFreeBlock) {
+		Trc_PRT_heap_port_omrheap_allocate_heap_full_exit();
+		return NULL;
+	}
+
 	/* even the entire heap won't fit */
 	if (adjustedRequestSize > heapSize) {
 		Trc_PRT_heap_port_omrheap_allocate_cannot_satisfy_reuqest_exit();
@@ -302,6 +574,12 @@ omrheap_free(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, void *addr
 		return;
 	}
 
+	if (IS_SEGREGATED_FIT(heap)) {
+		segregatedFitFree(heap, address);
+		Trc_PRT_heap_port_omrheap_free_exit();
+		return;
+	}
+
 	thisBlockTopPadding = ((int64_t *)address) - 1;
 
 	/*assertion to check we have an occupied block*/
@@ -414,6 +692,12 @@ omrheap_reallocate(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, void
 		}
 	}
 
+	if (IS_SEGREGATED_FIT(heap)) {
+		address = segregatedFitReallocate(heap, address, adjustedRequestSize);
+		Trc_PRT_heap_port_omrheap_reallocate_exit(address);
+		return address;
+	}
+
 	growAmount = adjustedRequestSize - thisBlockSize;
 	if (0 == growAmount) {
 		Trc_PRT_heap_port_omrheap_reallocate_no_realloc_necessary();
@@ -611,6 +895,20 @@ omrheap_grow(struct OMRPortLibrary *portLibrary, struct J9Heap *heap, uintptr_t
 	baseSlot = (int64_t *)heap;
 	/* Check whether the tail of the heap is free or not. */
 	temp = baseSlot[heapSize - 1];
+	if (IS_SEGREGATED_FIT(heap)) {
+		uintptr_t freeBlockSlot = heapSize;
+
+		if (0 < temp) {
+			freeBlockSlot = heapSize - (uintptr_t)temp - 2;
+			segregatedFitRemove(baseSlot, freeBlockSlot);
+		}
+		baseSlot[freeBlockSlot] = heapSize + numSlots - freeBlockSlot - 2;
+		baseSlot[heapSize + numSlots - 1] = baseSlot[freeBlockSlot];
+		segregatedFitInsert(baseSlot, freeBlockSlot);
+		heap->heapSize = heapSize + numSlots;
+		Trc_PRT_heap_port_omrheap_grow_exit(result);
+		return result;
+	}
 	/* If the value at the tail node is negative, then it is occupied, if not, it is free */
 	if (0 > temp) {
 		baseSlot[heapSize] = numSlots - 2;
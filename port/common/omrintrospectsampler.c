@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Continuous stack sampling
+ */
+
+#include "omrport.h"
+#include "omrportpriv.h"
+
+/**
+ * Create a stack sampler. Unlike @ref omrintrospect_threads_startDo, a sampler does not suspend
+ * threads: the operating system records the stack of each registered thread at intervals of the
+ * CPU time it uses, and the samples are collected later with @ref omrintrospect_sampler_drain.
+ * No signals are involved, so sampling is safe to leave running.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] params Sampling period and buffer sizes, or NULL for the defaults.
+ * @param[out] sampler On success, the new sampler, which samples no threads yet.
+ *
+ * @return 0 on success, OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM where sampling is not
+ * available, or another negative error code on failure.
+ */
+int32_t
+omrintrospect_sampler_open(struct OMRPortLibrary *portLibrary, const OMRIntrospectSamplerParams *params, struct OMRIntrospectSampler **sampler)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Start sampling a thread of this process.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sampler The sampler.
+ * @param[in] threadId The operating system ID of the thread, or 0 for the calling thread.
+ *
+ * @return 0 on success, OMRPORT_ERROR_NOPERMISSION if the system does not allow this process to
+ * sample its threads, or another negative error code on failure.
+ */
+int32_t
+omrintrospect_sampler_add_thread(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, uintptr_t threadId)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Stop sampling a thread. Samples of the thread that have not been drained are discarded.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sampler The sampler.
+ * @param[in] threadId The operating system ID of the thread, or 0 for the calling thread.
+ *
+ * @return 0 on success, OMRPORT_ERROR_INVALID_ARGUMENTS if the thread is not being sampled.
+ */
+int32_t
+omrintrospect_sampler_remove_thread(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, uintptr_t threadId)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Pass the samples taken since the last drain to callback, in batches of at most the batch size
+ * of the sampler. The samples of each thread are in time order. Sampled threads keep running.
+ * The callback may add and remove threads, but must not drain the same sampler; samples of
+ * threads moved by those changes may be left for the next drain.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sampler The sampler.
+ * @param[in] callback Called with each batch.
+ * @param[in] userData Passed to callback.
+ *
+ * @return the number of samples passed to callback, or a negative error code.
+ */
+intptr_t
+omrintrospect_sampler_drain(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, OMRIntrospectSampleCallback callback, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Stop sampling all threads and free the sampler. Undrained samples are discarded.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sampler The sampler.
+ */
+void
+omrintrospect_sampler_close(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler)
+{
+}
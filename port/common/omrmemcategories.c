@@ -53,6 +53,50 @@ OMRMEM_CATEGORY_1_CHILD("Port Library", OMRMEM_CATEGORY_PORT_LIBRARY, OMRMEM_CAT
 OMRMEM_CATEGORY_NO_CHILDREN("Port Library", OMRMEM_CATEGORY_PORT_LIBRARY);
 #endif /* OMR_ENV_DATA64 */
 
+/**
+ * Get the first of the cache line aligned counter shards of a category.
+ */
+static OMRMemCategoryCounterShard *
+firstCounterShard(OMRMemCategory *category)
+{
+	return (OMRMemCategoryCounterShard *)ROUND_UP_TO_POWEROF2((uintptr_t)category->shards, OMRMEM_CATEGORY_COUNTER_SHARD_SIZE);
+}
+
+/**
+ * Select the counter shard used by the calling thread.
+ *
+ * Threads run on separate stacks, so hashing the address of a local spreads threads
+ * across the shards without a TLS lookup. Any shard gives correct totals, so it doesn't
+ * matter that deep recursion may move a thread to a different shard.
+ */
+static OMRMemCategoryCounterShard *
+counterShard(OMRMemCategory *category)
+{
+	uintptr_t marker = 0;
+	uint32_t hash = (uint32_t)(((uintptr_t)&marker) >> 14) * (uint32_t)0x9E3779B1;
+
+	return &firstCounterShard(category)[(hash >> 24) & (OMRMEM_CATEGORY_COUNTER_SHARDS - 1)];
+}
+
+/**
+ * Sum the live counters of a memory category over all of its shards.
+ */
+static void
+sumCounters(OMRMemCategory *category, uintptr_t *liveBytes, uintptr_t *liveAllocations)
+{
+	uintptr_t bytes = category->liveBytes;
+	uintptr_t allocations = category->liveAllocations;
+	OMRMemCategoryCounterShard *shards = firstCounterShard(category);
+	uint32_t i = 0;
+
+	for (i = 0; i < OMRMEM_CATEGORY_COUNTER_SHARDS; i++) {
+		bytes += shards[i].liveBytes;
+		allocations += shards[i].liveAllocations;
+	}
+	*liveBytes = bytes;
+	*liveAllocations = allocations;
+}
+
 /**
  * Increments the counters for a memory category.
  *
@@ -61,12 +105,15 @@ OMRMEM_CATEGORY_NO_CHILDREN("Port Library", OMRMEM_CATEGORY_PORT_LIBRARY);
 void
 omrmem_categories_increment_counters(OMRMemCategory *category, uintptr_t size)
 {
+	OMRMemCategoryCounterShard *shard = NULL;
+
 	Trc_Assert_PTR_mem_categories_increment_counters_NULL_category(NULL != category);
 
+	shard = counterShard(category);
 	/* Increment block count */
-	addAtomic(&category->liveAllocations, 1);
-
-	omrmem_categories_increment_bytes(category, size);
+	addAtomic(&shard->liveAllocations, 1);
+	/* Increment bytes */
+	addAtomic(&shard->liveBytes, size);
 }
 
 /**
@@ -80,7 +127,7 @@ omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size)
 	Trc_Assert_PTR_mem_categories_increment_bytes_NULL_category(NULL != category);
 
 	/* Increment bytes */
-	addAtomic(&category->liveBytes, size);
+	addAtomic(&counterShard(category)->liveBytes, size);
 }
 
 /**
@@ -91,12 +138,16 @@ omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size)
 void
 omrmem_categories_decrement_counters(OMRMemCategory *category, uintptr_t size)
 {
+	OMRMemCategoryCounterShard *shard = NULL;
+
 	Trc_Assert_PTR_mem_categories_decrement_counters_NULL_category(NULL != category);
 
+	/* The shard may differ from the one the allocation was counted in; only the sum is meaningful. */
+	shard = counterShard(category);
 	/* Decrement block count */
-	subtractAtomic(&category->liveAllocations, 1);
-
-	omrmem_categories_decrement_bytes(category, size);
+	subtractAtomic(&shard->liveAllocations, 1);
+	/* Decrement size */
+	subtractAtomic(&shard->liveBytes, size);
 }
 
 /**
@@ -110,7 +161,7 @@ omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size)
 	Trc_Assert_PTR_mem_categories_decrement_bytes_NULL_category(NULL != category);
 
 	/* Decrement size */
-	subtractAtomic(&category->liveBytes, size);
+	subtractAtomic(&counterShard(category)->liveBytes, size);
 }
 
 /**
@@ -164,11 +215,14 @@ _recursive_category_walk_children(struct OMRPortLibrary *portLibrary, OMRMemCate
 {
 	uint32_t i;
 	uintptr_t result;
+	uintptr_t liveBytes = 0;
+	uintptr_t liveAllocations = 0;
 
 	for (i = 0; i < parent->numberOfChildren; i++) {
 		uint32_t childCode = parent->children[i];
 		OMRMemCategory *child = omrmem_get_category(portLibrary, childCode);
-		result = state->walkFunction(child->categoryCode, child->name, child->liveBytes, child->liveAllocations, FALSE, parent->categoryCode, state);
+		sumCounters(child, &liveBytes, &liveAllocations);
+		result = state->walkFunction(child->categoryCode, child->name, liveBytes, liveAllocations, FALSE, parent->categoryCode, state);
 
 		if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
 			result = _recursive_category_walk_children(portLibrary, state, child);
@@ -188,8 +242,11 @@ static uintptr_t
 _recursive_category_walk_root(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state, OMRMemCategory *walkPoint)
 {
 	uintptr_t result;
+	uintptr_t liveBytes = 0;
+	uintptr_t liveAllocations = 0;
 
-	result = state->walkFunction(walkPoint->categoryCode, walkPoint->name, walkPoint->liveBytes, walkPoint->liveAllocations, TRUE, 0, state);
+	sumCounters(walkPoint, &liveBytes, &liveAllocations);
+	result = state->walkFunction(walkPoint->categoryCode, walkPoint->name, liveBytes, liveAllocations, TRUE, 0, state);
 
 	if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
 		return _recursive_category_walk_children(portLibrary, state, walkPoint);
@@ -208,11 +265,13 @@ _recursive_category_walk_root(struct OMRPortLibrary *portLibrary, OMRMemCategory
 void
 omrmem_walk_categories(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state)
 {
+	uintptr_t result = J9MEM_CATEGORIES_KEEP_ITERATING;
+
 	/* User supplied categories are expected to include PORT_LIBRARY and UNKNOWN as part of their tree */
 	if (portLibrary->portGlobals->control.language_memory_categories.categories != NULL) {
-		_recursive_category_walk_root(portLibrary, state, portLibrary->portGlobals->control.language_memory_categories.categories[0]);
+		result = _recursive_category_walk_root(portLibrary, state, portLibrary->portGlobals->control.language_memory_categories.categories[0]);
 	} else {
-		uintptr_t result = _recursive_category_walk_root(portLibrary, state, &portLibrary->portGlobals->portLibraryMemoryCategory);
+		result = _recursive_category_walk_root(portLibrary, state, &portLibrary->portGlobals->portLibraryMemoryCategory);
 		if (result != J9MEM_CATEGORIES_KEEP_ITERATING) {
 			return;
 		}
@@ -223,10 +282,13 @@ omrmem_walk_categories(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkSta
 		}
 
 #if defined(OMR_ENV_DATA64)
-		_recursive_category_walk_root(portLibrary, state, &portLibrary->portGlobals->unusedAllocate32HeapRegionsMemoryCategory);
+		result = _recursive_category_walk_root(portLibrary, state, &portLibrary->portGlobals->unusedAllocate32HeapRegionsMemoryCategory);
 #endif
 	}
 
+	if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
+		omrmem_slab_walk_categories(portLibrary, state);
+	}
 }
 
 /**
@@ -0,0 +1,814 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Slab allocator for small omrmem_allocate_memory requests
+ */
+
+/*
+ * Small blocks are carved out of OMRMEM_SLAB_SIZE slabs, each holding blocks of
+ * one size class for one memory category. A slab is charged to its category
+ * when it is created and credited when it is released, so allocating and
+ * freeing a block doesn't touch the category counters.
+ *
+ * Each attached thread keeps a magazine of free blocks per size class, all
+ * from slabs of one category. Allocations and frees that hit the magazine take
+ * no lock; refilling or flushing a magazine takes the allocator monitor.
+ *
+ * A slab block has a one word header holding its slab address, tagged with
+ * OMRMEM_SLAB_BLOCK_TAG. The word before a tagged block is the category pointer
+ * of its J9MemTag header, which is always even, so the tag bit tells the two
+ * kinds of block apart. This relies on the 64-bit J9MemTag layout, so the slab
+ * allocator is only available on 64-bit platforms.
+ *
+ * Slabs which still hold blocks when the allocator is shut down are retired
+ * rather than freed: their blocks stay valid, and the slab is freed when its
+ * last block is.
+ */
+#include <string.h>
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrportpg.h"
+#include "omrutilbase.h"
+#include "ut_omrport.h"
+
+#if defined(OMR_ENV_DATA64)
+
+#define OMRMEM_SLAB_SIZE ((uintptr_t)64 * 1024)
+#define OMRMEM_SLAB_EYECATCHER 0x51AB51AB
+/* a slab which still held blocks when the allocator was shut down */
+#define OMRMEM_SLAB_RETIRED_EYECATCHER 0x51AB0DED
+#define OMRMEM_SLAB_SIZE_CLASSES 7
+#define OMRMEM_SLAB_MAX_BLOCK_SIZE 256
+#define OMRMEM_SLAB_MAGAZINE_SIZE 32
+#define OMRMEM_SLAB_MAGAZINE_REFILL (OMRMEM_SLAB_MAGAZINE_SIZE / 2)
+
+#define OMRMEM_SLAB_BLOCK_TAG ((uintptr_t)0x1)
+#define OMRMEM_SLAB_BLOCK_FREED ((uintptr_t)0x2)
+#define OMRMEM_SLAB_BLOCK_FLAGS (OMRMEM_SLAB_BLOCK_TAG | OMRMEM_SLAB_BLOCK_FREED)
+#define OMRMEM_SLAB_HEADER_SIZE sizeof(uintptr_t)
+#define OMRMEM_SLAB_MAX_BYTES (OMRMEM_SLAB_MAX_BLOCK_SIZE - OMRMEM_SLAB_HEADER_SIZE)
+
+static const uintptr_t slabBlockSizes[OMRMEM_SLAB_SIZE_CLASSES] = {32, 48, 64, 96, 128, 192, 256};
+
+/* size class for (byteAmount + header) rounded up to a multiple of 16, indexed by that multiple */
+static const uint8_t slabSizeClassIndex[(OMRMEM_SLAB_MAX_BLOCK_SIZE / 16) + 1] = {
+	0, 0, 0, 1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6
+};
+
+typedef struct OMRMemSlab {
+	uint32_t eyeCatcher;
+	uint32_t sizeClass;
+	OMRMemCategory *category;
+	uintptr_t blockSize;
+	/* blocks handed out of the slab, including those held in magazines */
+	volatile uintptr_t liveBlocks;
+	uint8_t *freeList;
+	uint8_t *bump;
+	uint8_t *end;
+	BOOLEAN onPartialList;
+	struct OMRMemSlabCategory *owner;
+	struct OMRMemSlab *next;
+	struct OMRMemSlab *previous;
+	struct OMRMemSlab *nextSlab;
+	struct OMRMemSlab *previousSlab;
+} OMRMemSlab;
+
+/* Slabs of one category with free blocks, by size class. */
+typedef struct OMRMemSlabCategory {
+	OMRMemCategory *category;
+	struct OMRMemSlabCategory *next;
+	OMRMemSlab *partial[OMRMEM_SLAB_SIZE_CLASSES];
+} OMRMemSlabCategory;
+
+typedef struct OMRMemSlabMagazine {
+	OMRMemCategory *category;
+	uintptr_t count;
+	uint8_t *blocks[OMRMEM_SLAB_MAGAZINE_SIZE];
+} OMRMemSlabMagazine;
+
+typedef struct OMRMemSlabThreadCache {
+	struct OMRMemSlabAllocator *allocator;
+	struct OMRMemSlabThreadCache *next;
+	struct OMRMemSlabThreadCache *previous;
+	uint64_t allocations;
+	uint64_t allocatedBytes;
+	OMRMemSlabMagazine magazines[OMRMEM_SLAB_SIZE_CLASSES];
+} OMRMemSlabThreadCache;
+
+typedef struct OMRMemSlabAllocator {
+	struct OMRPortLibrary *portLibrary;
+	omrthread_monitor_t monitor;
+	omrthread_tls_key_t cacheKey;
+	volatile uintptr_t flags;
+	OMRMemSlabCategory *categories;
+	OMRMemSlab *slabs;
+	OMRMemSlabThreadCache *caches;
+	uintptr_t slabCount;
+	/* bytes on slab free lists and in never used slab tails */
+	uintptr_t freeBytes;
+	/* totals of threads whose caches have been released */
+	uint64_t allocations;
+	uint64_t allocatedBytes;
+} OMRMemSlabAllocator;
+
+static void *allocateInternal(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount);
+static void freeInternal(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t byteAmount);
+static OMRMemSlabCategory *findSlabCategory(OMRMemSlabAllocator *allocator, OMRMemCategory *category);
+static OMRMemSlab *createSlab(OMRMemSlabAllocator *allocator, OMRMemSlabCategory *slabCategory, uint32_t sizeClass);
+static void unlinkSlab(OMRMemSlabAllocator *allocator, OMRMemSlab *slab);
+static void releaseSlab(OMRMemSlabAllocator *allocator, OMRMemSlab *slab);
+static void retireSlab(OMRMemSlabAllocator *allocator, OMRMemSlab *slab);
+static void unlinkPartialSlab(OMRMemSlab *slab);
+static uint8_t *takeBlock(OMRMemSlab *slab);
+static void returnBlock(OMRMemSlabAllocator *allocator, uint8_t *block);
+static void flushMagazine(OMRMemSlabAllocator *allocator, OMRMemSlabMagazine *magazine, uintptr_t count);
+static BOOLEAN refillMagazine(OMRMemSlabAllocator *allocator, OMRMemSlabMagazine *magazine, OMRMemCategory *category, uint32_t sizeClass);
+static OMRMemSlabThreadCache *getThreadCache(OMRMemSlabAllocator *allocator, BOOLEAN create);
+static void releaseThreadCache(OMRMemSlabAllocator *allocator, OMRMemSlabThreadCache *cache);
+static void threadCacheFinalizer(void *cache);
+static void reportCorruption(struct OMRPortLibrary *portLibrary, void *memoryPointer);
+
+/*
+ * The allocator's own structures are charged to the port library category directly,
+ * since allocating them with omrmem_allocate_memory could re-enter the slab allocator.
+ */
+static void *
+allocateInternal(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount)
+{
+	void *memoryPointer = omrmem_allocate_memory_basic(portLibrary, byteAmount);
+
+	if (NULL != memoryPointer) {
+		omrmem_categories_increment_counters(omrmem_get_category(portLibrary, OMRMEM_CATEGORY_PORT_LIBRARY), byteAmount);
+	}
+	return memoryPointer;
+}
+
+static void
+freeInternal(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t byteAmount)
+{
+	omrmem_categories_decrement_counters(omrmem_get_category(portLibrary, OMRMEM_CATEGORY_PORT_LIBRARY), byteAmount);
+	omrmem_free_memory_basic(portLibrary, memoryPointer);
+}
+
+static void
+reportCorruption(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	BOOLEAN memoryCorruptionDetected = FALSE;
+
+	portLibrary->portGlobals->corruptedMemoryBlock = memoryPointer;
+	Trc_Assert_PRT_memory_corruption_detected(memoryCorruptionDetected);
+}
+
+/* Find or create the partial slab lists for category. Caller holds the allocator monitor. */
+static OMRMemSlabCategory *
+findSlabCategory(OMRMemSlabAllocator *allocator, OMRMemCategory *category)
+{
+	OMRMemSlabCategory *slabCategory = allocator->categories;
+
+	while ((NULL != slabCategory) && (category != slabCategory->category)) {
+		slabCategory = slabCategory->next;
+	}
+	if (NULL == slabCategory) {
+		slabCategory = allocateInternal(allocator->portLibrary, sizeof(OMRMemSlabCategory));
+		if (NULL != slabCategory) {
+			memset(slabCategory, 0, sizeof(OMRMemSlabCategory));
+			slabCategory->category = category;
+			slabCategory->next = allocator->categories;
+			allocator->categories = slabCategory;
+		}
+	}
+	return slabCategory;
+}
+
+/* Create an empty slab and put it on its partial list. Caller holds the allocator monitor. */
+static OMRMemSlab *
+createSlab(OMRMemSlabAllocator *allocator, OMRMemSlabCategory *slabCategory, uint32_t sizeClass)
+{
+	struct OMRPortLibrary *portLibrary = allocator->portLibrary;
+	OMRMemSlab *slab = omrmem_allocate_memory_basic(portLibrary, OMRMEM_SLAB_SIZE);
+
+	if (NULL != slab) {
+		uintptr_t blockSize = slabBlockSizes[sizeClass];
+		uint8_t *firstBlock = (uint8_t *)slab + ROUND_UP_TO_POWEROF2(sizeof(OMRMemSlab), 16);
+
+		memset(slab, 0, sizeof(OMRMemSlab));
+		slab->eyeCatcher = OMRMEM_SLAB_EYECATCHER;
+		slab->sizeClass = sizeClass;
+		slab->category = slabCategory->category;
+		slab->blockSize = blockSize;
+		slab->bump = firstBlock;
+		slab->end = firstBlock + (((OMRMEM_SLAB_SIZE - (firstBlock - (uint8_t *)slab)) / blockSize) * blockSize);
+		slab->owner = slabCategory;
+
+		slab->next = slabCategory->partial[sizeClass];
+		if (NULL != slab->next) {
+			slab->next->previous = slab;
+		}
+		slabCategory->partial[sizeClass] = slab;
+		slab->onPartialList = TRUE;
+
+		slab->nextSlab = allocator->slabs;
+		if (NULL != slab->nextSlab) {
+			slab->nextSlab->previousSlab = slab;
+		}
+		allocator->slabs = slab;
+		allocator->slabCount += 1;
+		allocator->freeBytes += slab->end - slab->bump;
+
+		/* the category is charged for the whole slab */
+		omrmem_categories_increment_counters(slab->category, OMRMEM_SLAB_SIZE);
+	}
+	return slab;
+}
+
+/* Unlink a slab from the allocator. Caller holds the allocator monitor. */
+static void
+unlinkSlab(OMRMemSlabAllocator *allocator, OMRMemSlab *slab)
+{
+	if (slab->onPartialList) {
+		unlinkPartialSlab(slab);
+	}
+	if (NULL != slab->previousSlab) {
+		slab->previousSlab->nextSlab = slab->nextSlab;
+	} else {
+		allocator->slabs = slab->nextSlab;
+	}
+	if (NULL != slab->nextSlab) {
+		slab->nextSlab->previousSlab = slab->previousSlab;
+	}
+	allocator->slabCount -= 1;
+	allocator->freeBytes -= slab->end - ((uint8_t *)slab + ROUND_UP_TO_POWEROF2(sizeof(OMRMemSlab), 16));
+
+	omrmem_categories_decrement_counters(slab->category, OMRMEM_SLAB_SIZE);
+}
+
+/* Free an empty slab. Caller holds the allocator monitor. */
+static void
+releaseSlab(OMRMemSlabAllocator *allocator, OMRMemSlab *slab)
+{
+	unlinkSlab(allocator, slab);
+	slab->eyeCatcher = 0;
+	omrmem_free_memory_basic(allocator->portLibrary, slab);
+}
+
+/*
+ * Detach a slab which still holds blocks from the allocator being shut down. The slab
+ * no longer refers to the allocator or its category, and omrmem_slab_free frees it
+ * once its last block is freed.
+ */
+static void
+retireSlab(OMRMemSlabAllocator *allocator, OMRMemSlab *slab)
+{
+	unlinkSlab(allocator, slab);
+	slab->owner = NULL;
+	slab->category = NULL;
+	slab->eyeCatcher = OMRMEM_SLAB_RETIRED_EYECATCHER;
+}
+
+static void
+unlinkPartialSlab(OMRMemSlab *slab)
+{
+	if (NULL != slab->previous) {
+		slab->previous->next = slab->next;
+	} else {
+		slab->owner->partial[slab->sizeClass] = slab->next;
+	}
+	if (NULL != slab->next) {
+		slab->next->previous = slab->previous;
+	}
+	slab->next = NULL;
+	slab->previous = NULL;
+	slab->onPartialList = FALSE;
+}
+
+/* Take a free block from a partial slab, unlinking the slab once it is full. Caller holds the allocator monitor. */
+static uint8_t *
+takeBlock(OMRMemSlab *slab)
+{
+	uint8_t *block = slab->freeList;
+
+	if (NULL != block) {
+		slab->freeList = *(uint8_t **)(block + OMRMEM_SLAB_HEADER_SIZE);
+	} else {
+		block = slab->bump;
+		slab->bump += slab->blockSize;
+		*(uintptr_t *)block = (uintptr_t)slab | OMRMEM_SLAB_BLOCK_FLAGS;
+	}
+	slab->liveBlocks += 1;
+	if ((NULL == slab->freeList) && (slab->bump == slab->end)) {
+		unlinkPartialSlab(slab);
+	}
+	return block;
+}
+
+/*
+ * Put a block back on its slab. An empty slab is released unless it is the only
+ * partial slab of its size class, which is kept to absorb alloc/free cycles.
+ * Caller holds the allocator monitor.
+ */
+static void
+returnBlock(OMRMemSlabAllocator *allocator, uint8_t *block)
+{
+	OMRMemSlab *slab = (OMRMemSlab *)(*(uintptr_t *)block & ~OMRMEM_SLAB_BLOCK_FLAGS);
+
+	*(uint8_t **)(block + OMRMEM_SLAB_HEADER_SIZE) = slab->freeList;
+	slab->freeList = block;
+	slab->liveBlocks -= 1;
+	allocator->freeBytes += slab->blockSize;
+
+	if (!slab->onPartialList) {
+		OMRMemSlab **head = &slab->owner->partial[slab->sizeClass];
+
+		slab->next = *head;
+		if (NULL != slab->next) {
+			slab->next->previous = slab;
+		}
+		*head = slab;
+		slab->onPartialList = TRUE;
+	}
+	if ((0 == slab->liveBlocks) && ((NULL != slab->next) || (NULL != slab->previous))) {
+		releaseSlab(allocator, slab);
+	}
+}
+
+/* Return the oldest count blocks of a magazine to their slabs. Caller holds the allocator monitor. */
+static void
+flushMagazine(OMRMemSlabAllocator *allocator, OMRMemSlabMagazine *magazine, uintptr_t count)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < count; i++) {
+		returnBlock(allocator, magazine->blocks[i]);
+	}
+	magazine->count -= count;
+	memmove(magazine->blocks, magazine->blocks + count, magazine->count * sizeof(magazine->blocks[0]));
+}
+
+/* Switch a magazine to category if needed and fill it. Caller holds the allocator monitor. */
+static BOOLEAN
+refillMagazine(OMRMemSlabAllocator *allocator, OMRMemSlabMagazine *magazine, OMRMemCategory *category, uint32_t sizeClass)
+{
+	OMRMemSlabCategory *slabCategory = NULL;
+
+	if (category != magazine->category) {
+		flushMagazine(allocator, magazine, magazine->count);
+		magazine->category = category;
+	}
+	slabCategory = findSlabCategory(allocator, category);
+	if (NULL != slabCategory) {
+		while (magazine->count < OMRMEM_SLAB_MAGAZINE_REFILL) {
+			OMRMemSlab *slab = slabCategory->partial[sizeClass];
+
+			if (NULL == slab) {
+				slab = createSlab(allocator, slabCategory, sizeClass);
+				if (NULL == slab) {
+					break;
+				}
+			}
+			magazine->blocks[magazine->count] = takeBlock(slab);
+			magazine->count += 1;
+			allocator->freeBytes -= slab->blockSize;
+		}
+	}
+	return 0 != magazine->count;
+}
+
+/* Get the calling thread's cache, or NULL if the thread isn't attached. */
+static OMRMemSlabThreadCache *
+getThreadCache(OMRMemSlabAllocator *allocator, BOOLEAN create)
+{
+	omrthread_t self = omrthread_self();
+	OMRMemSlabThreadCache *cache = NULL;
+
+	if (NULL != self) {
+		cache = omrthread_tls_get(self, allocator->cacheKey);
+		if ((NULL == cache) && create) {
+			cache = allocateInternal(allocator->portLibrary, sizeof(OMRMemSlabThreadCache));
+			if (NULL != cache) {
+				memset(cache, 0, sizeof(OMRMemSlabThreadCache));
+				cache->allocator = allocator;
+				omrthread_monitor_enter(allocator->monitor);
+				cache->next = allocator->caches;
+				if (NULL != cache->next) {
+					cache->next->previous = cache;
+				}
+				allocator->caches = cache;
+				omrthread_monitor_exit(allocator->monitor);
+				omrthread_tls_set(self, allocator->cacheKey, cache);
+			}
+		}
+	}
+	return cache;
+}
+
+/* Return a cache's blocks to their slabs and free it. Caller holds the allocator monitor. */
+static void
+releaseThreadCache(OMRMemSlabAllocator *allocator, OMRMemSlabThreadCache *cache)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < OMRMEM_SLAB_SIZE_CLASSES; i++) {
+		flushMagazine(allocator, &cache->magazines[i], cache->magazines[i].count);
+	}
+	allocator->allocations += cache->allocations;
+	allocator->allocatedBytes += cache->allocatedBytes;
+	if (NULL != cache->previous) {
+		cache->previous->next = cache->next;
+	} else {
+		allocator->caches = cache->next;
+	}
+	if (NULL != cache->next) {
+		cache->next->previous = cache->previous;
+	}
+	freeInternal(allocator->portLibrary, cache, sizeof(OMRMemSlabThreadCache));
+}
+
+static void
+threadCacheFinalizer(void *cache)
+{
+	OMRMemSlabAllocator *allocator = ((OMRMemSlabThreadCache *)cache)->allocator;
+
+	omrthread_monitor_enter(allocator->monitor);
+	releaseThreadCache(allocator, (OMRMemSlabThreadCache *)cache);
+	omrthread_monitor_exit(allocator->monitor);
+}
+
+/**
+ * Enable or disable the slab allocator.
+ *
+ * Disabling the allocator only stops new allocations from using it: blocks already
+ * allocated remain valid, and the calling thread's cached blocks and any empty slabs
+ * are released. Other threads update their caches without the allocator monitor, so
+ * their cached blocks can't be taken from them here: they stay cached until the thread
+ * detaches or the allocator is shut down, and the slabs holding them are released then.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] flags OMRPORT_MEM_SLAB_xxx flags, or 0 to disable the allocator
+ *
+ * @return 0 on success, non-zero if the allocator could not be created
+ */
+int32_t
+omrmem_slab_control(struct OMRPortLibrary *portLibrary, uintptr_t flags)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+
+	if (NULL == allocator) {
+		if (OMR_ARE_NO_BITS_SET(flags, OMRPORT_MEM_SLAB_ENABLED)) {
+			return 0;
+		}
+		allocator = allocateInternal(portLibrary, sizeof(OMRMemSlabAllocator));
+		if (NULL == allocator) {
+			return 1;
+		}
+		memset(allocator, 0, sizeof(OMRMemSlabAllocator));
+		allocator->portLibrary = portLibrary;
+		if (0 != omrthread_monitor_init_with_name(&allocator->monitor, 0, "omrmem slab allocator")) {
+			freeInternal(portLibrary, allocator, sizeof(OMRMemSlabAllocator));
+			return 1;
+		}
+		if (0 != omrthread_tls_alloc_with_finalizer(&allocator->cacheKey, threadCacheFinalizer)) {
+			omrthread_monitor_destroy(allocator->monitor);
+			freeInternal(portLibrary, allocator, sizeof(OMRMemSlabAllocator));
+			return 1;
+		}
+		portLibrary->portGlobals->slabAllocator = allocator;
+	}
+
+	allocator->flags = OMR_ARE_ANY_BITS_SET(flags, OMRPORT_MEM_SLAB_ENABLED) ? flags : 0;
+
+	if (0 == allocator->flags) {
+		OMRMemSlabThreadCache *cache = getThreadCache(allocator, FALSE);
+		OMRMemSlab *slab = NULL;
+
+		omrthread_monitor_enter(allocator->monitor);
+		if (NULL != cache) {
+			uintptr_t i = 0;
+
+			for (i = 0; i < OMRMEM_SLAB_SIZE_CLASSES; i++) {
+				flushMagazine(allocator, &cache->magazines[i], cache->magazines[i].count);
+			}
+		}
+		slab = allocator->slabs;
+		while (NULL != slab) {
+			OMRMemSlab *next = slab->nextSlab;
+
+			if (0 == slab->liveBlocks) {
+				releaseSlab(allocator, slab);
+			}
+			slab = next;
+		}
+		omrthread_monitor_exit(allocator->monitor);
+	}
+	return 0;
+}
+
+/**
+ * Allocate a small block from the slab allocator.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] byteAmount Number of bytes to allocate
+ * @param[in] category Memory category to charge
+ *
+ * @return pointer to memory, or NULL if the request should be served by the tagged allocator
+ */
+void *
+omrmem_slab_allocate(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount, OMRMemCategory *category)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+	OMRMemSlabThreadCache *cache = NULL;
+	OMRMemSlabMagazine *magazine = NULL;
+	uint32_t sizeClass = 0;
+	uint8_t *block = NULL;
+
+	if ((NULL == allocator) || (0 == allocator->flags) || (byteAmount > OMRMEM_SLAB_MAX_BYTES)) {
+		return NULL;
+	}
+	cache = getThreadCache(allocator, TRUE);
+	if (NULL == cache) {
+		return NULL;
+	}
+
+	sizeClass = slabSizeClassIndex[(byteAmount + OMRMEM_SLAB_HEADER_SIZE + 15) >> 4];
+	magazine = &cache->magazines[sizeClass];
+	if ((category != magazine->category) || (0 == magazine->count)) {
+		BOOLEAN refilled = FALSE;
+
+		omrthread_monitor_enter(allocator->monitor);
+		refilled = refillMagazine(allocator, magazine, category, sizeClass);
+		omrthread_monitor_exit(allocator->monitor);
+		if (!refilled) {
+			return NULL;
+		}
+	}
+
+	magazine->count -= 1;
+	block = magazine->blocks[magazine->count];
+	*(uintptr_t *)block &= ~OMRMEM_SLAB_BLOCK_FREED;
+	cache->allocations += 1;
+	cache->allocatedBytes += slabBlockSizes[sizeClass];
+	return block + OMRMEM_SLAB_HEADER_SIZE;
+}
+
+/**
+ * Check whether memoryPointer was allocated by the slab allocator.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] memoryPointer A block returned by omrmem_allocate_memory
+ *
+ * @return TRUE if the block belongs to the slab allocator, or to a slab retired when it was shut down
+ */
+BOOLEAN
+omrmem_slab_owns(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	/* the tag bit is never set in a J9MemTag header, so this holds whether or not the allocator exists */
+	return OMR_ARE_ANY_BITS_SET(*(uintptr_t *)((uint8_t *)memoryPointer - OMRMEM_SLAB_HEADER_SIZE), OMRMEM_SLAB_BLOCK_TAG);
+}
+
+/**
+ * Get the usable size of a slab block.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] memoryPointer A block for which omrmem_slab_owns returns TRUE
+ *
+ * @return the number of bytes that may be used at memoryPointer
+ */
+uintptr_t
+omrmem_slab_usable_size(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	OMRMemSlab *slab = (OMRMemSlab *)(*(uintptr_t *)((uint8_t *)memoryPointer - OMRMEM_SLAB_HEADER_SIZE) & ~OMRMEM_SLAB_BLOCK_FLAGS);
+
+	return slab->blockSize - OMRMEM_SLAB_HEADER_SIZE;
+}
+
+/**
+ * Free a slab block.
+ *
+ * With OMRPORT_MEM_SLAB_CHECK_TAGS the block header is validated first, catching
+ * double frees and pointers that don't address a block.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] memoryPointer A block for which omrmem_slab_owns returns TRUE
+ */
+void
+omrmem_slab_free(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+	uint8_t *block = (uint8_t *)memoryPointer - OMRMEM_SLAB_HEADER_SIZE;
+	uintptr_t header = *(uintptr_t *)block;
+	OMRMemSlab *slab = (OMRMemSlab *)(header & ~OMRMEM_SLAB_BLOCK_FLAGS);
+	OMRMemSlabThreadCache *cache = NULL;
+
+	if (OMRMEM_SLAB_RETIRED_EYECATCHER == slab->eyeCatcher) {
+		/* the block outlived the allocator; the last block of its slab frees the slab */
+		*(uintptr_t *)block = header | OMRMEM_SLAB_BLOCK_FREED;
+		if (0 == subtractAtomic(&slab->liveBlocks, 1)) {
+			slab->eyeCatcher = 0;
+			omrmem_free_memory_basic(portLibrary, slab);
+		}
+		return;
+	}
+
+	if (OMR_ARE_ANY_BITS_SET(allocator->flags, OMRPORT_MEM_SLAB_CHECK_TAGS)) {
+		uint8_t *firstBlock = (uint8_t *)slab + ROUND_UP_TO_POWEROF2(sizeof(OMRMemSlab), 16);
+
+		if (OMR_ARE_ANY_BITS_SET(header, OMRMEM_SLAB_BLOCK_FREED)
+			|| (OMRMEM_SLAB_EYECATCHER != slab->eyeCatcher)
+			|| (block < firstBlock)
+			|| (block >= slab->bump)
+			|| (0 != ((uintptr_t)(block - firstBlock) % slab->blockSize))
+		) {
+			reportCorruption(portLibrary, memoryPointer);
+			return;
+		}
+	}
+	*(uintptr_t *)block = header | OMRMEM_SLAB_BLOCK_FREED;
+
+	if (0 != allocator->flags) {
+		cache = getThreadCache(allocator, FALSE);
+	}
+	if (NULL != cache) {
+		OMRMemSlabMagazine *magazine = &cache->magazines[slab->sizeClass];
+
+		if ((slab->category == magazine->category) && (magazine->count < OMRMEM_SLAB_MAGAZINE_SIZE)) {
+			magazine->blocks[magazine->count] = block;
+			magazine->count += 1;
+			return;
+		}
+	}
+
+	omrthread_monitor_enter(allocator->monitor);
+	if ((NULL != cache) && (slab->category == cache->magazines[slab->sizeClass].category)) {
+		OMRMemSlabMagazine *magazine = &cache->magazines[slab->sizeClass];
+
+		/* the magazine is full: keep the most recently freed half */
+		flushMagazine(allocator, magazine, OMRMEM_SLAB_MAGAZINE_SIZE - OMRMEM_SLAB_MAGAZINE_REFILL);
+		magazine->blocks[magazine->count] = block;
+		magazine->count += 1;
+	} else {
+		returnBlock(allocator, block);
+	}
+	omrthread_monitor_exit(allocator->monitor);
+}
+
+/**
+ * Report the slab allocator through a memory category walk.
+ *
+ * While the allocator is enabled or holds slabs, it is walked as an extra root, "Slab allocator", whose bytes are the free
+ * space inside slabs (their fragmentation) and whose allocations are the number of
+ * slabs. Its child, "Slab allocations", counts the blocks and bytes allocated since the
+ * allocator was enabled: sampling it periodically gives the allocation rate.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] state Walk state containing callback pointer
+ *
+ * @return J9MEM_CATEGORIES_KEEP_ITERATING or J9MEM_CATEGORIES_STOP_ITERATING
+ */
+uintptr_t
+omrmem_slab_walk_categories(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+	OMRMemSlabThreadCache *cache = NULL;
+	uintptr_t freeBytes = 0;
+	uintptr_t slabCount = 0;
+	uint64_t allocations = 0;
+	uint64_t allocatedBytes = 0;
+	uintptr_t result = J9MEM_CATEGORIES_KEEP_ITERATING;
+
+	if (NULL == allocator) {
+		return result;
+	}
+
+	omrthread_monitor_enter(allocator->monitor);
+	if ((0 == allocator->flags) && (0 == allocator->slabCount)) {
+		/* the allocator has been disabled and holds no memory */
+		omrthread_monitor_exit(allocator->monitor);
+		return result;
+	}
+	freeBytes = allocator->freeBytes;
+	slabCount = allocator->slabCount;
+	allocations = allocator->allocations;
+	allocatedBytes = allocator->allocatedBytes;
+	for (cache = allocator->caches; NULL != cache; cache = cache->next) {
+		uintptr_t i = 0;
+
+		/* other threads update their caches without the monitor, so this is a snapshot */
+		for (i = 0; i < OMRMEM_SLAB_SIZE_CLASSES; i++) {
+			freeBytes += cache->magazines[i].count * slabBlockSizes[i];
+		}
+		allocations += cache->allocations;
+		allocatedBytes += cache->allocatedBytes;
+	}
+	omrthread_monitor_exit(allocator->monitor);
+
+	result = state->walkFunction(OMRMEM_CATEGORY_PORT_LIBRARY_SLAB_ALLOCATOR, "Slab allocator", freeBytes, slabCount, TRUE, 0, state);
+	if (J9MEM_CATEGORIES_KEEP_ITERATING == result) {
+		result = state->walkFunction(OMRMEM_CATEGORY_PORT_LIBRARY_SLAB_ALLOCATIONS, "Slab allocations",
+			(uintptr_t)allocatedBytes, (uintptr_t)allocations, FALSE, OMRMEM_CATEGORY_PORT_LIBRARY_SLAB_ALLOCATOR, state);
+	}
+	return result;
+}
+
+/**
+ * Free the slab allocator and its empty slabs.
+ *
+ * Slabs still holding blocks are retired rather than freed, so that those blocks
+ * can still be passed to omrmem_free_memory; each is freed with its last block.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+omrmem_slab_shutdown(struct OMRPortLibrary *portLibrary)
+{
+	OMRMemSlabAllocator *allocator = portLibrary->portGlobals->slabAllocator;
+
+	if (NULL != allocator) {
+		omrthread_tls_free(allocator->cacheKey);
+		while (NULL != allocator->caches) {
+			releaseThreadCache(allocator, allocator->caches);
+		}
+		while (NULL != allocator->slabs) {
+			if (0 == allocator->slabs->liveBlocks) {
+				releaseSlab(allocator, allocator->slabs);
+			} else {
+				retireSlab(allocator, allocator->slabs);
+			}
+		}
+		while (NULL != allocator->categories) {
+			OMRMemSlabCategory *next = allocator->categories->next;
+
+			freeInternal(portLibrary, allocator->categories, sizeof(OMRMemSlabCategory));
+			allocator->categories = next;
+		}
+		omrthread_monitor_destroy(allocator->monitor);
+		portLibrary->portGlobals->slabAllocator = NULL;
+		freeInternal(portLibrary, allocator, sizeof(OMRMemSlabAllocator));
+	}
+}
+
+#else /* defined(OMR_ENV_DATA64) */
+
+int32_t
+omrmem_slab_control(struct OMRPortLibrary *portLibrary, uintptr_t flags)
+{
+	/* the slab allocator relies on the 64-bit J9MemTag layout */
+	return OMR_ARE_ANY_BITS_SET(flags, OMRPORT_MEM_SLAB_ENABLED) ? 1 : 0;
+}
+
+void *
+omrmem_slab_allocate(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount, OMRMemCategory *category)
+{
+	return NULL;
+}
+
+BOOLEAN
+omrmem_slab_owns(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	return FALSE;
+}
+
+uintptr_t
+omrmem_slab_usable_size(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	return 0;
+}
+
+void
+omrmem_slab_free(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+}
+
+uintptr_t
+omrmem_slab_walk_categories(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state)
+{
+	return J9MEM_CATEGORIES_KEEP_ITERATING;
+}
+
+void
+omrmem_slab_shutdown(struct OMRPortLibrary *portLibrary)
+{
+}
+
+#endif /* defined(OMR_ENV_DATA64) */
@@ -177,6 +177,14 @@ omrmem_allocate_memory(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount,
 	Trc_PRT_mem_omrmem_allocate_memory_Entry(byteAmount, callSite);
 	allocationByteAmount = ROUNDED_BYTE_AMOUNT(byteAmount);
 
+	if (NULL != portLibrary->portGlobals->slabAllocator) {
+		pointer = omrmem_slab_allocate(portLibrary, byteAmount, omrmem_get_category(portLibrary, category));
+		if (NULL != pointer) {
+			Trc_PRT_mem_omrmem_allocate_memory_Exit(pointer);
+			return pointer;
+		}
+	}
+
 	/* Guard against overflow when wrapped with ROUNDED_BYTE_AMOUNT. */
 	if (allocationByteAmount >= byteAmount) {
 		pointer = allocateFunction(portLibrary, allocationByteAmount);
@@ -205,8 +213,12 @@ omrmem_free_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 	Trc_PRT_mem_omrmem_free_memory_Entry(memoryPointer);
 
 	if (memoryPointer != NULL) {
-		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
-		freeFunction(portLibrary, memoryPointer);
+		if (omrmem_slab_owns(portLibrary, memoryPointer)) {
+			omrmem_slab_free(portLibrary, memoryPointer);
+		} else {
+			memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
+			freeFunction(portLibrary, memoryPointer);
+		}
 	}
 	Trc_PRT_mem_omrmem_free_memory_Exit();
 }
@@ -226,7 +238,10 @@ omrmem_advise_and_free_memory(struct OMRPortLibrary *portLibrary, void *memoryPo
 	advise_and_free_memory_func_t adviseAndFreeFunction = omrmem_advise_and_free_memory_basic;
 	Trc_PRT_mem_omrmem_advise_and_free_memory_Entry(memoryPointer);
 
-	if (memoryPointer != NULL) {
+	if ((memoryPointer != NULL) && omrmem_slab_owns(portLibrary, memoryPointer)) {
+		/* slab blocks are too small to be worth advising */
+		omrmem_slab_free(portLibrary, memoryPointer);
+	} else if (memoryPointer != NULL) {
 #if (defined(LINUX) || defined (AIXPPC) || defined(J9ZOS390) || defined(OSX))
 
 		J9MemTag *headerTag = NULL;
@@ -286,6 +301,15 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 		pointer = omrmem_allocate_memory(portLibrary, byteAmount, NULL == callSite ? OMR_GET_CALLSITE() : callSite, category);
 	} else if (byteAmount == 0) {
 		omrmem_free_memory(portLibrary, memoryPointer);
+	} else if (omrmem_slab_owns(portLibrary, memoryPointer)) {
+		/* slab blocks don't record their callsite or size, so copy the whole usable block */
+		uintptr_t usableSize = omrmem_slab_usable_size(portLibrary, memoryPointer);
+
+		pointer = omrmem_allocate_memory(portLibrary, byteAmount, NULL == callSite ? OMR_GET_CALLSITE() : callSite, category);
+		if (NULL != pointer) {
+			memcpy(pointer, memoryPointer, OMR_MIN(usableSize, byteAmount));
+			omrmem_slab_free(portLibrary, memoryPointer);
+		}
 	} else {
 		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
 		if (NULL == callSite) {
@@ -335,6 +359,7 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 void
 omrmem_shutdown(struct OMRPortLibrary *portLibrary)
 {
+	omrmem_slab_shutdown(portLibrary);
 	omrmem_shutdown_categories(portLibrary);
 
 #if defined(OMR_ENV_DATA64)
@@ -56,6 +56,7 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrtime_hires_clock, /* time_hires_clock */
 	omrtime_hires_frequency, /* time_hires_frequency */
 	omrtime_hires_delta, /* time_hires_delta */
+	omrtime_fast_nanos, /* time_fast_nanos */
 	omrsysinfo_startup, /* sysinfo_startup */
 	omrsysinfo_shutdown, /* sysinfo_shutdown */
 	omrsysinfo_process_exists, /* sysinfo_process_exists */
@@ -135,6 +136,12 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrfilestream_setbuffer, /* filestream_setbuffer */
 	omrfilestream_fdopen, /* filestream_fdopen */
 	omrfilestream_fileno, /* filestream_fileno */
+	omrfilestream_log_open, /* filestream_log_open */
+	omrfilestream_log_write, /* filestream_log_write */
+	omrfilestream_log_vprintf, /* filestream_log_vprintf */
+	omrfilestream_log_printf, /* filestream_log_printf */
+	omrfilestream_log_flush, /* filestream_log_flush */
+	omrfilestream_log_close, /* filestream_log_close */
 	omrsl_startup, /* sl_startup */
 	omrsl_shutdown, /* sl_shutdown */
 	omrsl_close_shared_library, /* sl_close_shared_library */
@@ -193,6 +200,8 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrvmem_numa_get_node_details, /* vmem_numa_get_node_details */
 	omrvmem_get_available_physical_memory, /* vmem_get_available_physical_memory */
 	omrvmem_get_process_memory_size, /* vmem_get_process_memory_size */
+	omrvmem_get_hugepage_coverage, /* vmem_get_hugepage_coverage */
+	omrvmem_commit_memory_ex, /* vmem_commit_memory_ex */
 	omrstr_startup, /* str_startup */
 	omrstr_shutdown, /* str_shutdown */
 	omrstr_printf, /* str_printf */
@@ -339,6 +348,8 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrsysinfo_cgroup_subsystem_iterator_destroy, /* sysinfo_cgroup_subsystem_iterator_destroy */
 	omrsysinfo_get_process_start_time, /* sysinfo_get_process_start_time */
 	omrsysinfo_get_number_context_switches, /* sysinfo_get_number_context_switches */
+	omrsysinfo_memory_pressure_subscribe, /* sysinfo_memory_pressure_subscribe */
+	omrsysinfo_memory_pressure_unsubscribe, /* sysinfo_memory_pressure_unsubscribe */
 	omrport_init_library, /* port_init_library */
 	omrport_startup_library, /* port_startup_library */
 	omrport_create_library, /* port_create_library */
@@ -352,6 +363,11 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrintrospect_backtrace_thread, /* introspect_backtrace_thread */
 	omrintrospect_backtrace_symbols, /* introspect_backtrace_symbols */
 	omrintrospect_backtrace_symbols_ex, /* introspect_backtrace_symbols_ex */
+	omrintrospect_sampler_open, /* introspect_sampler_open */
+	omrintrospect_sampler_add_thread, /* introspect_sampler_add_thread */
+	omrintrospect_sampler_remove_thread, /* introspect_sampler_remove_thread */
+	omrintrospect_sampler_drain, /* introspect_sampler_drain */
+	omrintrospect_sampler_close, /* introspect_sampler_close */
 	omrsyslog_query, /* syslog_query */
 	omrsyslog_set, /* syslog_set */
 	omrmem_walk_categories, /* mem_walk_categories */
@@ -403,6 +419,11 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrsock_getsockopt_int, /* sock_getsockopt_int */
 	omrsock_getsockopt_linger, /* sock_getsockopt_linger */
 	omrsock_getsockopt_timeval, /* sock_getsockopt_timeval */
+	omrfile_async_open, /* file_async_open */
+	omrfile_async_close, /* file_async_close */
+	omrfile_async_submit, /* file_async_submit */
+	omrfile_async_poll, /* file_async_poll */
+	omrfile_async_get_backend, /* file_async_get_backend */
 #if defined(OMR_OPT_CUDA)
 	NULL, /* cuda_configData */
 	omrcuda_startup, /* cuda_startup */
@@ -344,5 +344,9 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 	}
 #endif /* defined(PPG_mem32BitFlags) */
 
+	if (0 == strcmp(OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR, key)) {
+		return omrmem_slab_control(portLibrary, value);
+	}
+
 	return 1;
 }
@@ -1204,6 +1204,40 @@ omrsysinfo_get_number_context_switches(struct OMRPortLibrary *portLibrary, uint6
 	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
 }
 
+/**
+ * Subscribe to memory pressure notifications for a cgroup v2 memory cgroup.
+ *
+ * A pressure stall information trigger is registered on memory.pressure when params->stallType
+ * is not OMRPORT_MEMORY_PRESSURE_STALL_NONE, and memory.events is watched for increases of its
+ * high, max, oom and oom_kill counters when params->watchEvents is set. Notifications are delivered
+ * by calling params->callback on a thread owned by the port library, one event at a time. The
+ * callback must not call @ref omrsysinfo_memory_pressure_unsubscribe.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] params What to watch and where to deliver notifications.
+ * @param[out] monitor On success, the subscription to pass to @ref omrsysinfo_memory_pressure_unsubscribe.
+ *
+ * @return 0 on success, OMRPORT_ERROR_SYSINFO_CGROUP_VERSION_NOT_AVAILABLE if the process is not in
+ * a cgroup v2 memory cgroup, or another negative error code on failure.
+ */
+int32_t
+omrsysinfo_memory_pressure_subscribe(struct OMRPortLibrary *portLibrary, const struct OMRMemoryPressureParams *params, struct OMRMemoryPressureMonitor **monitor)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Stop memory pressure notifications and release the subscription. No callback is running or
+ * will be made once this returns.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] monitor The subscription returned by @ref omrsysinfo_memory_pressure_subscribe.
+ */
+void
+omrsysinfo_memory_pressure_unsubscribe(struct OMRPortLibrary *portLibrary, struct OMRMemoryPressureMonitor *monitor)
+{
+}
+
 /**
  * Get the process ID and commandline for each process.
  * @param[in] portLibrary The port library.
@@ -111,6 +111,23 @@ omrtime_hires_delta(struct OMRPortLibrary *portLibrary, uint64_t startTime, uint
 {
 	return 0;
 }
+/**
+ * Query a fast monotonic clock.
+ * Retrieve the same clock as @ref omrtime_nano_time, at a lower cost per call where the platform
+ * allows it. On x86-64 Linux with an invariant TSC that the kernel also uses as its clocksource,
+ * the time is computed from the TSC, calibrated against CLOCK_MONOTONIC and periodically re-synced
+ * with it; elsewhere, or once the TSC is found to disagree with CLOCK_MONOTONIC, this is
+ * @ref omrtime_nano_time.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return time value in nanoseconds, comparable with values from @ref omrtime_nano_time.
+ */
+int64_t
+omrtime_fast_nanos(struct OMRPortLibrary *portLibrary)
+{
+	return portLibrary->time_nano_time(portLibrary);
+}
 /**
  * Query OS for timestamp.
  * Retrieve the current value of system clock and convert to milliseconds.
@@ -433,3 +433,19 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 {
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
+
+/**
+ * Report how much of a reservation is resident and how much of that is backed by huge pages,
+ * whether transparent huge pages or pages from the hugetlbfs pool.
+ *
+ * @param [in] portLibrary port library
+ * @param [in] identifier identifier of the reservation to measure
+ * @param [out] hugePageBytes pointer to variable to receive the number of bytes backed by huge pages
+ * @param [out] residentBytes pointer to variable to receive the number of resident bytes
+ * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+ */
+int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBytes, uintptr_t *residentBytes)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
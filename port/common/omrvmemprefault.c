@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Parallel pre-faulting of committed virtual memory
+ */
+
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrthread.h"
+#include "omrutil.h"
+
+#if defined(LINUX)
+#include <sys/mman.h>
+
+/* MADV_POPULATE_WRITE is available from Linux 5.14 */
+#if !defined(MADV_POPULATE_WRITE)
+#define MADV_POPULATE_WRITE 23
+#endif /* !defined(MADV_POPULATE_WRITE) */
+#endif /* defined(LINUX) */
+
+/* Ranges are split on this boundary so that a transparent huge page is never faulted by two threads */
+#define OMRVMEM_PREFAULT_CHUNK_ALIGNMENT ((uintptr_t)2 * 1024 * 1024)
+/* Helper threads are not worth starting for less than this much memory each */
+#define OMRVMEM_PREFAULT_MIN_BYTES_PER_THREAD ((uintptr_t)8 * 1024 * 1024)
+#define OMRVMEM_PREFAULT_STACK_SIZE ((uintptr_t)64 * 1024)
+
+typedef struct OMRVmemPrefaultState {
+	omrthread_monitor_t monitor;
+	uint8_t *address;
+	uintptr_t byteAmount;
+	uintptr_t pageSize;
+	uintptr_t chunkSize;
+	uintptr_t nextChunk;
+	uintptr_t chunkCount;
+} OMRVmemPrefaultState;
+
+static void
+touchPages(uint8_t *address, uintptr_t byteAmount, uintptr_t pageSize)
+{
+	volatile uint8_t *cursor = (volatile uint8_t *)address;
+	volatile uint8_t *end = cursor + byteAmount;
+
+#if defined(LINUX)
+	/* Populating the whole chunk in one call avoids a fault per page */
+	if (0 == madvise(address, (size_t)byteAmount, MADV_POPULATE_WRITE)) {
+		return;
+	}
+#endif /* defined(LINUX) */
+
+	/* Write back the value already there so that the contents of the range are preserved */
+	for (; cursor < end; cursor += pageSize) {
+		*cursor = *cursor;
+	}
+}
+
+/**
+ * Claim and fault chunks until none remain. Run by the helpers and by the committing thread.
+ */
+static void
+prefaultChunks(OMRVmemPrefaultState *state)
+{
+	for (;;) {
+		uintptr_t chunk = 0;
+		uintptr_t offset = 0;
+
+		omrthread_monitor_enter(state->monitor);
+		chunk = state->nextChunk;
+		if (chunk < state->chunkCount) {
+			state->nextChunk += 1;
+		}
+		omrthread_monitor_exit(state->monitor);
+		if (chunk >= state->chunkCount) {
+			break;
+		}
+
+		offset = chunk * state->chunkSize;
+		touchPages(state->address + offset, OMR_MIN(state->chunkSize, state->byteAmount - offset), state->pageSize);
+	}
+}
+
+static int J9THREAD_PROC
+prefaultHelper(void *arg)
+{
+	OMRVmemPrefaultState *state = (OMRVmemPrefaultState *)arg;
+
+	/* The state lives on the committing thread's stack, which joins the helpers before returning */
+	prefaultChunks(state);
+
+	return 0;
+}
+
+/**
+ * Fault in every page of a committed, writable range, using up to threadCount threads including
+ * the calling thread. The range is split into chunks that the threads claim in turn, so a slow
+ * helper does not hold up the others. If helper threads cannot be started the calling thread
+ * faults the whole range.
+ *
+ * Pages are faulted by rewriting their first byte, so the range must not be written concurrently.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] address The start of the range, aligned to pageSize.
+ * @param[in] byteAmount The size of the range.
+ * @param[in] pageSize The page size of the range.
+ * @param[in] threadCount The maximum number of threads to use.
+ */
+void
+omrvmem_prefault_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t pageSize, uintptr_t threadCount)
+{
+	OMRVmemPrefaultState state;
+	omrthread_t *helpers = NULL;
+	uintptr_t helperCount = 0;
+	uintptr_t i = 0;
+
+	if ((0 == byteAmount) || (0 == pageSize)) {
+		return;
+	}
+
+	threadCount = OMR_MIN(threadCount, byteAmount / OMRVMEM_PREFAULT_MIN_BYTES_PER_THREAD);
+	if (threadCount <= 1) {
+		touchPages((uint8_t *)address, byteAmount, pageSize);
+		return;
+	}
+
+	helpers = (omrthread_t *)portLibrary->mem_allocate_memory(portLibrary, (threadCount - 1) * sizeof(omrthread_t), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == helpers) {
+		touchPages((uint8_t *)address, byteAmount, pageSize);
+		return;
+	}
+	if (0 != omrthread_monitor_init_with_name(&state.monitor, 0, "omrvmem prefault")) {
+		portLibrary->mem_free_memory(portLibrary, helpers);
+		touchPages((uint8_t *)address, byteAmount, pageSize);
+		return;
+	}
+	state.address = (uint8_t *)address;
+	state.byteAmount = byteAmount;
+	state.pageSize = pageSize;
+	/* Several chunks per thread balance the load when some threads are descheduled */
+	state.chunkSize = ROUND_UP_TO_POWEROF2(byteAmount / (threadCount * 4), OMR_MAX(pageSize, OMRVMEM_PREFAULT_CHUNK_ALIGNMENT));
+	state.nextChunk = 0;
+	state.chunkCount = (byteAmount + state.chunkSize - 1) / state.chunkSize;
+
+	for (helperCount = 0; helperCount < (threadCount - 1); helperCount++) {
+		if (J9THREAD_SUCCESS != createJoinableThreadWithCategory(&helpers[helperCount], OMRVMEM_PREFAULT_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0,
+				&prefaultHelper, &state, J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			break;
+		}
+	}
+
+	prefaultChunks(&state);
+
+	/* Joining rather than waiting on the monitor ensures no helper still uses it when it is destroyed */
+	for (i = 0; i < helperCount; i++) {
+		omrthread_join(helpers[i]);
+	}
+	omrthread_monitor_destroy(state.monitor);
+	portLibrary->mem_free_memory(portLibrary, helpers);
+}
+
+#if !defined(LINUX) || defined(OMRZTPF)
+/**
+ * Commit memory like @ref omrvmem_commit_memory, optionally placing it on NUMA nodes and faulting
+ * it in with several threads so that the first pass over the range does not pay the page fault cost
+ * serially.
+ *
+ * Only OMRPORT_VMEM_NUMA_POLICY_PREFERRED is honoured here, through @ref omrvmem_numa_set_affinity.
+ * Linux overrides this in linux/omrvmem.c to apply the other policies with mbind.
+ *
+ * @param [in] portLibrary port library
+ * @param [in] address The page aligned address of the range to commit
+ * @param [in] byteAmount The page aligned size of the range
+ * @param [in] identifier Descriptor of the reservation containing the range
+ * @param [in] params Commit options, or NULL for a plain commit
+ *
+ * @return address on success, NULL on failure. NUMA placement and pre-faulting are best effort and
+ * do not cause the commit to fail.
+ */
+void *
+omrvmem_commit_memory_ex(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, struct J9PortVmemCommitParams *params)
+{
+	void *rc = NULL;
+
+	if ((NULL != params) && (OMRPORT_VMEM_NUMA_POLICY_PREFERRED == params->numaPolicy)) {
+		portLibrary->vmem_numa_set_affinity(portLibrary, params->numaNode, address, byteAmount, identifier);
+	}
+	rc = portLibrary->vmem_commit_memory(portLibrary, address, byteAmount, identifier);
+	if ((NULL != rc) && (NULL != params) && (0 != params->prefaultThreads)
+		&& OMR_ARE_ANY_BITS_SET(identifier->mode, OMRPORT_VMEM_MEMORY_MODE_WRITE)
+	) {
+		omrvmem_prefault_memory(portLibrary, address, byteAmount, identifier->pageSize, params->prefaultThreads);
+	}
+	return rc;
+}
+#endif /* !defined(LINUX) || defined(OMRZTPF) */
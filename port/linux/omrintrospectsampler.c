@@ -0,0 +1,426 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Continuous stack sampling with perf_event
+ */
+
+/*
+ * Each sampled thread gets a perf_event software task-clock event with a sample period in
+ * nanoseconds of CPU time. The kernel writes PERF_RECORD_SAMPLE records holding the thread ID,
+ * the time and the user space call chain into a ring buffer mapped for that event, and a drain
+ * walks the ring buffers without stopping anybody. The call chain is unwound by the kernel
+ * through frame pointers, so frames of code built without them may be missing.
+ */
+
+#include "omrport.h"
+#include "omrportpriv.h"
+
+#if !defined(OMRZTPF)
+#include <errno.h>
+#include <string.h>
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "omrthread.h"
+#include "omrutilbase.h"
+
+#define SAMPLER_DEFAULT_PERIOD_NANOS J9CONST_U64(10000000)
+#define SAMPLER_DEFAULT_MAX_FRAMES 64
+#define SAMPLER_DEFAULT_BUFFER_PAGES 8
+#define SAMPLER_DEFAULT_BATCH_SIZE 64
+/* perf_event_header.size is 16 bits */
+#define SAMPLER_MAX_RECORD_SIZE 65536
+
+typedef struct OMRSampledThread {
+	uintptr_t threadId;
+	int fd;
+	struct perf_event_mmap_page *header;
+	uint8_t *data;
+	uintptr_t dataSize;
+	uintptr_t mapSize;
+} OMRSampledThread;
+
+typedef struct OMRIntrospectSampler {
+	OMRIntrospectSamplerParams params;
+	omrthread_monitor_t monitor; /**< protects threads */
+	omrthread_monitor_t drainMonitor; /**< serializes drains, which use batch, frames and recordBuffer */
+	OMRSampledThread *threads;
+	uintptr_t threadCount;
+	uintptr_t threadCapacity;
+	OMRIntrospectSample *batch;
+	void **frames; /**< batchSize * maxFrames frames for the samples in batch */
+	uint8_t *recordBuffer; /**< a record that wraps around the end of a ring buffer is reassembled here */
+} OMRIntrospectSampler;
+
+static uintptr_t
+currentThreadId(void)
+{
+	return (uintptr_t)syscall(SYS_gettid);
+}
+
+static int
+openSampleEvent(OMRIntrospectSampler *sampler, uintptr_t threadId)
+{
+	struct perf_event_attr attr;
+	int fd = -1;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_SOFTWARE;
+	attr.config = PERF_COUNT_SW_TASK_CLOCK;
+	attr.sample_period = sampler->params.periodNanos;
+	attr.sample_type = PERF_SAMPLE_TID | PERF_SAMPLE_TIME | PERF_SAMPLE_CALLCHAIN;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.exclude_callchain_kernel = 1;
+#if defined(PERF_ATTR_SIZE_VER5)
+	attr.sample_max_stack = (uint16_t)OMR_MIN(sampler->params.maxFrames, 0xFFFF);
+#endif /* defined(PERF_ATTR_SIZE_VER5) */
+	/* time samples on the omrtime_nano_time clock */
+	attr.use_clockid = 1;
+	attr.clockid = CLOCK_MONOTONIC;
+
+	fd = (int)syscall(__NR_perf_event_open, &attr, (pid_t)threadId, -1, -1, PERF_FLAG_FD_CLOEXEC);
+	if ((-1 == fd) && (EINVAL == errno)) {
+		/* Kernels before 4.1 have no clockid, and before 4.8 no sample_max_stack */
+		attr.use_clockid = 0;
+		attr.clockid = 0;
+#if defined(PERF_ATTR_SIZE_VER5)
+		attr.sample_max_stack = 0;
+#endif /* defined(PERF_ATTR_SIZE_VER5) */
+		fd = (int)syscall(__NR_perf_event_open, &attr, (pid_t)threadId, -1, -1, PERF_FLAG_FD_CLOEXEC);
+	}
+	return fd;
+}
+
+static void
+closeSampledThread(OMRSampledThread *thread)
+{
+	munmap(thread->header, thread->mapSize);
+	close(thread->fd);
+}
+
+/**
+ * Copy one PERF_RECORD_SAMPLE into the next slot of the batch.
+ */
+static void
+addSample(OMRIntrospectSampler *sampler, const uint8_t *record, uintptr_t *batchCount)
+{
+	/* sample_type TID | TIME | CALLCHAIN: { header; u32 pid, tid; u64 time; u64 nr; u64 ips[nr]; } */
+	const uint8_t *body = record + sizeof(struct perf_event_header);
+	const uint64_t *ips = (const uint64_t *)(body + 24);
+	uint64_t nr = *(const uint64_t *)(body + 16);
+	OMRIntrospectSample *sample = &sampler->batch[*batchCount];
+	uint64_t i = 0;
+
+	sample->threadId = *(const uint32_t *)(body + 4);
+	sample->timeNanos = *(const uint64_t *)(body + 8);
+	sample->frames = &sampler->frames[*batchCount * sampler->params.maxFrames];
+	sample->frameCount = 0;
+	for (i = 0; (i < nr) && (sample->frameCount < sampler->params.maxFrames); i++) {
+		/* skip the PERF_CONTEXT_* markers that separate kernel and user frames */
+		if (ips[i] < (uint64_t)PERF_CONTEXT_MAX) {
+			sample->frames[sample->frameCount] = (void *)(uintptr_t)ips[i];
+			sample->frameCount += 1;
+		}
+	}
+
+	*batchCount += 1;
+}
+#endif /* !defined(OMRZTPF) */
+
+int32_t
+omrintrospect_sampler_open(struct OMRPortLibrary *portLibrary, const OMRIntrospectSamplerParams *params, struct OMRIntrospectSampler **sampler)
+{
+#if !defined(OMRZTPF)
+	OMRIntrospectSampler *newSampler = NULL;
+	uintptr_t frameCount = 0;
+
+	if (NULL == sampler) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	*sampler = NULL;
+
+	newSampler = (OMRIntrospectSampler *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRIntrospectSampler), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newSampler) {
+		return OMRPORT_ERROR_OPFAILED;
+	}
+	memset(newSampler, 0, sizeof(OMRIntrospectSampler));
+	if (NULL != params) {
+		newSampler->params = *params;
+	}
+	if (0 == newSampler->params.periodNanos) {
+		newSampler->params.periodNanos = SAMPLER_DEFAULT_PERIOD_NANOS;
+	}
+	if (0 == newSampler->params.maxFrames) {
+		newSampler->params.maxFrames = SAMPLER_DEFAULT_MAX_FRAMES;
+	}
+	if (0 == newSampler->params.bufferPages) {
+		newSampler->params.bufferPages = SAMPLER_DEFAULT_BUFFER_PAGES;
+	}
+	/* the kernel requires a power of 2 data pages */
+	while (0 != (newSampler->params.bufferPages & (newSampler->params.bufferPages - 1))) {
+		newSampler->params.bufferPages += newSampler->params.bufferPages & ~(newSampler->params.bufferPages - 1);
+	}
+	if (0 == newSampler->params.batchSize) {
+		newSampler->params.batchSize = SAMPLER_DEFAULT_BATCH_SIZE;
+	}
+
+	frameCount = newSampler->params.batchSize * newSampler->params.maxFrames;
+	newSampler->batch = (OMRIntrospectSample *)portLibrary->mem_allocate_memory(portLibrary,
+		newSampler->params.batchSize * sizeof(OMRIntrospectSample), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	newSampler->frames = (void **)portLibrary->mem_allocate_memory(portLibrary,
+		frameCount * sizeof(void *), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	newSampler->recordBuffer = (uint8_t *)portLibrary->mem_allocate_memory(portLibrary,
+		SAMPLER_MAX_RECORD_SIZE, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if ((NULL == newSampler->batch) || (NULL == newSampler->frames) || (NULL == newSampler->recordBuffer)
+		|| (0 != omrthread_monitor_init_with_name(&newSampler->monitor, 0, "omrintrospect sampler"))
+		|| (0 != omrthread_monitor_init_with_name(&newSampler->drainMonitor, 0, "omrintrospect sampler drain"))
+	) {
+		if (NULL != newSampler->monitor) {
+			omrthread_monitor_destroy(newSampler->monitor);
+		}
+		portLibrary->mem_free_memory(portLibrary, newSampler->batch);
+		portLibrary->mem_free_memory(portLibrary, newSampler->frames);
+		portLibrary->mem_free_memory(portLibrary, newSampler->recordBuffer);
+		portLibrary->mem_free_memory(portLibrary, newSampler);
+		return OMRPORT_ERROR_OPFAILED;
+	}
+
+	*sampler = newSampler;
+	return 0;
+#else /* !defined(OMRZTPF) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* !defined(OMRZTPF) */
+}
+
+int32_t
+omrintrospect_sampler_add_thread(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, uintptr_t threadId)
+{
+#if !defined(OMRZTPF)
+	uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+	OMRSampledThread thread;
+	int32_t rc = 0;
+
+	if (NULL == sampler) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	memset(&thread, 0, sizeof(thread));
+	thread.threadId = (0 == threadId) ? currentThreadId() : threadId;
+	thread.fd = openSampleEvent(sampler, thread.threadId);
+	if (-1 == thread.fd) {
+		switch (errno) {
+		case EACCES:
+		case EPERM:
+			/* kernel.perf_event_paranoid, or a seccomp filter */
+			return OMRPORT_ERROR_NOPERMISSION;
+		case ENOSYS:
+		case ENOENT:
+			return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+		case ESRCH:
+			return OMRPORT_ERROR_INVALID_ARGUMENTS;
+		default:
+			return OMRPORT_ERROR_OPFAILED;
+		}
+	}
+
+	/* one header page followed by the ring buffer */
+	thread.dataSize = sampler->params.bufferPages * pageSize;
+	thread.mapSize = thread.dataSize + pageSize;
+	thread.header = (struct perf_event_mmap_page *)mmap(NULL, thread.mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, thread.fd, 0);
+	if (MAP_FAILED == (void *)thread.header) {
+		close(thread.fd);
+		/* The locked memory limit for perf buffers is kernel.perf_event_mlock_kb */
+		return (EPERM == errno) ? OMRPORT_ERROR_NOPERMISSION : OMRPORT_ERROR_OPFAILED;
+	}
+	thread.data = (uint8_t *)thread.header + pageSize;
+
+	omrthread_monitor_enter(sampler->monitor);
+	if (sampler->threadCount == sampler->threadCapacity) {
+		uintptr_t newCapacity = OMR_MAX(sampler->threadCapacity * 2, 16);
+		OMRSampledThread *newThreads = (OMRSampledThread *)portLibrary->mem_reallocate_memory(portLibrary, sampler->threads,
+			newCapacity * sizeof(OMRSampledThread), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == newThreads) {
+			rc = OMRPORT_ERROR_OPFAILED;
+		} else {
+			sampler->threads = newThreads;
+			sampler->threadCapacity = newCapacity;
+		}
+	}
+	if (0 == rc) {
+		sampler->threads[sampler->threadCount] = thread;
+		sampler->threadCount += 1;
+	}
+	omrthread_monitor_exit(sampler->monitor);
+
+	if (0 != rc) {
+		closeSampledThread(&thread);
+	}
+	return rc;
+#else /* !defined(OMRZTPF) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* !defined(OMRZTPF) */
+}
+
+int32_t
+omrintrospect_sampler_remove_thread(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, uintptr_t threadId)
+{
+#if !defined(OMRZTPF)
+	int32_t rc = OMRPORT_ERROR_INVALID_ARGUMENTS;
+	uintptr_t i = 0;
+
+	if (NULL == sampler) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	if (0 == threadId) {
+		threadId = currentThreadId();
+	}
+	omrthread_monitor_enter(sampler->monitor);
+	for (i = 0; i < sampler->threadCount; i++) {
+		if (sampler->threads[i].threadId == threadId) {
+			closeSampledThread(&sampler->threads[i]);
+			sampler->threadCount -= 1;
+			sampler->threads[i] = sampler->threads[sampler->threadCount];
+			rc = 0;
+			break;
+		}
+	}
+	omrthread_monitor_exit(sampler->monitor);
+	return rc;
+#else /* !defined(OMRZTPF) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* !defined(OMRZTPF) */
+}
+
+intptr_t
+omrintrospect_sampler_drain(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, OMRIntrospectSampleCallback callback, void *userData)
+{
+#if !defined(OMRZTPF)
+	intptr_t delivered = 0;
+	uintptr_t batchCount = 0;
+	uintptr_t i = 0;
+
+	if ((NULL == sampler) || (NULL == callback)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+	/* The callback runs without the sampler monitor, so that it may add and remove threads. Those
+	 * move entries of sampler->threads, so no pointer into it is kept across a callback.
+	 */
+	omrthread_monitor_enter(sampler->drainMonitor);
+	omrthread_monitor_enter(sampler->monitor);
+	while (i < sampler->threadCount) {
+		OMRSampledThread *thread = &sampler->threads[i];
+		uintptr_t threadId = thread->threadId;
+		uint64_t head = thread->header->data_head;
+		uint64_t tail = thread->header->data_tail;
+		BOOLEAN batchFull = FALSE;
+
+		/* read records only after data_head, pairing with the kernel's write barrier */
+		issueReadBarrier();
+		while (tail < head) {
+			uintptr_t offset = (uintptr_t)(tail % thread->dataSize);
+			const struct perf_event_header *record = (const struct perf_event_header *)(thread->data + offset);
+			uintptr_t size = record->size;
+
+			if (0 == size) {
+				break;
+			}
+			if (PERF_RECORD_SAMPLE == record->type) {
+				if ((offset + size) > thread->dataSize) {
+					uintptr_t firstPart = thread->dataSize - offset;
+					memcpy(sampler->recordBuffer, record, firstPart);
+					memcpy(sampler->recordBuffer + firstPart, thread->data, size - firstPart);
+					record = (const struct perf_event_header *)sampler->recordBuffer;
+				}
+				addSample(sampler, (const uint8_t *)record, &batchCount);
+			}
+			tail += size;
+			if (batchCount == sampler->params.batchSize) {
+				batchFull = TRUE;
+				break;
+			}
+		}
+		/* finish reading before handing the space back to the kernel; the batch holds copies */
+		issueReadWriteBarrier();
+		thread->header->data_tail = tail;
+
+		if (batchFull) {
+			uintptr_t j = 0;
+
+			omrthread_monitor_exit(sampler->monitor);
+			callback(portLibrary, sampler->batch, batchCount, userData);
+			delivered += batchCount;
+			batchCount = 0;
+			omrthread_monitor_enter(sampler->monitor);
+			/* carry on with this thread wherever it is now or, if it was removed, with the thread
+			 * that took its slot; records of a thread passed over are left for the next drain
+			 */
+			for (j = 0; j < sampler->threadCount; j++) {
+				if (threadId == sampler->threads[j].threadId) {
+					i = j;
+					break;
+				}
+			}
+		} else {
+			i += 1;
+		}
+	}
+	omrthread_monitor_exit(sampler->monitor);
+	if (0 != batchCount) {
+		callback(portLibrary, sampler->batch, batchCount, userData);
+		delivered += batchCount;
+	}
+	omrthread_monitor_exit(sampler->drainMonitor);
+
+	return delivered;
+#else /* !defined(OMRZTPF) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* !defined(OMRZTPF) */
+}
+
+void
+omrintrospect_sampler_close(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler)
+{
+#if !defined(OMRZTPF)
+	if (NULL != sampler) {
+		uintptr_t i = 0;
+
+		for (i = 0; i < sampler->threadCount; i++) {
+			closeSampledThread(&sampler->threads[i]);
+		}
+		omrthread_monitor_destroy(sampler->monitor);
+		omrthread_monitor_destroy(sampler->drainMonitor);
+		portLibrary->mem_free_memory(portLibrary, sampler->threads);
+		portLibrary->mem_free_memory(portLibrary, sampler->batch);
+		portLibrary->mem_free_memory(portLibrary, sampler->frames);
+		portLibrary->mem_free_memory(portLibrary, sampler->recordBuffer);
+		portLibrary->mem_free_memory(portLibrary, sampler);
+	}
+#endif /* !defined(OMRZTPF) */
+}
@@ -57,6 +57,15 @@
 #define MADV_HUGEPAGE 14
 #endif /* MADV_HUGEPAGE */
 
+#if !defined(MADV_NOHUGEPAGE)
+#define MADV_NOHUGEPAGE 15
+#endif /* MADV_NOHUGEPAGE */
+
+/* MADV_POPULATE_WRITE is available from Linux 5.14 */
+#if !defined(MADV_POPULATE_WRITE)
+#define MADV_POPULATE_WRITE 23
+#endif /* MADV_POPULATE_WRITE */
+
 #if !defined(MFD_HUGETLB)
 #define MFD_HUGETLB 0x4
 #endif /* MFD_HUGETLB */
@@ -73,6 +82,10 @@
 #define MPOL_F_MEMS_ALLOWED 4
 #endif
 
+#if !defined(MPOL_LOCAL)
+#define MPOL_LOCAL 4
+#endif
+
 #include <sys/shm.h>
 
 #if !defined(MAP_FAILED)
@@ -89,6 +102,7 @@
 #define VMEM_MEMINFO_SIZE_MAX   2048
 #define VMEM_PROC_MEMINFO_FNAME "/proc/meminfo"
 #define VMEM_PROC_MAPS_FNAME    "/proc/self/maps"
+#define VMEM_PROC_SMAPS_FNAME   "/proc/self/smaps"
 
 #define VMEM_TRANSPARENT_HUGEPAGE_FNAME "/sys/kernel/mm/transparent_hugepage/enabled"
 #define VMEM_TRANSPARENT_HUGEPAGE_MADVISE "always [madvise] never"
@@ -142,6 +156,8 @@ static BOOLEAN isStrictAndOutOfRange(void *memoryPointer, void *startAddress, vo
 static BOOLEAN rangeIsValid(struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount);
 static void *reserveMemoryWithShmat(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t pageSize, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t mode);
 static uintptr_t adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount);
+static void applyHugepagePolicyOnReserve(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount);
+static void applyHugepagePolicyOnCommit(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount);
 
 static BOOLEAN set_flags_for_mmap(int *flags);
 static void *reserve_memory_with_mmap(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t mode, uintptr_t pageSize, OMRMemCategory *category);
@@ -653,6 +669,7 @@ omrvmem_commit_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr
 				fflush(stdout);
 #endif
 				rc = address;
+				applyHugepagePolicyOnCommit(portLibrary, identifier, address, byteAmount);
 			} else {
 				Trc_PRT_vmem_omrvmem_commit_memory_mprotect_failure(errno);
 				portLibrary->error_set_last_error(portLibrary, errno, OMRPORT_ERROR_VMEM_OPFAILED);
@@ -777,6 +794,7 @@ omrvmem_vmem_params_init(struct OMRPortLibrary *portLibrary, struct J9PortVmemPa
 	params->options = 0;
 	params->category = OMRMEM_CATEGORY_UNKNOWN;
 	params->alignmentInBytes = 0;
+	params->hugePagePolicy = OMRPORT_VMEM_HUGEPAGE_POLICY_DEFAULT;
 	return 0;
 }
 
@@ -809,6 +827,9 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 	Assert_PRT_true(params->startAddress <= params->endAddress);
 	ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(params->byteAmount, params->pageSize);
 
+	/* The policy is recorded before reserving so that a commit made as part of the reserve honours it */
+	identifier->hugePagePolicy = params->hugePagePolicy;
+
 	/* Invalid input */
 	if (0 == params->pageSize) {
 		update_vmemIdentifier(identifier, NULL, NULL, 0, 0, 0, 0, 0, NULL, -1);
@@ -817,9 +838,25 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 		uintptr_t alignmentInBytes = OMR_MAX(params->pageSize, params->alignmentInBytes);
 		uintptr_t minimumGranule = OMR_MIN(params->pageSize, params->alignmentInBytes);
 
-		/* Make sure that the alignment is a multiple of both requested alignment and page size (enforces that arguments are powers of two and, thus, their max is their lowest common multiple) */
-		if ((0 == minimumGranule) || (0 == (alignmentInBytes % minimumGranule))) {
-			memoryPointer = getMemoryInRangeWithMmap(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, alignmentInBytes, params->options, params->mode, PPG_vmem_pageSize[0]);
+		if ((OMRPORT_VMEM_HUGEPAGE_POLICY_HUGETLBFS == params->hugePagePolicy)
+			&& (0 != PPG_vmem_pageSize[1])
+			&& (0 == (params->byteAmount % PPG_vmem_pageSize[1]))
+			&& OMR_ARE_NO_BITS_SET(params->mode, OMRPORT_VMEM_MEMORY_MODE_SHARE_FILE_OPEN)
+		) {
+			/* Try the hugetlbfs pool first; the reservation then reports the large page size */
+			uintptr_t largePageAlignmentInBytes = OMR_MAX(PPG_vmem_pageSize[1], params->alignmentInBytes);
+			memoryPointer = getMemoryInRangeWithMmap(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, largePageAlignmentInBytes, params->options, params->mode | OMRPORT_VMEM_MEMORY_MODE_MMAP_HUGE_PAGES, PPG_vmem_pageSize[1]);
+		}
+
+		if (NULL == memoryPointer) {
+			if (OMRPORT_VMEM_HUGEPAGE_POLICY_HUGETLBFS == params->hugePagePolicy) {
+				/* The hugetlbfs pool is unavailable or exhausted, fall back to transparent huge pages */
+				identifier->hugePagePolicy = OMRPORT_VMEM_HUGEPAGE_POLICY_MADVISE;
+			}
+			/* Make sure that the alignment is a multiple of both requested alignment and page size (enforces that arguments are powers of two and, thus, their max is their lowest common multiple) */
+			if ((0 == minimumGranule) || (0 == (alignmentInBytes % minimumGranule))) {
+				memoryPointer = getMemoryInRangeWithMmap(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, alignmentInBytes, params->options, params->mode, PPG_vmem_pageSize[0]);
+			}
 		}
 	} else if (PPG_vmem_pageSize[1] == params->pageSize) {
 		uintptr_t largePageAlignmentInBytes = OMR_MAX(params->pageSize, params->alignmentInBytes);
@@ -850,6 +887,10 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 				uintptr_t alignmentInBytes = OMR_MAX(defaultPageSize, params->alignmentInBytes);
 				uintptr_t minimumGranule = OMR_MIN(defaultPageSize, params->alignmentInBytes);
 
+				if (OMRPORT_VMEM_HUGEPAGE_POLICY_HUGETLBFS == params->hugePagePolicy) {
+					identifier->hugePagePolicy = OMRPORT_VMEM_HUGEPAGE_POLICY_MADVISE;
+				}
+
 				/* Make sure that the alignment is a multiple of both requested alignment and page size (enforces that arguments are powers of two and, thus, their max is their lowest common multiple) */
 				if ((0 == minimumGranule) || (0 == (alignmentInBytes % minimumGranule))) {
 					memoryPointer = getMemoryInRangeWithMmap(portLibrary, identifier, category, params->byteAmount, params->startAddress, params->endAddress, alignmentInBytes, params->options, params->mode, PPG_vmem_pageSize[0]);
@@ -863,6 +904,9 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 		update_vmemIdentifier(identifier, NULL, NULL, 0, 0, 0, 0, 0, NULL, -1);
 		Trc_PRT_vmem_omrvmem_reserve_memory_unsupported_page_size(params->pageSize);
 	}
+	if (NULL == memoryPointer) {
+		identifier->hugePagePolicy = OMRPORT_VMEM_HUGEPAGE_POLICY_DEFAULT;
+	}
 #if defined(OMR_PORT_NUMA_SUPPORT)
 	if (NULL != memoryPointer) {
 		port_numa_interleave_memory(portLibrary, memoryPointer, params->byteAmount);
@@ -975,6 +1019,74 @@ adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byte
 #endif /* defined(MAP_ANON) || defined(MAP_ANONYMOUS) */
 }
 
+/**
+ * Apply the reservation-time part of the huge page policy recorded in the identifier to a
+ * newly reserved default page size range. The madvise and eager policies act on commit instead,
+ * so that only ranges actually in use are promoted.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] identifier The identifier of the reservation.
+ * @param[in] address The start of the reserved range.
+ * @param[in] byteAmount The size of the reserved range.
+ */
+static void
+applyHugepagePolicyOnReserve(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount)
+{
+	switch (identifier->hugePagePolicy) {
+	case OMRPORT_VMEM_HUGEPAGE_POLICY_DEFAULT:
+		adviseHugepage(portLibrary, address, byteAmount);
+		break;
+	case OMRPORT_VMEM_HUGEPAGE_POLICY_NEVER:
+		madvise(address, (size_t)byteAmount, MADV_NOHUGEPAGE);
+		break;
+	default:
+		break;
+	}
+}
+
+/**
+ * Apply the commit-time part of the huge page policy recorded in the identifier. Failures are
+ * ignored: the range is committed either way, only its huge page coverage is affected, and
+ * that can be inspected with omrvmem_get_hugepage_coverage.
+ *
+ * The eager policy prefaults the range with MADV_POPULATE_WRITE, falling back to touching
+ * each page of a private mapping on kernels that predate it.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] identifier The identifier of the reservation.
+ * @param[in] address The start of the committed range.
+ * @param[in] byteAmount The size of the committed range.
+ */
+static void
+applyHugepagePolicyOnCommit(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount)
+{
+	if ((PPG_vmem_pageSize[0] != identifier->pageSize) || (0 == byteAmount)) {
+		return;
+	}
+
+	switch (identifier->hugePagePolicy) {
+	case OMRPORT_VMEM_HUGEPAGE_POLICY_MADVISE:
+		madvise(address, (size_t)byteAmount, MADV_HUGEPAGE);
+		break;
+	case OMRPORT_VMEM_HUGEPAGE_POLICY_EAGER:
+		madvise(address, (size_t)byteAmount, MADV_HUGEPAGE);
+		if (OMR_ARE_ANY_BITS_SET(identifier->mode, OMRPORT_VMEM_MEMORY_MODE_WRITE)
+			&& (0 != madvise(address, (size_t)byteAmount, MADV_POPULATE_WRITE))
+			&& (EINVAL == errno)
+			&& (OMRPORT_VMEM_RESERVE_USED_MMAP == identifier->allocator)
+		) {
+			volatile uint8_t *cursor = (volatile uint8_t *)address;
+			volatile uint8_t *end = cursor + byteAmount;
+			for (; cursor < end; cursor += PPG_vmem_pageSize[0]) {
+				*cursor = *cursor;
+			}
+		}
+		break;
+	default:
+		break;
+	}
+}
+
 uintptr_t
 omrvmem_get_page_size(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier)
 {
@@ -1377,6 +1489,7 @@ omrvmem_create_double_mapped_region(struct OMRPortLibrary *portLibrary, void* re
 	BOOLEAN shouldDecrementCategoryCounter = FALSE;
 	/* All regions are fully double mapped. Partial double mapping is not supported yet. */
 	Assert_PRT_true((regionsCount * regionSize) == byteAmount);
+	newIdentifier->hugePagePolicy = OMRPORT_VMEM_HUGEPAGE_POLICY_DEFAULT;
 
 	if (0 != (OMRPORT_VMEM_MEMORY_MODE_COMMIT & mode)) {
 		protectionFlags = get_protectionBits(mode);
@@ -1522,6 +1635,7 @@ omrvmem_get_contiguous_region_memory(struct OMRPortLibrary *portLibrary, void* a
 	byteAmount = addressesCount * addressSize;
 	BOOLEAN successfulContiguousMap = FALSE;
 	BOOLEAN shouldUnmapAddr = FALSE;
+	newIdentifier->hugePagePolicy = OMRPORT_VMEM_HUGEPAGE_POLICY_DEFAULT;
 
 	if (0 != (OMRPORT_VMEM_MEMORY_MODE_COMMIT & mode)) {
 		protectionFlags = get_protectionBits(mode);
@@ -1939,7 +2053,7 @@ allocAnywhere:
 
 		memoryPointer = NULL;
 	} else if (0 == (mode & OMRPORT_VMEM_MEMORY_MODE_MMAP_HUGE_PAGES)) {
-		adviseHugepage(portLibrary, memoryPointer, byteAmount);
+		applyHugepagePolicyOnReserve(portLibrary, identifier, memoryPointer, byteAmount);
 	}
 
 	return memoryPointer;
@@ -2130,6 +2244,40 @@ omrvmem_numa_set_affinity(struct OMRPortLibrary *portLibrary, uintptr_t numaNode
 	return result;
 }
 
+void *
+omrvmem_commit_memory_ex(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, struct J9PortVmemCommitParams *params)
+{
+	void *rc = NULL;
+
+	if ((NULL != params) && (OMRPORT_VMEM_NUMA_POLICY_NONE != params->numaPolicy)) {
+		/* The policy must be in place before the range is faulted in. Placement is best effort. */
+		if (OMRPORT_VMEM_NUMA_POLICY_PREFERRED == params->numaPolicy) {
+			portLibrary->vmem_numa_set_affinity(portLibrary, params->numaNode, address, byteAmount, identifier);
+		}
+#if defined(OMR_PORT_NUMA_SUPPORT)
+		else if ((1 == PPG_numa_platform_supports_numa) && OMR_ARE_NO_BITS_SET(identifier->mode, OMRPORT_VMEM_NO_AFFINITY)) {
+			if (OMRPORT_VMEM_NUMA_POLICY_INTERLEAVE == params->numaPolicy) {
+				/* See port_numa_interleave_memory for why the mbind is retried with a smaller maxnode */
+				unsigned long maxnode = sizeof(J9PortNodeMask) * 8;
+				if (0 != do_mbind(address, byteAmount, MPOL_INTERLEAVE, PPG_numa_mempolicy_node_mask.mask, maxnode, 0)) {
+					do_mbind(address, byteAmount, MPOL_INTERLEAVE, PPG_numa_mempolicy_node_mask.mask, PPG_numa_max_node_bits, 0);
+				}
+			} else if (OMRPORT_VMEM_NUMA_POLICY_LOCAL == params->numaPolicy) {
+				do_mbind(address, byteAmount, MPOL_LOCAL, NULL, 0, 0);
+			}
+		}
+#endif /* defined(OMR_PORT_NUMA_SUPPORT) */
+	}
+
+	rc = portLibrary->vmem_commit_memory(portLibrary, address, byteAmount, identifier);
+	if ((NULL != rc) && (NULL != params) && (0 != params->prefaultThreads)
+		&& OMR_ARE_ANY_BITS_SET(identifier->mode, OMRPORT_VMEM_MEMORY_MODE_WRITE)
+	) {
+		omrvmem_prefault_memory(portLibrary, address, byteAmount, identifier->pageSize, params->prefaultThreads);
+	}
+	return rc;
+}
+
 intptr_t
 omrvmem_numa_get_node_details(struct OMRPortLibrary *portLibrary, J9MemoryNodeDetail *numaNodes, uintptr_t *nodeCount)
 {
@@ -2333,6 +2481,120 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return result;
 }
 
+/**
+ * Accumulate the counters of one /proc/self/smaps mapping into the coverage totals, scaled to the
+ * part of the mapping that overlaps the queried range. A reservation may be merged with a neighbouring
+ * mapping that has identical attributes, in which case the result is an estimate.
+ */
+static void
+addSmapsCoverage(uintptr_t vmaStart, uintptr_t vmaEnd, uintptr_t rangeStart, uintptr_t rangeEnd, uint64_t rssKB, uint64_t hugeKB, uint64_t hugetlbKB, uint64_t *hugePageBytes, uint64_t *residentBytes)
+{
+	uintptr_t overlapStart = OMR_MAX(vmaStart, rangeStart);
+	uintptr_t overlapEnd = OMR_MIN(vmaEnd, rangeEnd);
+
+	if (overlapStart < overlapEnd) {
+		uint64_t huge = (hugeKB + hugetlbKB) * 1024;
+		uint64_t resident = (rssKB + hugetlbKB) * 1024;
+		if ((overlapEnd - overlapStart) != (vmaEnd - vmaStart)) {
+			double fraction = (double)(overlapEnd - overlapStart) / (double)(vmaEnd - vmaStart);
+			huge = (uint64_t)(huge * fraction);
+			resident = (uint64_t)(resident * fraction);
+		}
+		*hugePageBytes += huge;
+		*residentBytes += resident;
+	}
+}
+
+int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBytes, uintptr_t *residentBytes)
+{
+	uintptr_t rangeStart = 0;
+	uintptr_t rangeEnd = 0;
+	uint64_t hugeTotal = 0;
+	uint64_t residentTotal = 0;
+	uintptr_t vmaStart = 0;
+	uintptr_t vmaEnd = 0;
+	uint64_t rssKB = 0;
+	uint64_t hugeKB = 0;
+	uint64_t hugetlbKB = 0;
+	char readBuf[4096];
+	/* Only the beginning of each line is needed: the address range or the counter name and value */
+	char lineBuf[128];
+	intptr_t lineCursor = 0;
+	BOOLEAN gotEOF = FALSE;
+	intptr_t fd = -1;
+
+	if ((NULL == identifier) || (NULL == identifier->address) || (0 == identifier->size) || (NULL == hugePageBytes) || (NULL == residentBytes)) {
+		return OMRPORT_ERROR_VMEM_INVALID_PARAMS;
+	}
+	rangeStart = (uintptr_t)identifier->address;
+	rangeEnd = rangeStart + identifier->size;
+
+	fd = omrfile_open(portLibrary, VMEM_PROC_SMAPS_FNAME, EsOpenRead, 0);
+	if (-1 == fd) {
+		return OMRPORT_ERROR_VMEM_OPFAILED;
+	}
+
+	while (!gotEOF) {
+		intptr_t readCursor = 0;
+		intptr_t bytesRead = omrfile_read(portLibrary, fd, readBuf, sizeof(readBuf));
+		if (-1 == bytesRead) {
+			if (OMRPORT_ERROR_FILE_EOF != omrerror_last_error_number(portLibrary)) {
+				omrfile_close(portLibrary, fd);
+				return OMRPORT_ERROR_VMEM_OPFAILED;
+			}
+			gotEOF = TRUE;
+			bytesRead = 0;
+		}
+
+		for (readCursor = 0; readCursor < bytesRead; readCursor++) {
+			char ch = readBuf[readCursor];
+			if ('\n' != ch) {
+				if (lineCursor < (intptr_t)(sizeof(lineBuf) - 1)) {
+					lineBuf[lineCursor] = ch;
+					lineCursor++;
+				}
+			} else {
+				uintptr_t start = 0;
+				uintptr_t end = 0;
+				char key[32];
+				uint64_t valueKB = 0;
+
+				lineBuf[lineCursor] = '\0';
+				lineCursor = 0;
+				if (2 == sscanf(lineBuf, "%" SCNxPTR "-%" SCNxPTR, &start, &end)) {
+					/* A new mapping starts: account for the previous one */
+					addSmapsCoverage(vmaStart, vmaEnd, rangeStart, rangeEnd, rssKB, hugeKB, hugetlbKB, &hugeTotal, &residentTotal);
+					vmaStart = start;
+					vmaEnd = end;
+					rssKB = 0;
+					hugeKB = 0;
+					hugetlbKB = 0;
+				} else if ((vmaStart < rangeEnd) && (rangeStart < vmaEnd)
+					&& (2 == sscanf(lineBuf, "%31[^:]: %" SCNu64, key, &valueKB))
+				) {
+					if (0 == strcmp(key, "Rss")) {
+						rssKB = valueKB;
+					} else if ((0 == strcmp(key, "AnonHugePages"))
+						|| (0 == strcmp(key, "ShmemPmdMapped"))
+						|| (0 == strcmp(key, "FilePmdMapped"))
+					) {
+						hugeKB += valueKB;
+					} else if ((0 == strcmp(key, "Private_Hugetlb")) || (0 == strcmp(key, "Shared_Hugetlb"))) {
+						hugetlbKB += valueKB;
+					}
+				}
+			}
+		}
+	}
+	omrfile_close(portLibrary, fd);
+
+	addSmapsCoverage(vmaStart, vmaEnd, rangeStart, rangeEnd, rssKB, hugeKB, hugetlbKB, &hugeTotal, &residentTotal);
+	*hugePageBytes = (uintptr_t)hugeTotal;
+	*residentBytes = (uintptr_t)residentTotal;
+	return 0;
+}
+
 static void
 addressIterator_init(AddressIterator *iterator, ADDRESS minimum, ADDRESS maximum, uintptr_t alignment, intptr_t direction)
 {
@@ -134,6 +134,7 @@ typedef struct OMRPortLibraryGlobalData {
 	uintptr_t vmemEnableMadvise;					/* madvise to use Transparent HugePage (THP) for Virtual memory allocated by mmap */
 	J9SysinfoCPUTime oldestCPUTime;
 	J9SysinfoCPUTime latestCPUTime;
+	struct OMRMemSlabAllocator *slabAllocator;		/* small block allocator, created by OMRPORT_CTLDATA_MEM_SLAB_ALLOCATOR */
 } OMRPortLibraryGlobalData;
 
 /* J9SourceJ9CPUControl*/
@@ -264,6 +265,18 @@ omrfile_blockingasync_startup(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC void
 omrfile_blockingasync_shutdown(struct OMRPortLibrary *portLibrary);
 
+/* omrfileasync.c */
+extern J9_CFUNC int32_t
+omrfile_async_open(struct OMRPortLibrary *portLibrary, uintptr_t queueDepth, uint32_t flags, struct OMRFileAsyncQueue **queue);
+extern J9_CFUNC void
+omrfile_async_close(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue);
+extern J9_CFUNC intptr_t
+omrfile_async_submit(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue, struct OMRFileAsyncRequest **requests, uintptr_t count);
+extern J9_CFUNC intptr_t
+omrfile_async_poll(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue, uintptr_t minCompletions);
+extern J9_CFUNC uint32_t
+omrfile_async_get_backend(struct OMRPortLibrary *portLibrary, struct OMRFileAsyncQueue *queue);
+
 /* J9SourceJ9FileStream */
 extern J9_CFUNC int32_t
 omrfilestream_startup(struct OMRPortLibrary *portLibrary);
@@ -290,6 +303,20 @@ omrfilestream_fdopen(struct OMRPortLibrary *portLibrary, intptr_t fd, int32_t fl
 extern J9_CFUNC intptr_t
 omrfilestream_fileno(struct OMRPortLibrary *portLibrary, OMRFileStream *stream);
 
+/* J9SourceJ9FileStreamLog*/
+extern J9_CFUNC int32_t
+omrfilestream_log_open(struct OMRPortLibrary *portLibrary, intptr_t fd, uintptr_t bufferSize, uintptr_t flushIntervalMillis, struct OMRLogStream **logStream);
+extern J9_CFUNC intptr_t
+omrfilestream_log_write(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *buf, intptr_t nbytes);
+extern J9_CFUNC void
+omrfilestream_log_vprintf(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *format, va_list args);
+extern J9_CFUNC void
+omrfilestream_log_printf(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream, const char *format, ...);
+extern J9_CFUNC int32_t
+omrfilestream_log_flush(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream);
+extern J9_CFUNC int32_t
+omrfilestream_log_close(struct OMRPortLibrary *portLibrary, struct OMRLogStream *logStream);
+
 /* J9SourceJ9FileText*/
 extern J9_CFUNC intptr_t
 omrfile_write_text(struct OMRPortLibrary *portLibrary, intptr_t fd, const char *buf, intptr_t nbytes);
@@ -373,6 +400,22 @@ omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size);
 extern J9_CFUNC void
 omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size);
 
+/* omrmemslab.c */
+extern J9_CFUNC int32_t
+omrmem_slab_control(struct OMRPortLibrary *portLibrary, uintptr_t flags);
+extern J9_CFUNC void *
+omrmem_slab_allocate(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount, OMRMemCategory *category);
+extern J9_CFUNC BOOLEAN
+omrmem_slab_owns(struct OMRPortLibrary *portLibrary, void *memoryPointer);
+extern J9_CFUNC uintptr_t
+omrmem_slab_usable_size(struct OMRPortLibrary *portLibrary, void *memoryPointer);
+extern J9_CFUNC void
+omrmem_slab_free(struct OMRPortLibrary *portLibrary, void *memoryPointer);
+extern J9_CFUNC uintptr_t
+omrmem_slab_walk_categories(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state);
+extern J9_CFUNC void
+omrmem_slab_shutdown(struct OMRPortLibrary *portLibrary);
+
 /* J9SourceJ9MemoryMap*/
 extern J9_CFUNC void
 omrmmap_unmap_file(struct OMRPortLibrary *portLibrary, J9MmapHandle *handle);
@@ -667,6 +710,10 @@ extern J9_CFUNC int32_t
 omrsysinfo_get_process_start_time(struct OMRPortLibrary *portLibrary, uintptr_t pid, uint64_t *processStartTimeInNanoseconds);
 extern J9_CFUNC int32_t
 omrsysinfo_get_number_context_switches(struct OMRPortLibrary *portLibrary, uint64_t *numSwitches);
+extern J9_CFUNC int32_t
+omrsysinfo_memory_pressure_subscribe(struct OMRPortLibrary *portLibrary, const struct OMRMemoryPressureParams *params, struct OMRMemoryPressureMonitor **monitor);
+extern J9_CFUNC void
+omrsysinfo_memory_pressure_unsubscribe(struct OMRPortLibrary *portLibrary, struct OMRMemoryPressureMonitor *monitor);
 
 /* J9SourceJ9Signal*/
 extern J9_CFUNC int32_t
@@ -843,6 +890,8 @@ extern J9_CFUNC uint64_t
 omrtime_hires_clock(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC uint64_t
 omrtime_hires_delta(struct OMRPortLibrary *portLibrary, uint64_t startTime, uint64_t endTime, uint64_t requiredResolution);
+extern J9_CFUNC int64_t
+omrtime_fast_nanos(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC uint64_t
 omrtime_hires_frequency(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC int32_t
@@ -921,6 +970,14 @@ extern J9_CFUNC int32_t
 omrvmem_get_available_physical_memory(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 extern J9_CFUNC int32_t
 omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+extern J9_CFUNC int32_t
+omrvmem_get_hugepage_coverage(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, uintptr_t *hugePageBytes, uintptr_t *residentBytes);
+extern J9_CFUNC void *
+omrvmem_commit_memory_ex(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, struct J9PortVmemCommitParams *params);
+
+/* J9SourceVmemPrefault*/
+extern J9_CFUNC void
+omrvmem_prefault_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, uintptr_t pageSize, uintptr_t threadCount);
 
 /* J9SourcePort*/
 extern J9_CFUNC int32_t
@@ -966,6 +1023,18 @@ omrintrospect_backtrace_symbols(struct OMRPortLibrary *portLibrary, J9PlatformTh
 extern J9_CFUNC uintptr_t
 omrintrospect_backtrace_symbols_ex(struct OMRPortLibrary *portLibrary, J9PlatformThread *threadInfo, J9Heap *heap, uint32_t options);
 
+/* omrintrospectsampler */
+extern J9_CFUNC int32_t
+omrintrospect_sampler_open(struct OMRPortLibrary *portLibrary, const OMRIntrospectSamplerParams *params, struct OMRIntrospectSampler **sampler);
+extern J9_CFUNC int32_t
+omrintrospect_sampler_add_thread(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, uintptr_t threadId);
+extern J9_CFUNC int32_t
+omrintrospect_sampler_remove_thread(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, uintptr_t threadId);
+extern J9_CFUNC intptr_t
+omrintrospect_sampler_drain(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler, OMRIntrospectSampleCallback callback, void *userData);
+extern J9_CFUNC void
+omrintrospect_sampler_close(struct OMRPortLibrary *portLibrary, struct OMRIntrospectSampler *sampler);
+
 /* omrcuda */
 #if defined(OMR_OPT_CUDA)
 extern J9_CFUNC int32_t
@@ -110,6 +110,7 @@ OBJECTS += omrexit
 OBJECTS += omrfile
 OBJECTS += omrfiletext
 OBJECTS += omrfilestream
+OBJECTS += omrfilestreamlog
 OBJECTS += omrfilestreamtext
 
 ifneq (win,$(OMR_HOST_OS))
@@ -117,6 +118,7 @@ ifneq (win,$(OMR_HOST_OS))
 endif
 
 OBJECTS += omrfile_blockingasync
+OBJECTS += omrfileasync
 
 ifeq (win,$(OMR_HOST_OS))
   OBJECTS += omrfilehelpers
@@ -130,6 +132,7 @@ OBJECTS += omrheap
 OBJECTS += omrmem
 OBJECTS += omrmemtag
 OBJECTS += omrmemcategories
+OBJECTS += omrmemslab
 OBJECTS += omrport
 OBJECTS += omrmmap
 OBJECTS += j9nls
@@ -138,6 +141,7 @@ OBJECTS += omrosbacktrace
 OBJECTS += omrosbacktrace_impl
 OBJECTS += omrintrospect
 OBJECTS += omrintrospect_common
+OBJECTS += omrintrospectsampler
 OBJECTS += omrosdump
 OBJECTS += omrportcontrol
 OBJECTS += omrportptb
@@ -160,6 +164,7 @@ OBJECTS += omrtime
 OBJECTS += omrtlshelpers
 OBJECTS += omrtty
 OBJECTS += omrvmem
+OBJECTS += omrvmemprefault
 OBJECTS += ut_omrport
 OBJECTS += omrmemtag_checks
 ifneq (win,$(OMR_HOST_OS))
@@ -149,7 +149,10 @@
 #endif
 
 #if defined(LINUX) && !defined(OMRZTPF)
+#include <fcntl.h>
 #include <linux/magic.h>
+#include <poll.h>
+#include <sys/inotify.h>
 #include <sys/sysinfo.h>
 #include <sys/vfs.h>
 #include <sched.h>
@@ -165,6 +168,7 @@
 #include "omrportpriv.h"
 #include "omrportpg.h"
 #include "omrportptb.h"
+#include "omrutil.h"
 #include "portnls.h"
 #include "ut_omrport.h"
 
@@ -7558,6 +7562,389 @@ done:
 #endif /* defined(LINUX) */
 }
 
+#if defined(LINUX) && !defined(OMRZTPF)
+#define OMR_MEMORY_PRESSURE_THREAD_STACK_SIZE ((uintptr_t)64 * 1024)
+
+typedef struct OMRMemoryPressureMonitor {
+	struct OMRPortLibrary *portLibrary;
+	OMRMemoryPressureCallback callback;
+	void *userData;
+	uint32_t stallType;
+	char *pressurePath;
+	char *eventsPath;
+	int stallFd; /**< kernel pressure stall trigger, or -1 */
+	int inotifyFd;
+	int pressureWatch; /**< inotify watch of a stand-in memory.pressure, or -1 */
+	int eventsWatch; /**< inotify watch of memory.events, or -1 */
+	int wakePipe[2];
+	uint64_t eventCounts[OMRPORT_MEMORY_PRESSURE_EVENT_OOM_KILL + 1];
+	omrthread_t thread; /**< joined by omrsysinfo_memory_pressure_unsubscribe */
+} OMRMemoryPressureMonitor;
+
+/**
+ * Build the path of a file in the memory cgroup directory: the stand-in directory if one was
+ * given, otherwise the cgroup v2 memory cgroup of this process.
+ *
+ * @return the allocated path, or NULL on failure with *rc set
+ */
+static char *
+getMemoryPressureFilePath(struct OMRPortLibrary *portLibrary, const char *directory, const char *fileName, int32_t *rc)
+{
+	char pathBuf[PATH_MAX];
+	intptr_t bufferLength = sizeof(pathBuf);
+	uintptr_t pathLength = 0;
+	char *path = NULL;
+
+	if (NULL == directory) {
+		*rc = getAbsolutePathOfCgroupSubsystemFile(portLibrary, OMR_CGROUP_SUBSYSTEM_MEMORY, fileName, pathBuf, &bufferLength);
+	} else {
+		*rc = 0;
+		if (portLibrary->str_printf(portLibrary, NULL, 0, "%s/%s", directory, fileName) > sizeof(pathBuf)) {
+			*rc = OMRPORT_ERROR_STRING_BUFFER_TOO_SMALL;
+		} else {
+			portLibrary->str_printf(portLibrary, pathBuf, sizeof(pathBuf), "%s/%s", directory, fileName);
+		}
+	}
+	if (0 == *rc) {
+		pathLength = strlen(pathBuf) + 1;
+		path = (char *)portLibrary->mem_allocate_memory(portLibrary, pathLength, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == path) {
+			*rc = OMRPORT_ERROR_SYSINFO_MEMORY_ALLOC_FAILED;
+		} else {
+			memcpy(path, pathBuf, pathLength);
+		}
+	}
+	return path;
+}
+
+/**
+ * Read a small cgroup file into buffer as a NUL terminated string.
+ *
+ * @return the number of bytes read, or -1 on failure
+ */
+static intptr_t
+readMemoryPressureFile(const char *path, char *buffer, uintptr_t bufferSize)
+{
+	intptr_t bytesRead = -1;
+	int fd = open(path, O_RDONLY);
+
+	if (-1 != fd) {
+		bytesRead = read(fd, buffer, bufferSize - 1);
+		if (bytesRead >= 0) {
+			buffer[bytesRead] = '\0';
+		}
+		close(fd);
+	}
+	return bytesRead;
+}
+
+/**
+ * Parse the high, max, oom and oom_kill counters out of memory.events. Counters missing from the
+ * file are left unchanged.
+ */
+static void
+readMemoryEventCounts(const char *path, uint64_t *counts)
+{
+	char buffer[512];
+
+	if (readMemoryPressureFile(path, buffer, sizeof(buffer)) > 0) {
+		char *line = buffer;
+		while ('\0' != *line) {
+			char key[32];
+			uint64_t value = 0;
+			char *next = strchr(line, '\n');
+
+			if (NULL != next) {
+				*next = '\0';
+				next += 1;
+			} else {
+				next = line + strlen(line);
+			}
+			if (2 == sscanf(line, "%31s %" SCNu64, key, &value)) {
+				if (0 == strcmp(key, "high")) {
+					counts[OMRPORT_MEMORY_PRESSURE_EVENT_HIGH] = value;
+				} else if (0 == strcmp(key, "max")) {
+					counts[OMRPORT_MEMORY_PRESSURE_EVENT_MAX] = value;
+				} else if (0 == strcmp(key, "oom")) {
+					counts[OMRPORT_MEMORY_PRESSURE_EVENT_OOM] = value;
+				} else if (0 == strcmp(key, "oom_kill")) {
+					counts[OMRPORT_MEMORY_PRESSURE_EVENT_OOM_KILL] = value;
+				}
+			}
+			line = next;
+		}
+	}
+}
+
+/**
+ * Return the total stall time in microseconds from the "some" or "full" line of memory.pressure,
+ * or 0 if it cannot be read.
+ */
+static uint64_t
+readMemoryStallTotal(const char *path, uint32_t stallType)
+{
+	char buffer[256];
+	uint64_t total = 0;
+
+	if (readMemoryPressureFile(path, buffer, sizeof(buffer)) > 0) {
+		const char *prefix = (OMRPORT_MEMORY_PRESSURE_STALL_FULL == stallType) ? "full " : "some ";
+		char *line = strstr(buffer, prefix);
+		if (NULL != line) {
+			char *totalField = strstr(line, "total=");
+			char *lineEnd = strchr(line, '\n');
+			if ((NULL != totalField) && ((NULL == lineEnd) || (totalField < lineEnd))) {
+				sscanf(totalField, "total=%" SCNu64, &total);
+			}
+		}
+	}
+	return total;
+}
+
+static void
+deliverMemoryEventChanges(OMRMemoryPressureMonitor *monitor)
+{
+	uint64_t counts[OMRPORT_MEMORY_PRESSURE_EVENT_OOM_KILL + 1];
+	uint32_t type = 0;
+
+	memcpy(counts, monitor->eventCounts, sizeof(counts));
+	readMemoryEventCounts(monitor->eventsPath, counts);
+	for (type = OMRPORT_MEMORY_PRESSURE_EVENT_HIGH; type <= OMRPORT_MEMORY_PRESSURE_EVENT_OOM_KILL; type++) {
+		if (counts[type] > monitor->eventCounts[type]) {
+			OMRMemoryPressureEvent event;
+			event.type = type;
+			event.count = counts[type];
+			monitor->callback(monitor->portLibrary, &event, monitor->userData);
+		}
+		monitor->eventCounts[type] = counts[type];
+	}
+}
+
+static void
+deliverMemoryStall(OMRMemoryPressureMonitor *monitor)
+{
+	OMRMemoryPressureEvent event;
+	event.type = OMRPORT_MEMORY_PRESSURE_EVENT_STALL;
+	event.count = readMemoryStallTotal(monitor->pressurePath, monitor->stallType);
+	monitor->callback(monitor->portLibrary, &event, monitor->userData);
+}
+
+static int J9THREAD_PROC
+memoryPressureThread(void *arg)
+{
+	OMRMemoryPressureMonitor *monitor = (OMRMemoryPressureMonitor *)arg;
+	struct pollfd fds[3];
+	nfds_t fdCount = 0;
+	nfds_t i = 0;
+
+	fds[fdCount].fd = monitor->wakePipe[0];
+	fds[fdCount].events = POLLIN;
+	fdCount += 1;
+	if (-1 != monitor->inotifyFd) {
+		fds[fdCount].fd = monitor->inotifyFd;
+		fds[fdCount].events = POLLIN;
+		fdCount += 1;
+	}
+	if (-1 != monitor->stallFd) {
+		fds[fdCount].fd = monitor->stallFd;
+		fds[fdCount].events = POLLPRI;
+		fdCount += 1;
+	}
+
+	for (;;) {
+		if (poll(fds, fdCount, -1) < 0) {
+			if (EINTR == errno) {
+				continue;
+			}
+			break;
+		}
+		if (0 != fds[0].revents) {
+			/* unsubscribe */
+			break;
+		}
+		for (i = 1; i < fdCount; i++) {
+			if (0 == fds[i].revents) {
+				continue;
+			}
+			if (fds[i].fd == monitor->stallFd) {
+				if (OMR_ARE_ANY_BITS_SET(fds[i].revents, POLLERR | POLLNVAL)) {
+					/* The cgroup was removed: a negative descriptor is skipped by poll */
+					fds[i].fd = -1;
+				} else if (OMR_ARE_ANY_BITS_SET(fds[i].revents, POLLPRI)) {
+					deliverMemoryStall(monitor);
+				}
+			} else {
+				char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+				BOOLEAN pressureChanged = FALSE;
+				BOOLEAN eventsChanged = FALSE;
+				intptr_t length = read(monitor->inotifyFd, buffer, sizeof(buffer));
+				intptr_t offset = 0;
+
+				while ((offset + (intptr_t)sizeof(struct inotify_event)) <= length) {
+					struct inotify_event *notification = (struct inotify_event *)(buffer + offset);
+					if (notification->wd == monitor->pressureWatch) {
+						pressureChanged = TRUE;
+					} else if (notification->wd == monitor->eventsWatch) {
+						eventsChanged = TRUE;
+					}
+					offset += sizeof(struct inotify_event) + notification->len;
+				}
+				if (pressureChanged) {
+					deliverMemoryStall(monitor);
+				}
+				if (eventsChanged) {
+					deliverMemoryEventChanges(monitor);
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void
+freeMemoryPressureMonitor(struct OMRPortLibrary *portLibrary, OMRMemoryPressureMonitor *monitor)
+{
+	if (-1 != monitor->stallFd) {
+		close(monitor->stallFd);
+	}
+	if (-1 != monitor->inotifyFd) {
+		close(monitor->inotifyFd);
+	}
+	if (-1 != monitor->wakePipe[0]) {
+		close(monitor->wakePipe[0]);
+		close(monitor->wakePipe[1]);
+	}
+	portLibrary->mem_free_memory(portLibrary, monitor->pressurePath);
+	portLibrary->mem_free_memory(portLibrary, monitor->eventsPath);
+	portLibrary->mem_free_memory(portLibrary, monitor);
+}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+
+int32_t
+omrsysinfo_memory_pressure_subscribe(struct OMRPortLibrary *portLibrary, const struct OMRMemoryPressureParams *params, struct OMRMemoryPressureMonitor **monitor)
+{
+#if defined(LINUX) && !defined(OMRZTPF)
+	int32_t rc = 0;
+	BOOLEAN synthetic = FALSE;
+	OMRMemoryPressureMonitor *newMonitor = NULL;
+
+	if ((NULL == params) || (NULL == monitor) || (NULL == params->callback)
+		|| (params->stallType > OMRPORT_MEMORY_PRESSURE_STALL_FULL)
+		|| ((OMRPORT_MEMORY_PRESSURE_STALL_NONE == params->stallType) && !params->watchEvents)
+	) {
+		return OMRPORT_ERROR_SYSINFO_CGROUP_NULL_PARAM;
+	}
+
+	if (NULL == params->cgroupDirectory) {
+		/* Pressure stall information and memory.events only exist in cgroup v2 */
+		if (!portLibrary->sysinfo_cgroup_is_system_available(portLibrary)
+			|| OMR_ARE_NO_BITS_SET(PPG_sysinfoControlFlags, OMRPORT_SYSINFO_CGROUP_V2_AVAILABLE)
+		) {
+			return OMRPORT_ERROR_SYSINFO_CGROUP_VERSION_NOT_AVAILABLE;
+		}
+	} else {
+		struct statfs buf;
+		if (0 != statfs(params->cgroupDirectory, &buf)) {
+			return OMRPORT_ERROR_SYSINFO_SYS_FS_CGROUP_STATFS_FAILED;
+		}
+		synthetic = (CGROUP2_SUPER_MAGIC != buf.f_type);
+	}
+
+	newMonitor = (OMRMemoryPressureMonitor *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRMemoryPressureMonitor), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newMonitor) {
+		return OMRPORT_ERROR_SYSINFO_MEMORY_ALLOC_FAILED;
+	}
+	memset(newMonitor, 0, sizeof(OMRMemoryPressureMonitor));
+	newMonitor->portLibrary = portLibrary;
+	newMonitor->callback = params->callback;
+	newMonitor->userData = params->userData;
+	newMonitor->stallType = params->stallType;
+	newMonitor->stallFd = -1;
+	newMonitor->inotifyFd = -1;
+	newMonitor->pressureWatch = -1;
+	newMonitor->eventsWatch = -1;
+	newMonitor->wakePipe[0] = -1;
+	newMonitor->wakePipe[1] = -1;
+
+	newMonitor->pressurePath = getMemoryPressureFilePath(portLibrary, params->cgroupDirectory, "memory.pressure", &rc);
+	if (0 == rc) {
+		newMonitor->eventsPath = getMemoryPressureFilePath(portLibrary, params->cgroupDirectory, "memory.events", &rc);
+	}
+	if ((0 == rc) && (0 != pipe2(newMonitor->wakePipe, O_CLOEXEC))) {
+		newMonitor->wakePipe[0] = -1;
+		rc = OMRPORT_ERROR_SYSINFO_OPFAILED;
+	}
+	if ((0 == rc) && (synthetic || params->watchEvents)) {
+		newMonitor->inotifyFd = inotify_init1(IN_CLOEXEC);
+		if (-1 == newMonitor->inotifyFd) {
+			rc = OMRPORT_ERROR_SYSINFO_OPFAILED;
+		}
+	}
+
+	if ((0 == rc) && (OMRPORT_MEMORY_PRESSURE_STALL_NONE != params->stallType)) {
+		if (synthetic) {
+			/* Each rewrite of the stand-in file fires the trigger */
+			newMonitor->pressureWatch = inotify_add_watch(newMonitor->inotifyFd, newMonitor->pressurePath, IN_CLOSE_WRITE);
+			if (-1 == newMonitor->pressureWatch) {
+				rc = OMRPORT_ERROR_SYSINFO_CGROUP_SUBSYSTEM_FILE_FOPEN_FAILED;
+			}
+		} else {
+			char trigger[64];
+			uintptr_t triggerLength = portLibrary->str_printf(portLibrary, trigger, sizeof(trigger), "%s %llu %llu",
+					(OMRPORT_MEMORY_PRESSURE_STALL_FULL == params->stallType) ? "full" : "some",
+					(unsigned long long)params->stallThresholdMicros, (unsigned long long)params->stallWindowMicros);
+
+			newMonitor->stallFd = open(newMonitor->pressurePath, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+			if (-1 == newMonitor->stallFd) {
+				rc = OMRPORT_ERROR_SYSINFO_CGROUP_SUBSYSTEM_FILE_FOPEN_FAILED;
+			} else if (write(newMonitor->stallFd, trigger, triggerLength + 1) < 0) {
+				/* The kernel rejects windows outside 500ms to 10s and thresholds larger than the window */
+				rc = (EINVAL == errno) ? OMRPORT_ERROR_SYSINFO_PARAM_HAS_INVALID_RANGE : OMRPORT_ERROR_SYSINFO_OPFAILED;
+			}
+		}
+	}
+
+	if ((0 == rc) && params->watchEvents) {
+		/* Only increases after this point are reported */
+		readMemoryEventCounts(newMonitor->eventsPath, newMonitor->eventCounts);
+		/* The kernel reports updates to cgroup files as modifications; a stand-in file is watched for completed rewrites */
+		newMonitor->eventsWatch = inotify_add_watch(newMonitor->inotifyFd, newMonitor->eventsPath, synthetic ? IN_CLOSE_WRITE : IN_MODIFY);
+		if (-1 == newMonitor->eventsWatch) {
+			rc = OMRPORT_ERROR_SYSINFO_CGROUP_SUBSYSTEM_FILE_FOPEN_FAILED;
+		}
+	}
+
+	if ((0 == rc) && (J9THREAD_SUCCESS != createJoinableThreadWithCategory(&newMonitor->thread, OMR_MEMORY_PRESSURE_THREAD_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0,
+			&memoryPressureThread, newMonitor, J9THREAD_CATEGORY_SYSTEM_THREAD))
+	) {
+		rc = OMRPORT_ERROR_SYSINFO_OPFAILED;
+	}
+
+	if (0 != rc) {
+		freeMemoryPressureMonitor(portLibrary, newMonitor);
+		newMonitor = NULL;
+	}
+	*monitor = newMonitor;
+	return rc;
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+}
+
+void
+omrsysinfo_memory_pressure_unsubscribe(struct OMRPortLibrary *portLibrary, struct OMRMemoryPressureMonitor *monitor)
+{
+#if defined(LINUX) && !defined(OMRZTPF)
+	if (NULL != monitor) {
+		char wake = 0;
+		while ((write(monitor->wakePipe[1], &wake, 1) < 0) && (EINTR == errno)) {
+		}
+		omrthread_join(monitor->thread);
+		freeMemoryPressureMonitor(portLibrary, monitor);
+	}
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+}
+
 #if defined(LINUX)
 /*
  * A helper function to fully read a file.
@@ -34,6 +34,34 @@
 #include <sys/types.h>
 #include <sys/time.h>
 #include "omrport.h"
+#include "omrportpriv.h"
+#include "omrutilbase.h"
+
+#if defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64)
+#include <cpuid.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+#include <x86intrin.h>
+
+#define OMRTIME_TSC_DISABLED 0
+#define OMRTIME_TSC_CALIBRATING 1
+#define OMRTIME_TSC_ENABLED 2
+
+/* length of the initial calibration, during which omrtime_fast_nanos uses CLOCK_MONOTONIC */
+#define OMRTIME_TSC_CALIBRATION_NANOS J9CONST64(10000000)
+/* how often the conversion is re-synced with CLOCK_MONOTONIC */
+#define OMRTIME_TSC_RESYNC_NANOS J9CONST64(1000000000)
+/* largest correction applied per re-sync interval, in parts per million, matching the NTP slew limit */
+#define OMRTIME_TSC_MAX_SLEW_PPM 500
+/* the TSC is abandoned if it disagrees with CLOCK_MONOTONIC by more than this plus the slew limit */
+#define OMRTIME_TSC_MAX_ERROR_NANOS J9CONST64(100000)
+
+#define OMRTIME_COMPILER_BARRIER() __asm__ __volatile__("" ::: "memory")
+/* how long a reader spins on a conversion being published before yielding the CPU */
+#define OMRTIME_TSC_SPINS_BEFORE_YIELD 1000
+#endif /* defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) */
 
 #if defined(OSX) || defined(LINUX)
 /* Frequency is nanoseconds / second */
@@ -129,6 +157,288 @@ omrtime_nano_time(struct OMRPortLibrary *portLibrary)
 	return hiresTime;
 }
 
+#if defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64)
+/**
+ * @internal
+ * Read the TSC and CLOCK_MONOTONIC as close together as possible. The tightest of a few
+ * samples is kept, so that an interrupt during one of them does not skew the pair.
+ *
+ * @return the TSC value at the middle of the clock_gettime call
+ */
+static uint64_t
+readTSCAndMonotonic(int64_t *nanos)
+{
+	uint64_t ticks = 0;
+	uint64_t bestSpan = UINT64_MAX;
+	uintptr_t i = 0;
+
+	for (i = 0; i < 3; i++) {
+		struct timespec ts;
+		uint64_t before = __rdtsc();
+		uint64_t after = 0;
+
+		clock_gettime(OMRTIME_NANO_CLOCK, &ts);
+		after = __rdtsc();
+		if ((after - before) < bestSpan) {
+			bestSpan = after - before;
+			ticks = before + (bestSpan / 2);
+			*nanos = ((int64_t)ts.tv_sec * OMRPORT_TIME_DELTA_IN_NANOSECONDS) + (int64_t)ts.tv_nsec;
+		}
+	}
+	return ticks;
+}
+
+/**
+ * @internal
+ * Nanoseconds on the conversion line through (baseTicks, baseNanos) at ticks, which must not be behind baseTicks.
+ */
+static int64_t
+tscLineNanos(uint64_t baseTicks, int64_t baseNanos, uint64_t multiplier, uint64_t ticks)
+{
+	return baseNanos + (int64_t)(((unsigned __int128)(ticks - baseTicks) * multiplier) >> 32);
+}
+
+/**
+ * @internal
+ * Start replacing the conversion. Readers retry while the sequence number is odd or changes under them,
+ * so a reader that returned a value did so before this point, from ticks read before *ticks.
+ *
+ * @return the lowest value the new conversion may give at *ticks: the current line's value there,
+ * or, while calibrating, CLOCK_MONOTONIC, which readers have been returning meanwhile
+ */
+static int64_t
+beginTSCUpdate(struct OMRPortLibrary *portLibrary, OMRTimeTSCClock *clock, uint64_t *ticks)
+{
+	int64_t floor = clock->lastNanos;
+
+	clock->sequence += 1;
+	issueReadWriteBarrier();
+	_mm_lfence();
+	*ticks = __rdtsc();
+	if (OMRTIME_TSC_ENABLED == clock->state) {
+		if (*ticks >= clock->baseTicks) {
+			floor = OMR_MAX(floor, tscLineNanos(clock->baseTicks, clock->baseNanos, clock->multiplier, *ticks));
+		} else {
+			floor = OMR_MAX(floor, clock->baseNanos);
+		}
+	} else {
+		floor = OMR_MAX(floor, omrtime_nano_time(portLibrary));
+	}
+	return floor;
+}
+
+/**
+ * @internal
+ * Install a conversion between beginTSCUpdate and endTSCUpdate.
+ */
+static void
+setTSCConversion(OMRTimeTSCClock *clock, uint64_t baseTicks, int64_t baseNanos, uint64_t multiplier)
+{
+	clock->baseTicks = baseTicks;
+	clock->baseNanos = baseNanos;
+	clock->multiplier = multiplier;
+	clock->resyncTicks = (uint64_t)(((unsigned __int128)OMRTIME_TSC_RESYNC_NANOS << 32) / multiplier);
+}
+
+/**
+ * @internal
+ * Stop using the TSC, between beginTSCUpdate and endTSCUpdate. CLOCK_MONOTONIC may be behind the
+ * values the TSC gave, so from now on it is not allowed below floor.
+ */
+static void
+disableTSCConversion(OMRTimeTSCClock *clock, int64_t floor)
+{
+	clock->lastNanos = floor;
+	issueWriteBarrier();
+	clock->state = OMRTIME_TSC_DISABLED;
+}
+
+static void
+endTSCUpdate(OMRTimeTSCClock *clock)
+{
+	issueWriteBarrier();
+	clock->sequence += 1;
+}
+
+/**
+ * @internal
+ * Nanoseconds per tick scaled by 2^32, measured from the calibration point to (ticks, nanos).
+ *
+ * @return the multiplier, or 0 if the TSC did not advance
+ */
+static uint64_t
+measureTSCMultiplier(OMRTimeTSCClock *clock, uint64_t ticks, int64_t nanos)
+{
+	uint64_t multiplier = 0;
+
+	if ((ticks > clock->calibrationTicks) && (nanos > clock->calibrationNanos)) {
+		multiplier = (uint64_t)(((unsigned __int128)(uint64_t)(nanos - clock->calibrationNanos) << 32) / (ticks - clock->calibrationTicks));
+	}
+	return multiplier;
+}
+
+/**
+ * @internal
+ * Called by the one thread that won clock->resyncing, while the TSC is being calibrated and once the
+ * conversion is due to be re-synced. Each new conversion starts at the tick it is published at, from no
+ * lower than any value returned before it, so omrtime_fast_nanos never goes backwards.
+ */
+static int64_t
+syncTSCClock(struct OMRPortLibrary *portLibrary, OMRTimeTSCClock *clock)
+{
+	int64_t nanos = 0;
+	uint64_t ticks = readTSCAndMonotonic(&nanos);
+	uint64_t publishTicks = 0;
+	int64_t floor = 0;
+
+	if (OMRTIME_TSC_CALIBRATING == clock->state) {
+		if ((nanos - clock->calibrationNanos) >= OMRTIME_TSC_CALIBRATION_NANOS) {
+			uint64_t multiplier = measureTSCMultiplier(clock, ticks, nanos);
+
+			floor = beginTSCUpdate(portLibrary, clock, &publishTicks);
+			if ((0 == multiplier) || (publishTicks < ticks)) {
+				disableTSCConversion(clock, floor);
+			} else {
+				floor = OMR_MAX(floor, tscLineNanos(ticks, nanos, multiplier, publishTicks));
+				setTSCConversion(clock, publishTicks, floor, multiplier);
+				clock->state = OMRTIME_TSC_ENABLED;
+			}
+			endTSCUpdate(clock);
+			nanos = floor;
+		}
+	} else if (OMRTIME_TSC_ENABLED == clock->state) {
+		/* Continue the current line so the clock does not jump, then slew towards CLOCK_MONOTONIC */
+		uint64_t elapsedTicks = ticks - clock->baseTicks;
+		int64_t estimate = clock->baseNanos + (int64_t)(((unsigned __int128)elapsedTicks * clock->multiplier) >> 32);
+		int64_t error = estimate - nanos;
+		int64_t maxSlew = (OMRTIME_TSC_RESYNC_NANOS / 1000000) * OMRTIME_TSC_MAX_SLEW_PPM;
+		int64_t maxError = OMRTIME_TSC_MAX_ERROR_NANOS + ((nanos - clock->baseNanos) / 1000000) * OMRTIME_TSC_MAX_SLEW_PPM;
+		uint64_t multiplier = measureTSCMultiplier(clock, ticks, nanos);
+
+		floor = beginTSCUpdate(portLibrary, clock, &publishTicks);
+		if ((ticks < clock->baseTicks) || (publishTicks < ticks) || (error > maxError) || (-error > maxError) || (0 == multiplier)) {
+			/* The TSC stopped, jumped or drifted: it cannot be trusted any more */
+			disableTSCConversion(clock, floor);
+			nanos = OMR_MAX(nanos, floor);
+		} else {
+			error = OMR_MAX(-maxSlew, OMR_MIN(maxSlew, error));
+			multiplier -= (uint64_t)(((__int128)multiplier * error) / OMRTIME_TSC_RESYNC_NANOS);
+			setTSCConversion(clock, publishTicks, floor, multiplier);
+			nanos = floor;
+		}
+		endTSCUpdate(clock);
+	}
+	issueWriteBarrier();
+	clock->resyncing = 0;
+
+	return nanos;
+}
+
+/**
+ * @internal
+ * The TSC can stand in for CLOCK_MONOTONIC if it runs at a constant rate in all power states and the
+ * kernel itself trusts it as its clocksource, which it stops doing when it finds the TSC unsynchronized
+ * between CPUs.
+ */
+static BOOLEAN
+isTSCClockUsable(void)
+{
+	unsigned int eax = 0;
+	unsigned int ebx = 0;
+	unsigned int ecx = 0;
+	unsigned int edx = 0;
+	BOOLEAN usable = FALSE;
+
+	if ((__get_cpuid_max(0x80000000, NULL) >= 0x80000007)
+		&& (0 != __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+		&& OMR_ARE_ANY_BITS_SET(edx, 1 << 8)
+	) {
+		int fd = open("/sys/devices/system/clocksource/clocksource0/current_clocksource", O_RDONLY);
+		if (-1 != fd) {
+			char clocksource[16];
+			ssize_t bytesRead = read(fd, clocksource, sizeof(clocksource) - 1);
+			if (bytesRead > 0) {
+				clocksource[bytesRead] = '\0';
+				usable = (0 == strcmp(clocksource, "tsc\n"));
+			}
+			close(fd);
+		}
+	}
+	return usable;
+}
+#endif /* defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) */
+
+int64_t
+omrtime_fast_nanos(struct OMRPortLibrary *portLibrary)
+{
+#if defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64)
+	OMRTimeTSCClock *clock = &PPG_time_tscClock;
+	uintptr_t spins = 0;
+
+	while (OMRTIME_TSC_DISABLED != clock->state) {
+		uintptr_t sequence = clock->sequence;
+		uintptr_t state = 0;
+		uint64_t ticks = 0;
+		uint64_t baseTicks = 0;
+		int64_t baseNanos = 0;
+		uint64_t multiplier = 0;
+		uint64_t resyncTicks = 0;
+
+		OMRTIME_COMPILER_BARRIER();
+		ticks = __rdtsc();
+		state = clock->state;
+		baseTicks = clock->baseTicks;
+		baseNanos = clock->baseNanos;
+		multiplier = clock->multiplier;
+		resyncTicks = clock->resyncTicks;
+		/* x86 does not reorder loads with loads, so only the compiler needs to be held back */
+		OMRTIME_COMPILER_BARRIER();
+		if ((0 != (sequence & 1)) || (sequence != clock->sequence)) {
+			/* the writer only has a handful of stores left to make, unless it has been preempted */
+			spins += 1;
+			if (0 == (spins % OMRTIME_TSC_SPINS_BEFORE_YIELD)) {
+				sched_yield();
+			} else {
+				_mm_pause();
+			}
+			continue;
+		}
+
+		if (OMRTIME_TSC_ENABLED == state) {
+			/* also false if ticks is behind baseTicks */
+			uint64_t elapsedTicks = ticks - baseTicks;
+			if (elapsedTicks < resyncTicks) {
+				return tscLineNanos(baseTicks, baseNanos, multiplier, ticks);
+			}
+			if (0 == compareAndSwapUDATA((uintptr_t *)&clock->resyncing, 0, 1)) {
+				return syncTSCClock(portLibrary, clock);
+			}
+			/* Another thread is re-syncing: stay on the current line, which the next one starts above */
+			return (ticks < baseTicks) ? baseNanos : tscLineNanos(baseTicks, baseNanos, multiplier, ticks);
+		} else if (OMRTIME_TSC_CALIBRATING == state) {
+			int64_t nanos = 0;
+
+			if (0 == compareAndSwapUDATA((uintptr_t *)&clock->resyncing, 0, 1)) {
+				return syncTSCClock(portLibrary, clock);
+			}
+			nanos = omrtime_nano_time(portLibrary);
+			OMRTIME_COMPILER_BARRIER();
+			/* if calibration finished meanwhile, its line may start below nanos */
+			if (sequence == clock->sequence) {
+				return nanos;
+			}
+		}
+	}
+
+	if (0 != clock->lastNanos) {
+		int64_t nanos = omrtime_nano_time(portLibrary);
+		/* the TSC was in use, and may have run ahead of CLOCK_MONOTONIC */
+		return OMR_MAX(nanos, clock->lastNanos);
+	}
+#endif /* defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) */
+	return omrtime_nano_time(portLibrary);
+}
+
 /**
  * Query OS for timestamp.
  * Retrieve the current value of system clock and convert to milliseconds since
@@ -271,6 +581,14 @@ omrtime_startup(struct OMRPortLibrary *portLibrary)
 	if (0 != clock_getres(OMRTIME_NANO_CLOCK, &ts)) {
 		rc = OMRPORT_ERROR_STARTUP_TIME;
 	}
+#if defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64)
+	memset(&PPG_time_tscClock, 0, sizeof(PPG_time_tscClock));
+	if ((0 == rc) && isTSCClockUsable()) {
+		/* Calibration completes in omrtime_fast_nanos, so startup does not have to wait for it */
+		PPG_time_tscClock.calibrationTicks = readTSCAndMonotonic(&PPG_time_tscClock.calibrationNanos);
+		PPG_time_tscClock.state = OMRTIME_TSC_CALIBRATING;
+	}
+#endif /* defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) */
 #endif /* defined(OSX) */
 
 	return rc;
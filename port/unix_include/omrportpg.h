@@ -68,6 +68,22 @@ typedef struct OMRSTFLECache {
 	OMRSTFLEFacilities facilities;
 } OMRSTFLECache;
 
+#if defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64)
+/* Conversion from the TSC to CLOCK_MONOTONIC nanoseconds, see omrtime_fast_nanos */
+typedef struct OMRTimeTSCClock {
+	volatile uintptr_t sequence; /**< odd while the conversion is being updated */
+	volatile uintptr_t state;
+	volatile uintptr_t resyncing; /**< non-zero while one thread recalibrates */
+	uint64_t baseTicks;
+	int64_t baseNanos;
+	uint64_t multiplier; /**< nanoseconds per tick, scaled by 2^32 */
+	uint64_t resyncTicks; /**< ticks after baseTicks at which to re-sync */
+	uint64_t calibrationTicks; /**< TSC at startup, the start of the calibration baseline */
+	int64_t calibrationNanos; /**< CLOCK_MONOTONIC at startup */
+	volatile int64_t lastNanos; /**< once the TSC is disabled, the floor for CLOCK_MONOTONIC values */
+} OMRTimeTSCClock;
+#endif /* defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) */
+
 typedef struct OMRPortPlatformGlobals {
 	uintptr_t numa_platform_supports_numa;
 	uintptr_t numa_platform_interleave_memory;
@@ -91,6 +107,9 @@ typedef struct OMRPortPlatformGlobals {
 	int64_t last_clock_delta_update;  /** hw clock microsecond timestamp of last clock delta adjustment */
 	int64_t software_msec_clock_delta; /** signed difference between hw and sw clocks in milliseconds */
 #endif
+#if defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64)
+	OMRTimeTSCClock time_tscClock;
+#endif /* defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) */
 	BOOLEAN loggingEnabled;
 	uintptr_t systemLoggingFlags;
 	BOOLEAN globalConverterEnabled;
@@ -142,6 +161,9 @@ typedef struct OMRPortPlatformGlobals {
 #define PPG_last_clock_delta_update  (portLibrary->portGlobals->platformGlobals.last_clock_delta_update)
 #define PPG_software_msec_clock_delta (portLibrary->portGlobals->platformGlobals.software_msec_clock_delta)
 #endif
+#if defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64)
+#define PPG_time_tscClock (portLibrary->portGlobals->platformGlobals.time_tscClock)
+#endif /* defined(LINUX) && defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) */
 #if defined(OMR_ENV_DATA64)
 #define PPG_mem_mem32_subAllocHeapMem32 (portLibrary->portGlobals->platformGlobals.subAllocHeapMem32)
 #endif
@@ -2077,3 +2077,14 @@ omrsysinfo_get_processes(struct OMRPortLibrary *portLibrary, OMRProcessInfoCallb
 {
 	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
 }
+
+int32_t
+omrsysinfo_memory_pressure_subscribe(struct OMRPortLibrary *portLibrary, const struct OMRMemoryPressureParams *params, struct OMRMemoryPressureMonitor **monitor)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+void
+omrsysinfo_memory_pressure_unsubscribe(struct OMRPortLibrary *portLibrary, struct OMRMemoryPressureMonitor *monitor)
+{
+}
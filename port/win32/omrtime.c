@@ -262,6 +262,12 @@ omrtime_hires_delta(struct OMRPortLibrary *portLibrary, uint64_t startTime, uint
 	return ticks;
 }
 
+int64_t
+omrtime_fast_nanos(struct OMRPortLibrary *portLibrary)
+{
+	return portLibrary->time_nano_time(portLibrary);
+}
+
 /**
  * PortLibrary shutdown.
  *
@@ -45,6 +45,12 @@ static intptr_t threadDestroy(omrthread_t thread, int globalAlreadyLocked);
 static void threadFree(omrthread_t thread, int globalAlreadyLocked);
 static WRAPPER_TYPE thread_wrapper(WRAPPER_ARG arg);
 static void OMRNORETURN threadInternalExit(int globalAlreadyLocked);
+static uintptr_t threadCacheAttrCompatible(omrthread_library_t lib, omrthread_attr_t attr);
+static omrthread_t threadCacheTake(omrthread_library_t lib, omrthread_t self, omrthread_attr_t attr, int globalIsLocked);
+static void threadCacheStart(omrthread_t thread, omrthread_attr_t attr, uintptr_t suspend, omrthread_entrypoint_t entrypoint, void *entryarg);
+static BOOLEAN threadCachePark(omrthread_t self, int *globalAlreadyLocked);
+static void threadCacheTrim(omrthread_library_t lib);
+static void threadCacheShutdown(omrthread_library_t lib);
 
 static void threadEnqueue(omrthread_t *queue, omrthread_t thread);
 static void threadDequeue(omrthread_t volatile *queue, omrthread_t thread);
@@ -59,18 +65,18 @@ static intptr_t monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrth
 static void monitor_free(omrthread_library_t lib, omrthread_monitor_t monitor);
 static void monitor_free_nolock(omrthread_library_t lib, omrthread_t thread, omrthread_monitor_t monitor);
 #if !defined(OMR_THR_THREE_TIER_LOCKING)
-static intptr_t monitor_enter(omrthread_t self, omrthread_monitor_t monitor);
+static intptr_t monitor_enter(omrthread_t self, omrthread_monitor_t monitor, void *callSite);
 #endif /* !defined(OMR_THR_THREE_TIER_LOCKING) */
 static intptr_t monitor_exit(omrthread_t self, omrthread_monitor_t monitor);
 static intptr_t monitor_wait(omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible);
-static intptr_t monitor_notify_one_or_all(omrthread_monitor_t monitor, int notifyall);
+static intptr_t monitor_notify_one_or_all(omrthread_monitor_t monitor, uintptr_t count);
 #if defined(OMR_THR_THREE_TIER_LOCKING)
-static intptr_t monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable);
+static intptr_t monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, void *callSite);
 static intptr_t monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible);
-static intptr_t monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
+static intptr_t monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, uintptr_t count);
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 static intptr_t monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor, int64_t millis, intptr_t nanos, uintptr_t interruptible);
-static intptr_t monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notifyall);
+static intptr_t monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, uintptr_t count);
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 static intptr_t init_spinCounts(omrthread_library_t lib);
@@ -134,6 +140,10 @@ static void free_mcs_nodes(omrthread_library_t lib, omrthread_mcs_nodes_t mcsNod
 omrthread_t global_lock_owner = UNOWNED;
 #endif /* THREAD_ASSERTS */
 
+#if defined(OMR_THR_FAST_TLS)
+__thread omrthread_t omrthread_current_thread __attribute__((tls_model("initial-exec"))) = NULL;
+#endif /* defined(OMR_THR_FAST_TLS) */
+
 #ifdef OMR_THR_THREE_TIER_LOCKING
 #define ASSERT_MONITOR_UNOWNED_IF_NOT_3TIER(monitor) do {} while (0)
 #else
@@ -254,11 +264,16 @@ omrthread_init(omrthread_library_t lib)
 	lib->stack_usage = 0;
 #endif /* defined(OMR_OS_WINDOWS) */
 	lib->flags = 0;
+	lib->contentionSampleInterval = 0;
+	lib->contentionProfiler = NULL;
+	lib->contentionProfilerUsers = 0;
+	memset(&lib->threadCache, 0, sizeof(lib->threadCache));
 
 	omrthread_mem_init(lib);
 
 	/* set all TLS finalizers to NULL. This indicates that the key is unused */
 	memset(lib->tls_finalizers, 0, sizeof(lib->tls_finalizers));
+	memset((void *)lib->tls_finalizer_chunks, 0, sizeof(lib->tls_finalizer_chunks));
 
 #if !(CALLER_LAST_INDEX <= MAX_CALLER_INDEX)
 #error "CALLER_LAST_INDEX must be <= MAX_CALLER_INDEX"
@@ -697,8 +712,11 @@ omrthread_shutdown(void)
 	 * have completed. omrthread_exit holds the global lock until the thread is ready
 	 * to exit to the OS.
 	 */
+	threadCacheShutdown(lib);
 	GLOBAL_LOCK_SIMPLE(lib);
 	GLOBAL_UNLOCK_SIMPLE(lib);
+	omrthread_contention_profiler_shutdown(lib);
+	omrthread_tls_shutdown(lib);
 #if defined(OMR_PORT_NUMA_SUPPORT)
 	omrthread_numa_shutdown(lib);
 #endif /* OMR_PORT_NUMA_SUPPORT */
@@ -867,6 +885,11 @@ postForkResetThreads(omrthread_t self)
 	preserveMCSNodesInForkSurvivor(self);
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
+	/* Parked threads did not survive the fork; they are freed below with the other threads. */
+	lib->threadCache.parked = NULL;
+	lib->threadCache.parkedCount = 0;
+	lib->threadCache.exiting = 0;
+
 	threadIterator = (omrthread_t)pool_startDo(lib->thread_pool, &threadPoolState);
 	while (NULL != threadIterator) {
 		if (threadIterator == self) {
@@ -1001,6 +1024,7 @@ postForkResetMonitors(omrthread_t self)
 #endif /* defined(THREAD_ASSERTS) */
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 				entry->blocking = NULL;
+				entry->notifiedBlockingCount = 0;
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 				entry->waiting = NULL;
 				entry->notifyAllWaiting = NULL;
@@ -1079,6 +1103,49 @@ postForkResetRWMutexes(omrthread_t self)
 
 #endif /* defined(OMR_THR_FORK_SUPPORT) */
 
+/**
+ * Configure the cache of exited threads reused by omrthread_create_ex.
+ *
+ * Shrinking the cache releases the excess parked threads.
+ *
+ * @param[in] maxThreads maximum number of parked threads, or 0 to disable the cache
+ * @param[in] idleMillis how long a thread stays parked before exiting, or 0 to wait indefinitely
+ * @return none
+ */
+void
+omrthread_lib_set_thread_cache(uintptr_t maxThreads, uintptr_t idleMillis)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+
+	GLOBAL_LOCK_SIMPLE(lib);
+	lib->threadCache.maxThreads = maxThreads;
+	lib->threadCache.idleMillis = idleMillis;
+	threadCacheTrim(lib);
+	GLOBAL_UNLOCK_SIMPLE(lib);
+}
+
+/**
+ * Get the thread cache's configuration and counters.
+ *
+ * @param[out] stats the counters
+ * @return none
+ */
+void
+omrthread_lib_get_thread_cache_stats(omrthread_thread_cache_stats_t *stats)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+
+	GLOBAL_LOCK_SIMPLE(lib);
+	stats->maxThreads = lib->threadCache.maxThreads;
+	stats->idleMillis = lib->threadCache.idleMillis;
+	stats->parkedThreads = lib->threadCache.parkedCount;
+	stats->hits = lib->threadCache.hits;
+	stats->misses = lib->threadCache.misses;
+	stats->parks = lib->threadCache.parks;
+	stats->expired = lib->threadCache.expired;
+	GLOBAL_UNLOCK_SIMPLE(lib);
+}
+
 /**
  * Get threading library global flags.
  *
@@ -1351,7 +1418,7 @@ omrthread_attach_ex(omrthread_t *handle, omrthread_attr_t *attr)
 
 	initialize_thread_priority(thread);
 
-	TLS_SET(lib->self_ptr, thread);
+	SET_SELF(lib, thread);
 
 	thread->tid = omrthread_get_ras_tid();
 	thread->waitNumber = 0;
@@ -1532,7 +1599,7 @@ omrthread_detach(omrthread_t thread)
 		if (0 == (thread->flags & J9THREAD_FLAG_JOINABLE)) {
 			threadDestroy(thread, GLOBAL_NOT_LOCKED);
 		}
-		TLS_SET(library->self_ptr, NULL);
+		SET_SELF(library, NULL);
 	}
 }
 
@@ -1646,7 +1713,7 @@ thread_wrapper(WRAPPER_ARG arg)
 
 	thread->tid = omrthread_get_ras_tid();
 
-	TLS_SET(lib->self_ptr, thread);
+	SET_SELF(lib, thread);
 
 #if defined(OMR_OS_WINDOWS)
 	if (lib->stack_usage) {
@@ -1661,6 +1728,8 @@ thread_wrapper(WRAPPER_ARG arg)
 
 	increment_memory_counter(&lib->nativeStackCategory, thread->stacksize);
 
+	/* A thread parked in the thread cache comes back here to run its next entrypoint. */
+threadStart:
 	/* Handle the create-suspended case.
 	 * (This code is basically the same as omrthread_suspend, but we need to
 	 * test the condition under mutex or else there's a timing hole)
@@ -1734,6 +1803,10 @@ thread_wrapper(WRAPPER_ARG arg)
 	/* omrthread_exit not called */
 #endif /* defined(LINUX) && !defined(OMRZTPF) */
 
+	if (threadCachePark(thread, &globalAlreadyLocked)) {
+		goto threadStart;
+	}
+
 	threadInternalExit(globalAlreadyLocked);
 	/* UNREACHABLE */
 	WRAPPER_RETURN();
@@ -1907,6 +1980,17 @@ threadCreate(omrthread_t *handle, const omrthread_attr_t *attr, uintptr_t suspen
 	}
 	ASSERT(tempAttr);
 
+	if (0 != lib->threadCache.maxThreads) {
+		thread = threadCacheTake(lib, self, tempAttr, globalIsLocked);
+		if (NULL != thread) {
+			if (handle) {
+				*handle = thread;
+			}
+			threadCacheStart(thread, tempAttr, suspend, entrypoint, entryarg);
+			goto threadCreateSucceeded;
+		}
+	}
+
 	thread = threadAllocate(lib, globalIsLocked);
 	if (!thread) {
 		retVal = J9THREAD_ERR_CANT_ALLOCATE_J9THREAD_T;
@@ -1951,6 +2035,10 @@ threadCreate(omrthread_t *handle, const omrthread_attr_t *attr, uintptr_t suspen
 	}
 	thread->entrypoint = entrypoint;
 	thread->entryarg = entryarg;
+	thread->cacheable = threadCacheAttrCompatible(lib, tempAttr);
+	thread->cacheTaken = 0;
+	thread->cacheNext = NULL;
+	thread->cacheName[0] = '\0';
 	thread->lockedmonitorcount = 0;
 	thread->waitNumber = 0;
 	thread->lastCategorySwitchTime = 0;
@@ -1979,6 +2067,7 @@ threadCreate(omrthread_t *handle, const omrthread_attr_t *attr, uintptr_t suspen
 		goto cleanup4;
 	}
 
+threadCreateSucceeded:
 	/* clean up the temp attr */
 	if (tempAttrAllocated) {
 		omrthread_attr_destroy(&tempAttr);
@@ -2213,6 +2302,7 @@ threadFree(omrthread_t thread, int globalAlreadyLocked)
 	jlm_thread_free(lib, thread);
 #endif
 
+	omrthread_tls_free_chunks(thread);
 	pool_removeElement(lib->thread_pool, thread);
 	lib->threadCount--;
 
@@ -2298,11 +2388,14 @@ threadInternalExit(int globalAlreadyLocked)
 		GLOBAL_UNLOCK_SIMPLE(lib);
 		if (detached) {
 			TLS_SET(tlsKey, NULL);
+#if defined(OMR_THR_FAST_TLS)
+			omrthread_current_thread = NULL;
+#endif /* defined(OMR_THR_FAST_TLS) */
 		}
 	}
 #else /* THREAD_ASSERTS */
 	if (detached) {
-		TLS_SET(lib->self_ptr, NULL);
+		SET_SELF(lib, NULL);
 	}
 	GLOBAL_UNLOCK_SIMPLE(lib);
 #endif /* THREAD_ASSERTS */
@@ -2317,6 +2410,298 @@ dontreturn:
 
 
 
+/**
+ * Check whether a thread created with attr may be parked in, or taken from, the thread cache.
+ *
+ * Joinable threads must really exit for omrthread_join, and threads with an explicit
+ * real-time policy keep OS scheduling state that a later request may not want.
+ *
+ * @param[in] lib the thread library
+ * @param[in] attr creation attributes
+ * @return non-zero if the thread is compatible with the cache
+ */
+static uintptr_t
+threadCacheAttrCompatible(omrthread_library_t lib, omrthread_attr_t attr)
+{
+	return (J9THREAD_CREATE_JOINABLE != attr->detachstate)
+		&& ((J9THREAD_SCHEDPOLICY_OTHER == attr->schedpolicy) || (J9THREAD_SCHEDPOLICY_INHERIT == attr->schedpolicy))
+		&& OMR_ARE_NO_BITS_SET(lib->flags, J9THREAD_LIB_FLAG_REALTIME_SCHEDULING_ENABLED);
+}
+
+/**
+ * Take a parked thread whose stack size, priority and category match attr.
+ *
+ * The thread is marked as taken while the global mutex is still held, so that an
+ * idle timeout firing before threadCacheStart hands it an entrypoint waits for
+ * that entrypoint instead of looking for itself on the parked list.
+ *
+ * @param[in] lib the thread library
+ * @param[in] self the creating thread
+ * @param[in] attr creation attributes
+ * @param[in] globalIsLocked indicates whether the threading library global mutex is already locked
+ * @return a parked thread, or NULL if none is compatible
+ *
+ * @see threadCacheStart, threadCachePark
+ */
+static omrthread_t
+threadCacheTake(omrthread_library_t lib, omrthread_t self, omrthread_attr_t attr, int globalIsLocked)
+{
+	omrthread_t thread = NULL;
+	omrthread_t *link = NULL;
+	omrthread_prio_t priority = attr->priority;
+
+	if (!threadCacheAttrCompatible(lib, attr)) {
+		return NULL;
+	}
+	if ((NULL != self) && (J9THREAD_SCHEDPOLICY_INHERIT == attr->schedpolicy)) {
+		priority = self->priority;
+	}
+
+	if (!globalIsLocked) {
+		GLOBAL_LOCK_SIMPLE(lib);
+	}
+	for (link = &lib->threadCache.parked; NULL != *link; link = &(*link)->cacheNext) {
+		omrthread_t candidate = *link;
+		if ((candidate->stacksize == attr->stacksize)
+			&& (candidate->priority == priority)
+			&& (candidate->category == attr->category)
+			&& (candidate->effective_category == candidate->category)
+		) {
+			*link = candidate->cacheNext;
+			candidate->cacheNext = NULL;
+			candidate->cacheTaken = 1;
+			lib->threadCache.parkedCount -= 1;
+			thread = candidate;
+			break;
+		}
+	}
+	if (NULL == thread) {
+		lib->threadCache.misses += 1;
+	} else {
+		lib->threadCache.hits += 1;
+	}
+	if (!globalIsLocked) {
+		GLOBAL_UNLOCK_SIMPLE(lib);
+	}
+
+	return thread;
+}
+
+/**
+ * Hand a new entrypoint to a thread taken from the thread cache and wake it.
+ * The thread renames itself to the name in attr before running entrypoint, or
+ * without one to the calling thread's name, which is the name a new thread inherits.
+ *
+ * @param[in] thread a thread returned by threadCacheTake
+ * @param[in] attr creation attributes
+ * @param[in] suspend Non-zero if the thread should suspend before entering entrypoint
+ * @param[in] entrypoint
+ * @param[in] entryarg
+ * @return none
+ */
+static void
+threadCacheStart(omrthread_t thread, omrthread_attr_t attr, uintptr_t suspend, omrthread_entrypoint_t entrypoint, void *entryarg)
+{
+	THREAD_LOCK(thread, CALLER_THREAD_CACHE_REUSE);
+	/* attr and its name may be gone by the time the thread wakes, so keep a copy */
+	if (NULL != attr->name) {
+		strncpy(thread->cacheName, attr->name, sizeof(thread->cacheName) - 1);
+		thread->cacheName[sizeof(thread->cacheName) - 1] = '\0';
+	} else if (0 != THREAD_GET_NAME(thread->cacheName, sizeof(thread->cacheName))) {
+		/* the name can't be read here, so it can't be restored either */
+		thread->cacheName[0] = '\0';
+	}
+	thread->flags = (thread->flags & J9THREAD_FLAG_CPU_SAMPLING_ENABLED) | (suspend ? J9THREAD_FLAG_SUSPENDED : 0);
+	thread->os_errno = J9THREAD_INVALID_OS_ERRNO;
+#if defined(OMR_PORT_NUMA_SUPPORT)
+	memset(&(thread->numaAffinity), 0x0, sizeof(thread->numaAffinity));
+#endif /* OMR_PORT_NUMA_SUPPORT */
+	thread->entryarg = entryarg;
+	/* a non-NULL entrypoint is what releases the parked thread */
+	thread->entrypoint = entrypoint;
+	NOTIFY_WRAPPER(thread);
+	THREAD_UNLOCK(thread);
+}
+
+/**
+ * Park the current thread in the thread cache after its entrypoint has finished,
+ * and wait for it to be reused.
+ *
+ * Threads that left through omrthread_exit are not parked. If the thread can't be
+ * parked, or it is not reused before the idle timeout expires, the state of the
+ * global mutex on return is given by globalAlreadyLocked, ready for threadInternalExit.
+ *
+ * @param[in] self the current thread
+ * @param[in,out] globalAlreadyLocked indicates whether the thread library global mutex is already locked.
+ *            Updated to reflect the state of the global mutex on return.
+ * @return TRUE if the thread has been given a new entrypoint to run, FALSE if it must exit
+ */
+static BOOLEAN
+threadCachePark(omrthread_t self, int *globalAlreadyLocked)
+{
+	omrthread_library_t lib = self->library;
+	omrthread_t *link = NULL;
+	uintptr_t idleMillis = 0;
+	BOOLEAN reused = FALSE;
+
+	/* checked without the lock first: nothing to do in the common case where the cache is disabled */
+	if ((0 == self->cacheable) || (0 == lib->threadCache.maxThreads) || *globalAlreadyLocked) {
+		return FALSE;
+	}
+
+	omrthread_tls_finalize(self);
+	GLOBAL_LOCK(self, CALLER_THREAD_CACHE_PARK);
+	*globalAlreadyLocked = GLOBAL_IS_LOCKED;
+
+	if ((lib->threadCache.parkedCount >= lib->threadCache.maxThreads)
+		|| (0 != self->attachcount)
+		|| (0 != self->lockedmonitorcount)
+		|| OMR_ARE_ANY_BITS_SET(self->flags, J9THREAD_FLAG_CANCELED | J9THREAD_FLAG_JOINABLE)
+	) {
+		return FALSE;
+	}
+
+	THREAD_LOCK(self, CALLER_THREAD_CACHE_PARK);
+	/*
+	 * Is there an interruptServer thread out there trying to interrupt us?
+	 * Its services are no longer required.
+	 */
+	if (self->interrupter) {
+		THREAD_LOCK(self->interrupter, CALLER_THREAD_CACHE_PARK);
+		self->interrupter->flags |= J9THREAD_FLAG_CANCELED;
+		THREAD_UNLOCK(self->interrupter);
+		self->interrupter = NULL;
+	}
+	self->flags &= J9THREAD_FLAG_CPU_SAMPLING_ENABLED;
+	self->entrypoint = NULL;
+	self->entryarg = NULL;
+	self->waitNumber = 0;
+	memset(self->tls, 0, sizeof(self->tls));
+	THREAD_UNLOCK(self);
+	omrthread_tls_free_chunks(self);
+
+	self->cacheTaken = 0;
+	self->cacheNext = lib->threadCache.parked;
+	lib->threadCache.parked = self;
+	lib->threadCache.parkedCount += 1;
+	lib->threadCache.parks += 1;
+	idleMillis = lib->threadCache.idleMillis;
+	GLOBAL_UNLOCK_SIMPLE(lib);
+
+	THREAD_LOCK(self, CALLER_THREAD_CACHE_PARK);
+	if ((NULL == self->entrypoint) && OMR_ARE_NO_BITS_SET(self->flags, J9THREAD_FLAG_CANCELED)) {
+		if (0 == idleMillis) {
+			OMROSCOND_WAIT(self->condition, self->mutex);
+				if ((NULL != self->entrypoint) || OMR_ARE_ANY_BITS_SET(self->flags, J9THREAD_FLAG_CANCELED)) {
+					break;
+				}
+			OMROSCOND_WAIT_LOOP();
+		} else {
+			intptr_t boundedMillis = BOUNDED_I64_TO_IDATA(idleMillis);
+
+			OMROSCOND_WAIT_IF_TIMEDOUT(self->condition, self->mutex, boundedMillis, 0) {
+				break;
+			} else {
+				if ((NULL != self->entrypoint) || OMR_ARE_ANY_BITS_SET(self->flags, J9THREAD_FLAG_CANCELED)) {
+					break;
+				}
+			}
+			OMROSCOND_WAIT_TIMED_LOOP();
+		}
+	}
+	reused = (NULL != self->entrypoint);
+	THREAD_UNLOCK(self);
+
+	if (!reused) {
+		GLOBAL_LOCK(self, CALLER_THREAD_CACHE_PARK);
+		THREAD_LOCK(self, CALLER_THREAD_CACHE_PARK);
+		/* a creator may have taken this thread while it was timing out, and not yet set its entrypoint */
+		reused = (0 != self->cacheTaken);
+		if (!reused) {
+			if (OMR_ARE_ANY_BITS_SET(self->flags, J9THREAD_FLAG_CANCELED)) {
+				/* threadCacheTrim already unlinked this thread */
+				lib->threadCache.exiting -= 1;
+			} else {
+				for (link = &lib->threadCache.parked; self != *link; link = &(*link)->cacheNext) {
+					ASSERT(NULL != *link);
+				}
+				*link = self->cacheNext;
+				lib->threadCache.parkedCount -= 1;
+				lib->threadCache.expired += 1;
+			}
+			self->cacheNext = NULL;
+		}
+		THREAD_UNLOCK(self);
+		if (reused) {
+			GLOBAL_UNLOCK_SIMPLE(lib);
+			THREAD_LOCK(self, CALLER_THREAD_CACHE_PARK);
+			if (NULL == self->entrypoint) {
+				OMROSCOND_WAIT(self->condition, self->mutex);
+					if (NULL != self->entrypoint) {
+						break;
+					}
+				OMROSCOND_WAIT_LOOP();
+			}
+			THREAD_UNLOCK(self);
+		}
+	}
+
+	if (reused && ('\0' != self->cacheName[0])) {
+		THREAD_SET_NAME(self->handle, self->handle, self->cacheName);
+	}
+
+	*globalAlreadyLocked = reused ? GLOBAL_NOT_LOCKED : GLOBAL_IS_LOCKED;
+	return reused;
+}
+
+/**
+ * Release parked threads until no more than the cache maximum remain.
+ * Assumes the caller holds the global mutex.
+ *
+ * @param[in] lib the thread library
+ * @return none
+ */
+static void
+threadCacheTrim(omrthread_library_t lib)
+{
+	while (lib->threadCache.parkedCount > lib->threadCache.maxThreads) {
+		omrthread_t thread = lib->threadCache.parked;
+
+		lib->threadCache.parked = thread->cacheNext;
+		thread->cacheNext = NULL;
+		lib->threadCache.parkedCount -= 1;
+		lib->threadCache.exiting += 1;
+
+		THREAD_LOCK(thread, CALLER_THREAD_CACHE_PARK);
+		thread->flags |= J9THREAD_FLAG_CANCELED;
+		NOTIFY_WRAPPER(thread);
+		THREAD_UNLOCK(thread);
+	}
+}
+
+/**
+ * Disable the thread cache and wait until every parked thread has started exiting.
+ *
+ * @param[in] lib the thread library
+ * @return none
+ */
+static void
+threadCacheShutdown(omrthread_library_t lib)
+{
+	GLOBAL_LOCK_SIMPLE(lib);
+	lib->threadCache.maxThreads = 0;
+	threadCacheTrim(lib);
+	/* an exiting thread holds the global mutex from here until it exits to the OS */
+	while (0 != lib->threadCache.exiting) {
+		GLOBAL_UNLOCK_SIMPLE(lib);
+		omrthread_yield();
+		GLOBAL_LOCK_SIMPLE(lib);
+	}
+	GLOBAL_UNLOCK_SIMPLE(lib);
+}
+
+
+
 /**
  * Return the omrthread_t for the current thread.
  *
@@ -3730,6 +4115,7 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 	monitor->blocking = NULL;
+	monitor->notifiedBlockingCount = 0;
 	monitor->spinlockState = J9THREAD_MONITOR_SPINLOCK_UNOWNED;
 
 	/* check if we should spin on system monitors that are backing a Object monitor
@@ -3834,9 +4220,9 @@ omrthread_monitor_enter(omrthread_monitor_t monitor)
 	}
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
-	return monitor_enter_three_tier(self, monitor, DONT_SET_ABORTABLE);
+	return monitor_enter_three_tier(self, monitor, DONT_SET_ABORTABLE, OMRTHREAD_CALL_SITE());
 #else /* defined(OMR_THR_THREE_TIER_LOCKING) */
-	return monitor_enter(self, monitor);
+	return monitor_enter(self, monitor, OMRTHREAD_CALL_SITE());
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 }
 
@@ -3872,9 +4258,9 @@ omrthread_monitor_enter_using_threadId(omrthread_monitor_t monitor, omrthread_t
 	}
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
-	return monitor_enter_three_tier(threadId, monitor, DONT_SET_ABORTABLE);
+	return monitor_enter_three_tier(threadId, monitor, DONT_SET_ABORTABLE, OMRTHREAD_CALL_SITE());
 #else /* defined(OMR_THR_THREE_TIER_LOCKING) */
-	return monitor_enter(threadId, monitor);
+	return monitor_enter(threadId, monitor, OMRTHREAD_CALL_SITE());
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 }
 
@@ -3907,9 +4293,9 @@ omrthread_monitor_enter_abortable_using_threadId(omrthread_monitor_t monitor, om
 	}
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
-	return monitor_enter_three_tier(threadId, monitor, SET_ABORTABLE);
+	return monitor_enter_three_tier(threadId, monitor, SET_ABORTABLE, OMRTHREAD_CALL_SITE());
 #else /* defined(OMR_THR_THREE_TIER_LOCKING) */
-	return monitor_enter(threadId, monitor);
+	return monitor_enter(threadId, monitor, OMRTHREAD_CALL_SITE());
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 }
 
@@ -3924,12 +4310,16 @@ omrthread_monitor_enter_abortable_using_threadId(omrthread_monitor_t monitor, om
  *
  * @param[in] self current thread
  * @param[in] monitor monitor to enter
+ * @param[in] callSite caller of the public enter function, for the contention profiler; may be NULL
  * @return 0 on success
  * @todo Get JLM code out of here
  */
 static intptr_t
-monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
+monitor_enter(omrthread_t self, omrthread_monitor_t monitor, void *callSite)
 {
+	OMRThreadContentionSample sample;
+	BOOLEAN sampled = FALSE;
+
 	ASSERT(self);
 	ASSERT(0 == self->monitor);
 	ASSERT(monitor);
@@ -3943,7 +4333,12 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
 	self->monitor = monitor;
 	THREAD_UNLOCK(self);
 
-	MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER);
+	if (0 == self->library->contentionSampleInterval) {
+		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER);
+	} else if (0 != MONITOR_TRY_LOCK(monitor)) {
+		sampled = omrthread_contention_sample_begin(self, callSite, &sample);
+		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER);
+	}
 
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, IS_SLOW_ENTER);
 
@@ -3957,6 +4352,10 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
 	monitor->owner = self;
 	monitor->count = 1;
 
+	if (sampled) {
+		omrthread_contention_sample_end(self, monitor, &sample);
+	}
+
 	ASSERT(0 == self->monitor);
 
 	return 0;
@@ -3973,13 +4372,17 @@ monitor_enter(omrthread_t self, omrthread_monitor_t monitor)
  *
  * @param[in] self current thread
  * @param[in] monitor monitor to enter
+ * @param[in] isAbortable whether the enter may be aborted
+ * @param[in] callSite caller of the public enter function, for the contention profiler; may be NULL
  * @return 0 on success, J9THREAD_INTERRUPTED_MONITOR_ENTER otherwise
  * @todo Get JLM code out of here
  */
 static intptr_t
-monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
+monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable, void *callSite)
 {
 	int blockedCount = 0;
+	OMRThreadContentionSample sample;
+	BOOLEAN sampled = FALSE;
 #if defined(OMR_THR_MCS_LOCKS)
 	omrthread_mcs_node_t mcsNode = omrthread_mcs_node_allocate(self);
 #endif /* defined(OMR_THR_MCS_LOCKS) */
@@ -4004,6 +4407,11 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 			break;
 		}
 
+		/* spinning failed: the time until the monitor is owned counts as contention */
+		if ((0 == blockedCount) && (0 != self->library->contentionSampleInterval)) {
+			sampled = omrthread_contention_sample_begin(self, callSite, &sample);
+		}
+
 		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
 
 #if !defined(OMR_THR_MCS_LOCKS)
@@ -4108,6 +4516,10 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 
 	UPDATE_JLM_MON_ENTER(self, monitor, !IS_RECURSIVE_ENTER, (blockedCount > 0));
 
+	if (sampled) {
+		omrthread_contention_sample_end(self, monitor, &sample);
+	}
+
 	ASSERT(!(self->flags & J9THREAD_FLAG_BLOCKED));
 	ASSERT(0 == self->monitor);
 
@@ -4121,6 +4533,11 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
  * Notify all threads blocked on the monitor's mutex, waiting
  * to be told that it's ok to try again to get the spinlock.
  *
+ * Waiters that monitor_notify_three_tier() moved onto the blocking queue
+ * (wait morphing) are woken one at a time: only the first of them is
+ * notified here, and it hands off to the next one when it releases the
+ * monitor (see monitor_wait_three_tier()).
+ *
  * Assumes that the caller already owns the monitor's mutex.
  *
  */
@@ -4128,6 +4545,7 @@ static void
 unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 {
 	omrthread_t queue, next;
+	BOOLEAN notifiedWoken = FALSE;
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	uintptr_t i = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
@@ -4140,15 +4558,25 @@ unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 
 	next = monitor->blocking;
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
-	for (; (NULL != next) && (i > 0); i--)
+	while ((NULL != next) && (i > 0))
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	while (NULL != next)
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	{
 		queue = next;
 		next = queue->next;
+		/* only morphed waiters are on the blocking queue with J9THREAD_FLAG_NOTIFIED set */
+		if (J9THREAD_FLAG_NOTIFIED == (queue->flags & J9THREAD_FLAG_NOTIFIED)) {
+			if (notifiedWoken) {
+				continue;
+			}
+			notifiedWoken = TRUE;
+		}
 		NOTIFY_WRAPPER(queue);
 		Trc_THR_ThreadSpinLockThreadUnblocked(self, queue, monitor);
+#if defined(OMR_THR_SPIN_WAKE_CONTROL)
+		i -= 1;
+#endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	}
 }
 
@@ -4762,7 +5190,8 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 #ifdef OMR_THR_THREE_TIER_LOCKING
 	if (monitor_enter_three_tier(
 			self, monitor,
-			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE))
+			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE),
+			NULL)
 		== J9THREAD_INTERRUPTED_MONITOR_ENTER
 	) {
 		/* we don't own the monitor */
@@ -4814,6 +5243,8 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 	uintptr_t timedOut = 0;
 #if defined(OMR_THR_MCS_LOCKS)
 	omrthread_t nextThread = NULL;
+#else /* defined(OMR_THR_MCS_LOCKS) */
+	BOOLEAN handOff = FALSE;
 #endif /* defined(OMR_THR_MCS_LOCKS) */
 
 	ASSERT(monitor);
@@ -4962,6 +5393,12 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 	/* we have to remove self from the wait queue */
 	if (notified) {
 		queue = &monitor->blocking;
+		ASSERT(monitor->notifiedBlockingCount > 0);
+		monitor->notifiedBlockingCount -= 1;
+#if !defined(OMR_THR_MCS_LOCKS)
+		/* other notified waiters are still parked on the blocking queue until we release the monitor */
+		handOff = (0 != monitor->notifiedBlockingCount);
+#endif /* !defined(OMR_THR_MCS_LOCKS) */
 	} else {
 		queue = &monitor->waiting;
 	}
@@ -5010,13 +5447,28 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 
 	if (monitor_enter_three_tier(
 			self, monitor,
-			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE))
+			(BOOLEAN)((interruptible & J9THREAD_FLAG_ABORTABLE)? SET_ABORTABLE: DONT_SET_ABORTABLE),
+			NULL)
 		== J9THREAD_INTERRUPTED_MONITOR_ENTER
 	) {
+#if !defined(OMR_THR_MCS_LOCKS)
+		if (handOff) {
+			/* we won't release the monitor, so wake the next notified waiter now */
+			MONITOR_LOCK(monitor, CALLER_MONITOR_WAIT);
+			unblock_spinlock_threads(self, monitor);
+			MONITOR_UNLOCK(monitor);
+		}
+#endif /* !defined(OMR_THR_MCS_LOCKS) */
 		/* we don't own the monitor */
 		return J9THREAD_INTERRUPTED_MONITOR_ENTER;
 	}
 	monitor->count = count;
+#if !defined(OMR_THR_MCS_LOCKS)
+	if (handOff) {
+		/* make sure releasing the monitor unblocks the next notified waiter */
+		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED);
+	}
+#endif /* !defined(OMR_THR_MCS_LOCKS) */
 
 	ASSERT(monitor->owner == self);
 	ASSERT(monitor->count == count);
@@ -5125,36 +5577,60 @@ omrthread_monitor_notify_all(omrthread_monitor_t monitor)
 	return monitor_notify_one_or_all(monitor, NOTIFY_ALL);
 }
 
+/**
+ * Notify at most count threads waiting on a monitor.
+ *
+ * A thread is considered to be waiting on the monitor if
+ * it is currently blocked while executing omrthread_monitor_wait on the monitor.
+ *
+ * This lets a producer wake exactly as many threads as it has published
+ * work items for, rather than choosing between omrthread_monitor_notify
+ * and omrthread_monitor_notify_all. Threads are notified in the order
+ * they started waiting. If fewer than count threads are waiting, all of
+ * them are notified; if count is 0, no action is taken.
+ *
+ * @param[in] monitor a monitor to be signaled
+ * @param[in] count the maximum number of threads to notify
+ * @return  0 once the monitor has been signaled<br>J9THREAD_ILLEGAL_MONITOR_STATE if the current thread does not own the monitor
+ *
+ * @see omrthread_monitor_notify, omrthread_monitor_notify_all, omrthread_monitor_wait
+ */
+intptr_t
+omrthread_monitor_notify_n(omrthread_monitor_t monitor, uintptr_t count)
+{
+	return monitor_notify_one_or_all(monitor, count);
+}
+
 
 
 /**
- * Signal one or all threads waiting on the monitor.
+ * Signal up to count threads waiting on the monitor.
  *
  * If no threads are waiting, this does nothing.
  *
  * @param[in] monitor monitor to be notified on
- * @param[in] notifyall 0 to notify one, non-zero to notify all
+ * @param[in] count maximum number of threads to notify, NOTIFY_ONE or NOTIFY_ALL
  * @return 0 once the monitor has been signalled<br>
  * J9THREAD_ILLEGAL_MONITOR_STATE if the current thread does not
  * own the monitor
  *
  */
 static intptr_t
-monitor_notify_one_or_all(omrthread_monitor_t monitor, int notifyall)
+monitor_notify_one_or_all(omrthread_monitor_t monitor, uintptr_t count)
 {
 	intptr_t rc = J9THREAD_ILLEGAL_MONITOR_STATE;
 	omrthread_t self = MACRO_SELF();
 
-	Trc_THR_ThreadMonitorNotifyEnter(self, monitor, notifyall);
+	Trc_THR_ThreadMonitorNotifyEnter(self, monitor, (int)(NOTIFY_ALL == count));
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 	if (self->library->flags & J9THREAD_LIB_FLAG_FAST_NOTIFY) {
-		rc = monitor_notify_three_tier(self, monitor, notifyall);
+		rc = monitor_notify_three_tier(self, monitor, count);
 	} else {
-		rc = monitor_notify_original(self, monitor, notifyall);
+		rc = monitor_notify_original(self, monitor, count);
 	}
 #else
-	rc = monitor_notify_original(self, monitor, notifyall);
+	rc = monitor_notify_original(self, monitor, count);
 #endif
 
 	Trc_THR_ThreadMonitorNotifyExit(self, monitor, rc);
@@ -5168,10 +5644,10 @@ monitor_notify_one_or_all(omrthread_monitor_t monitor, int notifyall)
  * TODO: Split the 3-tier and non-3-tier implementations.
  */
 static intptr_t
-monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notifyall)
+monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, uintptr_t count)
 {
 	omrthread_t queue, next;
-	int someoneNotified = 0;
+	uintptr_t notifiedCount = 0;
 
 	ASSERT(self);
 	ASSERT(monitor);
@@ -5187,25 +5663,21 @@ monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notif
 
 	next = monitor->waiting;
 	if (next) {
-		if (notifyall) {
+		if (NOTIFY_ALL == count) {
 			monitor_notify_all_migration(monitor);
 		}
 	}
 
-	while (next) {
+	while ((next) && (notifiedCount < count)) {
 		queue = next;
 		next = queue->next;
 		THREAD_LOCK(queue, CALLER_NOTIFY_ONE_OR_ALL);
 		if (queue->flags & J9THREAD_FLAG_WAITING) {
 			threadNotify(queue);
 			Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
-			someoneNotified = 1;
+			notifiedCount += 1;
 		}
 		THREAD_UNLOCK(queue);
-
-		if ((someoneNotified) && (!notifyall)) {
-			break;
-		}
 	}
 
 #ifdef OMR_THR_THREE_TIER_LOCKING
@@ -5216,8 +5688,14 @@ monitor_notify_original(omrthread_t self, omrthread_monitor_t monitor, int notif
 }
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
+/*
+ * Notified threads are not woken here. They are moved straight from the
+ * waiting queue onto the blocking queue (wait morphing), and are woken one
+ * at a time as the monitor is released (see unblock_spinlock_threads()),
+ * rather than all of them waking up only to contend for the monitor.
+ */
 static intptr_t
-monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int notifyall)
+monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, uintptr_t count)
 {
 	omrthread_t queue;
 
@@ -5231,7 +5709,7 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 
 	MONITOR_LOCK(monitor, CALLER_NOTIFY_ONE_OR_ALL);
 	queue = monitor->waiting;
-	if (queue) {
+	if ((NULL != queue) && (0 != count)) {
 #if defined(OMR_THR_MCS_LOCKS)
 #if defined(THREAD_ASSERTS)
 		ASSERT(monitor->spinlockState == J9THREAD_MONITOR_SPINLOCK_OWNED);
@@ -5245,7 +5723,7 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED);
 #endif /* defined(THREAD_ASSERTS) */
 #endif /* defined(OMR_THR_MCS_LOCKS) */
-		if (notifyall) {
+		if (NOTIFY_ALL == count) {
 			/* set all the thread flags */
 			do {
 				THREAD_LOCK(queue, 0);
@@ -5253,6 +5731,7 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 				queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
 				Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
 				THREAD_UNLOCK(queue);
+				monitor->notifiedBlockingCount += 1;
 
 				queue = queue->next;
 			} while (queue);
@@ -5273,14 +5752,22 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 			monitor->waiting = NULL;
 
 		} else {
-			THREAD_LOCK(queue, 0);
-			queue->flags &= ~J9THREAD_FLAG_WAITING;
-			queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
-			Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
-			THREAD_UNLOCK(queue);
+			do {
+				omrthread_t next = queue->next;
+
+				THREAD_LOCK(queue, 0);
+				queue->flags &= ~J9THREAD_FLAG_WAITING;
+				queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
+				Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
+				THREAD_UNLOCK(queue);
+
+				threadDequeue(&monitor->waiting, queue);
+				threadEnqueue(&monitor->blocking, queue);
+				monitor->notifiedBlockingCount += 1;
+				count -= 1;
 
-			threadDequeue(&monitor->waiting, queue);
-			threadEnqueue(&monitor->blocking, queue);
+				queue = next;
+			} while ((NULL != queue) && (0 != count));
 		}
 	}
 
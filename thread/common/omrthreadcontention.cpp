@@ -0,0 +1,399 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file omrthreadcontention.cpp
+ * @brief Sampling monitor contention profiler.
+ *
+ * Every Nth slow-path monitor acquisition on a thread (one where the monitor could
+ * not be taken immediately) captures a native backtrace before the thread blocks
+ * and, once the monitor is owned, adds the time spent waiting to a fixed-size
+ * open-addressed table keyed by (monitor, backtrace). Table slots are claimed
+ * with a CAS and updated with atomic adds, so recording never takes a lock.
+ *
+ * The table is published through lib->contentionProfiler. Threads recording a
+ * sample register in lib->contentionProfilerUsers so that a table being replaced
+ * is not freed under them.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+
+#if (defined(LINUX) && !defined(OMRZTPF)) || defined(OSX)
+#include <execinfo.h>
+#define OMRTHREAD_CONTENTION_HAS_BACKTRACE
+#endif /* (defined(LINUX) && !defined(OMRZTPF)) || defined(OSX) */
+
+extern "C" {
+
+#include "threaddef.h"
+#include "ut_j9thr.h"
+
+#define CONTENTION_SITE_EMPTY ((uintptr_t)0)
+#define CONTENTION_SITE_CLAIMED ((uintptr_t)1)
+#define CONTENTION_SITE_READY ((uintptr_t)2)
+
+#define CONTENTION_NAME_LENGTH 64
+
+/* give up on a sample after this many probes, rather than scan a nearly full table */
+#define CONTENTION_MAX_PROBES 64
+
+typedef struct OMRThreadContentionSite {
+	volatile uintptr_t state;
+	uintptr_t hash;
+	omrthread_monitor_t monitor;
+	uintptr_t frameCount;
+	void *frames[J9THREAD_CONTENTION_MAX_FRAMES];
+	char monitorName[CONTENTION_NAME_LENGTH];
+	volatile uint64_t samples;
+	volatile uint64_t waitTime;
+} OMRThreadContentionSite;
+
+typedef struct OMRThreadContentionProfiler {
+	omrthread_contention_backtrace_t backtrace;
+	void *userData;
+	uintptr_t mask;
+	volatile uint64_t samples;
+	volatile uint64_t droppedSamples;
+	volatile uintptr_t sites;
+	OMRThreadContentionSite *table;
+} OMRThreadContentionProfiler;
+
+#if defined(OMRTHREAD_CONTENTION_HAS_BACKTRACE)
+static uintptr_t
+defaultBacktrace(void *userData, void **frames, uintptr_t maxFrames)
+{
+	int count = backtrace(frames, (int)maxFrames);
+	return (count > 0) ? (uintptr_t)count : 0;
+}
+#endif /* defined(OMRTHREAD_CONTENTION_HAS_BACKTRACE) */
+
+static OMRThreadContentionProfiler *
+acquireProfiler(omrthread_library_t lib)
+{
+	OMRThreadContentionProfiler *profiler = NULL;
+
+	VM_AtomicSupport::add(&lib->contentionProfilerUsers, 1);
+	profiler = (OMRThreadContentionProfiler *)lib->contentionProfiler;
+	if (NULL == profiler) {
+		VM_AtomicSupport::subtract(&lib->contentionProfilerUsers, 1);
+	}
+	return profiler;
+}
+
+static void
+releaseProfiler(omrthread_library_t lib)
+{
+	VM_AtomicSupport::subtract(&lib->contentionProfilerUsers, 1);
+}
+
+/**
+ * Unpublish the current profile and free it once no thread is recording into it.
+ */
+static void
+freeProfiler(omrthread_library_t lib)
+{
+	OMRThreadContentionProfiler *profiler = (OMRThreadContentionProfiler *)VM_AtomicSupport::set((volatile uintptr_t *)&lib->contentionProfiler, 0);
+
+	if (NULL != profiler) {
+		while (0 != lib->contentionProfilerUsers) {
+			omrthread_yield();
+		}
+		omrthread_free_memory(lib, profiler->table);
+		omrthread_free_memory(lib, profiler);
+	}
+}
+
+static uintptr_t
+hashSite(omrthread_monitor_t monitor, void **frames, uintptr_t frameCount)
+{
+	/* FNV-1a over the pointer values */
+	uintptr_t hash = (uintptr_t)2166136261u;
+	uintptr_t i = 0;
+
+	hash = (hash ^ (uintptr_t)monitor) * (uintptr_t)16777619u;
+	for (i = 0; i < frameCount; i++) {
+		hash = (hash ^ (uintptr_t)frames[i]) * (uintptr_t)16777619u;
+	}
+	return hash;
+}
+
+/**
+ * Replace the characters that separate fields in the folded-stack format.
+ * @return the length of name
+ */
+static uintptr_t
+foldName(char *name)
+{
+	uintptr_t length = 0;
+
+	for (length = 0; '\0' != name[length]; length++) {
+		if ((';' == name[length]) || (' ' == name[length]) || ('\n' == name[length])) {
+			name[length] = '_';
+		}
+	}
+	return length;
+}
+
+static BOOLEAN
+siteMatches(OMRThreadContentionSite *site, uintptr_t hash, omrthread_monitor_t monitor, void **frames, uintptr_t frameCount)
+{
+	return (site->hash == hash)
+		&& (site->monitor == monitor)
+		&& (site->frameCount == frameCount)
+		&& (0 == memcmp(site->frames, frames, frameCount * sizeof(void *)));
+}
+
+BOOLEAN
+omrthread_contention_sample_begin(omrthread_t self, void *callSite, OMRThreadContentionSample *sample)
+{
+	omrthread_library_t lib = self->library;
+	uintptr_t interval = lib->contentionSampleInterval;
+	OMRThreadContentionProfiler *profiler = NULL;
+	uintptr_t frameCount = 0;
+	uintptr_t i = 0;
+
+	if (0 == interval) {
+		return FALSE;
+	}
+	if (self->contentionSampleCountdown > 1) {
+		self->contentionSampleCountdown -= 1;
+		return FALSE;
+	}
+	self->contentionSampleCountdown = interval;
+
+	profiler = acquireProfiler(lib);
+	if (NULL == profiler) {
+		return FALSE;
+	}
+	if (NULL != profiler->backtrace) {
+		frameCount = profiler->backtrace(profiler->userData, sample->frames, J9THREAD_CONTENTION_MAX_FRAMES);
+	}
+	releaseProfiler(lib);
+
+	/* drop the frames inside the thread library: everything inner to the caller of the enter function */
+	if (NULL != callSite) {
+		for (i = 0; i < frameCount; i++) {
+			if (sample->frames[i] == callSite) {
+				break;
+			}
+		}
+		if (i < frameCount) {
+			memmove(sample->frames, &sample->frames[i], (frameCount - i) * sizeof(void *));
+			frameCount -= i;
+		} else if (0 == frameCount) {
+			sample->frames[0] = callSite;
+			frameCount = 1;
+		}
+	}
+	sample->frameCount = frameCount;
+	sample->startTime = omrthread_get_hires_clock();
+	return TRUE;
+}
+
+void
+omrthread_contention_sample_end(omrthread_t self, omrthread_monitor_t monitor, OMRThreadContentionSample *sample)
+{
+	omrthread_library_t lib = self->library;
+	uint64_t waitTime = omrthread_get_hires_clock() - sample->startTime;
+	uintptr_t hash = hashSite(monitor, sample->frames, sample->frameCount);
+	OMRThreadContentionProfiler *profiler = acquireProfiler(lib);
+	uintptr_t probe = 0;
+
+	if (NULL == profiler) {
+		return;
+	}
+	for (probe = 0; probe < CONTENTION_MAX_PROBES; probe++) {
+		OMRThreadContentionSite *site = &profiler->table[(hash + probe) & profiler->mask];
+		uintptr_t state = site->state;
+
+		if (CONTENTION_SITE_EMPTY == state) {
+			state = VM_AtomicSupport::lockCompareExchange(&site->state, CONTENTION_SITE_EMPTY, CONTENTION_SITE_CLAIMED);
+			if (CONTENTION_SITE_EMPTY == state) {
+				const char *name = omrthread_monitor_get_name(monitor);
+				site->hash = hash;
+				site->monitor = monitor;
+				site->frameCount = sample->frameCount;
+				memcpy(site->frames, sample->frames, sample->frameCount * sizeof(void *));
+				/* the monitor may be destroyed before the profile is dumped */
+				if (NULL != name) {
+					strncpy(site->monitorName, name, CONTENTION_NAME_LENGTH - 1);
+				} else {
+					snprintf(site->monitorName, CONTENTION_NAME_LENGTH, "monitor@%p", (void *)monitor);
+				}
+				site->monitorName[CONTENTION_NAME_LENGTH - 1] = '\0';
+				foldName(site->monitorName);
+				VM_AtomicSupport::writeBarrier();
+				site->state = CONTENTION_SITE_READY;
+				VM_AtomicSupport::add(&profiler->sites, 1);
+				state = CONTENTION_SITE_READY;
+			}
+		}
+		/* another thread is filling in this slot; it can only be a match if its hash is ours */
+		while (CONTENTION_SITE_CLAIMED == state) {
+			VM_AtomicSupport::yieldCPU();
+			state = site->state;
+		}
+		VM_AtomicSupport::readBarrier();
+		if (siteMatches(site, hash, monitor, sample->frames, sample->frameCount)) {
+			VM_AtomicSupport::addU64(&site->samples, 1);
+			VM_AtomicSupport::addU64(&site->waitTime, waitTime);
+			VM_AtomicSupport::addU64(&profiler->samples, 1);
+			releaseProfiler(lib);
+			return;
+		}
+	}
+	VM_AtomicSupport::addU64(&profiler->droppedSamples, 1);
+	releaseProfiler(lib);
+}
+
+void
+omrthread_contention_profiler_shutdown(omrthread_library_t lib)
+{
+	lib->contentionSampleInterval = 0;
+	freeProfiler(lib);
+}
+
+intptr_t
+omrthread_contention_profiler_start(uintptr_t sampleInterval, uintptr_t tableSize, omrthread_contention_backtrace_t backtrace, void *userData)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	OMRThreadContentionProfiler *profiler = NULL;
+	uintptr_t capacity = 1;
+
+	if (0 == sampleInterval) {
+		sampleInterval = 1;
+	}
+	if (0 == tableSize) {
+		tableSize = J9THREAD_CONTENTION_DEFAULT_TABLE_SIZE;
+	}
+	while (capacity < tableSize) {
+		capacity <<= 1;
+	}
+#if defined(OMRTHREAD_CONTENTION_HAS_BACKTRACE)
+	if (NULL == backtrace) {
+		backtrace = defaultBacktrace;
+	}
+#endif /* defined(OMRTHREAD_CONTENTION_HAS_BACKTRACE) */
+
+	profiler = (OMRThreadContentionProfiler *)omrthread_allocate_memory(lib, sizeof(OMRThreadContentionProfiler), OMRMEM_CATEGORY_THREADS);
+	if (NULL == profiler) {
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	memset(profiler, 0, sizeof(OMRThreadContentionProfiler));
+	profiler->table = (OMRThreadContentionSite *)omrthread_allocate_memory(lib, capacity * sizeof(OMRThreadContentionSite), OMRMEM_CATEGORY_THREADS);
+	if (NULL == profiler->table) {
+		omrthread_free_memory(lib, profiler);
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	memset(profiler->table, 0, capacity * sizeof(OMRThreadContentionSite));
+	profiler->backtrace = backtrace;
+	profiler->userData = userData;
+	profiler->mask = capacity - 1;
+
+	/* discard the previous profile, if any */
+	GLOBAL_LOCK_SIMPLE(lib);
+	lib->contentionSampleInterval = 0;
+	freeProfiler(lib);
+	lib->contentionProfiler = profiler;
+	VM_AtomicSupport::writeBarrier();
+	lib->contentionSampleInterval = sampleInterval;
+	GLOBAL_UNLOCK_SIMPLE(lib);
+
+	Trc_THR_omrthread_contention_profiler_start(sampleInterval, capacity);
+	return J9THREAD_SUCCESS;
+}
+
+void
+omrthread_contention_profiler_stop(void)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+
+	lib->contentionSampleInterval = 0;
+	Trc_THR_omrthread_contention_profiler_stop();
+}
+
+static void
+writeFrame(omrthread_contention_symbolize_t symbolize, omrthread_contention_write_t write, void *userData, void *address)
+{
+	char buffer[256];
+
+	if ((NULL == symbolize) || (0 == symbolize(userData, address, buffer, sizeof(buffer)))) {
+		snprintf(buffer, sizeof(buffer), "%p", address);
+	}
+	buffer[sizeof(buffer) - 1] = '\0';
+	write(userData, buffer, foldName(buffer));
+	write(userData, ";", 1);
+}
+
+intptr_t
+omrthread_contention_profiler_dump(omrthread_contention_symbolize_t symbolize, omrthread_contention_write_t write, void *userData)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	OMRThreadContentionProfiler *profiler = acquireProfiler(lib);
+	uintptr_t i = 0;
+
+	if (NULL == profiler) {
+		return J9THREAD_ERR;
+	}
+	for (i = 0; i <= profiler->mask; i++) {
+		OMRThreadContentionSite *site = &profiler->table[i];
+		if (CONTENTION_SITE_READY == site->state) {
+			char buffer[CONTENTION_NAME_LENGTH + 32];
+			uintptr_t frame = site->frameCount;
+			int length = 0;
+
+			VM_AtomicSupport::readBarrier();
+			/* outermost frame first */
+			while (frame > 0) {
+				frame -= 1;
+				writeFrame(symbolize, write, userData, site->frames[frame]);
+			}
+			length = snprintf(buffer, sizeof(buffer), "%s %llu\n", site->monitorName, (unsigned long long)site->waitTime);
+			if (length > 0) {
+				write(userData, buffer, OMR_MIN((uintptr_t)length, sizeof(buffer) - 1));
+			}
+		}
+	}
+	releaseProfiler(lib);
+	return J9THREAD_SUCCESS;
+}
+
+void
+omrthread_contention_profiler_get_stats(omrthread_contention_stats_t *stats)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	OMRThreadContentionProfiler *profiler = acquireProfiler(lib);
+
+	memset(stats, 0, sizeof(*stats));
+	stats->sampleInterval = lib->contentionSampleInterval;
+	if (NULL != profiler) {
+		stats->samples = profiler->samples;
+		stats->droppedSamples = profiler->droppedSamples;
+		stats->sites = profiler->sites;
+		releaseProfiler(lib);
+	}
+}
+
+} /* extern "C" */
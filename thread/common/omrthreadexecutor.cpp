@@ -0,0 +1,740 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file omrthreadexecutor.cpp
+ * @brief Fixed-size worker pool with per-worker work-stealing deques.
+ *
+ * Each worker owns a bounded Chase-Lev deque: the owner pushes and pops at the
+ * bottom without locking, other workers steal from the top with a single CAS.
+ * Tasks submitted from threads that are not workers of the executor, or that
+ * do not fit in the submitting worker's deque, go to a FIFO shared queue
+ * protected by the executor monitor. The monitor is otherwise only used to park
+ * idle workers and to wake threads joining on a task.
+ */
+
+#include "AtomicSupport.hpp"
+
+extern "C" {
+
+#include "threaddef.h"
+#include "ut_j9thr.h"
+
+#define EXECUTOR_TASK_PENDING ((uintptr_t)0)
+#define EXECUTOR_TASK_JOIN_WAITING ((uintptr_t)1)
+#define EXECUTOR_TASK_DONE ((uintptr_t)2)
+
+#define EXECUTOR_TASK_DETACHED 0x1
+
+/* keeps the deque indices written by the owner and by thieves on separate lines */
+#define EXECUTOR_CACHE_LINE_SIZE 64
+
+/* chunks handed out per worker by omrthread_executor_parallel_for when no grain is given */
+#define EXECUTOR_DEFAULT_CHUNKS_PER_WORKER 4
+
+typedef struct OMRThreadExecutorTask {
+	omrthread_executor_task_fn_t function;
+	void *arg;
+	struct OMRThreadExecutor *executor;
+	struct OMRThreadExecutorTask *next;
+	volatile uintptr_t state;
+	uint32_t category;
+	uint32_t flags;
+} OMRThreadExecutorTask;
+
+typedef struct OMRThreadExecutorDeque {
+	volatile uintptr_t top;
+	uint8_t topPadding[EXECUTOR_CACHE_LINE_SIZE - sizeof(uintptr_t)];
+	volatile uintptr_t bottom;
+	uintptr_t mask;
+	OMRThreadExecutorTask *volatile *slots;
+} OMRThreadExecutorDeque;
+
+typedef struct OMRThreadExecutorWorker {
+	OMRThreadExecutorDeque deque;
+	struct OMRThreadExecutor *executor;
+	omrthread_t thread;
+	uintptr_t index;
+	uintptr_t victimSeed;
+	uint8_t padding[EXECUTOR_CACHE_LINE_SIZE];
+} OMRThreadExecutorWorker;
+
+typedef struct OMRThreadExecutor {
+	omrthread_monitor_t monitor;
+	OMRThreadExecutorTask *sharedHead;
+	OMRThreadExecutorTask *sharedTail;
+	volatile uintptr_t pendingTasks;
+	volatile uintptr_t idleWorkers;
+	volatile uintptr_t shutdown;
+	uintptr_t workerCount;
+	uint32_t flags;
+	OMRThreadExecutorWorker *workers;
+	volatile uintptr_t tasksSubmitted;
+	volatile uintptr_t tasksExecuted;
+	volatile uintptr_t tasksStolen;
+	volatile uintptr_t tasksOverflowed;
+	J9ThreadsCpuUsage cpuUsage;
+} OMRThreadExecutor;
+
+typedef struct OMRThreadExecutorRange {
+	omrthread_executor_range_fn_t function;
+	void *arg;
+	volatile uintptr_t next;
+	uintptr_t end;
+	uintptr_t grain;
+} OMRThreadExecutorRange;
+
+static OMRThreadExecutorWorker *findWorker(OMRThreadExecutor *executor, omrthread_t self);
+static BOOLEAN dequePush(OMRThreadExecutorDeque *deque, OMRThreadExecutorTask *task);
+static OMRThreadExecutorTask *dequePop(OMRThreadExecutorDeque *deque);
+static OMRThreadExecutorTask *dequeSteal(OMRThreadExecutorDeque *deque);
+static OMRThreadExecutorTask *takeSharedTask(OMRThreadExecutor *executor);
+static OMRThreadExecutorTask *stealTask(OMRThreadExecutor *executor, OMRThreadExecutorWorker *thief);
+static OMRThreadExecutorTask *findTask(OMRThreadExecutor *executor, OMRThreadExecutorWorker *worker);
+static void runTask(OMRThreadExecutor *executor, omrthread_t self, OMRThreadExecutorTask *task);
+static void completeTask(OMRThreadExecutor *executor, OMRThreadExecutorTask *task);
+static void accountCpuTime(J9ThreadsCpuUsage *usage, uint32_t category, int64_t cpuTime);
+static void runRange(void *arg);
+static int J9THREAD_PROC workerMain(void *arg);
+
+/**
+ * Return the worker of executor running on thread self, or NULL if self is not one of its workers.
+ */
+static OMRThreadExecutorWorker *
+findWorker(OMRThreadExecutor *executor, omrthread_t self)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < executor->workerCount; i++) {
+		if (executor->workers[i].thread == self) {
+			return &executor->workers[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Push a task at the bottom of a deque. Must only be called by the deque's owner.
+ * @return FALSE if the deque is full
+ */
+static BOOLEAN
+dequePush(OMRThreadExecutorDeque *deque, OMRThreadExecutorTask *task)
+{
+	uintptr_t bottom = deque->bottom;
+	uintptr_t top = deque->top;
+
+	if ((bottom - top) > deque->mask) {
+		return FALSE;
+	}
+	deque->slots[bottom & deque->mask] = task;
+	/* the slot must be visible before thieves can see the new bottom */
+	VM_AtomicSupport::writeBarrier();
+	deque->bottom = bottom + 1;
+	return TRUE;
+}
+
+/**
+ * Pop the most recently pushed task from the bottom of a deque. Must only be
+ * called by the deque's owner.
+ */
+static OMRThreadExecutorTask *
+dequePop(OMRThreadExecutorDeque *deque)
+{
+	OMRThreadExecutorTask *task = NULL;
+	uintptr_t bottom = deque->bottom;
+	uintptr_t top = deque->top;
+
+	if (bottom == top) {
+		return NULL;
+	}
+	bottom -= 1;
+	deque->bottom = bottom;
+	/* publish the reservation of the bottom slot before reading top */
+	VM_AtomicSupport::readWriteBarrier();
+	top = deque->top;
+	if ((intptr_t)(bottom - top) >= 0) {
+		task = deque->slots[bottom & deque->mask];
+		if (bottom == top) {
+			/* last element: race the thieves for it */
+			if (top != VM_AtomicSupport::lockCompareExchange(&deque->top, top, top + 1)) {
+				task = NULL;
+			}
+			deque->bottom = bottom + 1;
+		}
+	} else {
+		deque->bottom = bottom + 1;
+	}
+	return task;
+}
+
+/**
+ * Steal the oldest task from the top of a deque.
+ */
+static OMRThreadExecutorTask *
+dequeSteal(OMRThreadExecutorDeque *deque)
+{
+	uintptr_t top = deque->top;
+	VM_AtomicSupport::readWriteBarrier();
+	uintptr_t bottom = deque->bottom;
+
+	if ((intptr_t)(bottom - top) > 0) {
+		OMRThreadExecutorTask *task = deque->slots[top & deque->mask];
+		if (top == VM_AtomicSupport::lockCompareExchange(&deque->top, top, top + 1)) {
+			return task;
+		}
+	}
+	return NULL;
+}
+
+static OMRThreadExecutorTask *
+takeSharedTask(OMRThreadExecutor *executor)
+{
+	OMRThreadExecutorTask *task = NULL;
+
+	if (NULL != executor->sharedHead) {
+		omrthread_monitor_enter(executor->monitor);
+		task = executor->sharedHead;
+		if (NULL != task) {
+			executor->sharedHead = task->next;
+			if (NULL == executor->sharedHead) {
+				executor->sharedTail = NULL;
+			}
+		}
+		omrthread_monitor_exit(executor->monitor);
+	}
+	return task;
+}
+
+/**
+ * Try each other worker's deque once, starting from a pseudo-random victim.
+ */
+static OMRThreadExecutorTask *
+stealTask(OMRThreadExecutor *executor, OMRThreadExecutorWorker *thief)
+{
+	uintptr_t workerCount = executor->workerCount;
+	uintptr_t start = 0;
+	uintptr_t i = 0;
+
+	if (NULL != thief) {
+		/* xorshift step */
+		uintptr_t seed = thief->victimSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		thief->victimSeed = seed;
+		start = seed % workerCount;
+	}
+	for (i = 0; i < workerCount; i++) {
+		OMRThreadExecutorWorker *victim = &executor->workers[(start + i) % workerCount];
+		if (victim != thief) {
+			OMRThreadExecutorTask *task = dequeSteal(&victim->deque);
+			if (NULL != task) {
+				VM_AtomicSupport::add(&executor->tasksStolen, 1);
+				return task;
+			}
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Find a task to run: the worker's own deque first, then the shared queue, then other workers.
+ * worker is NULL when the caller is not a worker of executor.
+ */
+static OMRThreadExecutorTask *
+findTask(OMRThreadExecutor *executor, OMRThreadExecutorWorker *worker)
+{
+	OMRThreadExecutorTask *task = NULL;
+
+	if (NULL != worker) {
+		task = dequePop(&worker->deque);
+	}
+	if (NULL == task) {
+		task = takeSharedTask(executor);
+	}
+	if (NULL == task) {
+		task = stealTask(executor, worker);
+	}
+	if (NULL != task) {
+		VM_AtomicSupport::subtract(&executor->pendingTasks, 1);
+	}
+	return task;
+}
+
+static void
+accountCpuTime(J9ThreadsCpuUsage *usage, uint32_t category, int64_t cpuTime)
+{
+	if (OMR_ARE_ALL_BITS_SET(category, J9THREAD_CATEGORY_RESOURCE_MONITOR_THREAD)) {
+		usage->resourceMonitorCpuTime += cpuTime;
+	} else if (OMR_ARE_ALL_BITS_SET(category, J9THREAD_CATEGORY_SYSTEM_THREAD)) {
+		usage->systemJvmCpuTime += cpuTime;
+		if (OMR_ARE_ALL_BITS_SET(category, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+			usage->gcCpuTime += cpuTime;
+		} else if (OMR_ARE_ALL_BITS_SET(category, J9THREAD_CATEGORY_SYSTEM_JIT_THREAD)) {
+			usage->jitCpuTime += cpuTime;
+		}
+	} else {
+		usage->applicationCpuTime += cpuTime;
+		if (OMR_ARE_ALL_BITS_SET(category, J9THREAD_CATEGORY_APPLICATION_THREAD)) {
+			uintptr_t userCategory = (category & J9THREAD_USER_DEFINED_THREAD_CATEGORY_MASK) >> J9THREAD_USER_DEFINED_THREAD_CATEGORY_BIT_SHIFT;
+			if ((userCategory > 0) && (userCategory <= J9THREAD_MAX_USER_DEFINED_THREAD_CATEGORIES)) {
+				usage->applicationUserCpuTime[userCategory - 1] += cpuTime;
+			}
+		}
+	}
+}
+
+/**
+ * Run a task on the current thread. The thread's category is switched to the task's
+ * category for the duration of the task so that the library's CPU accounting charges
+ * the right category.
+ */
+static void
+runTask(OMRThreadExecutor *executor, omrthread_t self, OMRThreadExecutorTask *task)
+{
+	uint32_t savedCategory = (uint32_t)omrthread_get_category(self);
+	uint32_t category = savedCategory;
+	BOOLEAN accountCpu = OMR_ARE_ALL_BITS_SET(executor->flags, J9THREAD_EXECUTOR_FLAG_ACCOUNT_CPU);
+	int64_t startCpuTime = 0;
+
+	if ((J9THREAD_EXECUTOR_CATEGORY_INHERIT != task->category) && (savedCategory != task->category)) {
+		if (0 == omrthread_set_category(self, task->category, J9THREAD_TYPE_SET_MODIFY)) {
+			category = task->category;
+		}
+	}
+	if (accountCpu) {
+		startCpuTime = omrthread_get_self_cpu_time(self);
+	}
+
+	task->function(task->arg);
+
+	if (accountCpu) {
+		int64_t cpuTime = omrthread_get_self_cpu_time(self) - startCpuTime;
+		if ((startCpuTime >= 0) && (cpuTime > 0)) {
+			/* J9ThreadsCpuUsage is in microseconds */
+			omrthread_monitor_enter(executor->monitor);
+			accountCpuTime(&executor->cpuUsage, category, cpuTime / 1000);
+			omrthread_monitor_exit(executor->monitor);
+		}
+	}
+	if (category != savedCategory) {
+		omrthread_set_category(self, savedCategory, J9THREAD_TYPE_SET_MODIFY);
+	}
+	VM_AtomicSupport::add(&executor->tasksExecuted, 1);
+
+	completeTask(executor, task);
+}
+
+static void
+completeTask(OMRThreadExecutor *executor, OMRThreadExecutorTask *task)
+{
+	if (OMR_ARE_ALL_BITS_SET(task->flags, EXECUTOR_TASK_DETACHED)) {
+		omrthread_free_memory((omrthread_library_t)GLOBAL_DATA(default_library), task);
+	} else if (EXECUTOR_TASK_PENDING != VM_AtomicSupport::lockCompareExchange(&task->state, EXECUTOR_TASK_PENDING, EXECUTOR_TASK_DONE)) {
+		/* a joiner is (or is about to be) waiting on the monitor */
+		omrthread_monitor_enter(executor->monitor);
+		task->state = EXECUTOR_TASK_DONE;
+		omrthread_monitor_notify_all(executor->monitor);
+		omrthread_monitor_exit(executor->monitor);
+	}
+}
+
+static int J9THREAD_PROC
+workerMain(void *arg)
+{
+	OMRThreadExecutorWorker *worker = (OMRThreadExecutorWorker *)arg;
+	OMRThreadExecutor *executor = worker->executor;
+	omrthread_t self = omrthread_self();
+
+	for (;;) {
+		OMRThreadExecutorTask *task = findTask(executor, worker);
+		if (NULL != task) {
+			runTask(executor, self, task);
+			continue;
+		}
+
+		omrthread_monitor_enter(executor->monitor);
+		/* pairs with the pendingTasks increment / idleWorkers check in queueTask */
+		VM_AtomicSupport::add(&executor->idleWorkers, 1);
+		if (0 == executor->pendingTasks) {
+			if (executor->shutdown) {
+				VM_AtomicSupport::subtract(&executor->idleWorkers, 1);
+				omrthread_monitor_exit(executor->monitor);
+				break;
+			}
+			omrthread_monitor_wait(executor->monitor);
+		}
+		VM_AtomicSupport::subtract(&executor->idleWorkers, 1);
+		omrthread_monitor_exit(executor->monitor);
+	}
+	return 0;
+}
+
+static void
+queueTask(OMRThreadExecutor *executor, OMRThreadExecutorTask *task)
+{
+	OMRThreadExecutorWorker *worker = findWorker(executor, omrthread_self());
+	BOOLEAN queued = FALSE;
+
+	VM_AtomicSupport::add(&executor->tasksSubmitted, 1);
+	VM_AtomicSupport::add(&executor->pendingTasks, 1);
+
+	if (NULL != worker) {
+		queued = dequePush(&worker->deque, task);
+		if (!queued) {
+			VM_AtomicSupport::add(&executor->tasksOverflowed, 1);
+		}
+	}
+	if (!queued) {
+		omrthread_monitor_enter(executor->monitor);
+		task->next = NULL;
+		if (NULL == executor->sharedTail) {
+			executor->sharedHead = task;
+		} else {
+			executor->sharedTail->next = task;
+		}
+		executor->sharedTail = task;
+		omrthread_monitor_notify(executor->monitor);
+		omrthread_monitor_exit(executor->monitor);
+	} else if (0 != executor->idleWorkers) {
+		omrthread_monitor_enter(executor->monitor);
+		omrthread_monitor_notify(executor->monitor);
+		omrthread_monitor_exit(executor->monitor);
+	}
+}
+
+void
+omrthread_executor_params_init(omrthread_executor_params_t *params)
+{
+	memset(params, 0, sizeof(*params));
+	params->name = "omrthread executor";
+	params->dequeCapacity = J9THREAD_EXECUTOR_DEFAULT_DEQUE_CAPACITY;
+	params->priority = J9THREAD_PRIORITY_NORMAL;
+	params->category = J9THREAD_CATEGORY_SYSTEM_THREAD;
+}
+
+intptr_t
+omrthread_executor_create(omrthread_executor_t *handle, const omrthread_executor_params_t *params)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	omrthread_executor_params_t defaults;
+	OMRThreadExecutor *executor = NULL;
+	omrthread_attr_t attr = NULL;
+	uintptr_t capacity = 1;
+	uintptr_t workerCount = 0;
+	uintptr_t created = 0;
+	uintptr_t i = 0;
+	intptr_t rc = J9THREAD_SUCCESS;
+
+	if (NULL == params) {
+		omrthread_executor_params_init(&defaults);
+		params = &defaults;
+	}
+	workerCount = params->workerCount;
+	if ((NULL == handle) || (0 == workerCount)) {
+		return J9THREAD_ERR_INVALID_VALUE;
+	}
+	/* round the deque capacity up to a power of 2 */
+	while (capacity < params->dequeCapacity) {
+		capacity <<= 1;
+	}
+
+	executor = (OMRThreadExecutor *)omrthread_allocate_memory(lib, sizeof(OMRThreadExecutor), OMRMEM_CATEGORY_THREADS);
+	if (NULL == executor) {
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	memset(executor, 0, sizeof(OMRThreadExecutor));
+	executor->workerCount = workerCount;
+	executor->flags = params->flags;
+
+	executor->workers = (OMRThreadExecutorWorker *)omrthread_allocate_memory(lib, workerCount * sizeof(OMRThreadExecutorWorker), OMRMEM_CATEGORY_THREADS);
+	if (NULL == executor->workers) {
+		rc = J9THREAD_ERR_NOMEMORY;
+		goto fail;
+	}
+	memset(executor->workers, 0, workerCount * sizeof(OMRThreadExecutorWorker));
+	for (i = 0; i < workerCount; i++) {
+		OMRThreadExecutorWorker *worker = &executor->workers[i];
+		worker->executor = executor;
+		worker->index = i;
+		worker->victimSeed = (i + 1) * 2654435761u;
+		worker->deque.mask = capacity - 1;
+		worker->deque.slots = (OMRThreadExecutorTask *volatile *)omrthread_allocate_memory(lib, capacity * sizeof(OMRThreadExecutorTask *), OMRMEM_CATEGORY_THREADS);
+		if (NULL == worker->deque.slots) {
+			rc = J9THREAD_ERR_NOMEMORY;
+			goto fail;
+		}
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&executor->monitor, 0, params->name)) {
+		rc = J9THREAD_ERR;
+		goto fail;
+	}
+
+	rc = omrthread_attr_init(&attr);
+	if (J9THREAD_SUCCESS != rc) {
+		goto fail;
+	}
+	omrthread_attr_set_name(&attr, params->name);
+	omrthread_attr_set_category(&attr, params->category);
+	omrthread_attr_set_priority(&attr, params->priority);
+	omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+	if (0 != params->stackSize) {
+		omrthread_attr_set_stacksize(&attr, params->stackSize);
+	}
+
+	/* workers start suspended so that their handles are published before they can run tasks */
+	for (created = 0; created < workerCount; created++) {
+		OMRThreadExecutorWorker *worker = &executor->workers[created];
+		rc = omrthread_create_ex(&worker->thread, &attr, TRUE, workerMain, worker);
+		if (J9THREAD_SUCCESS != rc) {
+			Trc_THR_omrthread_executor_create_worker_failed(executor, created, rc);
+			break;
+		}
+		if ((NULL != params->numaNodes) && (0 != params->numaNodeCount)) {
+			omrthread_numa_set_node_affinity(worker->thread, &params->numaNodes[created % params->numaNodeCount], 1, 0);
+		}
+	}
+	omrthread_attr_destroy(&attr);
+
+	if (J9THREAD_SUCCESS != rc) {
+		/* let the threads that were created exit */
+		executor->workerCount = created;
+		executor->shutdown = TRUE;
+		for (i = 0; i < created; i++) {
+			omrthread_resume(executor->workers[i].thread);
+		}
+		omrthread_executor_destroy(executor);
+		return rc;
+	}
+
+	for (i = 0; i < workerCount; i++) {
+		omrthread_resume(executor->workers[i].thread);
+	}
+
+	Trc_THR_omrthread_executor_create(executor, workerCount, capacity);
+	*handle = executor;
+	return J9THREAD_SUCCESS;
+
+fail:
+	if (NULL != executor->monitor) {
+		omrthread_monitor_destroy(executor->monitor);
+	}
+	if (NULL != executor->workers) {
+		for (i = 0; i < workerCount; i++) {
+			omrthread_free_memory(lib, (void *)executor->workers[i].deque.slots);
+		}
+		omrthread_free_memory(lib, executor->workers);
+	}
+	omrthread_free_memory(lib, executor);
+	return rc;
+}
+
+intptr_t
+omrthread_executor_destroy(omrthread_executor_t executor)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	uintptr_t i = 0;
+
+	if (NULL != findWorker(executor, omrthread_self())) {
+		return J9THREAD_INVALID_ARGUMENT;
+	}
+
+	omrthread_monitor_enter(executor->monitor);
+	executor->shutdown = TRUE;
+	omrthread_monitor_notify_all(executor->monitor);
+	omrthread_monitor_exit(executor->monitor);
+
+	/* workers drain the queues before they exit */
+	for (i = 0; i < executor->workerCount; i++) {
+		omrthread_join(executor->workers[i].thread);
+	}
+
+	Trc_THR_omrthread_executor_destroy(executor, (uintptr_t)executor->tasksExecuted, (uintptr_t)executor->tasksStolen);
+
+	omrthread_monitor_destroy(executor->monitor);
+	for (i = 0; i < executor->workerCount; i++) {
+		omrthread_free_memory(lib, (void *)executor->workers[i].deque.slots);
+	}
+	omrthread_free_memory(lib, executor->workers);
+	omrthread_free_memory(lib, executor);
+	return J9THREAD_SUCCESS;
+}
+
+intptr_t
+omrthread_executor_submit(omrthread_executor_t executor, omrthread_executor_task_fn_t function, void *arg, uint32_t category, omrthread_executor_task_t *handle)
+{
+	OMRThreadExecutorTask *task = NULL;
+
+	if (NULL == function) {
+		return J9THREAD_ERR_INVALID_VALUE;
+	}
+	task = (OMRThreadExecutorTask *)omrthread_allocate_memory((omrthread_library_t)GLOBAL_DATA(default_library), sizeof(OMRThreadExecutorTask), OMRMEM_CATEGORY_THREADS);
+	if (NULL == task) {
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	task->function = function;
+	task->arg = arg;
+	task->executor = executor;
+	task->next = NULL;
+	task->state = EXECUTOR_TASK_PENDING;
+	task->category = category;
+	task->flags = (NULL == handle) ? EXECUTOR_TASK_DETACHED : 0;
+	if (NULL != handle) {
+		/* the task may complete and be joined as soon as it is queued */
+		*handle = task;
+	}
+	queueTask(executor, task);
+	return J9THREAD_SUCCESS;
+}
+
+intptr_t
+omrthread_executor_join(omrthread_executor_task_t task)
+{
+	OMRThreadExecutor *executor = task->executor;
+	omrthread_t self = omrthread_self();
+	OMRThreadExecutorWorker *worker = findWorker(executor, self);
+
+	if (NULL != worker) {
+		/* help out rather than block a worker, which could deadlock nested joins */
+		while (EXECUTOR_TASK_DONE != task->state) {
+			OMRThreadExecutorTask *other = findTask(executor, worker);
+			if (NULL != other) {
+				runTask(executor, self, other);
+			} else {
+				omrthread_yield();
+			}
+		}
+	} else if (EXECUTOR_TASK_DONE != task->state) {
+		omrthread_monitor_enter(executor->monitor);
+		/* completeTask takes the monitor to finish the task once it sees this state */
+		VM_AtomicSupport::lockCompareExchange(&task->state, EXECUTOR_TASK_PENDING, EXECUTOR_TASK_JOIN_WAITING);
+		while (EXECUTOR_TASK_DONE != task->state) {
+			omrthread_monitor_wait(executor->monitor);
+		}
+		omrthread_monitor_exit(executor->monitor);
+	}
+	VM_AtomicSupport::readBarrier();
+	omrthread_free_memory((omrthread_library_t)GLOBAL_DATA(default_library), task);
+	return J9THREAD_SUCCESS;
+}
+
+static void
+runRange(void *arg)
+{
+	OMRThreadExecutorRange *range = (OMRThreadExecutorRange *)arg;
+
+	for (;;) {
+		uintptr_t end = VM_AtomicSupport::add(&range->next, range->grain);
+		uintptr_t start = end - range->grain;
+		if (start >= range->end) {
+			break;
+		}
+		if ((end > range->end) || (end < start)) {
+			end = range->end;
+		}
+		range->function(range->arg, start, end);
+	}
+}
+
+intptr_t
+omrthread_executor_parallel_for(omrthread_executor_t executor, uintptr_t start, uintptr_t end, uintptr_t grain, omrthread_executor_range_fn_t function, void *arg, uint32_t category)
+{
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	OMRThreadExecutorRange range;
+	omrthread_executor_task_t *tasks = NULL;
+	omrthread_t self = omrthread_self();
+	uintptr_t chunks = 0;
+	uintptr_t helpers = 0;
+	uintptr_t submitted = 0;
+	uint32_t savedCategory = 0;
+	intptr_t rc = J9THREAD_SUCCESS;
+
+	if (NULL == function) {
+		return J9THREAD_ERR_INVALID_VALUE;
+	}
+	if (start >= end) {
+		return J9THREAD_SUCCESS;
+	}
+	if (0 == grain) {
+		grain = (end - start) / (executor->workerCount * EXECUTOR_DEFAULT_CHUNKS_PER_WORKER);
+		if (0 == grain) {
+			grain = 1;
+		}
+	}
+	range.function = function;
+	range.arg = arg;
+	range.next = start;
+	range.end = end;
+	range.grain = grain;
+
+	/* chunks are claimed dynamically, so one helper task per other chunk (up to one per worker) is enough */
+	chunks = ((end - start) / grain) + ((0 == ((end - start) % grain)) ? 0 : 1);
+	helpers = OMR_MIN(chunks - 1, executor->workerCount);
+	if (0 != helpers) {
+		tasks = (omrthread_executor_task_t *)omrthread_allocate_memory(lib, helpers * sizeof(omrthread_executor_task_t), OMRMEM_CATEGORY_THREADS);
+		if (NULL == tasks) {
+			helpers = 0;
+		}
+	}
+	for (submitted = 0; submitted < helpers; submitted++) {
+		rc = omrthread_executor_submit(executor, runRange, &range, category, &tasks[submitted]);
+		if (J9THREAD_SUCCESS != rc) {
+			break;
+		}
+	}
+
+	/* the caller claims chunks too, in the requested category */
+	savedCategory = (uint32_t)omrthread_get_category(self);
+	if ((J9THREAD_EXECUTOR_CATEGORY_INHERIT != category) && (savedCategory != category)) {
+		omrthread_set_category(self, category, J9THREAD_TYPE_SET_MODIFY);
+	}
+	runRange(&range);
+	if ((J9THREAD_EXECUTOR_CATEGORY_INHERIT != category) && (savedCategory != category)) {
+		omrthread_set_category(self, savedCategory, J9THREAD_TYPE_SET_MODIFY);
+	}
+
+	while (0 != submitted) {
+		submitted -= 1;
+		omrthread_executor_join(tasks[submitted]);
+	}
+	if (NULL != tasks) {
+		omrthread_free_memory(lib, tasks);
+	}
+	/* a submission failure is not an error once the caller has run every chunk */
+	return J9THREAD_SUCCESS;
+}
+
+void
+omrthread_executor_get_stats(omrthread_executor_t executor, omrthread_executor_stats_t *stats)
+{
+	stats->tasksSubmitted = executor->tasksSubmitted;
+	stats->tasksExecuted = executor->tasksExecuted;
+	stats->tasksStolen = executor->tasksStolen;
+	stats->tasksOverflowed = executor->tasksOverflowed;
+	omrthread_monitor_enter(executor->monitor);
+	stats->cpuUsage = executor->cpuUsage;
+	omrthread_monitor_exit(executor->monitor);
+}
+
+} /* extern "C" */
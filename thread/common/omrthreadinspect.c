@@ -173,7 +173,18 @@ omrthread_monitor_walk_no_locking(omrthread_monitor_walk_state_t *walkState)
 void *
 omrthread_tls_get(omrthread_t thread, omrthread_tls_key_t key)
 {
-	return (void *)READU(thread->tls[key - 1]);
+	uintptr_t index = key - 1;
+	void **chunk = NULL;
+
+	if (index < J9THREAD_MAX_TLS_KEYS) {
+		return (void *)READU(thread->tls[index]);
+	}
+	index -= J9THREAD_MAX_TLS_KEYS;
+	chunk = READP(thread->tls_chunks[index / J9THREAD_TLS_CHUNK_SIZE]);
+	if (NULL == chunk) {
+		return NULL;
+	}
+	return (void *)READU(chunk[index % J9THREAD_TLS_CHUNK_SIZE]);
 }
 
 /**
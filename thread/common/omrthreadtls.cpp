@@ -0,0 +1,374 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 1991
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Thread local storage
+ *
+ * The first J9THREAD_MAX_TLS_KEYS keys are stored in the thread's tls[] array. Later keys,
+ * up to J9THREAD_MAX_EXTENDED_TLS_KEYS, are stored in chunks of J9THREAD_TLS_CHUNK_SIZE
+ * slots which are allocated the first time a key in the chunk is used, both for the
+ * library's finalizers and for each thread's values. Keys are claimed with a CAS on the
+ * finalizer slot, so omrthread_tls_alloc does not take a lock.
+ */
+
+#include <string.h>
+
+#include "AtomicSupport.hpp"
+
+extern "C" {
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "threaddef.h"
+#include "thread_internal.h"
+
+static void J9THREAD_PROC tls_null_finalizer(void *entry);
+
+/**
+ * Return the chunk stored at *chunkSlot, allocating and installing a zeroed chunk if there is none.
+ *
+ * @param[in] lib the thread library
+ * @param[in] chunkSlot the chunk pointer to fill in
+ * @param[in] chunkSize size of the chunk in bytes
+ * @return the chunk, or NULL if it could not be allocated
+ */
+static void *
+tls_get_or_allocate_chunk(omrthread_library_t lib, void *volatile *chunkSlot, uintptr_t chunkSize)
+{
+	void *chunk = *chunkSlot;
+
+	if (NULL == chunk) {
+		void *newChunk = omrthread_allocate_memory(lib, chunkSize, OMRMEM_CATEGORY_THREADS);
+		if (NULL != newChunk) {
+			memset(newChunk, 0, chunkSize);
+			VM_AtomicSupport::writeBarrier();
+			chunk = (void *)VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)chunkSlot, 0, (uintptr_t)newChunk);
+			if (NULL == chunk) {
+				chunk = newChunk;
+			} else {
+				/* another thread installed a chunk first */
+				omrthread_free_memory(lib, newChunk);
+			}
+		}
+	}
+	return chunk;
+}
+
+/**
+ * Find the finalizer slot for a TLS index.
+ *
+ * @param[in] lib the thread library
+ * @param[in] index key - 1
+ * @param[in] allocate whether to allocate the chunk holding the slot if it does not exist yet
+ * @return the slot, or NULL if its chunk does not exist and could not or should not be allocated
+ */
+static omrthread_tls_finalizer_t *
+tls_finalizer_slot(omrthread_library_t lib, uintptr_t index, BOOLEAN allocate)
+{
+	omrthread_tls_finalizer_t *chunk = NULL;
+
+	if (index < J9THREAD_MAX_TLS_KEYS) {
+		return &lib->tls_finalizers[index];
+	}
+	index -= J9THREAD_MAX_TLS_KEYS;
+	if (allocate) {
+		chunk = (omrthread_tls_finalizer_t *)tls_get_or_allocate_chunk(lib,
+			(void *volatile *)&lib->tls_finalizer_chunks[index / J9THREAD_TLS_CHUNK_SIZE],
+			J9THREAD_TLS_CHUNK_SIZE * sizeof(omrthread_tls_finalizer_t));
+	} else {
+		chunk = lib->tls_finalizer_chunks[index / J9THREAD_TLS_CHUNK_SIZE];
+	}
+	return (NULL == chunk) ? NULL : &chunk[index % J9THREAD_TLS_CHUNK_SIZE];
+}
+
+/**
+ * Find a thread's value slot for a TLS index.
+ *
+ * @param[in] thread the thread
+ * @param[in] index key - 1
+ * @param[in] allocate whether to allocate the chunk holding the slot if it does not exist yet
+ * @return the slot, or NULL if its chunk does not exist and could not or should not be allocated
+ */
+static void **
+tls_value_slot(omrthread_t thread, uintptr_t index, BOOLEAN allocate)
+{
+	void **chunk = NULL;
+
+	if (index < J9THREAD_MAX_TLS_KEYS) {
+		return &thread->tls[index];
+	}
+	index -= J9THREAD_MAX_TLS_KEYS;
+	if (allocate) {
+		chunk = (void **)tls_get_or_allocate_chunk(thread->library,
+			(void *volatile *)&thread->tls_chunks[index / J9THREAD_TLS_CHUNK_SIZE],
+			J9THREAD_TLS_CHUNK_SIZE * sizeof(void *));
+	} else {
+		chunk = thread->tls_chunks[index / J9THREAD_TLS_CHUNK_SIZE];
+	}
+	return (NULL == chunk) ? NULL : &chunk[index % J9THREAD_TLS_CHUNK_SIZE];
+}
+
+/**
+ * Allocate a thread local storage (TLS) key.
+ *
+ * Create and return a new, unique key for thread local storage.
+ *
+ * @note The handle returned will be > 0, so it is safe to test the handle against 0 to see if it's been
+ * allocated yet.
+ *
+ * @param[out] handle pointer to a key to be initialized with a key value
+ * @return 0 on success or negative value if a key could not be allocated (i.e. all TLS has been allocated)
+ *
+ * @see omrthread_tls_free, omrthread_tls_set
+ */
+intptr_t
+omrthread_tls_alloc(omrthread_tls_key_t *handle)
+{
+	return omrthread_tls_alloc_with_finalizer(handle, tls_null_finalizer);
+}
+
+
+/**
+ * Allocate a thread local storage (TLS) key.
+ *
+ * Create and return a new, unique key for thread local storage.
+ *
+ * @note The handle returned will be > 0, so it is safe to test the handle against 0 to see if it's been
+ * allocated yet.
+ *
+ * @note The lowest free key is returned. Keys up to J9THREAD_MAX_TLS_KEYS can be read with
+ * J9THREAD_TLS_GET without a function call.
+ *
+ * @param[out] handle pointer to a key to be initialized with a key value
+ * @param[in] finalizer a finalizer function which will be invoked when a thread is detached or terminates if the thread's TLS entry for this key is non-NULL
+ * @return 0 on success or negative value if a key could not be allocated (i.e. all TLS has been allocated)
+ *
+ * @see omrthread_tls_free, omrthread_tls_set
+ */
+intptr_t
+omrthread_tls_alloc_with_finalizer(omrthread_tls_key_t *handle, omrthread_tls_finalizer_t finalizer)
+{
+	uintptr_t index = 0;
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	ASSERT(lib);
+
+	*handle = 0;
+
+	for (index = 0; index < J9THREAD_MAX_EXTENDED_TLS_KEYS; index++) {
+		omrthread_tls_finalizer_t *slot = tls_finalizer_slot(lib, index, TRUE);
+		if (NULL == slot) {
+			/* out of memory for a new chunk of keys */
+			break;
+		}
+		if ((NULL == *slot)
+			&& (0 == VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)slot, 0, (uintptr_t)finalizer))
+		) {
+			*handle = index + 1;
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+
+
+/**
+ * Release a TLS key.
+ *
+ * Release a TLS key previously allocated by omrthread_tls_alloc.
+ *
+ * @param[in] key TLS key to be freed
+ * @return 0 on success or negative value on failure
+ *
+ * @see omrthread_tls_alloc, omrthread_tls_set
+ *
+ */
+intptr_t
+omrthread_tls_free(omrthread_tls_key_t key)
+{
+	J9PoolState state;
+	omrthread_t each;
+	omrthread_library_t lib = (omrthread_library_t)GLOBAL_DATA(default_library);
+	ASSERT(lib);
+
+	/* clear the TLS in every existing thread */
+	GLOBAL_LOCK_SIMPLE(lib);
+	each = (omrthread_t)pool_startDo(lib->thread_pool, &state);
+	while (each) {
+		void **slot = tls_value_slot(each, key - 1, FALSE);
+		if (NULL != slot) {
+			*slot = NULL;
+		}
+		each = (omrthread_t)pool_nextDo(&state);
+	}
+	GLOBAL_UNLOCK_SIMPLE(lib);
+
+	/* now return the key to the free set */
+	OMROSMUTEX_ENTER(lib->tls_mutex);
+	*tls_finalizer_slot(lib, key - 1, FALSE) = NULL;
+	OMROSMUTEX_EXIT(lib->tls_mutex);
+
+	return 0;
+}
+
+
+/**
+ * Set a thread's TLS value.
+ *
+ * @param[in] thread a thread
+ * @param[in] key key to have TLS value set (any value returned by omrthread_alloc)
+ * @param[in] value value to be stored in TLS
+ * @return 0 on success or negative value on failure
+ *
+ * @see omrthread_tls_alloc, omrthread_tls_free, omrthread_tls_get
+ */
+intptr_t
+omrthread_tls_set(omrthread_t thread, omrthread_tls_key_t key, void *value)
+{
+	void **slot = NULL;
+
+	if (key <= J9THREAD_MAX_TLS_KEYS) {
+		thread->tls[key - 1] = value;
+		return 0;
+	}
+
+	/* a NULL value does not need a chunk: a missing chunk reads as NULL */
+	slot = tls_value_slot(thread, key - 1, NULL != value);
+	if (NULL != slot) {
+		*slot = value;
+	} else if (NULL != value) {
+		return -1;
+	}
+
+	return 0;
+}
+
+
+/**
+ * Call the finalizer of a TLS slot of the current thread if the slot is non-NULL.
+ *
+ * @param[in] lib the thread library
+ * @param[in] value the thread's value slot
+ * @param[in] finalizer the key's finalizer slot
+ * @param[in] lock whether to read the value and finalizer under the TLS mutex
+ */
+static void
+tls_finalize_slot(omrthread_library_t lib, void **value, omrthread_tls_finalizer_t *finalizer, BOOLEAN lock)
+{
+	if (NULL != *value) {
+		void *valueCopy = NULL;
+		omrthread_tls_finalizer_t finalizerCopy = NULL;
+
+		/* read the value and finalizer together under mutex to be sure that they belong together */
+		if (lock) {
+			OMROSMUTEX_ENTER(lib->tls_mutex);
+		}
+		valueCopy = *value;
+		finalizerCopy = *finalizer;
+		if (lock) {
+			OMROSMUTEX_EXIT(lib->tls_mutex);
+		}
+
+		if ((NULL != valueCopy) && (NULL != finalizerCopy)) {
+			finalizerCopy(valueCopy);
+		}
+	}
+}
+
+static void
+tls_finalize(omrthread_t thread, BOOLEAN lock)
+{
+	uintptr_t index = 0;
+	uintptr_t chunk = 0;
+	omrthread_library_t lib = thread->library;
+
+	for (index = 0; index < J9THREAD_MAX_TLS_KEYS; index++) {
+		tls_finalize_slot(lib, &thread->tls[index], &lib->tls_finalizers[index], lock);
+	}
+
+	for (chunk = 0; chunk < J9THREAD_TLS_MAX_CHUNKS; chunk++) {
+		void **values = thread->tls_chunks[chunk];
+		if (NULL != values) {
+			/* a thread can only have a chunk for keys that have been allocated */
+			omrthread_tls_finalizer_t *finalizers = lib->tls_finalizer_chunks[chunk];
+			for (index = 0; index < J9THREAD_TLS_CHUNK_SIZE; index++) {
+				tls_finalize_slot(lib, &values[index], &finalizers[index], lock);
+			}
+		}
+	}
+}
+
+/**
+ * Run finalizers on any non-NULL TLS values for the current thread
+ *
+ * @param[in] thread current thread
+ * @return none
+ */
+void
+omrthread_tls_finalize(omrthread_t thread)
+{
+	tls_finalize(thread, TRUE);
+}
+
+void
+omrthread_tls_finalizeNoLock(omrthread_t thread)
+{
+	tls_finalize(thread, FALSE);
+}
+
+void
+omrthread_tls_free_chunks(omrthread_t thread)
+{
+	uintptr_t chunk = 0;
+
+	for (chunk = 0; chunk < J9THREAD_TLS_MAX_CHUNKS; chunk++) {
+		if (NULL != thread->tls_chunks[chunk]) {
+			omrthread_free_memory(thread->library, thread->tls_chunks[chunk]);
+			thread->tls_chunks[chunk] = NULL;
+		}
+	}
+}
+
+void
+omrthread_tls_shutdown(omrthread_library_t lib)
+{
+	uintptr_t chunk = 0;
+
+	for (chunk = 0; chunk < J9THREAD_TLS_MAX_CHUNKS; chunk++) {
+		if (NULL != lib->tls_finalizer_chunks[chunk]) {
+			omrthread_free_memory(lib, lib->tls_finalizer_chunks[chunk]);
+			lib->tls_finalizer_chunks[chunk] = NULL;
+		}
+	}
+}
+
+static void J9THREAD_PROC
+tls_null_finalizer(void *entry)
+{
+	/* do nothing */
+}
+
+} /* extern "C" */
@@ -55,6 +55,43 @@ void
 omrthread_init(omrthread_library_t lib);
 
 
+/* ---------------- omrthreadcontention.cpp ---------------- */
+
+typedef struct OMRThreadContentionSample {
+	uint64_t startTime;
+	uintptr_t frameCount;
+	void *frames[J9THREAD_CONTENTION_MAX_FRAMES];
+} OMRThreadContentionSample;
+
+/**
+ * Decide whether this slow-path monitor enter is sampled and, if so, capture its backtrace
+ * and start time. Call before blocking on the monitor.
+ * @param[in] self the current thread
+ * @param[in] callSite return address of the public enter function, used to trim library frames; may be NULL
+ * @param[out] sample the sample to fill in
+ * @return TRUE if the enter is sampled and omrthread_contention_sample_end must be called once the monitor is owned
+ */
+BOOLEAN
+omrthread_contention_sample_begin(omrthread_t self, void *callSite, OMRThreadContentionSample *sample);
+
+/**
+ * Record a sample started by omrthread_contention_sample_begin. Call once the monitor is owned.
+ * @param[in] self the current thread
+ * @param[in] monitor the monitor that was contended
+ * @param[in] sample the sample
+ * @return void
+ */
+void
+omrthread_contention_sample_end(omrthread_t self, omrthread_monitor_t monitor, OMRThreadContentionSample *sample);
+
+/**
+ * Stop the profiler and free its table.
+ * @param[in] lib the thread library
+ * @return void
+ */
+void
+omrthread_contention_profiler_shutdown(omrthread_library_t lib);
+
 /* ---------------- omrthreadjlm.c ---------------- */
 
 #if defined(OMR_THR_JLM)
@@ -105,7 +142,7 @@ jlm_monitor_clear(omrthread_library_t lib, omrthread_monitor_t monitor);
 
 #endif /* OMR_THR_JLM */
 
-/* ---------------- omrthreadtls.c ---------------- */
+/* ---------------- omrthreadtls.cpp ---------------- */
 
 /**
  * @brief
@@ -124,6 +161,22 @@ omrthread_tls_finalize(omrthread_t thread);
 void
 omrthread_tls_finalizeNoLock(omrthread_t thread);
 
+/**
+ * Free the chunks holding a thread's values for keys beyond J9THREAD_MAX_TLS_KEYS.
+ *
+ * @param[in] thread the thread being freed
+ */
+void
+omrthread_tls_free_chunks(omrthread_t thread);
+
+/**
+ * Free the chunks holding the finalizers for keys beyond J9THREAD_MAX_TLS_KEYS.
+ *
+ * @param[in] lib the thread library
+ */
+void
+omrthread_tls_shutdown(omrthread_library_t lib);
+
 /* ---------------- thrprof.c ---------------- */
 
 /**
@@ -162,6 +162,8 @@ enum {
 	CALLER_STORE_EXIT_CPU_USAGE,
 	CALLER_GET_JVM_CPU_USAGE_INFO,
 	CALLER_SET_FLAG_ENABLE_CPU_MONITOR,
+	CALLER_THREAD_CACHE_PARK,
+	CALLER_THREAD_CACHE_REUSE,
 	CALLER_LAST_INDEX
 };
 #define MAX_CALLER_INDEX CALLER_LAST_INDEX
@@ -169,8 +171,8 @@ enum {
 /*
  * helper defines for local functions
  */
-#define NOTIFY_ONE (0)
-#define NOTIFY_ALL (1)
+#define NOTIFY_ONE ((uintptr_t)1)
+#define NOTIFY_ALL UINTPTR_MAX
 #define GLOBAL_NOT_LOCKED (0)
 #define GLOBAL_IS_LOCKED  (1)
 
@@ -185,7 +187,17 @@ enum {
  */
 #define CUSTOM_ADAPTIVE_SPIN_TRUE  (1)
 
+#if defined(OMR_THR_FAST_TLS)
+#define MACRO_SELF() (omrthread_current_thread)
+#define SET_SELF(lib, thread) \
+	do { \
+		TLS_SET((lib)->self_ptr, (thread)); \
+		omrthread_current_thread = (thread); \
+	} while (0)
+#else /* defined(OMR_THR_FAST_TLS) */
 #define MACRO_SELF() ((omrthread_t)TLS_GET(((omrthread_library_t)GLOBAL_DATA(default_library))->self_ptr))
+#define SET_SELF(lib, thread) TLS_SET((lib)->self_ptr, (thread))
+#endif /* defined(OMR_THR_FAST_TLS) */
 
 #if defined(THREAD_ASSERTS)
 #define GLOBAL_LOCK(self, caller) \
@@ -262,6 +274,16 @@ enum {
 
 #define MONITOR_UNLOCK(monitor) OMROSMUTEX_EXIT((monitor)->mutex)
 
+/* return address of the current function, identifying the caller of a public entry point */
+#if defined(__GNUC__)
+#define OMRTHREAD_CALL_SITE() __builtin_return_address(0)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define OMRTHREAD_CALL_SITE() _ReturnAddress()
+#else /* defined(__GNUC__) */
+#define OMRTHREAD_CALL_SITE() NULL
+#endif /* defined(__GNUC__) */
+
 #define IS_OBJECT_MONITOR(monitor) (J9THREAD_MONITOR_OBJECT == ((monitor)->flags & J9THREAD_MONITOR_OBJECT))
 
 #define IS_JLM_ENABLED(thread) ((thread)->library->flags & J9THREAD_LIB_FLAG_JLM_INIT_DATA_STRUCTURES)
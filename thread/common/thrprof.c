@@ -31,6 +31,10 @@
 #if defined(LINUX)
 #define _GNU_SOURCE
 #include <sys/resource.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
 #endif /* defined(LINUX) */
 
 #include <string.h> /* for memset() */
@@ -930,6 +934,78 @@ omrthread_get_hires_clock(void)
 #define THREAD_WALK_RESOURCE_USAGE_MUTEX_HELD	0x1
 #define THREAD_WALK_MONITOR_MUTEX_HELD			0x2
 
+/**
+ * Add a thread's CPU time since its last category switch to the totals for its category.
+ * @param[in] usage the totals
+ * @param[in] thread the thread
+ * @param[in] threadCpuTime the thread's CPU time since its last category switch, in microseconds
+ */
+static void
+accumulateThreadCpuUsage(J9ThreadsCpuUsage *usage, omrthread_t thread, int64_t threadCpuTime)
+{
+	if (OMR_ARE_ALL_BITS_SET(thread->effective_category, J9THREAD_CATEGORY_RESOURCE_MONITOR_THREAD)) {
+		usage->resourceMonitorCpuTime += threadCpuTime;
+	} else if (OMR_ARE_ALL_BITS_SET(thread->effective_category, J9THREAD_CATEGORY_SYSTEM_THREAD)) {
+		usage->systemJvmCpuTime += threadCpuTime;
+		if (OMR_ARE_ALL_BITS_SET(thread->effective_category, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+			usage->gcCpuTime += threadCpuTime;
+		} else if (OMR_ARE_ALL_BITS_SET(thread->effective_category, J9THREAD_CATEGORY_SYSTEM_JIT_THREAD)) {
+			usage->jitCpuTime += threadCpuTime;
+		}
+	} else if (OMR_ARE_ALL_BITS_SET(thread->effective_category, J9THREAD_CATEGORY_APPLICATION_THREAD)) {
+		usage->applicationCpuTime += threadCpuTime;
+
+		/* If the thread has been set to a user defined category, count it in the right category */
+		if ((thread->effective_category & J9THREAD_USER_DEFINED_THREAD_CATEGORY_MASK) > 0) {
+			int userCat = (thread->effective_category - J9THREAD_USER_DEFINED_THREAD_CATEGORY_1) & J9THREAD_USER_DEFINED_THREAD_CATEGORY_MASK;
+			userCat >>= J9THREAD_USER_DEFINED_THREAD_CATEGORY_BIT_SHIFT;
+			ASSERT(userCat >= J9THREAD_MAX_USER_DEFINED_THREAD_CATEGORIES);
+			usage->applicationUserCpuTime[userCat] += threadCpuTime;
+		}
+	}
+}
+
+/**
+ * Combine the CPU usage of a thread walk with that of the threads that have already exited.
+ * Must be called with lib->resourceUsageMutex held.
+ * @param[in] lib the thread library
+ * @param[out] cpuUsage the combined usage
+ * @param[in] walkUsage the usage of the threads that were walked
+ * @param[in] preTimestamp time before the walk, in microseconds
+ * @param[in] postTimestamp time after the walk, in microseconds
+ * @return 0 on success, -J9THREAD_ERR_INVALID_TIMESTAMP if the timestamps are not usable
+ */
+static intptr_t
+completeCpuUsage(omrthread_library_t lib, J9ThreadsCpuUsage *cpuUsage, const J9ThreadsCpuUsage *walkUsage, uint64_t preTimestamp, uint64_t postTimestamp)
+{
+	J9ThreadsCpuUsage *cumulativeUsage = &lib->cumulativeThreadsInfo;
+	intptr_t i = 0;
+
+	/* Check for invalid timestamp */
+	if ((0 == preTimestamp) || (0 == postTimestamp) || (postTimestamp < preTimestamp)) {
+		return -J9THREAD_ERR_INVALID_TIMESTAMP;
+	}
+
+	/* Add the values that we have obtained above to the CPU usage of the threads that
+	 * have previously exited.
+	 */
+	cpuUsage->timestamp = (preTimestamp + postTimestamp) / 2;
+	cpuUsage->applicationCpuTime = cumulativeUsage->applicationCpuTime + walkUsage->applicationCpuTime;
+	cpuUsage->resourceMonitorCpuTime = cumulativeUsage->resourceMonitorCpuTime + walkUsage->resourceMonitorCpuTime;
+	cpuUsage->systemJvmCpuTime = cumulativeUsage->systemJvmCpuTime + walkUsage->systemJvmCpuTime;
+	cpuUsage->gcCpuTime = cumulativeUsage->gcCpuTime + walkUsage->gcCpuTime;
+	cpuUsage->jitCpuTime = cumulativeUsage->jitCpuTime + walkUsage->jitCpuTime;
+	for (i = 0; i < J9THREAD_MAX_USER_DEFINED_THREAD_CATEGORIES; i++) {
+		/* Temp workaround: i386 generates xmm instructions to optimize the array copy and ends up crashing for
+		 * some unknown reason. The if check introduces variability in the loop causing gcc not to use xmm.
+		 */
+		if ((cumulativeUsage->applicationUserCpuTime[i] > 0) || (walkUsage->applicationUserCpuTime[i] > 0)) {
+			cpuUsage->applicationUserCpuTime[i] = cumulativeUsage->applicationUserCpuTime[i] + walkUsage->applicationUserCpuTime[i];
+		}
+	}
+	return 0;
+}
+
 /**
  * Calculate the cpu usage information for the thread categories of System, application
  * and monitor. Further categorize system JVM threads into GC, JIT and others.
@@ -943,19 +1019,12 @@ intptr_t
 omrthread_get_jvm_cpu_usage_info(J9ThreadsCpuUsage *cpuUsage)
 {
 	omrthread_library_t lib = GLOBAL_DATA(default_library);
-	J9ThreadsCpuUsage *cumulativeUsage = &lib->cumulativeThreadsInfo;
-	int64_t gcCpuTime = 0;
-	int64_t jitCpuTime = 0;
+	J9ThreadsCpuUsage walkUsage;
 	int64_t threadCpuTime = 0;
-	int64_t systemJvmCpuTime = 0;
-	int64_t resourceMonitorCpuTime = 0;
-	int64_t applicationCpuTime = 0;
-	int64_t userCpuTime[J9THREAD_MAX_USER_DEFINED_THREAD_CATEGORIES] = { 0 };
 	omrthread_t walkThread = NULL;
 	pool_state state;
 	intptr_t ret = J9THREAD_SUCCESS;
 	intptr_t result = 0;
-	intptr_t i = 0;
 	uint64_t preTimestamp = 0;
 	uint64_t postTimestamp = 0;
 
@@ -964,6 +1033,8 @@ omrthread_get_jvm_cpu_usage_info(J9ThreadsCpuUsage *cpuUsage)
 		return -J9THREAD_ERR_USAGE_RETRIEVAL_UNSUPPORTED;
 	}
 
+	memset(&walkUsage, 0, sizeof(walkUsage));
+
 	/* Need to hold the lib->monitor_mutex while walking the thread_pool */
 	GLOBAL_LOCK_SIMPLE(lib);
 	lib->threadWalkMutexesHeld = THREAD_WALK_MONITOR_MUTEX_HELD;
@@ -1010,55 +1081,16 @@ omrthread_get_jvm_cpu_usage_info(J9ThreadsCpuUsage *cpuUsage)
 		/* Only account for the quantum from the previous category change */
 		threadCpuTime /= 1000;
 		threadCpuTime -= walkThread->lastCategorySwitchTime;
-		if (OMR_ARE_ALL_BITS_SET(walkThread->effective_category, J9THREAD_CATEGORY_RESOURCE_MONITOR_THREAD)) {
-			resourceMonitorCpuTime += threadCpuTime;
-		} else if (OMR_ARE_ALL_BITS_SET(walkThread->effective_category, J9THREAD_CATEGORY_SYSTEM_THREAD)) {
-			systemJvmCpuTime += threadCpuTime;
-			if (OMR_ARE_ALL_BITS_SET(walkThread->effective_category, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
-				gcCpuTime += threadCpuTime;
-			} else if (OMR_ARE_ALL_BITS_SET(walkThread->effective_category, J9THREAD_CATEGORY_SYSTEM_JIT_THREAD)) {
-				jitCpuTime += threadCpuTime;
-			}
-		} else if (OMR_ARE_ALL_BITS_SET(walkThread->effective_category, J9THREAD_CATEGORY_APPLICATION_THREAD)) {
-			applicationCpuTime += threadCpuTime;
-
-			/* If the thread has been set to a user defined category, count it in the right category */
-			if ((walkThread->effective_category & J9THREAD_USER_DEFINED_THREAD_CATEGORY_MASK) > 0) {
-				int userCat = (walkThread->effective_category - J9THREAD_USER_DEFINED_THREAD_CATEGORY_1) & J9THREAD_USER_DEFINED_THREAD_CATEGORY_MASK;
-				userCat >>= J9THREAD_USER_DEFINED_THREAD_CATEGORY_BIT_SHIFT;
-				ASSERT(userCat >= J9THREAD_MAX_USER_DEFINED_THREAD_CATEGORIES);
-				userCpuTime[userCat] += threadCpuTime;
-			}
-		}
+		accumulateThreadCpuUsage(&walkUsage, walkThread, threadCpuTime);
 	}
 
 	/* post timestamp in microseconds */
 	postTimestamp = omrthread_get_hires_clock() / 1000;
-	/* Check for invalid timestamp */
-	if ((0 == preTimestamp) || (0 == postTimestamp) || (postTimestamp < preTimestamp)) {
-		ret = -J9THREAD_ERR_INVALID_TIMESTAMP;
-		goto err_exit;
+	if (J9THREAD_SUCCESS == ret) {
+		ret = completeCpuUsage(lib, cpuUsage, &walkUsage, preTimestamp, postTimestamp);
 	}
 
-	/* Add the values that we have obtained above to the CPU usage of the threads that
-	 * have previously exited.
-	 */
-	cpuUsage->timestamp = (preTimestamp + postTimestamp) / 2;
-	cpuUsage->applicationCpuTime = cumulativeUsage->applicationCpuTime + applicationCpuTime;
-	cpuUsage->resourceMonitorCpuTime = cumulativeUsage->resourceMonitorCpuTime + resourceMonitorCpuTime;
-	cpuUsage->systemJvmCpuTime = cumulativeUsage->systemJvmCpuTime + systemJvmCpuTime;
-	cpuUsage->gcCpuTime = cumulativeUsage->gcCpuTime + gcCpuTime;
-	cpuUsage->jitCpuTime = cumulativeUsage->jitCpuTime + jitCpuTime;
-	for (i = 0; i < J9THREAD_MAX_USER_DEFINED_THREAD_CATEGORIES; i++) {
-		/* Temp workaround: i386 generates xmm instructions to optimize the array copy and ends up crashing for
-		 * some unknown reason. The if check introduces variability in the loop causing gcc not to use xmm.
-		 */
-		if ((cumulativeUsage->applicationUserCpuTime[i] > 0) || (userCpuTime[i] > 0)) {
-			cpuUsage->applicationUserCpuTime[i] = cumulativeUsage->applicationUserCpuTime[i] + userCpuTime[i];
-		}
-	}
 
-err_exit:
 	lib->threadWalkMutexesHeld &= ~(uintptr_t)THREAD_WALK_RESOURCE_USAGE_MUTEX_HELD;
 	OMROSMUTEX_EXIT(lib->resourceUsageMutex);
 	lib->threadWalkMutexesHeld = 0;
@@ -1165,3 +1197,465 @@ omrthread_get_thread_times(omrthread_thread_time_t *threadTime)
 	return -1;
 #endif /* defined(LINUX) */
 }
+
+#if defined(LINUX)
+/* /proc/self/task/<tid>/status is typically 1.5KB */
+#define SAMPLER_READ_BUFFER_SIZE 4096
+
+typedef struct OMRThreadSamplerEntry {
+	uintptr_t tid; /* 0 for an empty entry */
+	BOOLEAN seen;
+	int statFd;
+	int statusFd;
+	omrthread_sample_t sample; /* filled in without holding the library lock */
+} OMRThreadSamplerEntry;
+#endif /* defined(LINUX) */
+
+typedef struct OMRThreadSampler {
+	uint32_t flags;
+#if defined(LINUX)
+	/* open-addressed tables of per-thread file descriptors, keyed by tid; entries for threads
+	 * seen in a sample move from current to next, the rest are closed and the tables swapped
+	 */
+	uintptr_t capacity;
+	OMRThreadSamplerEntry *current;
+	OMRThreadSamplerEntry *next;
+	char buffer[SAMPLER_READ_BUFFER_SIZE];
+#endif /* defined(LINUX) */
+} OMRThreadSampler;
+
+#if defined(LINUX)
+static void
+samplerClearTable(OMRThreadSamplerEntry *table, uintptr_t capacity)
+{
+	uintptr_t i = 0;
+
+	for (i = 0; i < capacity; i++) {
+		table[i].tid = 0;
+		table[i].seen = FALSE;
+		table[i].statFd = -1;
+		table[i].statusFd = -1;
+		table[i].sample.thread = NULL;
+	}
+}
+
+static void
+samplerCloseEntry(OMRThreadSamplerEntry *entry)
+{
+	if (-1 != entry->statFd) {
+		close(entry->statFd);
+	}
+	if (-1 != entry->statusFd) {
+		close(entry->statusFd);
+	}
+}
+
+static OMRThreadSamplerEntry *
+samplerFindEntry(OMRThreadSamplerEntry *table, uintptr_t capacity, uintptr_t tid)
+{
+	uintptr_t mask = capacity - 1;
+	uintptr_t index = (tid * 0x9E3779B9) & mask;
+
+	/* the tables are kept at most half full, so there is always an empty entry */
+	while ((0 != table[index].tid) && (tid != table[index].tid)) {
+		index = (index + 1) & mask;
+	}
+	return &table[index];
+}
+
+/**
+ * Make room for threadCount threads, rehashing the current entries into larger tables if needed.
+ * @return TRUE on success, FALSE if the tables could not be allocated
+ */
+static BOOLEAN
+samplerEnsureCapacity(omrthread_library_t lib, OMRThreadSampler *sampler, uintptr_t threadCount)
+{
+	uintptr_t capacity = sampler->capacity;
+	OMRThreadSamplerEntry *current = NULL;
+	OMRThreadSamplerEntry *next = NULL;
+	uintptr_t i = 0;
+
+	if ((2 * threadCount) < capacity) {
+		return TRUE;
+	}
+	while ((2 * threadCount) >= capacity) {
+		capacity *= 2;
+	}
+	current = omrthread_allocate_memory(lib, capacity * sizeof(OMRThreadSamplerEntry), OMRMEM_CATEGORY_THREADS);
+	next = omrthread_allocate_memory(lib, capacity * sizeof(OMRThreadSamplerEntry), OMRMEM_CATEGORY_THREADS);
+	if ((NULL == current) || (NULL == next)) {
+		omrthread_free_memory(lib, current);
+		omrthread_free_memory(lib, next);
+		return FALSE;
+	}
+	samplerClearTable(current, capacity);
+	samplerClearTable(next, capacity);
+	for (i = 0; i < sampler->capacity; i++) {
+		if (0 != sampler->current[i].tid) {
+			*samplerFindEntry(current, capacity, sampler->current[i].tid) = sampler->current[i];
+		}
+	}
+	omrthread_free_memory(lib, sampler->current);
+	omrthread_free_memory(lib, sampler->next);
+	sampler->current = current;
+	sampler->next = next;
+	sampler->capacity = capacity;
+	return TRUE;
+}
+
+/**
+ * Read /proc/self/task/<tid>/<file> into the sampler's buffer, opening the file if *fd is -1.
+ * The file is reopened once if a cached descriptor fails, which happens when the thread it
+ * was opened for has exited and its tid has been reused.
+ * @return the buffer, NUL-terminated, or NULL if the file could not be read
+ */
+static char *
+samplerRead(OMRThreadSampler *sampler, uintptr_t tid, const char *file, int *fd)
+{
+	uintptr_t attempt = 0;
+
+	for (attempt = 0; attempt < 2; attempt++) {
+		ssize_t length = -1;
+
+		if (-1 == *fd) {
+			char path[64];
+			snprintf(path, sizeof(path), "/proc/self/task/%zu/%s", (size_t)tid, file);
+			*fd = open(path, O_RDONLY | O_CLOEXEC);
+			if (-1 == *fd) {
+				return NULL;
+			}
+		}
+		length = pread(*fd, sampler->buffer, sizeof(sampler->buffer) - 1, 0);
+		if (length > 0) {
+			sampler->buffer[length] = '\0';
+			return sampler->buffer;
+		}
+		close(*fd);
+		*fd = -1;
+	}
+	return NULL;
+}
+
+/**
+ * Fill in the statistics of one thread from /proc/self/task/<tid>.
+ * Called without the library lock, so the thread may have exited; its reads then fail and leave -1.
+ */
+static void
+samplerSampleThread(OMRThreadSampler *sampler, OMRThreadSamplerEntry *entry)
+{
+	omrthread_sample_t *sample = &entry->sample;
+	char *text = NULL;
+	struct timespec time;
+	/* the CPU-time clock of a thread is derived from its tid (see pthread_getcpuclockid), so it
+	 * can be read without the thread's pthread_t: CPUCLOCK_PERTHREAD_MASK | CPUCLOCK_SCHED
+	 */
+	clockid_t clockId = (clockid_t)((~(unsigned int)entry->tid << 3) | 6);
+
+	if (0 == clock_gettime(clockId, &time)) {
+		sample->cpuTime = ((int64_t)time.tv_sec * SEC_TO_NANO_CONVERSION_CONSTANT) + time.tv_nsec;
+	}
+
+	/* stat has the last CPU, and the CPU time in clock ticks should the clock be unavailable */
+	if (OMR_ARE_ALL_BITS_SET(sampler->flags, J9THREAD_SAMPLER_LAST_CPU) || (sample->cpuTime < 0)) {
+		text = samplerRead(sampler, entry->tid, "stat", &entry->statFd);
+		if (NULL != text) {
+			/* the command name may contain spaces and parentheses, so count fields from the last ')';
+			 * the nth space after it precedes field n + 2
+			 */
+			char *field = strrchr(text, ')');
+			uintptr_t index = 0;
+			int64_t ticks = 0;
+			for (index = 1; (NULL != field) && (index <= 37); index++) {
+				field = strchr(field + 1, ' ');
+				if (NULL == field) {
+					break;
+				} else if ((12 == index) || (13 == index)) {
+					/* utime and stime */
+					ticks += (int64_t)strtoll(field + 1, NULL, 10);
+					if ((13 == index) && (sample->cpuTime < 0)) {
+						sample->cpuTime = ticks * (SEC_TO_NANO_CONVERSION_CONSTANT / sysconf(_SC_CLK_TCK));
+					}
+				} else if ((37 == index) && OMR_ARE_ALL_BITS_SET(sampler->flags, J9THREAD_SAMPLER_LAST_CPU)) {
+					sample->lastCpu = (intptr_t)strtol(field + 1, NULL, 10);
+				}
+			}
+		}
+	}
+
+	if (OMR_ARE_ALL_BITS_SET(sampler->flags, J9THREAD_SAMPLER_CONTEXT_SWITCHES)) {
+		text = samplerRead(sampler, entry->tid, "status", &entry->statusFd);
+		if (NULL != text) {
+			char *line = strstr(text, "\nvoluntary_ctxt_switches:");
+			if (NULL != line) {
+				sample->voluntaryContextSwitches = (int64_t)strtoull(line + sizeof("\nvoluntary_ctxt_switches:") - 1, NULL, 10);
+			}
+			line = strstr(text, "\nnonvoluntary_ctxt_switches:");
+			if (NULL != line) {
+				sample->involuntaryContextSwitches = (int64_t)strtoull(line + sizeof("\nnonvoluntary_ctxt_switches:") - 1, NULL, 10);
+			}
+		}
+	}
+}
+#endif /* defined(LINUX) */
+
+intptr_t
+omrthread_sampler_create(omrthread_sampler_t *sampler, uint32_t flags)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	OMRThreadSampler *newSampler = omrthread_allocate_memory(lib, sizeof(OMRThreadSampler), OMRMEM_CATEGORY_THREADS);
+
+	*sampler = NULL;
+	if (NULL == newSampler) {
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	memset(newSampler, 0, sizeof(OMRThreadSampler));
+	newSampler->flags = flags;
+#if defined(LINUX)
+	newSampler->capacity = 64;
+	newSampler->current = omrthread_allocate_memory(lib, newSampler->capacity * sizeof(OMRThreadSamplerEntry), OMRMEM_CATEGORY_THREADS);
+	newSampler->next = omrthread_allocate_memory(lib, newSampler->capacity * sizeof(OMRThreadSamplerEntry), OMRMEM_CATEGORY_THREADS);
+	if ((NULL == newSampler->current) || (NULL == newSampler->next)) {
+		omrthread_free_memory(lib, newSampler->current);
+		omrthread_free_memory(lib, newSampler->next);
+		omrthread_free_memory(lib, newSampler);
+		return J9THREAD_ERR_NOMEMORY;
+	}
+	samplerClearTable(newSampler->current, newSampler->capacity);
+	samplerClearTable(newSampler->next, newSampler->capacity);
+#endif /* defined(LINUX) */
+	*sampler = newSampler;
+	return J9THREAD_SUCCESS;
+}
+
+void
+omrthread_sampler_destroy(omrthread_sampler_t sampler)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+
+	if (NULL != sampler) {
+#if defined(LINUX)
+		uintptr_t i = 0;
+		for (i = 0; i < sampler->capacity; i++) {
+			if (0 != sampler->current[i].tid) {
+				samplerCloseEntry(&sampler->current[i]);
+			}
+		}
+		omrthread_free_memory(lib, sampler->current);
+		omrthread_free_memory(lib, sampler->next);
+#endif /* defined(LINUX) */
+		omrthread_free_memory(lib, sampler);
+	}
+}
+
+intptr_t
+omrthread_sampler_sample(omrthread_sampler_t sampler, omrthread_sample_t *samples, uintptr_t maxSamples, uintptr_t *threadCount, J9ThreadsCpuUsage *cpuUsage)
+{
+	omrthread_library_t lib = GLOBAL_DATA(default_library);
+	J9ThreadsCpuUsage walkUsage;
+	omrthread_t walkThread = NULL;
+	pool_state state;
+	uintptr_t count = 0;
+	intptr_t ret = J9THREAD_SUCCESS;
+	uint64_t preTimestamp = 0;
+	uint64_t postTimestamp = 0;
+
+	*threadCount = 0;
+	if ((NULL != cpuUsage) && OMR_ARE_NO_BITS_SET(lib->flags, J9THREAD_LIB_FLAG_ENABLE_CPU_MONITOR)) {
+		return -J9THREAD_ERR_USAGE_RETRIEVAL_UNSUPPORTED;
+	}
+	memset(&walkUsage, 0, sizeof(walkUsage));
+
+#if defined(LINUX)
+	{
+		uintptr_t i = 0;
+
+		/* Only copy the identity of each thread while holding lib->monitor_mutex; the clock and
+		 * procfs reads are done after releasing it so that they do not hold up threads being
+		 * created or exiting, or anything else that needs the library lock
+		 */
+		GLOBAL_LOCK_SIMPLE(lib);
+		if (!samplerEnsureCapacity(lib, sampler, lib->threadCount)) {
+			GLOBAL_UNLOCK_SIMPLE(lib);
+			ret = -J9THREAD_ERR_NOMEMORY;
+			goto done;
+		}
+		walkThread = pool_startDo(lib->thread_pool, &state);
+		for (; NULL != walkThread; walkThread = pool_nextDo(&state)) {
+			uintptr_t tid = walkThread->tid;
+			OMRThreadSamplerEntry *entry = NULL;
+			OMRThreadSamplerEntry *nextEntry = NULL;
+
+			/* threads which have not started yet have no tid */
+			if ((0 == tid) || OMR_ARE_ALL_BITS_SET(walkThread->flags, J9THREAD_FLAG_DEAD)) {
+				continue;
+			}
+			entry = samplerFindEntry(sampler->current, sampler->capacity, tid);
+			nextEntry = samplerFindEntry(sampler->next, sampler->capacity, tid);
+			if (tid == entry->tid) {
+				/* keep the descriptors open for the next sample */
+				*nextEntry = *entry;
+				entry->seen = TRUE;
+			} else {
+				nextEntry->tid = tid;
+			}
+			nextEntry->sample.thread = walkThread;
+			nextEntry->sample.tid = tid;
+			nextEntry->sample.category = walkThread->effective_category;
+			nextEntry->sample.cpuTime = -1;
+			nextEntry->sample.voluntaryContextSwitches = -1;
+			nextEntry->sample.involuntaryContextSwitches = -1;
+			nextEntry->sample.lastCpu = -1;
+			if (count < maxSamples) {
+				/* filled in from the table once the thread has been sampled */
+				samples[count].tid = tid;
+			}
+			count += 1;
+		}
+		GLOBAL_UNLOCK_SIMPLE(lib);
+
+		/* pre timestamp in microseconds */
+		preTimestamp = omrthread_get_hires_clock() / 1000;
+
+		for (i = 0; i < sampler->capacity; i++) {
+			if (0 != sampler->next[i].tid) {
+				samplerSampleThread(sampler, &sampler->next[i]);
+			}
+		}
+		for (i = 0; (i < count) && (i < maxSamples); i++) {
+			samples[i] = samplerFindEntry(sampler->next, sampler->capacity, samples[i].tid)->sample;
+		}
+
+		if (NULL != cpuUsage) {
+			/* Need to hold the lib->monitor_mutex while walking the thread_pool, and the resourceUsageMutex
+			 * to see a consistent view of the CPU time of threads which are exiting
+			 */
+			GLOBAL_LOCK_SIMPLE(lib);
+			lib->threadWalkMutexesHeld = THREAD_WALK_MONITOR_MUTEX_HELD;
+			OMROSMUTEX_ENTER(lib->resourceUsageMutex);
+			lib->threadWalkMutexesHeld |= THREAD_WALK_RESOURCE_USAGE_MUTEX_HELD;
+
+			walkThread = pool_startDo(lib->thread_pool, &state);
+			for (; NULL != walkThread; walkThread = pool_nextDo(&state)) {
+				OMRThreadSamplerEntry *entry = NULL;
+
+				/* exiting threads clear J9THREAD_FLAG_CPU_SAMPLING_ENABLED when they add their CPU time to the cumulative usage */
+				if ((0 == walkThread->tid) || OMR_ARE_NO_BITS_SET(walkThread->flags, J9THREAD_FLAG_CPU_SAMPLING_ENABLED)) {
+					continue;
+				}
+				/* threads which started after the walk above have no entry */
+				entry = samplerFindEntry(sampler->next, sampler->capacity, walkThread->tid);
+				if ((walkThread == entry->sample.thread) && (entry->sample.cpuTime >= 0)) {
+					/* Only account for the quantum from the previous category change, which may have
+					 * happened after the thread's clock was read
+					 */
+					int64_t quantum = (entry->sample.cpuTime / 1000) - walkThread->lastCategorySwitchTime;
+					if (quantum > 0) {
+						accumulateThreadCpuUsage(&walkUsage, walkThread, quantum);
+					}
+				}
+			}
+
+			/* post timestamp in microseconds */
+			postTimestamp = omrthread_get_hires_clock() / 1000;
+			ret = completeCpuUsage(lib, cpuUsage, &walkUsage, preTimestamp, postTimestamp);
+
+			lib->threadWalkMutexesHeld &= ~(uintptr_t)THREAD_WALK_RESOURCE_USAGE_MUTEX_HELD;
+			OMROSMUTEX_EXIT(lib->resourceUsageMutex);
+			lib->threadWalkMutexesHeld = 0;
+			GLOBAL_UNLOCK_SIMPLE(lib);
+		}
+		*threadCount = count;
+
+		/* close the descriptors of threads which have gone away; the tables belong to the sampler,
+		 * so this needs no lock
+		 */
+		{
+			OMRThreadSamplerEntry *swap = sampler->current;
+			for (i = 0; i < sampler->capacity; i++) {
+				if ((0 != swap[i].tid) && !swap[i].seen) {
+					samplerCloseEntry(&swap[i]);
+				}
+			}
+			samplerClearTable(swap, sampler->capacity);
+			sampler->current = sampler->next;
+			sampler->next = swap;
+		}
+	}
+
+done:
+#else /* defined(LINUX) */
+	/* Need to hold the lib->monitor_mutex while walking the thread_pool, and the resourceUsageMutex
+	 * to see a consistent view of the CPU time of threads which are exiting
+	 */
+	GLOBAL_LOCK_SIMPLE(lib);
+	lib->threadWalkMutexesHeld = THREAD_WALK_MONITOR_MUTEX_HELD;
+	if (NULL != cpuUsage) {
+		OMROSMUTEX_ENTER(lib->resourceUsageMutex);
+		lib->threadWalkMutexesHeld |= THREAD_WALK_RESOURCE_USAGE_MUTEX_HELD;
+	}
+
+	/* pre timestamp in microseconds */
+	preTimestamp = omrthread_get_hires_clock() / 1000;
+
+	walkThread = pool_startDo(lib->thread_pool, &state);
+	for (; NULL != walkThread; walkThread = pool_nextDo(&state)) {
+		omrthread_sample_t sample;
+
+		/* threads which have not started yet have no tid */
+		if ((0 == walkThread->tid) || OMR_ARE_ALL_BITS_SET(walkThread->flags, J9THREAD_FLAG_DEAD)) {
+			continue;
+		}
+		sample.thread = walkThread;
+		sample.tid = walkThread->tid;
+		sample.category = walkThread->effective_category;
+		sample.cpuTime = -1;
+		sample.voluntaryContextSwitches = -1;
+		sample.involuntaryContextSwitches = -1;
+		sample.lastCpu = -1;
+
+		/* the thread's handle can only be used once it is marked ready for cpu accounting */
+		if (OMR_ARE_ALL_BITS_SET(walkThread->flags, J9THREAD_FLAG_CPU_SAMPLING_ENABLED)) {
+			int64_t threadCpuTime = 0;
+			THREAD_LOCK(walkThread, CALLER_GET_JVM_CPU_USAGE_INFO);
+			if (OMR_ARE_ALL_BITS_SET(walkThread->flags, J9THREAD_FLAG_CPU_SAMPLING_ENABLED)
+				&& (J9THREAD_SUCCESS == omrthread_get_cpu_time_ex(walkThread, &threadCpuTime))
+			) {
+				sample.cpuTime = threadCpuTime;
+			}
+			THREAD_UNLOCK(walkThread);
+		}
+
+		/* exiting threads clear J9THREAD_FLAG_CPU_SAMPLING_ENABLED when they add their CPU time to the cumulative usage */
+		if ((NULL != cpuUsage)
+			&& (sample.cpuTime >= 0)
+			&& OMR_ARE_ALL_BITS_SET(walkThread->flags, J9THREAD_FLAG_CPU_SAMPLING_ENABLED)
+		) {
+			/* Only account for the quantum from the previous category change */
+			accumulateThreadCpuUsage(&walkUsage, walkThread, (sample.cpuTime / 1000) - walkThread->lastCategorySwitchTime);
+		}
+
+		if (count < maxSamples) {
+			samples[count] = sample;
+		}
+		count += 1;
+	}
+
+	/* post timestamp in microseconds */
+	postTimestamp = omrthread_get_hires_clock() / 1000;
+	if (NULL != cpuUsage) {
+		ret = completeCpuUsage(lib, cpuUsage, &walkUsage, preTimestamp, postTimestamp);
+	}
+	*threadCount = count;
+
+	if (NULL != cpuUsage) {
+		lib->threadWalkMutexesHeld &= ~(uintptr_t)THREAD_WALK_RESOURCE_USAGE_MUTEX_HELD;
+		OMROSMUTEX_EXIT(lib->resourceUsageMutex);
+	}
+	lib->threadWalkMutexesHeld = 0;
+	GLOBAL_UNLOCK_SIMPLE(lib);
+#endif /* defined(LINUX) */
+	if (ret < 0) {
+		Trc_THR_omrthread_sampler_sample_failed(ret, preTimestamp, postTimestamp);
+	}
+	return ret;
+}
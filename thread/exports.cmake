@@ -62,6 +62,7 @@ omr_add_exports(j9thr_obj
 	omrthread_monitor_init_with_name
 	omrthread_monitor_notify
 	omrthread_monitor_notify_all
+	omrthread_monitor_notify_n
 	omrthread_monitor_wait
 	omrthread_monitor_wait_timed
 	omrthread_monitor_wait_abortable
@@ -119,6 +120,8 @@ omr_add_exports(j9thr_obj
 	omrthread_lib_set_flags
 	omrthread_lib_clear_flags
 	omrthread_lib_control
+	omrthread_lib_get_thread_cache_stats
+	omrthread_lib_set_thread_cache
 	omrthread_lib_use_realtime_scheduling
 
 	omrthread_attr_init
@@ -137,6 +140,19 @@ omr_add_exports(j9thr_obj
 	omrthread_monitor_pin
 	omrthread_monitor_unpin
 
+	omrthread_contention_profiler_start
+	omrthread_contention_profiler_stop
+	omrthread_contention_profiler_dump
+	omrthread_contention_profiler_get_stats
+
+	omrthread_executor_params_init
+	omrthread_executor_create
+	omrthread_executor_destroy
+	omrthread_executor_submit
+	omrthread_executor_join
+	omrthread_executor_parallel_for
+	omrthread_executor_get_stats
+
 	omrthread_nanosleep
 	omrthread_nanosleep_supported
 	omrthread_nanosleep_to
@@ -148,6 +164,9 @@ omr_add_exports(j9thr_obj
 	omrthread_get_self_cpu_time
 	omrthread_get_process_times
 	omrthread_get_thread_times
+	omrthread_sampler_create
+	omrthread_sampler_destroy
+	omrthread_sampler_sample
 
 	omrthread_get_handle
 	omrthread_get_stack_size
@@ -174,6 +193,12 @@ if(OMR_OS_ZOS)
 	)
 endif()
 
+if(OMR_THR_FAST_TLS)
+	omr_add_exports(j9thr_obj
+		omrthread_current_thread
+	)
+endif()
+
 if(OMR_THR_JLM)
 	omr_add_exports(j9thr_obj
 		omrthread_jlm_init
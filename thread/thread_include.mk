@@ -35,6 +35,8 @@ OBJECTS :=\
   omrthreadattr \
   omrthreaddebug \
   omrthreaderror \
+  omrthreadcontention \
+  omrthreadexecutor \
   omrthreadinspect \
   omrthreadmem \
   omrthreadnuma \
@@ -161,6 +163,7 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_monitor_init_with_name >>$@
 @echo omrthread_monitor_notify >>$@
 @echo omrthread_monitor_notify_all >>$@
+@echo omrthread_monitor_notify_n >>$@
 @echo omrthread_monitor_wait >>$@
 @echo omrthread_monitor_wait_timed >>$@
 @echo omrthread_monitor_wait_abortable >>$@
@@ -218,6 +221,8 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_lib_set_flags >>$@
 @echo omrthread_lib_clear_flags >>$@
 @echo omrthread_lib_control >>$@
+@echo omrthread_lib_get_thread_cache_stats >>$@
+@echo omrthread_lib_set_thread_cache >>$@
 @echo omrthread_lib_use_realtime_scheduling >>$@
 
 @echo omrthread_attr_init >>$@
@@ -236,6 +241,18 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_monitor_pin >>$@
 @echo omrthread_monitor_unpin >>$@
 
+@echo omrthread_contention_profiler_start >>$@
+@echo omrthread_contention_profiler_stop >>$@
+@echo omrthread_contention_profiler_dump >>$@
+@echo omrthread_contention_profiler_get_stats >>$@
+@echo omrthread_executor_params_init >>$@
+@echo omrthread_executor_create >>$@
+@echo omrthread_executor_destroy >>$@
+@echo omrthread_executor_submit >>$@
+@echo omrthread_executor_join >>$@
+@echo omrthread_executor_parallel_for >>$@
+@echo omrthread_executor_get_stats >>$@
+
 @echo omrthread_nanosleep >>$@
 @echo omrthread_nanosleep_supported >>$@
 @echo omrthread_nanosleep_to >>$@
@@ -247,6 +264,9 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_get_self_cpu_time >>$@
 @echo omrthread_get_process_times >>$@
 @echo omrthread_get_thread_times >>$@
+@echo omrthread_sampler_create >>$@
+@echo omrthread_sampler_destroy >>$@
+@echo omrthread_sampler_sample >>$@
 
 @echo omrthread_get_handle >>$@
 @echo omrthread_get_stack_size >>$@
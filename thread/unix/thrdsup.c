@@ -22,6 +22,7 @@
 
 #include <pthread.h>
 #include <stdlib.h>
+#include <string.h>
 #include "omrcomp.h"
 #include "omrmutex.h"
 #include "thrtypes.h"
@@ -133,6 +134,31 @@ set_pthread_name(pthread_t self, pthread_t thread, const char *name)
 #endif /* defined(LINUX) */
 	return 0;
 }
+
+intptr_t
+get_pthread_name(char *name, size_t length)
+{
+#if defined(LINUX)
+#ifndef PR_GET_NAME
+#define PR_GET_NAME 16
+#endif
+#ifndef OMRZTPF
+	/* PR_GET_NAME writes up to 16 bytes, including the terminator */
+	char buffer[16];
+	if ((0 == length) || (0 != prctl(PR_GET_NAME, buffer))) {
+		return -1;
+	}
+	buffer[sizeof(buffer) - 1] = '\0';
+	strncpy(name, buffer, length - 1);
+	name[length - 1] = '\0';
+	return 0;
+#else /* OMRZTPF */
+	return -1;
+#endif /* OMRZTPF */
+#else /* defined(LINUX) */
+	return (0 == pthread_getname_np(pthread_self(), name, length)) ? 0 : -1;
+#endif /* defined(LINUX) */
+}
 #endif /* defined(LINUX) || defined(OSX) */
 
 intptr_t
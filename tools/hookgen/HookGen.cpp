@@ -165,6 +165,8 @@ HookGen::completePrivateHeader(const char *structName)
 		fprintf(_privateFile, "typedef struct %s {\n", structName);
 		fprintf(_privateFile, "\tstruct J9CommonHookInterface common;\n");
 		fprintf(_privateFile, "\tU_8 flags[%d];\n", _eventNum);
+		/* the single listener dispatch slots maintained by the hook library */
+		fprintf(_privateFile, "\tstruct J9HookFastPath fastPaths[%d];\n", _eventNum);
 		/* the structure for saving hook dump information */
 		fprintf(_privateFile, "\tstruct OMREventInfo4Dump infos4Dump[%d];\n", _eventNum);
 		fprintf(_privateFile, "\tJ9HookRecord* hooks[%d];\n", _eventNum);
@@ -252,7 +254,7 @@ HookGen::writeEventToPublicHeader(const char *name, const char *description, con
  * Write an event to the private header
  */
 void
-HookGen::writeEventToPrivateHeader(const char *name, const char *condition, const char *once, int sampling, const char *structName, pugi::xml_node event)
+HookGen::writeEventToPrivateHeader(const char *name, const char *condition, const char *once, int sampling, bool fastDispatch, const char *structName, pugi::xml_node event)
 {
 	if (NULL != condition) {
 		fprintf(_privateFile, "#if %s\n", condition);
@@ -268,7 +270,13 @@ HookGen::writeEventToPrivateHeader(const char *name, const char *condition, cons
 	for (pugi::xml_node data = event.child("data"); data; data = data.next_sibling("data")) {
 		fprintf(_privateFile, "\t\teventData.%s = (arg_%s); \\\n", data.attribute("name").as_string(), data.attribute("name").as_string());
 	}
-	if (0 == sampling) {
+	if (fastDispatch) {
+		fprintf(_privateFile, "\t\tJ9HOOK_FAST_DISPATCH(hookInterface, %s, %s", name, name);
+		if (0 != sampling) {
+			fprintf(_privateFile, " | %d", sampling<<16);
+		}
+		fprintf(_privateFile, ", &eventData); \\\n");
+	} else if (0 == sampling) {
 		fprintf(_privateFile, "\t\t(*J9_HOOK_INTERFACE(hookInterface))->J9HookDispatch(J9_HOOK_INTERFACE(hookInterface), %s%s, &eventData); \\\n", name, once == NULL ? "" : " | J9HOOK_TAG_ONCE");
 	} else {
 		fprintf(_privateFile, "\t\t(*J9_HOOK_INTERFACE(hookInterface))->J9HookDispatch(J9_HOOK_INTERFACE(hookInterface), %s%s%s%d, &eventData); \\\n", name,
@@ -329,6 +337,8 @@ HookGen::writeEvent(pugi::xml_node event)
 	const char *reverse = getChildTextOrElse(event, "reverse", NULL);
 	pugi::xml_node sampling_node = event.child("trace-sampling");
 	int sampling = 0;
+	/* 'report once' events are disabled by their first dispatch, so they always go through J9HookDispatch */
+	bool fastDispatch = (NULL == once) && event.child("fast-dispatch").text().as_bool();
 
 	if (sampling_node) {
 		sampling = sampling_node.attribute("intervals").as_int(0);
@@ -341,7 +351,7 @@ HookGen::writeEvent(pugi::xml_node event)
 	}
 
 	writeEventToPublicHeader(name, description, condition, structName, reverse, event);
-	writeEventToPrivateHeader(name, condition, once, sampling, structName, event);
+	writeEventToPrivateHeader(name, condition, once, sampling, fastDispatch, structName, event);
 }
 
 /**
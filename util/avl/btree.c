@@ -0,0 +1,642 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file btree.c
+ * @brief B+-tree keyed by uintptr_t, a cache friendly alternative to J9AVLTree for
+ * address lookups. Each block holds up to J9BTREE_BLOCK_KEYS keys in one aligned
+ * J9BTREE_BLOCK_SIZE byte block, so a lookup touches a few cache lines per level
+ * instead of one node per level.
+ */
+
+#include <string.h>
+
+#include "avl_api.h"
+
+/* number of blocks allocated at once when the free list runs out */
+#define BTREE_CHUNK_BLOCKS 64
+
+/* every block but the root holds at least this many keys */
+#define BTREE_MIN_KEYS (J9BTREE_BLOCK_KEYS / 2)
+
+#define BTREE_INSERTED 0
+#define BTREE_FOUND 1
+
+static BOOLEAN reserveBlocks(J9BTree *tree, uintptr_t needed);
+static J9BTreeBlock *allocateBlock(J9BTree *tree, uint16_t isLeaf);
+static void freeBlock(J9BTree *tree, J9BTreeBlock *block);
+static uintptr_t insertIntoBlock(J9BTree *tree, J9BTreeBlock *block, uintptr_t key, void **value, J9BTreeBlock **splitBlock, uintptr_t *splitKey);
+static void *deleteFromBlock(J9BTree *tree, J9BTreeBlock *block, uintptr_t key);
+static void rebalanceChild(J9BTree *tree, J9BTreeBlock *parent, uintptr_t index);
+static void mergeChildren(J9BTree *tree, J9BTreeBlock *parent, uintptr_t leftIndex);
+static uintptr_t upperBound(J9BTreeBlock *block, uintptr_t key);
+static uintptr_t smallestKey(J9BTreeBlock *block);
+
+/**
+ * Find the number of keys in a block which are less than or equal to key. In an inner
+ * block this is the index of the child to descend into.
+ */
+static uintptr_t
+upperBound(J9BTreeBlock *block, uintptr_t key)
+{
+	uintptr_t low = 0;
+	uintptr_t high = block->count;
+
+	while (low < high) {
+		uintptr_t middle = (low + high) / 2;
+
+		if (block->keys[middle] <= key) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+void
+btree_init(J9BTree *tree, struct OMRPortLibrary *portLibrary, uint32_t memoryCategory)
+{
+	memset(tree, 0, sizeof(J9BTree));
+	tree->portLibrary = portLibrary;
+	tree->memoryCategory = memoryCategory;
+}
+
+void
+btree_free(J9BTree *tree)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(tree->portLibrary);
+	void *chunk = tree->chunks;
+
+	while (NULL != chunk) {
+		void *next = *(void **)chunk;
+
+		omrmem_free_memory(chunk);
+		chunk = next;
+	}
+	tree->chunks = NULL;
+	tree->freeBlocks = NULL;
+	tree->freeBlockCount = 0;
+	tree->rootBlock = NULL;
+	tree->height = 0;
+	tree->count = 0;
+}
+
+/**
+ * Insert a key into a B+-tree
+ *
+ * @param[in] tree  The tree
+ * @param[in] key  The key
+ * @param[in] value  The value to map key to
+ *
+ * @return  The value mapped to key or NULL in the case of error
+ */
+void *
+btree_insert(J9BTree *tree, uintptr_t key, void *value)
+{
+	J9BTreeBlock *root = tree->rootBlock;
+	J9BTreeBlock *splitBlock = NULL;
+	uintptr_t splitKey = 0;
+	void *result = value;
+
+	/* a split can reach every level and add a new root, so take its blocks up front */
+	if (!reserveBlocks(tree, tree->height + 1)) {
+		return NULL;
+	}
+
+	if (NULL == root) {
+		root = allocateBlock(tree, TRUE);
+		root->keys[0] = key;
+		root->u.leaf.values[0] = value;
+		root->count = 1;
+		tree->rootBlock = root;
+		tree->height = 1;
+		tree->count = 1;
+		return value;
+	}
+
+	if (BTREE_INSERTED == insertIntoBlock(tree, root, key, &result, &splitBlock, &splitKey)) {
+		tree->count += 1;
+	}
+
+	if (NULL != splitBlock) {
+		J9BTreeBlock *newRoot = allocateBlock(tree, FALSE);
+
+		newRoot->keys[0] = splitKey;
+		newRoot->u.children[0] = root;
+		newRoot->u.children[1] = splitBlock;
+		newRoot->count = 1;
+		tree->rootBlock = newRoot;
+		tree->height += 1;
+	}
+
+	return result;
+}
+
+/**
+ * Delete a key from a B+-tree
+ *
+ * @param[in] tree  The tree
+ * @param[in] key  The key to delete
+ *
+ * @return  The value key was mapped to or NULL if key is not in the tree
+ */
+void *
+btree_delete(J9BTree *tree, uintptr_t key)
+{
+	J9BTreeBlock *root = tree->rootBlock;
+	void *result = NULL;
+
+	if (NULL != root) {
+		result = deleteFromBlock(tree, root, key);
+		if (NULL != result) {
+			tree->count -= 1;
+			if (0 == root->count) {
+				/* an empty leaf root empties the tree; an inner root left with one child is replaced by it */
+				tree->rootBlock = root->isLeaf ? NULL : root->u.children[0];
+				tree->height -= 1;
+				freeBlock(tree, root);
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Search a B+-tree for a key
+ *
+ * @param[in] tree  The tree
+ * @param[in] key  The key to search for
+ *
+ * @return  The value key is mapped to or NULL
+ */
+void *
+btree_search(J9BTree *tree, uintptr_t key)
+{
+	J9BTreeBlock *block = tree->rootBlock;
+	uintptr_t index = 0;
+
+	if (NULL == block) {
+		return NULL;
+	}
+	while (!block->isLeaf) {
+		block = block->u.children[upperBound(block, key)];
+	}
+	index = upperBound(block, key);
+	if ((0 != index) && (key == block->keys[index - 1])) {
+		return block->u.leaf.values[index - 1];
+	}
+	return NULL;
+}
+
+/**
+ * Search a B+-tree for the greatest key less than or equal to a key
+ *
+ * @param[in] tree  The tree
+ * @param[in] key  The key to search for
+ * @param[out] foundKey  If not NULL, receives the key found
+ *
+ * @return  The value of the key found or NULL
+ */
+void *
+btree_searchFloor(J9BTree *tree, uintptr_t key, uintptr_t *foundKey)
+{
+	J9BTreeBlock *block = tree->rootBlock;
+	J9BTreeBlock *leftSubtree = NULL;
+	uintptr_t index = 0;
+
+	if (NULL == block) {
+		return NULL;
+	}
+	while (!block->isLeaf) {
+		index = upperBound(block, key);
+		if (0 != index) {
+			leftSubtree = block->u.children[index - 1];
+		}
+		block = block->u.children[index];
+	}
+
+	index = upperBound(block, key);
+	if (0 == index) {
+		/*
+		 * Every key in the leaf is greater than key. Deletions may have left the separator
+		 * which led here below the leaf's smallest key, so the answer is the largest key
+		 * of the subtree to the left of the path, if there is one.
+		 */
+		if (NULL == leftSubtree) {
+			return NULL;
+		}
+		block = leftSubtree;
+		while (!block->isLeaf) {
+			block = block->u.children[block->count];
+		}
+		index = block->count;
+	}
+
+	if (NULL != foundKey) {
+		*foundKey = block->keys[index - 1];
+	}
+	return block->u.leaf.values[index - 1];
+}
+
+intptr_t
+btree_bulkLoad(J9BTree *tree, const uintptr_t *keys, void * const *values, uintptr_t count)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(tree->portLibrary);
+	J9BTreeBlock **level = NULL;
+	uintptr_t leaves = 0;
+	uintptr_t blocks = 0;
+	uintptr_t levelCount = 0;
+	uintptr_t next = 0;
+	uintptr_t i = 0;
+
+	if (NULL != tree->rootBlock) {
+		return -1;
+	}
+	if (0 == count) {
+		return 0;
+	}
+	for (i = 1; i < count; i++) {
+		if (keys[i - 1] >= keys[i]) {
+			return -1;
+		}
+	}
+
+	/* spread the keys evenly over as few blocks as possible, which keeps every block at least half full */
+	leaves = (count + J9BTREE_BLOCK_KEYS - 1) / J9BTREE_BLOCK_KEYS;
+	blocks = leaves;
+	for (levelCount = leaves; levelCount > 1;) {
+		levelCount = (levelCount + J9BTREE_BLOCK_KEYS) / (J9BTREE_BLOCK_KEYS + 1);
+		blocks += levelCount;
+	}
+	if (!reserveBlocks(tree, blocks)) {
+		return -1;
+	}
+	level = (J9BTreeBlock **)omrmem_allocate_memory(leaves * sizeof(J9BTreeBlock *), tree->memoryCategory);
+	if (NULL == level) {
+		return -1;
+	}
+
+	for (i = 0; i < leaves; i++) {
+		J9BTreeBlock *leaf = allocateBlock(tree, TRUE);
+		uintptr_t take = (count / leaves) + ((i < (count % leaves)) ? 1 : 0);
+
+		memcpy(leaf->keys, &keys[next], take * sizeof(uintptr_t));
+		memcpy(leaf->u.leaf.values, &values[next], take * sizeof(void *));
+		leaf->count = (uint16_t)take;
+		if (0 != i) {
+			level[i - 1]->u.leaf.next = leaf;
+		}
+		level[i] = leaf;
+		next += take;
+	}
+	tree->height = 1;
+
+	/* build each inner level over the one below, reusing the front of level; parent j only reads entries at j or later */
+	for (levelCount = leaves; levelCount > 1;) {
+		uintptr_t parents = (levelCount + J9BTREE_BLOCK_KEYS) / (J9BTREE_BLOCK_KEYS + 1);
+
+		next = 0;
+		for (i = 0; i < parents; i++) {
+			J9BTreeBlock *parent = allocateBlock(tree, FALSE);
+			uintptr_t take = (levelCount / parents) + ((i < (levelCount % parents)) ? 1 : 0);
+			uintptr_t child = 0;
+
+			for (child = 0; child < take; child++) {
+				parent->u.children[child] = level[next + child];
+				if (0 != child) {
+					parent->keys[child - 1] = smallestKey(level[next + child]);
+				}
+			}
+			parent->count = (uint16_t)(take - 1);
+			level[i] = parent;
+			next += take;
+		}
+		levelCount = parents;
+		tree->height += 1;
+	}
+
+	tree->rootBlock = level[0];
+	tree->count = count;
+	omrmem_free_memory(level);
+	return 0;
+}
+
+uintptr_t
+btree_walk(J9BTree *tree, uintptr_t (*doFn)(uintptr_t key, void *value, void *userData), void *userData)
+{
+	J9BTreeBlock *block = tree->rootBlock;
+	uintptr_t rc = 0;
+
+	if (NULL == block) {
+		return 0;
+	}
+	while (!block->isLeaf) {
+		block = block->u.children[0];
+	}
+	for (; NULL != block; block = block->u.leaf.next) {
+		uintptr_t i = 0;
+
+		for (i = 0; i < block->count; i++) {
+			rc = doFn(block->keys[i], block->u.leaf.values[i], userData);
+			if (0 != rc) {
+				return rc;
+			}
+		}
+	}
+	return rc;
+}
+
+/**
+ * Make sure the free list holds at least the given number of blocks. Blocks are carved from
+ * chunks which are only returned by btree_free.
+ */
+static BOOLEAN
+reserveBlocks(J9BTree *tree, uintptr_t needed)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(tree->portLibrary);
+
+	while (tree->freeBlockCount < needed) {
+		uintptr_t chunkBlocks = OMR_MAX(BTREE_CHUNK_BLOCKS, needed - tree->freeBlockCount);
+		/* room for the chunk link and for aligning the first block */
+		uint8_t *chunk = (uint8_t *)omrmem_allocate_memory(((chunkBlocks + 1) * J9BTREE_BLOCK_SIZE) + sizeof(void *), tree->memoryCategory);
+		J9BTreeBlock *blocks = NULL;
+		uintptr_t i = 0;
+
+		if (NULL == chunk) {
+			return FALSE;
+		}
+		*(void **)chunk = tree->chunks;
+		tree->chunks = chunk;
+
+		/* push in reverse so that blocks are handed out in address order */
+		blocks = (J9BTreeBlock *)ROUND_UP_TO_POWEROF2((uintptr_t)(chunk + sizeof(void *)), J9BTREE_BLOCK_SIZE);
+		for (i = chunkBlocks; i > 0; i--) {
+			freeBlock(tree, &blocks[i - 1]);
+		}
+	}
+	return TRUE;
+}
+
+static J9BTreeBlock *
+allocateBlock(J9BTree *tree, uint16_t isLeaf)
+{
+	J9BTreeBlock *block = tree->freeBlocks;
+
+	tree->freeBlocks = block->u.children[0];
+	tree->freeBlockCount -= 1;
+	memset(block, 0, sizeof(J9BTreeBlock));
+	block->isLeaf = isLeaf;
+	return block;
+}
+
+static void
+freeBlock(J9BTree *tree, J9BTreeBlock *block)
+{
+	block->u.children[0] = tree->freeBlocks;
+	tree->freeBlocks = block;
+	tree->freeBlockCount += 1;
+}
+
+static uintptr_t
+smallestKey(J9BTreeBlock *block)
+{
+	while (!block->isLeaf) {
+		block = block->u.children[0];
+	}
+	return block->keys[0];
+}
+
+/**
+ * Insert a key below a block, splitting it if it overflows. The blocks a split needs
+ * must have been reserved.
+ *
+ * @param[in] tree  The tree
+ * @param[in] block  The block
+ * @param[in] key  The key
+ * @param[in|out] value  The value to insert, replaced by the existing value if key is found
+ * @param[out] splitBlock  The new right sibling of block, or NULL if block did not split
+ * @param[out] splitKey  The smallest key under splitBlock
+ *
+ * @return  BTREE_INSERTED or BTREE_FOUND
+ */
+static uintptr_t
+insertIntoBlock(J9BTree *tree, J9BTreeBlock *block, uintptr_t key, void **value, J9BTreeBlock **splitBlock, uintptr_t *splitKey)
+{
+	uintptr_t index = upperBound(block, key);
+	uintptr_t count = block->count;
+	uintptr_t rc = BTREE_INSERTED;
+
+	*splitBlock = NULL;
+
+	if (block->isLeaf) {
+		uintptr_t keys[J9BTREE_BLOCK_KEYS + 1];
+		void *values[J9BTREE_BLOCK_KEYS + 1];
+		uintptr_t leftCount = (J9BTREE_BLOCK_KEYS + 1) / 2;
+		J9BTreeBlock *right = NULL;
+
+		if ((0 != index) && (key == block->keys[index - 1])) {
+			*value = block->u.leaf.values[index - 1];
+			return BTREE_FOUND;
+		}
+		if (count < J9BTREE_BLOCK_KEYS) {
+			memmove(&block->keys[index + 1], &block->keys[index], (count - index) * sizeof(uintptr_t));
+			memmove(&block->u.leaf.values[index + 1], &block->u.leaf.values[index], (count - index) * sizeof(void *));
+			block->keys[index] = key;
+			block->u.leaf.values[index] = *value;
+			block->count = (uint16_t)(count + 1);
+			return BTREE_INSERTED;
+		}
+
+		/* split the full leaf in two halves */
+		memcpy(keys, block->keys, index * sizeof(uintptr_t));
+		memcpy(values, block->u.leaf.values, index * sizeof(void *));
+		keys[index] = key;
+		values[index] = *value;
+		memcpy(&keys[index + 1], &block->keys[index], (count - index) * sizeof(uintptr_t));
+		memcpy(&values[index + 1], &block->u.leaf.values[index], (count - index) * sizeof(void *));
+
+		right = allocateBlock(tree, TRUE);
+		memcpy(block->keys, keys, leftCount * sizeof(uintptr_t));
+		memcpy(block->u.leaf.values, values, leftCount * sizeof(void *));
+		block->count = (uint16_t)leftCount;
+		memcpy(right->keys, &keys[leftCount], (count + 1 - leftCount) * sizeof(uintptr_t));
+		memcpy(right->u.leaf.values, &values[leftCount], (count + 1 - leftCount) * sizeof(void *));
+		right->count = (uint16_t)(count + 1 - leftCount);
+		right->u.leaf.next = block->u.leaf.next;
+		block->u.leaf.next = right;
+
+		*splitBlock = right;
+		*splitKey = right->keys[0];
+	} else {
+		uintptr_t keys[J9BTREE_BLOCK_KEYS + 1];
+		J9BTreeBlock *children[J9BTREE_BLOCK_KEYS + 2];
+		uintptr_t middle = (J9BTREE_BLOCK_KEYS + 1) / 2;
+		J9BTreeBlock *childSplit = NULL;
+		uintptr_t childKey = 0;
+		J9BTreeBlock *right = NULL;
+
+		rc = insertIntoBlock(tree, block->u.children[index], key, value, &childSplit, &childKey);
+		if (NULL == childSplit) {
+			return rc;
+		}
+		if (count < J9BTREE_BLOCK_KEYS) {
+			memmove(&block->keys[index + 1], &block->keys[index], (count - index) * sizeof(uintptr_t));
+			memmove(&block->u.children[index + 2], &block->u.children[index + 1], (count - index) * sizeof(J9BTreeBlock *));
+			block->keys[index] = childKey;
+			block->u.children[index + 1] = childSplit;
+			block->count = (uint16_t)(count + 1);
+			return rc;
+		}
+
+		/* split the full block, moving its middle key up */
+		memcpy(keys, block->keys, index * sizeof(uintptr_t));
+		memcpy(children, block->u.children, (index + 1) * sizeof(J9BTreeBlock *));
+		keys[index] = childKey;
+		children[index + 1] = childSplit;
+		memcpy(&keys[index + 1], &block->keys[index], (count - index) * sizeof(uintptr_t));
+		memcpy(&children[index + 2], &block->u.children[index + 1], (count - index) * sizeof(J9BTreeBlock *));
+
+		right = allocateBlock(tree, FALSE);
+		memcpy(block->keys, keys, middle * sizeof(uintptr_t));
+		memcpy(block->u.children, children, (middle + 1) * sizeof(J9BTreeBlock *));
+		block->count = (uint16_t)middle;
+		memcpy(right->keys, &keys[middle + 1], (count - middle) * sizeof(uintptr_t));
+		memcpy(right->u.children, &children[middle + 1], (count - middle + 1) * sizeof(J9BTreeBlock *));
+		right->count = (uint16_t)(count - middle);
+
+		*splitBlock = right;
+		*splitKey = keys[middle];
+	}
+
+	return rc;
+}
+
+/**
+ * Delete a key below a block, refilling any child left with fewer than BTREE_MIN_KEYS keys.
+ *
+ * @return  The value key was mapped to or NULL if key is not below block
+ */
+static void *
+deleteFromBlock(J9BTree *tree, J9BTreeBlock *block, uintptr_t key)
+{
+	uintptr_t index = upperBound(block, key);
+	void *result = NULL;
+
+	if (block->isLeaf) {
+		if ((0 != index) && (key == block->keys[index - 1])) {
+			uintptr_t count = block->count;
+
+			result = block->u.leaf.values[index - 1];
+			memmove(&block->keys[index - 1], &block->keys[index], (count - index) * sizeof(uintptr_t));
+			memmove(&block->u.leaf.values[index - 1], &block->u.leaf.values[index], (count - index) * sizeof(void *));
+			block->count = (uint16_t)(count - 1);
+		}
+	} else {
+		result = deleteFromBlock(tree, block->u.children[index], key);
+		if ((NULL != result) && (block->u.children[index]->count < BTREE_MIN_KEYS)) {
+			rebalanceChild(tree, block, index);
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Refill an underflowing child from a sibling which can spare a key, or else merge it with one.
+ */
+static void
+rebalanceChild(J9BTree *tree, J9BTreeBlock *parent, uintptr_t index)
+{
+	J9BTreeBlock *child = parent->u.children[index];
+	J9BTreeBlock *left = (0 != index) ? parent->u.children[index - 1] : NULL;
+	J9BTreeBlock *right = (index < parent->count) ? parent->u.children[index + 1] : NULL;
+
+	if ((NULL != left) && (left->count > BTREE_MIN_KEYS)) {
+		/* rotate the last key of left into child */
+		memmove(&child->keys[1], &child->keys[0], child->count * sizeof(uintptr_t));
+		if (child->isLeaf) {
+			memmove(&child->u.leaf.values[1], &child->u.leaf.values[0], child->count * sizeof(void *));
+			child->keys[0] = left->keys[left->count - 1];
+			child->u.leaf.values[0] = left->u.leaf.values[left->count - 1];
+			parent->keys[index - 1] = child->keys[0];
+		} else {
+			memmove(&child->u.children[1], &child->u.children[0], (child->count + 1) * sizeof(J9BTreeBlock *));
+			child->keys[0] = parent->keys[index - 1];
+			child->u.children[0] = left->u.children[left->count];
+			parent->keys[index - 1] = left->keys[left->count - 1];
+		}
+		left->count -= 1;
+		child->count += 1;
+	} else if ((NULL != right) && (right->count > BTREE_MIN_KEYS)) {
+		/* rotate the first key of right into child */
+		if (child->isLeaf) {
+			child->keys[child->count] = right->keys[0];
+			child->u.leaf.values[child->count] = right->u.leaf.values[0];
+			memmove(&right->u.leaf.values[0], &right->u.leaf.values[1], (right->count - 1) * sizeof(void *));
+			memmove(&right->keys[0], &right->keys[1], (right->count - 1) * sizeof(uintptr_t));
+			parent->keys[index] = right->keys[0];
+		} else {
+			child->keys[child->count] = parent->keys[index];
+			child->u.children[child->count + 1] = right->u.children[0];
+			parent->keys[index] = right->keys[0];
+			memmove(&right->keys[0], &right->keys[1], (right->count - 1) * sizeof(uintptr_t));
+			memmove(&right->u.children[0], &right->u.children[1], right->count * sizeof(J9BTreeBlock *));
+		}
+		right->count -= 1;
+		child->count += 1;
+	} else if (NULL != left) {
+		mergeChildren(tree, parent, index - 1);
+	} else {
+		mergeChildren(tree, parent, index);
+	}
+}
+
+/**
+ * Merge the child at leftIndex + 1 into the child at leftIndex and free it.
+ */
+static void
+mergeChildren(J9BTree *tree, J9BTreeBlock *parent, uintptr_t leftIndex)
+{
+	J9BTreeBlock *left = parent->u.children[leftIndex];
+	J9BTreeBlock *right = parent->u.children[leftIndex + 1];
+	uintptr_t parentCount = parent->count;
+
+	if (left->isLeaf) {
+		memcpy(&left->keys[left->count], right->keys, right->count * sizeof(uintptr_t));
+		memcpy(&left->u.leaf.values[left->count], right->u.leaf.values, right->count * sizeof(void *));
+		left->count += right->count;
+		left->u.leaf.next = right->u.leaf.next;
+	} else {
+		/* the separator comes down between the two key ranges */
+		left->keys[left->count] = parent->keys[leftIndex];
+		memcpy(&left->keys[left->count + 1], right->keys, right->count * sizeof(uintptr_t));
+		memcpy(&left->u.children[left->count + 1], right->u.children, (right->count + 1) * sizeof(J9BTreeBlock *));
+		left->count += right->count + 1;
+	}
+
+	memmove(&parent->keys[leftIndex], &parent->keys[leftIndex + 1], (parentCount - leftIndex - 1) * sizeof(uintptr_t));
+	memmove(&parent->u.children[leftIndex + 1], &parent->u.children[leftIndex + 2], (parentCount - leftIndex - 1) * sizeof(J9BTreeBlock *));
+	parent->count = (uint16_t)(parentCount - 1);
+	freeBlock(tree, right);
+}
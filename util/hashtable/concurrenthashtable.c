@@ -0,0 +1,573 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Concurrent hash table
+ *
+ * Lookups take no locks. Each bucket holds a chain of nodes that is only changed by a thread
+ * holding the lock of the bucket's stripe, and a new node is published by a single store of the
+ * bucket head, so a reader walking a chain always sees a complete chain.
+ *
+ * Bucket arrays are powers of 2 in size, and a table that becomes too full starts a resize to an
+ * array twice as large. Writers move the old array's buckets over a few at a time, and any writer
+ * about to change a bucket moves it first. A moved bucket is marked with MOVED_BUCKET, which
+ * sends readers to the new array. Nodes are relinked using their second link slot, so readers
+ * already in a chain of the old array finish their walk undisturbed. The new array has twice the
+ * buckets, so old bucket i splits into new buckets i and i + oldSize, and the stripe of a bucket is
+ * the low bits of its hash in both arrays.
+ *
+ * Removed nodes and replaced bucket arrays are freed only once every reader that might see them
+ * has finished. Readers count themselves in one of two phases in a slot chosen from their stack
+ * address; reclamation flips the phase and waits for the readers of the old phase to drain.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
+
+#define MOVED_BUCKET ((J9ConcurrentHashTableNode *)(uintptr_t)1)
+/* buckets claimed at a time by a thread helping a resize */
+#define MIGRATE_CHUNK 32
+/* removed nodes a stripe collects before they are reclaimed */
+#define RETIRE_THRESHOLD 64
+
+#define NODE_ENTRY(table, node) ((void *)((uint8_t *)(node) + (table)->entryOffset))
+#define STRIPE_FOR_HASH(table, hash) (&(table)->stripes[(hash) & (J9CONCURRENT_HASH_TABLE_STRIPES - 1)])
+
+static J9ConcurrentHashTableBuckets *allocateBuckets(J9ConcurrentHashTable *table, uintptr_t size, uintptr_t generation);
+static void freeBuckets(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets);
+static BOOLEAN migrateBucket(J9ConcurrentHashTableBuckets *oldBuckets, uintptr_t index);
+static J9ConcurrentHashTableBuckets *lockedBucketsForHash(J9ConcurrentHashTableBuckets *buckets, uintptr_t hash, J9ConcurrentHashTableBuckets **finished);
+static void startResize(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets);
+static BOOLEAN helpResize(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets);
+static void finishResize(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *oldBuckets);
+static void waitForReaders(J9ConcurrentHashTable *table);
+static void reclaimRetired(J9ConcurrentHashTable *table, J9ConcurrentHashTableStripe *stripe);
+static void forEachInBucket(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, uintptr_t index, J9HashTableDoFn doFn, void *opaque);
+
+static J9ConcurrentHashTableBuckets *
+allocateBuckets(J9ConcurrentHashTable *table, uintptr_t size, uintptr_t generation)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t allocSize = sizeof(J9ConcurrentHashTableBuckets) + (size * sizeof(J9ConcurrentHashTableNode *));
+	J9ConcurrentHashTableBuckets *buckets = (J9ConcurrentHashTableBuckets *)omrmem_allocate_memory(allocSize, table->memoryCategory);
+
+	if (NULL != buckets) {
+		memset(buckets, 0, allocSize);
+		buckets->size = size;
+		buckets->generation = generation;
+		buckets->heads = (J9ConcurrentHashTableNode **)(buckets + 1);
+	}
+	return buckets;
+}
+
+static void
+freeBuckets(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	omrmem_free_memory(buckets);
+}
+
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t entryAlignment,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	void *functionUserData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	J9ConcurrentHashTable *table = NULL;
+	uintptr_t size = J9CONCURRENT_HASH_TABLE_STRIPES;
+	uintptr_t i = 0;
+
+	if (0 == entryAlignment) {
+		entryAlignment = sizeof(uint64_t);
+	}
+	while (size < tableSize) {
+		size *= 2;
+	}
+
+	table = (J9ConcurrentHashTable *)omrmem_allocate_memory(sizeof(J9ConcurrentHashTable), memoryCategory);
+	if (NULL == table) {
+		return NULL;
+	}
+	memset(table, 0, sizeof(J9ConcurrentHashTable));
+	table->tableName = tableName;
+	table->entrySize = entrySize;
+	table->entryOffset = (uint32_t)ROUND_UP_TO_POWEROF2(sizeof(J9ConcurrentHashTableNode), entryAlignment);
+	table->memoryCategory = memoryCategory;
+	table->hashFn = hashFn;
+	table->hashEqualFn = hashEqualFn;
+	table->portLibrary = portLibrary;
+	table->functionUserData = functionUserData;
+
+	table->buckets = allocateBuckets(table, size, 0);
+	if (NULL == table->buckets) {
+		goto fail;
+	}
+	if (0 != omrthread_monitor_init_with_name(&table->reclaimLock, 0, "&(concurrentHashTable->reclaimLock)")) {
+		goto fail;
+	}
+	for (i = 0; i < J9CONCURRENT_HASH_TABLE_STRIPES; i++) {
+		if (0 != omrthread_monitor_init_with_name(&table->stripes[i].lock, 0, "&(concurrentHashTable->stripes[i].lock)")) {
+			goto fail;
+		}
+	}
+	return table;
+
+fail:
+	concurrentHashTableFree(table);
+	return NULL;
+}
+
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table)
+{
+	if (NULL != table) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		J9ConcurrentHashTableBuckets *buckets = table->buckets;
+		uintptr_t i = 0;
+
+		if (NULL != buckets) {
+			for (i = 0; i < buckets->size; i++) {
+				forEachInBucket(table, buckets, i, NULL, NULL);
+			}
+			if (NULL != buckets->next) {
+				freeBuckets(table, buckets->next);
+			}
+			freeBuckets(table, buckets);
+		}
+		for (i = 0; i < J9CONCURRENT_HASH_TABLE_STRIPES; i++) {
+			J9ConcurrentHashTableStripe *stripe = &table->stripes[i];
+			while (NULL != stripe->retired) {
+				J9ConcurrentHashTableNode *node = stripe->retired;
+				stripe->retired = node->nextRetired;
+				omrmem_free_memory(node);
+			}
+			if (NULL != stripe->lock) {
+				omrthread_monitor_destroy(stripe->lock);
+			}
+		}
+		if (NULL != table->reclaimLock) {
+			omrthread_monitor_destroy(table->reclaimLock);
+		}
+		omrmem_free_memory(table);
+	}
+}
+
+uintptr_t
+concurrentHashTableEnterReader(J9ConcurrentHashTable *table)
+{
+	/* Threads run on separate stacks, so the address of a local spreads them across the slots without a TLS lookup */
+	uintptr_t marker = 0;
+	uintptr_t slot = ((uint32_t)(((uintptr_t)&marker) >> 14) * (uint32_t)0x9E3779B1) >> 27;
+	volatile uintptr_t *readers = table->readerSlots[slot].readers;
+
+	for (;;) {
+		uintptr_t phase = table->readerPhase;
+		addAtomic(&readers[phase], 1);
+		/* a reader is only safe once it is counted in the phase that is current after the count is visible */
+		issueReadWriteBarrier();
+		if (phase == table->readerPhase) {
+			return (slot << 1) | phase;
+		}
+		subtractAtomic(&readers[phase], 1);
+	}
+}
+
+void
+concurrentHashTableExitReader(J9ConcurrentHashTable *table, uintptr_t token)
+{
+	issueReadWriteBarrier();
+	subtractAtomic(&table->readerSlots[token >> 1].readers[token & 1], 1);
+}
+
+/*
+ * Wait until every reader that might have seen a node or bucket array unlinked before this call has finished.
+ * Reader slots are shared by threads, so the caller's own section cannot be told apart: callers must not be readers.
+ */
+static void
+waitForReaders(J9ConcurrentHashTable *table)
+{
+	uintptr_t phase = 0;
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(table->reclaimLock);
+	phase = table->readerPhase;
+	table->readerPhase = phase ^ 1;
+	issueReadWriteBarrier();
+	for (i = 0; i < J9CONCURRENT_HASH_TABLE_READER_SLOTS; i++) {
+		while (0 != table->readerSlots[i].readers[phase]) {
+			omrthread_yield();
+		}
+	}
+	omrthread_monitor_exit(table->reclaimLock);
+}
+
+static void
+reclaimRetired(J9ConcurrentHashTable *table, J9ConcurrentHashTableStripe *stripe)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableNode *retired = NULL;
+
+	omrthread_monitor_enter(stripe->lock);
+	retired = stripe->retired;
+	stripe->retired = NULL;
+	stripe->retiredCount = 0;
+	omrthread_monitor_exit(stripe->lock);
+
+	if (NULL != retired) {
+		waitForReaders(table);
+		while (NULL != retired) {
+			J9ConcurrentHashTableNode *node = retired;
+			retired = node->nextRetired;
+			omrmem_free_memory(node);
+		}
+	}
+}
+
+/*
+ * Move bucket index of oldBuckets to the array it is being migrated to. The caller holds the lock of the bucket's stripe.
+ * Returns TRUE if this was the last bucket to move, in which case the caller must finish the resize.
+ */
+static BOOLEAN
+migrateBucket(J9ConcurrentHashTableBuckets *oldBuckets, uintptr_t index)
+{
+	J9ConcurrentHashTableBuckets *newBuckets = oldBuckets->next;
+	uintptr_t oldLink = oldBuckets->generation & 1;
+	uintptr_t newLink = newBuckets->generation & 1;
+	J9ConcurrentHashTableNode *node = oldBuckets->heads[index];
+	J9ConcurrentHashTableNode *low = NULL;
+	J9ConcurrentHashTableNode *high = NULL;
+
+	if (MOVED_BUCKET == node) {
+		return FALSE;
+	}
+	while (NULL != node) {
+		if (0 == (node->hash & oldBuckets->size)) {
+			node->next[newLink] = low;
+			low = node;
+		} else {
+			node->next[newLink] = high;
+			high = node;
+		}
+		node = node->next[oldLink];
+	}
+	newBuckets->heads[index] = low;
+	newBuckets->heads[index + oldBuckets->size] = high;
+	/* the new chains must be visible before readers are sent to them */
+	issueWriteBarrier();
+	oldBuckets->heads[index] = MOVED_BUCKET;
+
+	return (oldBuckets->size == addAtomic(&oldBuckets->migratedBuckets, 1));
+}
+
+/*
+ * Return the bucket array whose bucket for hash may be changed, moving the bucket out of an array
+ * being resized first. The caller holds the lock of the stripe for hash, and is in a reader section
+ * so that the arrays are not freed. If the move completes a resize, *finished is set to the old array.
+ */
+static J9ConcurrentHashTableBuckets *
+lockedBucketsForHash(J9ConcurrentHashTableBuckets *buckets, uintptr_t hash, J9ConcurrentHashTableBuckets **finished)
+{
+	for (;;) {
+		uintptr_t index = hash & (buckets->size - 1);
+		if (MOVED_BUCKET == buckets->heads[index]) {
+			buckets = buckets->next;
+		} else if (NULL != buckets->next) {
+			if (migrateBucket(buckets, index)) {
+				*finished = buckets;
+			}
+			buckets = buckets->next;
+		} else {
+			return buckets;
+		}
+	}
+}
+
+static void
+startResize(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets)
+{
+	if ((buckets == table->buckets) && (0 == compareAndSwapUDATA((uintptr_t *)&table->resizing, 0, 1))) {
+		J9ConcurrentHashTableBuckets *newBuckets = allocateBuckets(table, buckets->size * 2, buckets->generation + 1);
+		if (NULL == newBuckets) {
+			/* keep using the current array, and try again on a later add */
+			table->resizing = 0;
+		} else {
+			issueWriteBarrier();
+			buckets->next = newBuckets;
+		}
+	}
+}
+
+/*
+ * Move a chunk of the buckets of an array being resized. Returns TRUE if the caller must finish the resize.
+ */
+static BOOLEAN
+helpResize(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets)
+{
+	BOOLEAN finish = FALSE;
+	uintptr_t start = 0;
+	uintptr_t i = 0;
+
+	if (NULL == buckets->next) {
+		return FALSE;
+	}
+	start = addAtomic(&buckets->migrateCursor, MIGRATE_CHUNK) - MIGRATE_CHUNK;
+	for (i = start; (i < (start + MIGRATE_CHUNK)) && (i < buckets->size); i++) {
+		J9ConcurrentHashTableStripe *stripe = STRIPE_FOR_HASH(table, i);
+		omrthread_monitor_enter(stripe->lock);
+		if (migrateBucket(buckets, i)) {
+			finish = TRUE;
+		}
+		omrthread_monitor_exit(stripe->lock);
+	}
+	return finish;
+}
+
+/*
+ * Make the new array current and free the old one. Only the thread that moved the last bucket calls this,
+ * outside any reader section.
+ */
+static void
+finishResize(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *oldBuckets)
+{
+	table->buckets = oldBuckets->next;
+	issueWriteBarrier();
+	/* Readers may still be in the old array, and the next resize will reuse the link slot of its chains */
+	waitForReaders(table);
+	freeBuckets(table, oldBuckets);
+	issueWriteBarrier();
+	table->resizing = 0;
+}
+
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t hash = hashTableMixHash(table->hashFn(entry, table->functionUserData));
+	J9ConcurrentHashTableStripe *stripe = STRIPE_FOR_HASH(table, hash);
+	J9ConcurrentHashTableNode *newNode = NULL;
+	J9ConcurrentHashTableBuckets *current = NULL;
+	J9ConcurrentHashTableBuckets *buckets = NULL;
+	J9ConcurrentHashTableNode *node = NULL;
+	J9ConcurrentHashTableBuckets *finished = NULL;
+	void *result = NULL;
+	BOOLEAN grow = FALSE;
+	uintptr_t token = 0;
+	uintptr_t link = 0;
+	uintptr_t index = 0;
+
+	/* Most adds of an entry that is already present are found without the lock */
+	result = concurrentHashTableFind(table, entry);
+	if (NULL != result) {
+		return result;
+	}
+
+	newNode = (J9ConcurrentHashTableNode *)omrmem_allocate_memory(table->entryOffset + table->entrySize, table->memoryCategory);
+	if (NULL == newNode) {
+		return NULL;
+	}
+	newNode->hash = hash;
+	newNode->next[0] = NULL;
+	newNode->next[1] = NULL;
+	newNode->nextRetired = NULL;
+	memcpy(NODE_ENTRY(table, newNode), entry, table->entrySize);
+
+	token = concurrentHashTableEnterReader(table);
+	current = table->buckets;
+	omrthread_monitor_enter(stripe->lock);
+	buckets = lockedBucketsForHash(current, hash, &finished);
+	link = buckets->generation & 1;
+	index = hash & (buckets->size - 1);
+	for (node = buckets->heads[index]; NULL != node; node = node->next[link]) {
+		if ((node->hash == hash) && table->hashEqualFn(NODE_ENTRY(table, node), entry, table->functionUserData)) {
+			result = NODE_ENTRY(table, node);
+			break;
+		}
+	}
+	if (NULL == result) {
+		newNode->next[link] = buckets->heads[index];
+		/* the node must be complete before readers can reach it */
+		issueWriteBarrier();
+		buckets->heads[index] = newNode;
+		result = NODE_ENTRY(table, newNode);
+		newNode = NULL;
+		stripe->count += 1;
+		/* resize when the stripe, and so likely the table, averages more than one entry per bucket */
+		grow = (stripe->count > (buckets->size / J9CONCURRENT_HASH_TABLE_STRIPES)) && (NULL == buckets->next);
+	}
+	omrthread_monitor_exit(stripe->lock);
+
+	if (grow) {
+		startResize(table, buckets);
+	}
+	if ((NULL == finished) && helpResize(table, current)) {
+		finished = current;
+	}
+	concurrentHashTableExitReader(table, token);
+
+	if (NULL != finished) {
+		finishResize(table, finished);
+	}
+	omrmem_free_memory(newNode);
+	return result;
+}
+
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = hashTableMixHash(table->hashFn(entry, table->functionUserData));
+	uintptr_t token = concurrentHashTableEnterReader(table);
+	J9ConcurrentHashTableBuckets *buckets = table->buckets;
+	J9ConcurrentHashTableNode *node = NULL;
+	void *result = NULL;
+
+	for (;;) {
+		node = buckets->heads[hash & (buckets->size - 1)];
+		if (MOVED_BUCKET != node) {
+			break;
+		}
+		buckets = buckets->next;
+	}
+	/* pairs with the write barrier before a node or chain is published */
+	issueReadBarrier();
+	for (; NULL != node; node = node->next[buckets->generation & 1]) {
+		if ((node->hash == hash) && table->hashEqualFn(NODE_ENTRY(table, node), entry, table->functionUserData)) {
+			result = NODE_ENTRY(table, node);
+			break;
+		}
+	}
+	concurrentHashTableExitReader(table, token);
+	return result;
+}
+
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = hashTableMixHash(table->hashFn(entry, table->functionUserData));
+	J9ConcurrentHashTableStripe *stripe = STRIPE_FOR_HASH(table, hash);
+	J9ConcurrentHashTableBuckets *current = NULL;
+	J9ConcurrentHashTableBuckets *buckets = NULL;
+	J9ConcurrentHashTableNode **previous = NULL;
+	J9ConcurrentHashTableNode *node = NULL;
+	J9ConcurrentHashTableBuckets *finished = NULL;
+	BOOLEAN reclaim = FALSE;
+	uintptr_t token = 0;
+	uintptr_t link = 0;
+
+	token = concurrentHashTableEnterReader(table);
+	current = table->buckets;
+	omrthread_monitor_enter(stripe->lock);
+	buckets = lockedBucketsForHash(current, hash, &finished);
+	link = buckets->generation & 1;
+	previous = &buckets->heads[hash & (buckets->size - 1)];
+	for (node = *previous; NULL != node; node = *previous) {
+		if ((node->hash == hash) && table->hashEqualFn(NODE_ENTRY(table, node), entry, table->functionUserData)) {
+			/* readers at the node still reach the rest of the chain through its link */
+			*previous = node->next[link];
+			break;
+		}
+		previous = &node->next[link];
+	}
+	if (NULL != node) {
+		node->nextRetired = stripe->retired;
+		stripe->retired = node;
+		stripe->retiredCount += 1;
+		stripe->count -= 1;
+		reclaim = (stripe->retiredCount >= RETIRE_THRESHOLD);
+	}
+	omrthread_monitor_exit(stripe->lock);
+
+	if ((NULL == finished) && helpResize(table, current)) {
+		finished = current;
+	}
+	concurrentHashTableExitReader(table, token);
+
+	if (NULL != finished) {
+		finishResize(table, finished);
+	}
+	if (reclaim) {
+		reclaimRetired(table, stripe);
+	}
+	return (NULL == node) ? 1 : 0;
+}
+
+uintptr_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table)
+{
+	uintptr_t count = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < J9CONCURRENT_HASH_TABLE_STRIPES; i++) {
+		count += table->stripes[i].count;
+	}
+	return count;
+}
+
+/*
+ * Call doFn on the entries of a bucket, following it to the array it was moved to.
+ * With no doFn, free the nodes instead.
+ */
+static void
+forEachInBucket(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, uintptr_t index, J9HashTableDoFn doFn, void *opaque)
+{
+	J9ConcurrentHashTableNode *node = buckets->heads[index];
+
+	if (MOVED_BUCKET == node) {
+		forEachInBucket(table, buckets->next, index, doFn, opaque);
+		forEachInBucket(table, buckets->next, index + buckets->size, doFn, opaque);
+	} else {
+		uintptr_t link = buckets->generation & 1;
+
+		issueReadBarrier();
+		while (NULL != node) {
+			J9ConcurrentHashTableNode *next = node->next[link];
+			if (NULL != doFn) {
+				doFn(NODE_ENTRY(table, node), opaque);
+			} else {
+				table->portLibrary->mem_free_memory(table->portLibrary, node);
+			}
+			node = next;
+		}
+	}
+}
+
+void
+concurrentHashTableForEachDo(J9ConcurrentHashTable *table, J9HashTableDoFn doFn, void *opaque)
+{
+	uintptr_t token = concurrentHashTableEnterReader(table);
+	J9ConcurrentHashTableBuckets *buckets = table->buckets;
+	uintptr_t i = 0;
+
+	for (i = 0; i < buckets->size; i++) {
+		forEachInBucket(table, buckets, i, doFn, opaque);
+	}
+	concurrentHashTableExitReader(table, token);
+}
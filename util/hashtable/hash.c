@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "omrcomp.h"
+#include "hashtable_internal.h"
 
 const uint8_t RandomValues[256] = {
 	1, 87, 49, 12, 176, 178, 102, 166, 121, 193, 6, 84, 249, 230, 44, 163,
@@ -41,3 +42,21 @@ const uint8_t RandomValues[256] = {
 	51, 65, 28, 144, 254, 221, 93, 189, 194, 139, 112, 43, 71, 109, 184, 209
 };
 
+/*
+ * Spread the bits of a user hash, so that hash functions with poor low bits (such as aligned
+ * pointers) still use all of the buckets of tables indexed by a power-of-two mask.
+ */
+uintptr_t
+hashTableMixHash(uintptr_t hash)
+{
+#if defined(OMR_ENV_DATA64)
+	hash ^= hash >> 33;
+	hash *= J9CONST_U64(0xFF51AFD7ED558CCD);
+	hash ^= hash >> 33;
+#else /* defined(OMR_ENV_DATA64) */
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6B;
+	hash ^= hash >> 13;
+#endif /* defined(OMR_ENV_DATA64) */
+	return hash;
+}
@@ -180,7 +180,7 @@ comparatorToEqualFn(void *leftKey, void *rightKey, void *userData)
  *
  * In general, you should expect collisionResilientHashTable to be slower than a regular hashtable and use more memory.
  *
- *  J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION is not supported (will be ignored)
+ *  J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION and J9HASH_TABLE_OPEN_ADDRESSING are not supported (will be ignored)
  *
  */
 J9HashTable *
@@ -197,7 +197,7 @@ collisionResilientHashTableNew(
 	J9HashTablePrintFn printFn,
 	void *functionUserData)
 {
-	return hashTableNewImpl(portLibrary, tableName, tableSize, entrySize, sizeof(uintptr_t), flags | J9HASH_TABLE_COLLISION_RESILIENT, memoryCategory, listToTreeThreshold, hashFn, NULL, comparatorFn, printFn, functionUserData);
+	return hashTableNewImpl(portLibrary, tableName, tableSize, entrySize, sizeof(uintptr_t), (flags & ~J9HASH_TABLE_OPEN_ADDRESSING) | J9HASH_TABLE_COLLISION_RESILIENT, memoryCategory, listToTreeThreshold, hashFn, NULL, comparatorFn, printFn, functionUserData);
 }
 
 /**
@@ -235,6 +235,16 @@ collisionResilientHashTableNew(
  *  	hashTableRehash()
  *  	hashTableDoRemove()
  *
+ *  When J9HASH_TABLE_OPEN_ADDRESSING is set, entries are stored inline in a power-of-two
+ *  array of slots, probed a group of slots at a time through a parallel array of one-byte
+ *  hash tags, instead of in chained pool nodes. Lookups then touch far fewer cache lines,
+ *  but an entry may move whenever the table grows or is rehashed, so pointers returned by
+ *  hashTableAdd() and hashTableFind() are only valid until the next hashTableAdd() or
+ *  hashTableRehash(). The tableSize is the number of entries expected rather than a number
+ *  of buckets. The table holds at most 7/8 of 2^31 entries: creating it fails if tableSize
+ *  is larger than that, and hashTableAdd() returns NULL once the table is that full.
+ *  J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION is ignored.
+ *
  */
 J9HashTable *
 hashTableNew(
@@ -311,6 +321,15 @@ hashTableNewImpl(
 	}
 	hashTable->nodeAlignment = entryAlignment;
 
+	if (J9HASH_TABLE_OPEN_ADDRESSING == (flags & J9HASH_TABLE_OPEN_ADDRESSING)) {
+		hashTable->equalFnUserData = functionUserData;
+		hashTable->hashEqualFn = hashEqualFn;
+		if (0 != openAddressingHashTableInit(hashTable, tableSize, entryAlignment)) {
+			goto error;
+		}
+		return hashTable;
+	}
+
 	if (J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION == ((flags & J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION))
 		&& (hashTable->listNodeSize == (2 * sizeof(uintptr_t)))
 		&& (hashTable->tableSize <= SPACE_OPT_LIMIT)
@@ -409,7 +428,9 @@ hashTableFree(J9HashTable *hashTable)
 		OMRPORT_ACCESS_FROM_OMRPORT(hashTable->portLibrary);
 		hashTable_printf("hashTableFree <%s>: table=%p\n", hashTable->tableName, hashTable);
 
-		if (NULL != hashTable->nodes) {
+		if (hashTableIsOpenAddressing(hashTable)) {
+			openAddressingHashTableFreeSlots(hashTable);
+		} else if (NULL != hashTable->nodes) {
 			omrmem_free_memory(hashTable->nodes);
 		}
 		if (NULL != hashTable->avlTreeTemplate) {
@@ -441,13 +462,19 @@ hashTableFree(J9HashTable *hashTable)
 void *
 hashTableFind(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	void *findNode = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableFind <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingHashTableFind(table, entry);
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
 	if (NULL == table->listNodePool) {
 		BOOLEAN found = FALSE;
 		void **node = hashTableFindNodeSpaceOpt(table, entry, head, &found);
@@ -523,14 +550,20 @@ hashTableFindNodeInTree(J9HashTable *table, void *entry, void **head)
 void *
 hashTableAdd(J9HashTable *table, void *entry)
 {
-	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
-	void **head = &table->nodes[hashCode % table->tableSize];
+	uintptr_t hashCode = 0;
+	void **head = NULL;
 	void *addNode = NULL;
 	BOOLEAN growFailure = FALSE;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableAdd <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingHashTableAdd(table, entry);
+	}
+
+	hashCode = table->hashFn(entry, table->hashFnUserData);
+	head = &table->nodes[hashCode % table->tableSize];
 	if ((table->numberOfNodes + 1) == table->tableSize) {
 		if (!hashTableCanGrow(table)) {
 			goto done;
@@ -709,13 +742,19 @@ listToTree(J9HashTable *table, void **head, uintptr_t listLength)
 uint32_t
 hashTableRemove(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	uint32_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableRemove <%s>: table=%p, entry=%p\n", table->tableName, table, entry);
 
+	if (hashTableIsOpenAddressing(table)) {
+		return openAddressingHashTableRemove(table, entry);
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
 	if (NULL == table->listNodePool) {
 		rc = hashTableRemoveNodeSpaceOpt(table, entry, head);
 	} else if (NULL == *head) {
@@ -828,7 +867,7 @@ hashTableForEachDo(J9HashTable *table, J9HashTableDoFn doFn, void *opaque)
 
 	hashTable_printf("hashTableForEachDo <%s>: table=%p\n", table->tableName, table);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsSpaceOptimized(table)) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
 	}
@@ -861,6 +900,11 @@ hashTableRehash(J9HashTable *table)
 	void  *tail = NULL;
 	uintptr_t tableSize = table->tableSize;
 
+	if (hashTableIsOpenAddressing(table)) {
+		openAddressingHashTableRehash(table);
+		return;
+	}
+
 	if (NULL == table->listNodePool) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
@@ -1019,7 +1063,9 @@ hashTableStartDo(J9HashTable *table,  J9HashTableState *handle)
 	handle->didDeleteCurrentNode = FALSE;
 	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		result = openAddressingHashTableNextDo(handle);
+	} else if (NULL == table->listNodePool) {
 		/* find the first non-empty bucket */
 		while (handle->bucketIndex < table->tableSize) {
 			void **node = &table->nodes[handle->bucketIndex];
@@ -1078,7 +1124,12 @@ hashTableNextDo(J9HashTableState *handle)
 	void *result = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		if (J9HASH_TABLE_ITERATE_STATE_FINISHED != handle->iterateState) {
+			handle->bucketIndex += 1;
+			result = openAddressingHashTableNextDo(handle);
+		}
+	} else if (NULL == table->listNodePool) {
 		/* space optimized hashTable - advance to the next bucket */
 		handle->bucketIndex += 1;
 		while (handle->bucketIndex < table->tableSize) {
@@ -1165,8 +1216,10 @@ hashTableDoRemove(J9HashTableState *handle)
 	uintptr_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
-	/* operation not supported on a space optimized hashTable */
-	if (NULL == table->listNodePool) {
+	if (hashTableIsOpenAddressing(table)) {
+		rc = openAddressingHashTableDoRemove(handle);
+	} else if (NULL == table->listNodePool) {
+		/* operation not supported on a space optimized hashTable */
 		Assert_hashTable_unreachable();
 	} else {
 		void *currentNode = NULL;
@@ -39,6 +39,48 @@
 extern "C" {
 #endif
 
+/* ---------------- hash.c ---------------- */
+
+/**
+ * Spread the bits of a user hash over the whole word.
+ * @param[in] hash The value returned by a table's hash function
+ * @return The mixed hash
+ */
+uintptr_t
+hashTableMixHash(uintptr_t hash);
+
+/* ---------------- openaddressinghashtable.c ---------------- */
+
+/**
+ * Allocate the slot and control arrays of a table created with J9HASH_TABLE_OPEN_ADDRESSING.
+ * @param[in] table The table, with its entry size and flags set
+ * @param[in] tableSize The number of entries the caller expects
+ * @param[in] entryAlignment Alignment of each entry, or 0
+ * @return 0 on success, 1 on failure
+ */
+uintptr_t
+openAddressingHashTableInit(J9HashTable *table, uint32_t tableSize, uint32_t entryAlignment);
+
+void
+openAddressingHashTableFreeSlots(J9HashTable *table);
+
+void *
+openAddressingHashTableFind(J9HashTable *table, void *entry);
+
+void *
+openAddressingHashTableAdd(J9HashTable *table, void *entry);
+
+uint32_t
+openAddressingHashTableRemove(J9HashTable *table, void *entry);
+
+void
+openAddressingHashTableRehash(J9HashTable *table);
+
+void *
+openAddressingHashTableNextDo(J9HashTableState *handle);
+
+uintptr_t
+openAddressingHashTableDoRemove(J9HashTableState *handle);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,517 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Open addressing mode of J9HashTable (J9HASH_TABLE_OPEN_ADDRESSING).
+ *
+ * Entries are stored inline in a power-of-two array of slots. A parallel array holds one control byte
+ * per slot: EMPTY, DELETED, or for a full slot the low 7 bits of the entry's hash. A lookup loads the
+ * control bytes of a whole group of slots at once and compares them with the 7-bit tag in parallel,
+ * so the equality function is normally called only for the entry that matches, and a miss usually
+ * costs a single cache line of control bytes. Groups are probed triangularly from the slot selected
+ * by the remaining hash bits, until a group containing an EMPTY byte is seen.
+ *
+ * The control array carries a copy of its first group after its end, so a group load starting near
+ * the end of the table needs no wraparound. The slot array carries one spare slot, used to swap
+ * entries while rehashing in place.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+#include "ut_hashtable.h"
+#include "omrport.h"
+
+#if defined(J9HAMMER) || defined(__SSE2__)
+#include <emmintrin.h>
+#define GROUP_SIZE 16
+/* one bit of the match mask per control byte */
+#define GROUP_SHIFT 0
+#elif defined(OMR_ARCH_AARCH64) /* defined(J9HAMMER) || defined(__SSE2__) */
+#include <arm_neon.h>
+#define GROUP_SIZE 16
+/* four bits of the match mask per control byte, of which only the top one is kept */
+#define GROUP_SHIFT 2
+#else /* defined(OMR_ARCH_AARCH64) */
+#define GROUP_SIZE 8
+/* eight bits of the match mask per control byte, of which only the top one is kept */
+#define GROUP_SHIFT 3
+#endif /* defined(J9HAMMER) || defined(__SSE2__) */
+
+#define CONTROL_EMPTY ((uint8_t)0x80)
+#define CONTROL_DELETED ((uint8_t)0xFE)
+#define CONTROL_IS_FULL(control) (0 == ((control) & 0x80))
+#define HASH_TAG(hash) ((uint8_t)((hash) & 0x7F))
+#define HASH_POSITION(hash) ((hash) >> 7)
+
+#define MIN_CAPACITY 16
+/* the largest power of two a J9HashTable tableSize can hold */
+#define MAX_CAPACITY ((uint32_t)1 << 31)
+/* slots that may be full or deleted before the table is grown or cleaned: 7/8 of the capacity */
+#define MAX_LOAD(capacity) ((capacity) - ((capacity) >> 3))
+
+#define SLOT(table, index) ((void *)((uint8_t *)(table)->slots + ((uintptr_t)(index) * (table)->slotSize)))
+#define SLOT_ALIGNMENT(table) (((table)->nodeAlignment > sizeof(uintptr_t)) ? (uintptr_t)(table)->nodeAlignment : sizeof(uintptr_t))
+
+static uintptr_t lowestBit(uint64_t value);
+static uint64_t groupMatch(const uint8_t *group, uint8_t tag);
+static uint64_t groupMatchEmpty(const uint8_t *group);
+static uint64_t groupMatchFree(const uint8_t *group);
+static void *allocateSlots(J9HashTable *table, uint32_t capacity, void **slots, uint8_t **controlBytes);
+static void freeSlots(J9HashTable *table, void *memory);
+static void setControl(J9HashTable *table, uintptr_t index, uint8_t control);
+static uintptr_t findIndex(J9HashTable *table, void *entry, uintptr_t hash);
+static uintptr_t findFreeIndex(J9HashTable *table, uintptr_t hash);
+static void removeIndex(J9HashTable *table, uintptr_t index);
+static uintptr_t resize(J9HashTable *table, uint32_t capacity);
+
+static uintptr_t
+lowestBit(uint64_t value)
+{
+#if defined(__GNUC__)
+	return (uintptr_t)__builtin_ctzll(value);
+#else /* defined(__GNUC__) */
+	uintptr_t bit = 0;
+	while (0 == (value & 1)) {
+		value >>= 1;
+		bit += 1;
+	}
+	return bit;
+#endif /* defined(__GNUC__) */
+}
+
+#if defined(J9HAMMER) || defined(__SSE2__)
+
+static uint64_t
+groupMatch(const uint8_t *group, uint8_t tag)
+{
+	__m128i control = _mm_loadu_si128((const __m128i *)group);
+	return (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)tag)));
+}
+
+static uint64_t
+groupMatchEmpty(const uint8_t *group)
+{
+	return groupMatch(group, CONTROL_EMPTY);
+}
+
+/* EMPTY and DELETED are the only control bytes with the top bit set */
+static uint64_t
+groupMatchFree(const uint8_t *group)
+{
+	return (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+}
+
+#elif defined(OMR_ARCH_AARCH64) /* defined(J9HAMMER) || defined(__SSE2__) */
+
+/* Narrow a byte-wise comparison result to a 64-bit mask, 4 bits per byte */
+#define NEON_MASK(result) \
+	(vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(result), 4)), 0) & J9CONST_U64(0x8888888888888888))
+
+static uint64_t
+groupMatch(const uint8_t *group, uint8_t tag)
+{
+	return NEON_MASK(vceqq_u8(vld1q_u8(group), vdupq_n_u8(tag)));
+}
+
+static uint64_t
+groupMatchEmpty(const uint8_t *group)
+{
+	return groupMatch(group, CONTROL_EMPTY);
+}
+
+static uint64_t
+groupMatchFree(const uint8_t *group)
+{
+	return NEON_MASK(vcltzq_s8(vreinterpretq_s8_u8(vld1q_u8(group))));
+}
+
+#else /* defined(OMR_ARCH_AARCH64) */
+
+#define LOW_BITS J9CONST_U64(0x0101010101010101)
+#define HIGH_BITS J9CONST_U64(0x8080808080808080)
+
+/* Load a group with its first control byte in the lowest bits, whatever the byte order */
+static uint64_t
+loadGroup(const uint8_t *group)
+{
+	uint64_t word = 0;
+	intptr_t i = 0;
+
+	for (i = GROUP_SIZE - 1; i >= 0; i--) {
+		word = (word << 8) | group[i];
+	}
+	return word;
+}
+
+/* May report a byte following a true match as a match too, which the caller's equality check rejects */
+static uint64_t
+groupMatch(const uint8_t *group, uint8_t tag)
+{
+	uint64_t word = loadGroup(group) ^ (LOW_BITS * tag);
+	return (word - LOW_BITS) & ~word & HIGH_BITS;
+}
+
+/* EMPTY is the only control byte with the top bit set and bit 1 clear */
+static uint64_t
+groupMatchEmpty(const uint8_t *group)
+{
+	uint64_t word = loadGroup(group);
+	return word & ~(word << 6) & HIGH_BITS;
+}
+
+static uint64_t
+groupMatchFree(const uint8_t *group)
+{
+	return loadGroup(group) & HIGH_BITS;
+}
+
+#endif /* defined(J9HAMMER) || defined(__SSE2__) */
+
+/*
+ * Allocate the slots and control bytes for a capacity, with every control byte EMPTY.
+ * Returns the block to free, or NULL.
+ */
+static void *
+allocateSlots(J9HashTable *table, uint32_t capacity, void **slots, uint8_t **controlBytes)
+{
+	OMRPortLibrary *portLibrary = table->portLibrary;
+	uintptr_t alignment = SLOT_ALIGNMENT(table);
+	uintptr_t slotBytes = 0;
+	uintptr_t size = 0;
+	void *memory = NULL;
+
+	/* a large capacity may not be addressable on 32-bit platforms */
+	if (((uintptr_t)capacity + 1) > ((UDATA_MAX - alignment - GROUP_SIZE - capacity) / table->slotSize)) {
+		return NULL;
+	}
+	slotBytes = ((uintptr_t)capacity + 1) * table->slotSize;
+	size = (alignment - 1) + slotBytes + capacity + GROUP_SIZE;
+
+#if defined(OMR_ENV_DATA64)
+	if (J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 == (table->flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32)) {
+		memory = portLibrary->mem_allocate_memory32(portLibrary, size, table->tableName, table->memoryCategory);
+	} else
+#endif /* OMR_ENV_DATA64 */
+	{
+		memory = portLibrary->mem_allocate_memory(portLibrary, size, table->tableName, table->memoryCategory);
+	}
+	if (NULL != memory) {
+		*slots = (void *)(((uintptr_t)memory + alignment - 1) & ~(alignment - 1));
+		*controlBytes = (uint8_t *)*slots + slotBytes;
+		memset(*controlBytes, CONTROL_EMPTY, capacity + GROUP_SIZE);
+	}
+	return memory;
+}
+
+static void
+freeSlots(J9HashTable *table, void *memory)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+
+#if defined(OMR_ENV_DATA64)
+	if (J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32 == (table->flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32)) {
+		omrmem_free_memory32(memory);
+	} else
+#endif /* OMR_ENV_DATA64 */
+	{
+		omrmem_free_memory(memory);
+	}
+}
+
+/* Set a control byte, and its copy if it is in the first group */
+static void
+setControl(J9HashTable *table, uintptr_t index, uint8_t control)
+{
+	uintptr_t mask = table->tableSize - 1;
+
+	table->controlBytes[index] = control;
+	table->controlBytes[((index - GROUP_SIZE) & mask) + GROUP_SIZE] = control;
+}
+
+/* Return the index of the slot holding an entry equal to entry, or UDATA_MAX */
+static uintptr_t
+findIndex(J9HashTable *table, void *entry, uintptr_t hash)
+{
+	uintptr_t mask = table->tableSize - 1;
+	uintptr_t position = HASH_POSITION(hash) & mask;
+	uintptr_t stride = 0;
+	uint8_t tag = HASH_TAG(hash);
+
+	for (;;) {
+		const uint8_t *group = table->controlBytes + position;
+		uint64_t matches = groupMatch(group, tag);
+
+		while (0 != matches) {
+			uintptr_t index = (position + (lowestBit(matches) >> GROUP_SHIFT)) & mask;
+			if (0 != table->hashEqualFn(SLOT(table, index), entry, table->equalFnUserData)) {
+				return index;
+			}
+			matches &= matches - 1;
+		}
+		/* the load limit guarantees every probe sequence reaches an EMPTY slot */
+		if (0 != groupMatchEmpty(group)) {
+			return UDATA_MAX;
+		}
+		stride += GROUP_SIZE;
+		position = (position + stride) & mask;
+	}
+}
+
+/* Return the index of the first EMPTY or DELETED slot in the probe sequence of hash */
+static uintptr_t
+findFreeIndex(J9HashTable *table, uintptr_t hash)
+{
+	uintptr_t mask = table->tableSize - 1;
+	uintptr_t position = HASH_POSITION(hash) & mask;
+	uintptr_t stride = 0;
+
+	for (;;) {
+		uint64_t free = groupMatchFree(table->controlBytes + position);
+		if (0 != free) {
+			return (position + (lowestBit(free) >> GROUP_SHIFT)) & mask;
+		}
+		stride += GROUP_SIZE;
+		position = (position + stride) & mask;
+	}
+}
+
+static void
+removeIndex(J9HashTable *table, uintptr_t index)
+{
+	table->numberOfNodes -= 1;
+	if (0 == table->numberOfNodes) {
+		/* nothing left to probe past, so all tombstones can go */
+		memset(table->controlBytes, CONTROL_EMPTY, table->tableSize + GROUP_SIZE);
+		table->numberOfDeletedSlots = 0;
+	} else {
+		setControl(table, index, CONTROL_DELETED);
+		table->numberOfDeletedSlots += 1;
+	}
+}
+
+/* Move every entry into a new slot array of the given capacity. Returns 0 on success, 1 on failure */
+static uintptr_t
+resize(J9HashTable *table, uint32_t capacity)
+{
+	void *oldMemory = table->nodes;
+	void *oldSlots = table->slots;
+	uint8_t *oldControlBytes = table->controlBytes;
+	uint32_t oldCapacity = table->tableSize;
+	void *slots = NULL;
+	uint8_t *controlBytes = NULL;
+	void *memory = allocateSlots(table, capacity, &slots, &controlBytes);
+	uintptr_t i = 0;
+
+	if (NULL == memory) {
+		return 1;
+	}
+	table->nodes = memory;
+	table->slots = slots;
+	table->controlBytes = controlBytes;
+	table->tableSize = capacity;
+	table->numberOfDeletedSlots = 0;
+
+	for (i = 0; i < oldCapacity; i++) {
+		if (CONTROL_IS_FULL(oldControlBytes[i])) {
+			void *oldSlot = (uint8_t *)oldSlots + (i * table->slotSize);
+			uintptr_t hash = hashTableMixHash(table->hashFn(oldSlot, table->hashFnUserData));
+			uintptr_t index = findFreeIndex(table, hash);
+
+			setControl(table, index, HASH_TAG(hash));
+			memcpy(SLOT(table, index), oldSlot, table->entrySize);
+		}
+	}
+	freeSlots(table, oldMemory);
+	return 0;
+}
+
+uintptr_t
+openAddressingHashTableInit(J9HashTable *table, uint32_t tableSize, uint32_t entryAlignment)
+{
+	uintptr_t alignment = 0;
+	uint32_t capacity = MIN_CAPACITY;
+
+	table->nodeAlignment = entryAlignment;
+	alignment = SLOT_ALIGNMENT(table);
+	table->slotSize = (uint32_t)(((table->entrySize + alignment - 1) / alignment) * alignment);
+	if (tableSize > MAX_LOAD(MAX_CAPACITY)) {
+		return 1;
+	}
+	while (MAX_LOAD(capacity) < tableSize) {
+		capacity <<= 1;
+	}
+	table->tableSize = capacity;
+	table->nodes = allocateSlots(table, capacity, &table->slots, &table->controlBytes);
+	return (NULL == table->nodes) ? 1 : 0;
+}
+
+void
+openAddressingHashTableFreeSlots(J9HashTable *table)
+{
+	if (NULL != table->nodes) {
+		freeSlots(table, table->nodes);
+		table->nodes = NULL;
+	}
+}
+
+void *
+openAddressingHashTableFind(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = hashTableMixHash(table->hashFn(entry, table->hashFnUserData));
+	uintptr_t index = findIndex(table, entry, hash);
+
+	return (UDATA_MAX == index) ? NULL : SLOT(table, index);
+}
+
+void *
+openAddressingHashTableAdd(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = hashTableMixHash(table->hashFn(entry, table->hashFnUserData));
+	uintptr_t index = findIndex(table, entry, hash);
+	void *slot = NULL;
+
+	if (UDATA_MAX != index) {
+		return SLOT(table, index);
+	}
+
+	if ((table->numberOfNodes + table->numberOfDeletedSlots) >= MAX_LOAD(table->tableSize)) {
+		if (!hashTableCanGrow(table) || !hashTableCanRehash(table)) {
+			return NULL;
+		}
+		if (table->numberOfNodes < (MAX_LOAD(table->tableSize) / 2)) {
+			/* mostly tombstones: clearing them makes enough room */
+			openAddressingHashTableRehash(table);
+		} else if ((table->tableSize >= MAX_CAPACITY) || (0 != resize(table, table->tableSize * 2))) {
+			if (0 == table->numberOfDeletedSlots) {
+				return NULL;
+			}
+			openAddressingHashTableRehash(table);
+		}
+	}
+
+	index = findFreeIndex(table, hash);
+	if (CONTROL_DELETED == table->controlBytes[index]) {
+		table->numberOfDeletedSlots -= 1;
+	}
+	setControl(table, index, HASH_TAG(hash));
+	slot = SLOT(table, index);
+	memcpy(slot, entry, table->entrySize);
+	table->numberOfNodes += 1;
+	return slot;
+}
+
+uint32_t
+openAddressingHashTableRemove(J9HashTable *table, void *entry)
+{
+	uintptr_t hash = hashTableMixHash(table->hashFn(entry, table->hashFnUserData));
+	uintptr_t index = findIndex(table, entry, hash);
+
+	if (UDATA_MAX == index) {
+		return 1;
+	}
+	removeIndex(table, index);
+	return 0;
+}
+
+/*
+ * Recompute the home of every entry in place, which also clears all tombstones. Every entry is first
+ * marked DELETED and every tombstone EMPTY; each DELETED slot is then moved to the first free slot of
+ * its probe sequence, swapping with the entry there if that one has not been placed yet.
+ */
+void
+openAddressingHashTableRehash(J9HashTable *table)
+{
+	uint8_t *controlBytes = table->controlBytes;
+	uintptr_t capacity = table->tableSize;
+	uintptr_t mask = capacity - 1;
+	void *spare = SLOT(table, capacity);
+	uintptr_t i = 0;
+
+	for (i = 0; i < capacity; i++) {
+		controlBytes[i] = CONTROL_IS_FULL(controlBytes[i]) ? CONTROL_DELETED : CONTROL_EMPTY;
+	}
+	memcpy(controlBytes + capacity, controlBytes, GROUP_SIZE);
+
+	for (i = 0; i < capacity; i++) {
+		void *slot = SLOT(table, i);
+		uintptr_t hash = 0;
+		uintptr_t start = 0;
+		uintptr_t index = 0;
+
+		if (CONTROL_DELETED != controlBytes[i]) {
+			continue;
+		}
+		hash = hashTableMixHash(table->hashFn(slot, table->hashFnUserData));
+		start = HASH_POSITION(hash) & mask;
+		index = findFreeIndex(table, hash);
+		if ((((i - start) & mask) / GROUP_SIZE) == (((index - start) & mask) / GROUP_SIZE)) {
+			/* already in the first group probed for it */
+			setControl(table, i, HASH_TAG(hash));
+		} else if (CONTROL_EMPTY == controlBytes[index]) {
+			setControl(table, index, HASH_TAG(hash));
+			memcpy(SLOT(table, index), slot, table->entrySize);
+			setControl(table, i, CONTROL_EMPTY);
+		} else {
+			setControl(table, index, HASH_TAG(hash));
+			memcpy(spare, SLOT(table, index), table->entrySize);
+			memcpy(SLOT(table, index), slot, table->entrySize);
+			memcpy(slot, spare, table->entrySize);
+			/* the entry swapped in still needs a home */
+			i -= 1;
+		}
+	}
+	table->numberOfDeletedSlots = 0;
+}
+
+/*
+ * Return the first full slot at or after handle->bucketIndex, or NULL when there are none left.
+ */
+void *
+openAddressingHashTableNextDo(J9HashTableState *handle)
+{
+	J9HashTable *table = handle->table;
+
+	while (handle->bucketIndex < table->tableSize) {
+		if (CONTROL_IS_FULL(table->controlBytes[handle->bucketIndex])) {
+			handle->pointerToCurrentNode = SLOT(table, handle->bucketIndex);
+			return handle->pointerToCurrentNode;
+		}
+		handle->bucketIndex += 1;
+	}
+	handle->iterateState = J9HASH_TABLE_ITERATE_STATE_FINISHED;
+	return NULL;
+}
+
+uintptr_t
+openAddressingHashTableDoRemove(J9HashTableState *handle)
+{
+	J9HashTable *table = handle->table;
+
+	if ((J9HASH_TABLE_ITERATE_STATE_FINISHED == handle->iterateState)
+		|| !CONTROL_IS_FULL(table->controlBytes[handle->bucketIndex])
+	) {
+		return 1;
+	}
+	removeIndex(table, handle->bucketIndex);
+	return 0;
+}
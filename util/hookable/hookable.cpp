@@ -65,6 +65,9 @@ static const J9HookInterface hookFunctionTable = {
 /* records are stored at the END of the interface in descending order */
 #define HOOK_RECORD(interface, event) (((J9HookRecord**)( (uint8_t*)(interface) + (interface)->size ))[ -1 - (event)])
 
+/* fast paths follow the flags, aligned as the generated interface aligns them */
+#define HOOK_FAST_PATH(interface, event) (&((J9HookFastPath *)ROUND_UP_TO_POWEROF2((uintptr_t)((uint8_t *)((interface) + 1) + (interface)->eventSize), sizeof(uintptr_t)))[event])
+
 /* e.g.
  0: J9CommonInterface::interface
  4: J9CommonInterface::size
@@ -88,6 +91,64 @@ static const J9HookInterface hookFunctionTable = {
 #define HOOK_INVALID_ID(id) ((id) | 1)
 #define HOOK_VALID_ID(id) ( (((id) | 1) + 1) )
 
+/* the dispatch counters of an event in a given shard */
+#define HOOK_COUNTER(interface, shard, event) (&(interface)->counterShards[((shard) * (interface)->counterShardStride) + (event)])
+
+/*
+ * Pick the counter shard of the dispatching thread. Each thread has its own stack, so the
+ * address of a local is a free per-thread key; a thread that lands in another shard now and
+ * then still leaves the aggregated totals exact.
+ */
+static VMINLINE uintptr_t
+dispatchCounterShard(void)
+{
+	uintptr_t marker = 0;
+	uint32_t hash = (uint32_t)(((uintptr_t)&marker) >> 14) * (uint32_t)0x9E3779B1;
+
+	return (hash >> 24) & (J9HOOK_COUNTER_SHARDS - 1);
+}
+
+/*
+ * Refresh the fast path slot of an event after its listeners changed. The slot is valid
+ * only while exactly one listener is registered. Must be called with the interface lock held.
+ */
+static void
+updateFastPath(J9CommonHookInterface *commonInterface, uintptr_t eventNum)
+{
+	J9HookFastPath *fastPath = HOOK_FAST_PATH(commonInterface, eventNum);
+	J9HookRecord *single = NULL;
+	uintptr_t listeners = 0;
+	uintptr_t sequence = fastPath->sequence & ~(uintptr_t)(J9HOOK_FASTPATH_BUSY | J9HOOK_FASTPATH_VALID);
+	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
+
+	while (NULL != record) {
+		if (HOOK_IS_VALID_ID(record->id)) {
+			single = record;
+			listeners += 1;
+		}
+		record = record->next;
+	}
+
+	/* readers which saw the old sequence fall back to J9HookDispatch from here on */
+	fastPath->sequence = sequence | J9HOOK_FASTPATH_BUSY;
+	VM_AtomicSupport::writeBarrier();
+
+	if (1 == listeners) {
+		fastPath->function = single->function;
+		fastPath->userData = single->userData;
+	} else {
+		fastPath->function = NULL;
+		fastPath->userData = NULL;
+	}
+	VM_AtomicSupport::writeBarrier();
+
+	sequence += J9HOOK_FASTPATH_GENERATION;
+	if (1 == listeners) {
+		sequence |= J9HOOK_FASTPATH_VALID;
+	}
+	fastPath->sequence = sequence;
+}
+
 
 intptr_t
 omrhook_lib_control(const char *key, uintptr_t value)
@@ -145,10 +206,80 @@ J9HookInitializeInterface(struct J9HookInterface **hookInterface, OMRPortLibrary
 	commonInterface->portLib = portLib;
 	commonInterface->threshold4Trace = OMRHOOK_DEFAULT_THRESHOLD_IN_MICROSECONDS_WARNING_CALLBACK_ELAPSED_TIME;
 
-	commonInterface->eventSize = (interfaceSize - sizeof(J9CommonHookInterface)) / (sizeof(U_8) + sizeof(OMREventInfo4Dump) + sizeof(J9HookRecord*));
+	commonInterface->eventSize = (interfaceSize - sizeof(J9CommonHookInterface)) / (sizeof(U_8) + sizeof(J9HookFastPath) + sizeof(OMREventInfo4Dump) + sizeof(J9HookRecord*));
+
+	/* keep every shard on cache lines of its own */
+	commonInterface->counterShardStride = ROUND_UP_TO_POWEROF2(commonInterface->eventSize * sizeof(OMREventCounter4Dump), J9HOOK_COUNTER_SHARD_ALIGNMENT) / sizeof(OMREventCounter4Dump);
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+		uintptr_t counterBytes = commonInterface->counterShardStride * J9HOOK_COUNTER_SHARDS * sizeof(OMREventCounter4Dump);
+
+		commonInterface->counterShardMemory = omrmem_allocate_memory(counterBytes + J9HOOK_COUNTER_SHARD_ALIGNMENT, OMRMEM_CATEGORY_VM);
+		if (NULL == commonInterface->counterShardMemory) {
+			J9HookShutdownInterface(hookInterface);
+			return J9HOOK_ERR_NOMEM;
+		}
+		commonInterface->counterShards = (OMREventCounter4Dump *)ROUND_UP_TO_POWEROF2((uintptr_t)commonInterface->counterShardMemory, J9HOOK_COUNTER_SHARD_ALIGNMENT);
+		memset(commonInterface->counterShards, 0, counterBytes);
+	}
 	return 0;
 }
 
+/*
+ * Raises *total to value, unless another thread has already published a larger one.
+ */
+static void
+raiseDumpTotal(volatile uintptr_t *total, uintptr_t value)
+{
+	uintptr_t current = *total;
+
+	while (value > current) {
+		uintptr_t previous = VM_AtomicSupport::lockCompareExchange(total, current, value);
+		if (previous == current) {
+			break;
+		}
+		current = previous;
+	}
+}
+
+/*
+ * Sums the counter shards of an event into its dump info. Concurrent callers may read the
+ * shards at different times; the totals published are never lowered, so a slower caller
+ * cannot replace a newer total with an older one.
+ */
+static void
+foldDumpCounters(J9CommonHookInterface *commonInterface, uintptr_t eventNum, OMREventInfo4Dump *eventDump)
+{
+	uintptr_t count = 0;
+	uintptr_t totalTime = 0;
+	uintptr_t shard = 0;
+
+	for (shard = 0; shard < J9HOOK_COUNTER_SHARDS; shard++) {
+		OMREventCounter4Dump *counter = HOOK_COUNTER(commonInterface, shard, eventNum);
+
+		count += counter->count;
+		totalTime += counter->totalTime;
+	}
+	raiseDumpTotal(&eventDump->count, count);
+	raiseDumpTotal(&eventDump->totalTime, totalTime);
+}
+
+/*
+ * Sums the counter shards of every event into its dump info.
+ *
+ * This function may be called directly.
+ */
+void
+J9HookAggregateDumpInfo(struct J9HookInterface **hookInterface)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	uintptr_t eventNum = 0;
+
+	for (eventNum = 0; eventNum < commonInterface->eventSize; eventNum++) {
+		foldDumpCounters(commonInterface, eventNum, J9HOOK_DUMPINFO(commonInterface, eventNum));
+	}
+}
+
 /*
  * Shuts down the specified hook interface.
  *
@@ -166,6 +297,13 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
 	if (commonInterface->pool) {
 		pool_kill(commonInterface->pool);
 	}
+
+	if (commonInterface->counterShardMemory) {
+		OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
+		omrmem_free_memory(commonInterface->counterShardMemory);
+		commonInterface->counterShardMemory = NULL;
+		commonInterface->counterShards = NULL;
+	}
 }
 
 
@@ -188,7 +326,9 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
 	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
 	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
+	OMREventCounter4Dump *counter = HOOK_COUNTER(commonInterface, dispatchCounterShard(), eventNum);
 	bool sampling = false;
+	bool refresh = false;
 
 	if (taggedEventNum & J9HOOK_TAG_ONCE) {
 		uint8_t oldFlags;
@@ -224,10 +364,17 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 				uint64_t startTime = 0;
 				uintptr_t count = 0;
 				if (NULL != eventDump) {
-					count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
+					/* the shard count decides sampling, so each shard samples every samplingInterval-th of its own calls */
+					count = VM_AtomicSupport::add(&counter->count, 1);
 					sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
+					/* keep infos4Dump close to the shards for dumps; folding reads every shard, so only do it every J9HOOK_COUNTER_REFRESH_INTERVAL calls */
+					refresh = (0 == (count & (J9HOOK_COUNTER_REFRESH_INTERVAL - 1)));
 				} else {
 					sampling =  false;
+					refresh = false;
+				}
+				if (refresh) {
+					foldDumpCounters(commonInterface, eventNum, eventDump);
 				}
 				OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
 				if (sampling) {
@@ -243,7 +390,7 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 					eventDump->lastHook.callsite = record->callsite;
 					eventDump->lastHook.func_ptr = (void *)record->function;
 					eventDump->lastHook.duration = timeDelta;
-					VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->totalTime, (uintptr_t)timeDelta);
+					VM_AtomicSupport::add(&counter->totalTime, (uintptr_t)timeDelta);
 
 					if ((eventDump->longestHook.duration < timeDelta) ||
 						(0 == eventDump->longestHook.startTime)) {
@@ -451,6 +598,7 @@ J9HookRegisterWithCallSitePrivate(struct J9HookInterface **hookInterface, uintpt
 				HOOK_FLAGS(commonInterface, eventNum) |= J9HOOK_FLAG_HOOKED | J9HOOK_FLAG_RESERVED;
 			}
 		}
+		updateFastPath(commonInterface, eventNum);
 	}
 
 	omrthread_monitor_exit(commonInterface->lock);
@@ -574,6 +722,9 @@ J9HookUnregister(struct J9HookInterface **hookInterface, uintptr_t taggedEventNu
 	if (hooksRemaining == 0) {
 		HOOK_FLAGS(commonInterface, eventNum) &= ~J9HOOK_FLAG_HOOKED;
 	}
+	if (0 != hooksRemoved) {
+		updateFastPath(commonInterface, eventNum);
+	}
 
 	omrthread_monitor_exit(commonInterface->lock);
 
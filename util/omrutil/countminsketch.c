@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "countminsketch.h"
+
+/*
+ * Split a key into two independent 32-bit hashes. Row i uses h1 + i * h2, which is as good
+ * as depth independent hash functions for the sketch's bounds.
+ */
+static void
+hashKey(void *key, uint32_t *h1, uint32_t *h2)
+{
+	uint64_t h = (uint64_t)(uintptr_t)key;
+
+	h ^= h >> 33;
+	h *= J9CONST_U64(0xff51afd7ed558ccd);
+	h ^= h >> 33;
+	h *= J9CONST_U64(0xc4ceb9fe1a85ec53);
+	h ^= h >> 33;
+	*h1 = (uint32_t)h;
+	/* odd, so that the rows of a key never collide with each other */
+	*h2 = (uint32_t)(h >> 32) | 1;
+}
+
+OMRCountMinSketch *
+countMinSketchNew(OMRPortLibrary *portLibrary, uint32_t width, uint32_t depth)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRCountMinSketch *sketch = NULL;
+	uint32_t roundedWidth = 1;
+
+	if ((0 == width) || (0 == depth) || (width > ((uint32_t)1 << 30))) {
+		return NULL;
+	}
+	while (roundedWidth < width) {
+		roundedWidth <<= 1;
+	}
+
+	sketch = omrmem_allocate_memory(sizeof(OMRCountMinSketch), OMRMEM_CATEGORY_MM);
+	if (NULL == sketch) {
+		return NULL;
+	}
+	sketch->width = roundedWidth;
+	sketch->depth = depth;
+	sketch->portLib = portLibrary;
+	sketch->counters = omrmem_allocate_memory((uintptr_t)roundedWidth * depth * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	if (NULL == sketch->counters) {
+		omrmem_free_memory(sketch);
+		return NULL;
+	}
+	countMinSketchClear(sketch);
+	return sketch;
+}
+
+void
+countMinSketchFree(OMRCountMinSketch *sketch)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(sketch->portLib);
+
+	omrmem_free_memory(sketch->counters);
+	omrmem_free_memory(sketch);
+}
+
+void
+countMinSketchClear(OMRCountMinSketch *sketch)
+{
+	memset(sketch->counters, 0, (uintptr_t)sketch->width * sketch->depth * sizeof(uintptr_t));
+	sketch->total = 0;
+}
+
+void
+countMinSketchUpdate(OMRCountMinSketch *sketch, void *key, uintptr_t count)
+{
+	uintptr_t *row = sketch->counters;
+	uint32_t mask = sketch->width - 1;
+	uint32_t h1 = 0;
+	uint32_t h2 = 0;
+	uint32_t i = 0;
+
+	hashKey(key, &h1, &h2);
+	for (i = 0; i < sketch->depth; i++) {
+		row[h1 & mask] += count;
+		h1 += h2;
+		row += sketch->width;
+	}
+	sketch->total += count;
+}
+
+uintptr_t
+countMinSketchEstimate(OMRCountMinSketch *sketch, void *key)
+{
+	uintptr_t *row = sketch->counters;
+	uint32_t mask = sketch->width - 1;
+	uintptr_t estimate = UINTPTR_MAX;
+	uint32_t h1 = 0;
+	uint32_t h2 = 0;
+	uint32_t i = 0;
+
+	hashKey(key, &h1, &h2);
+	for (i = 0; i < sketch->depth; i++) {
+		uintptr_t counter = row[h1 & mask];
+
+		if (counter < estimate) {
+			estimate = counter;
+		}
+		h1 += h2;
+		row += sketch->width;
+	}
+	return estimate;
+}
+
+uintptr_t
+countMinSketchGetTotal(OMRCountMinSketch *sketch)
+{
+	return sketch->total;
+}
+
+uintptr_t
+countMinSketchMerge(OMRCountMinSketch *sketch, OMRCountMinSketch *other)
+{
+	uintptr_t counters = (uintptr_t)sketch->width * sketch->depth;
+	uintptr_t i = 0;
+
+	if ((sketch->width != other->width) || (sketch->depth != other->depth)) {
+		return FALSE;
+	}
+	for (i = 0; i < counters; i++) {
+		sketch->counters[i] += other->counters[i];
+	}
+	sketch->total += other->total;
+	return TRUE;
+}
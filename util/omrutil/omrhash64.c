@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * xxHash64, a fast non-cryptographic hash with good avalanche behaviour.
+ * Input is consumed in 32-byte stripes by four independent accumulators, so
+ * long keys hash at close to memory bandwidth while short keys take only a
+ * few multiplies.
+ */
+
+#include <string.h>
+
+#include "omrcomp.h"
+#include "omrutil.h"
+
+#define HASH64_PRIME1 J9CONST_U64(0x9E3779B185EBCA87)
+#define HASH64_PRIME2 J9CONST_U64(0xC2B2AE3D27D4EB4F)
+#define HASH64_PRIME3 J9CONST_U64(0x165667B19E3779F9)
+#define HASH64_PRIME4 J9CONST_U64(0x85EBCA77C2B2AE63)
+#define HASH64_PRIME5 J9CONST_U64(0x27D4EB2F165667C5)
+
+#define HASH64_ROTL(value, bits) (((value) << (bits)) | ((value) >> (64 - (bits))))
+
+static uint64_t hash64Read64(const uint8_t *bytes);
+static uint32_t hash64Read32(const uint8_t *bytes);
+static uint64_t hash64Round(uint64_t accumulator, uint64_t input);
+static uint64_t hash64MergeRound(uint64_t accumulator, uint64_t value);
+
+static uint64_t
+hash64Read64(const uint8_t *bytes)
+{
+	uint64_t value = 0;
+	memcpy(&value, bytes, sizeof(value));
+#if !defined(OMR_ENV_LITTLE_ENDIAN)
+	value = ((value & J9CONST_U64(0x00000000FFFFFFFF)) << 32) | (value >> 32);
+	value = ((value & J9CONST_U64(0x0000FFFF0000FFFF)) << 16) | ((value >> 16) & J9CONST_U64(0x0000FFFF0000FFFF));
+	value = ((value & J9CONST_U64(0x00FF00FF00FF00FF)) << 8) | ((value >> 8) & J9CONST_U64(0x00FF00FF00FF00FF));
+#endif /* !defined(OMR_ENV_LITTLE_ENDIAN) */
+	return value;
+}
+
+static uint32_t
+hash64Read32(const uint8_t *bytes)
+{
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static uint64_t
+hash64Round(uint64_t accumulator, uint64_t input)
+{
+	accumulator += input * HASH64_PRIME2;
+	accumulator = HASH64_ROTL(accumulator, 31);
+	return accumulator * HASH64_PRIME1;
+}
+
+static uint64_t
+hash64MergeRound(uint64_t accumulator, uint64_t value)
+{
+	accumulator ^= hash64Round(0, value);
+	return (accumulator * HASH64_PRIME1) + HASH64_PRIME4;
+}
+
+uint64_t
+omrhash64(const void *data, uintptr_t len, uint64_t seed)
+{
+	const uint8_t *bytes = (const uint8_t *)data;
+	const uint8_t *end = bytes + len;
+	uint64_t hash = 0;
+
+	if (len >= 32) {
+		const uint8_t *limit = end - 32;
+		uint64_t v1 = seed + HASH64_PRIME1 + HASH64_PRIME2;
+		uint64_t v2 = seed + HASH64_PRIME2;
+		uint64_t v3 = seed;
+		uint64_t v4 = seed - HASH64_PRIME1;
+
+		do {
+			v1 = hash64Round(v1, hash64Read64(bytes));
+			v2 = hash64Round(v2, hash64Read64(bytes + 8));
+			v3 = hash64Round(v3, hash64Read64(bytes + 16));
+			v4 = hash64Round(v4, hash64Read64(bytes + 24));
+			bytes += 32;
+		} while (bytes <= limit);
+
+		hash = HASH64_ROTL(v1, 1) + HASH64_ROTL(v2, 7) + HASH64_ROTL(v3, 12) + HASH64_ROTL(v4, 18);
+		hash = hash64MergeRound(hash, v1);
+		hash = hash64MergeRound(hash, v2);
+		hash = hash64MergeRound(hash, v3);
+		hash = hash64MergeRound(hash, v4);
+	} else {
+		hash = seed + HASH64_PRIME5;
+	}
+
+	hash += (uint64_t)len;
+
+	while ((bytes + 8) <= end) {
+		hash ^= hash64Round(0, hash64Read64(bytes));
+		hash = (HASH64_ROTL(hash, 27) * HASH64_PRIME1) + HASH64_PRIME4;
+		bytes += 8;
+	}
+	if ((bytes + 4) <= end) {
+		hash ^= (uint64_t)hash64Read32(bytes) * HASH64_PRIME1;
+		hash = (HASH64_ROTL(hash, 23) * HASH64_PRIME2) + HASH64_PRIME3;
+		bytes += 4;
+	}
+	while (bytes < end) {
+		hash ^= (uint64_t)*bytes * HASH64_PRIME5;
+		hash = HASH64_ROTL(hash, 11) * HASH64_PRIME1;
+		bytes += 1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= HASH64_PRIME2;
+	hash ^= hash >> 29;
+	hash *= HASH64_PRIME3;
+	hash ^= hash >> 32;
+
+	return hash;
+}
@@ -196,6 +196,22 @@ rankingIncrementEntry(OMRRanking *ranking, void *key, uintptr_t count)
 	}
 }
 
+uintptr_t
+rankingFindEntry(OMRRanking *ranking, void *key, uintptr_t *count)
+{
+	hashTableEntry hashTableEntryToFind;
+	hashTableEntry *foundHashTableEntryPtr;
+	hashTableEntryToFind.data = key;
+
+	foundHashTableEntryPtr = hashTableFind(ranking->hashTable, &hashTableEntryToFind);
+	if (foundHashTableEntryPtr != NULL) {
+		*count = ranking->rankTable[foundHashTableEntryPtr->rank].count;
+		return TRUE;
+	} else {
+		return FALSE;
+	}
+}
+
 static void
 updateLowestNotFull(OMRRanking *ranking, void *key, uintptr_t count)
 {
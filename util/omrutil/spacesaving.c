@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <string.h>
+
 #include "spacesaving.h"
 
 
@@ -32,6 +34,7 @@ spaceSavingNew(OMRPortLibrary *portLibrary, uint32_t size)
 		return NULL;
 	}
 	newSpaceSaving->portLib = portLibrary;
+	newSpaceSaving->errorBound = 0;
 	newSpaceSaving->ranking = rankingNew(portLibrary, size);
 	if (NULL == newSpaceSaving->ranking) {
 		return NULL;
@@ -43,6 +46,7 @@ void
 spaceSavingClear(OMRSpaceSaving *spaceSaving)
 {
 	rankingClear(spaceSaving->ranking);
+	spaceSaving->errorBound = 0;
 }
 
 /* Todo: Implement capability to tell when the algorithm isn't performing well
@@ -53,7 +57,13 @@ spaceSavingUpdate(OMRSpaceSaving *spaceSaving, void *data, uintptr_t count)
 {
 	if (rankingIncrementEntry(spaceSaving->ranking, data, count) != TRUE) { /* doesn't exist in ranking*/
 		if (spaceSaving->ranking->curSize == spaceSaving->ranking->size) {
-			rankingUpdateLowest(spaceSaving->ranking, data, rankingGetLowestCount(spaceSaving->ranking) + count);
+			uintptr_t lowestCount = rankingGetLowestCount(spaceSaving->ranking);
+
+			/* the evicted key's true count, and the new key's overestimate, are at most lowestCount */
+			if (lowestCount > spaceSaving->errorBound) {
+				spaceSaving->errorBound = lowestCount;
+			}
+			rankingUpdateLowest(spaceSaving->ranking, data, lowestCount + count);
 		} else {
 			rankingUpdateLowest(spaceSaving->ranking, data, count);
 		}
@@ -86,3 +96,150 @@ spaceSavingGetCurSize(OMRSpaceSaving *spaceSaving)
 {
 	return spaceSaving->ranking->curSize;
 }
+
+uintptr_t
+spaceSavingGetErrorBound(OMRSpaceSaving *spaceSaving)
+{
+	return spaceSaving->errorBound;
+}
+
+/* A key missing from one side may have a true count up to that side's error bound there,
+ * so it is charged that bound. Merged counts therefore stay overestimates by at most the
+ * sum of the two bounds. Candidates that do not fit are dropped like evicted keys, so the
+ * bound is raised to the smallest count kept, which is at least any dropped count.
+ */
+uintptr_t
+spaceSavingMerge(OMRSpaceSaving *spaceSaving, OMRSpaceSaving *other)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(spaceSaving->portLib);
+	OMRRanking *ranking = spaceSaving->ranking;
+	OMRRanking *otherRanking = other->ranking;
+	uintptr_t bound = spaceSavingGetErrorBound(spaceSaving);
+	uintptr_t otherBound = spaceSavingGetErrorBound(other);
+	uintptr_t mergedBound = bound + otherBound;
+	uintptr_t maxCandidates = ranking->curSize + otherRanking->curSize;
+	uintptr_t candidates = 0;
+	void **keys = NULL;
+	uintptr_t *counts = NULL;
+	uintptr_t k = 0;
+	uintptr_t i = 0;
+
+	if (0 == otherRanking->curSize) {
+		spaceSaving->errorBound = mergedBound;
+		return TRUE;
+	}
+	keys = omrmem_allocate_memory(maxCandidates * (sizeof(void *) + sizeof(uintptr_t)), OMRMEM_CATEGORY_MM);
+	if (NULL == keys) {
+		return FALSE;
+	}
+	counts = (uintptr_t *)(keys + maxCandidates);
+
+	for (k = 1; k <= ranking->curSize; k++) {
+		void *key = rankingGetKthHighest(ranking, k);
+		uintptr_t otherCount = 0;
+
+		if (!rankingFindEntry(otherRanking, key, &otherCount)) {
+			otherCount = otherBound;
+		}
+		keys[candidates] = key;
+		counts[candidates] = rankingGetKthHighestCount(ranking, k) + otherCount;
+		candidates++;
+	}
+	for (k = 1; k <= otherRanking->curSize; k++) {
+		void *key = rankingGetKthHighest(otherRanking, k);
+		uintptr_t count = 0;
+
+		if (!rankingFindEntry(ranking, key, &count)) {
+			keys[candidates] = key;
+			counts[candidates] = rankingGetKthHighestCount(otherRanking, k) + bound;
+			candidates++;
+		}
+	}
+
+	/* keep the largest counts */
+	rankingClear(ranking);
+	for (i = 0; i < candidates; i++) {
+		if ((ranking->curSize < ranking->size) || (counts[i] > rankingGetLowestCount(ranking))) {
+			rankingUpdateLowest(ranking, keys[i], counts[i]);
+		}
+	}
+	if ((candidates > ranking->size) && (rankingGetLowestCount(ranking) > mergedBound)) {
+		mergedBound = rankingGetLowestCount(ranking);
+	}
+	spaceSaving->errorBound = mergedBound;
+
+	omrmem_free_memory(keys);
+	return TRUE;
+}
+
+OMRShardedSpaceSaving *
+shardedSpaceSavingNew(OMRPortLibrary *portLibrary, uint32_t size, uint32_t shardCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRShardedSpaceSaving *sharded = omrmem_allocate_memory(sizeof(OMRShardedSpaceSaving), OMRMEM_CATEGORY_MM);
+	uint32_t i = 0;
+
+	if (NULL == sharded) {
+		return NULL;
+	}
+	sharded->portLib = portLibrary;
+	sharded->shardCount = shardCount;
+	sharded->shards = omrmem_allocate_memory(shardCount * sizeof(OMRSpaceSaving *), OMRMEM_CATEGORY_MM);
+	if (NULL == sharded->shards) {
+		omrmem_free_memory(sharded);
+		return NULL;
+	}
+	memset(sharded->shards, 0, shardCount * sizeof(OMRSpaceSaving *));
+	for (i = 0; i < shardCount; i++) {
+		sharded->shards[i] = spaceSavingNew(portLibrary, size);
+		if (NULL == sharded->shards[i]) {
+			shardedSpaceSavingFree(sharded);
+			return NULL;
+		}
+	}
+	return sharded;
+}
+
+void
+shardedSpaceSavingFree(OMRShardedSpaceSaving *sharded)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(sharded->portLib);
+	uint32_t i = 0;
+
+	for (i = 0; i < sharded->shardCount; i++) {
+		if (NULL != sharded->shards[i]) {
+			spaceSavingFree(sharded->shards[i]);
+		}
+	}
+	omrmem_free_memory(sharded->shards);
+	omrmem_free_memory(sharded);
+}
+
+void
+shardedSpaceSavingClear(OMRShardedSpaceSaving *sharded)
+{
+	uint32_t i = 0;
+
+	for (i = 0; i < sharded->shardCount; i++) {
+		spaceSavingClear(sharded->shards[i]);
+	}
+}
+
+OMRSpaceSaving *
+shardedSpaceSavingGetShard(OMRShardedSpaceSaving *sharded, uintptr_t shardIndex)
+{
+	return sharded->shards[shardIndex % sharded->shardCount];
+}
+
+uintptr_t
+shardedSpaceSavingMerge(OMRShardedSpaceSaving *sharded, OMRSpaceSaving *result)
+{
+	uint32_t i = 0;
+
+	for (i = 0; i < sharded->shardCount; i++) {
+		if (!spaceSavingMerge(result, sharded->shards[i])) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
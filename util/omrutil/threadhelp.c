@@ -25,6 +25,8 @@
 #include "thread_api.h"
 
 static intptr_t failedToSetAttr(intptr_t rc);
+static intptr_t threadCreate(omrthread_t *handle, uintptr_t stacksize, uintptr_t priority, uintptr_t suspend,
+	omrthread_entrypoint_t entrypoint, void *entryarg, uint32_t category, BOOLEAN isJoinable);
 
 /*
  * See omrutil.h for doc
@@ -32,6 +34,48 @@ static intptr_t failedToSetAttr(intptr_t rc);
 intptr_t
 createThreadWithCategory(omrthread_t *handle, uintptr_t stacksize, uintptr_t priority, uintptr_t suspend,
 						 omrthread_entrypoint_t entrypoint, void *entryarg, uint32_t category)
+{
+	return threadCreate(handle, stacksize, priority, suspend, entrypoint, entryarg, category, FALSE);
+}
+
+/*
+ * See omrutil.h for doc
+ */
+intptr_t
+createJoinableThreadWithCategory(omrthread_t *handle, uintptr_t stacksize, uintptr_t priority, uintptr_t suspend,
+						 omrthread_entrypoint_t entrypoint, void *entryarg, uint32_t category)
+{
+	return threadCreate(handle, stacksize, priority, suspend, entrypoint, entryarg, category, TRUE);
+}
+
+/*
+ * See omrutil.h for doc
+ */
+intptr_t
+attachThreadWithCategory(omrthread_t *handle, uint32_t category)
+{
+	omrthread_attr_t attr;
+	intptr_t rc = J9THREAD_SUCCESS;
+
+	if (J9THREAD_SUCCESS != omrthread_attr_init(&attr)) {
+		return J9THREAD_ERR_CANT_ALLOC_ATTACH_ATTR;
+	}
+
+	if (failedToSetAttr(omrthread_attr_set_category(&attr, category))) {
+		rc = J9THREAD_ERR_INVALID_ATTACH_ATTR;
+		goto destroy_attr;
+	}
+
+	rc = omrthread_attach_ex(handle, &attr);
+
+destroy_attr:
+	omrthread_attr_destroy(&attr);
+	return rc;
+}
+
+static intptr_t
+threadCreate(omrthread_t *handle, uintptr_t stacksize, uintptr_t priority, uintptr_t suspend,
+			 omrthread_entrypoint_t entrypoint, void *entryarg, uint32_t category, BOOLEAN isJoinable)
 {
 	omrthread_attr_t attr;
 	intptr_t rc = J9THREAD_SUCCESS;
@@ -61,32 +105,12 @@ createThreadWithCategory(omrthread_t *handle, uintptr_t stacksize, uintptr_t pri
 		goto destroy_attr;
 	}
 
-	rc = omrthread_create_ex(handle, &attr, suspend, entrypoint, entryarg);
-
-destroy_attr:
-	omrthread_attr_destroy(&attr);
-	return rc;
-}
-
-/*
- * See omrutil.h for doc
- */
-intptr_t
-attachThreadWithCategory(omrthread_t *handle, uint32_t category)
-{
-	omrthread_attr_t attr;
-	intptr_t rc = J9THREAD_SUCCESS;
-
-	if (J9THREAD_SUCCESS != omrthread_attr_init(&attr)) {
-		return J9THREAD_ERR_CANT_ALLOC_ATTACH_ATTR;
-	}
-
-	if (failedToSetAttr(omrthread_attr_set_category(&attr, category))) {
-		rc = J9THREAD_ERR_INVALID_ATTACH_ATTR;
+	if (isJoinable && failedToSetAttr(omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))) {
+		rc = J9THREAD_ERR_INVALID_CREATE_ATTR;
 		goto destroy_attr;
 	}
 
-	rc = omrthread_attach_ex(handle, &attr);
+	rc = omrthread_create_ex(handle, &attr, suspend, entrypoint, entryarg);
 
 destroy_attr:
 	omrthread_attr_destroy(&attr);
@@ -0,0 +1,455 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Whole-buffer conversion between modified UTF-8 and UTF-16.
+ *
+ * Text handled by the runtime is mostly ASCII, so each routine hands runs of
+ * ASCII (0x01-0x7F) to a block function that checks and converts a vector's
+ * worth of units at a time, and falls back to decodeUTF8CharN or
+ * encodeUTF8CharN for every other character.  The results are exactly those
+ * of calling the per-character routines in a loop.
+ */
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#if defined(J9HAMMER) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define OMR_UTF8_X86_ACCELERATED
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define OMR_UTF8_TARGET(features)
+#else /* defined(_MSC_VER) */
+#define OMR_UTF8_TARGET(features) __attribute__((target(features)))
+#endif /* defined(_MSC_VER) */
+#endif /* defined(J9HAMMER) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)) */
+
+#define UTF8_IS_ASCII(c) (((c) >= 0x01) && ((c) <= 0x7F))
+
+/*
+ * Block functions consume whole blocks from the start of the input for as
+ * long as every unit in the block is ASCII, and return the number of units
+ * consumed.  Units past the last whole block are left to the caller.
+ */
+typedef uintptr_t (*utf8AsciiPrefixFunction)(const uint8_t *input, uintptr_t length);
+typedef uintptr_t (*utf8WidenAsciiFunction)(const uint8_t *input, uintptr_t length, uint16_t *output);
+typedef uintptr_t (*utf8NarrowAsciiFunction)(const uint16_t *input, uintptr_t length, uint8_t *output);
+
+static uintptr_t asciiPrefixWord(const uint8_t *input, uintptr_t length);
+static uintptr_t widenAsciiWord(const uint8_t *input, uintptr_t length, uint16_t *output);
+static uintptr_t narrowAsciiWord(const uint16_t *input, uintptr_t length, uint8_t *output);
+#if defined(OMR_UTF8_X86_ACCELERATED)
+static uintptr_t asciiPrefixSse2(const uint8_t *input, uintptr_t length);
+static uintptr_t widenAsciiSse2(const uint8_t *input, uintptr_t length, uint16_t *output);
+static uintptr_t narrowAsciiSse2(const uint16_t *input, uintptr_t length, uint8_t *output);
+static uintptr_t asciiPrefixAvx2(const uint8_t *input, uintptr_t length);
+static uintptr_t widenAsciiAvx2(const uint8_t *input, uintptr_t length, uint16_t *output);
+static uintptr_t narrowAsciiAvx2(const uint16_t *input, uintptr_t length, uint8_t *output);
+
+/* SSE2 is part of the x86-64 baseline, so it is the default there */
+#define UTF8_DEFAULT_ASCII_PREFIX asciiPrefixSse2
+#define UTF8_DEFAULT_WIDEN_ASCII widenAsciiSse2
+#define UTF8_DEFAULT_NARROW_ASCII narrowAsciiSse2
+#else /* defined(OMR_UTF8_X86_ACCELERATED) */
+#define UTF8_DEFAULT_ASCII_PREFIX asciiPrefixWord
+#define UTF8_DEFAULT_WIDEN_ASCII widenAsciiWord
+#define UTF8_DEFAULT_NARROW_ASCII narrowAsciiWord
+#endif /* defined(OMR_UTF8_X86_ACCELERATED) */
+
+static utf8AsciiPrefixFunction asciiPrefix = UTF8_DEFAULT_ASCII_PREFIX;
+static utf8WidenAsciiFunction widenAscii = UTF8_DEFAULT_WIDEN_ASCII;
+static utf8NarrowAsciiFunction narrowAscii = UTF8_DEFAULT_NARROW_ASCII;
+
+#define UTF8_WORD_ONES J9CONST_U64(0x0101010101010101)
+#define UTF8_WORD_HIGH_BITS J9CONST_U64(0x8080808080808080)
+#define UTF16_WORD_ONES J9CONST_U64(0x0001000100010001)
+#define UTF16_WORD_NON_ASCII_BITS J9CONST_U64(0xFF80FF80FF80FF80)
+
+/*
+ * Portable blocks of 8 bytes or 4 UTF-16 units.  A lane is flagged if it has
+ * a non-ASCII bit set, or if it is zero: subtracting one from a zero lane
+ * borrows and sets its top bit.  Borrows only start at zero lanes, so they
+ * never flag a block that is otherwise ASCII.
+ */
+static uintptr_t
+asciiPrefixWord(const uint8_t *input, uintptr_t length)
+{
+	uintptr_t done = 0;
+
+	while ((done + 8) <= length) {
+		uint64_t word = 0;
+
+		memcpy(&word, input + done, sizeof(word));
+		if (0 != ((word | (word - UTF8_WORD_ONES)) & UTF8_WORD_HIGH_BITS)) {
+			break;
+		}
+		done += 8;
+	}
+	return done;
+}
+
+static uintptr_t
+widenAsciiWord(const uint8_t *input, uintptr_t length, uint16_t *output)
+{
+	uintptr_t done = asciiPrefixWord(input, length);
+	uintptr_t i = 0;
+
+	for (i = 0; i < done; i++) {
+		output[i] = input[i];
+	}
+	return done;
+}
+
+static uintptr_t
+narrowAsciiWord(const uint16_t *input, uintptr_t length, uint8_t *output)
+{
+	uintptr_t done = 0;
+
+	while ((done + 4) <= length) {
+		uint64_t word = 0;
+
+		memcpy(&word, input + done, sizeof(word));
+		if (0 != ((word | (word - UTF16_WORD_ONES)) & UTF16_WORD_NON_ASCII_BITS)) {
+			break;
+		}
+		output[done] = (uint8_t)input[done];
+		output[done + 1] = (uint8_t)input[done + 1];
+		output[done + 2] = (uint8_t)input[done + 2];
+		output[done + 3] = (uint8_t)input[done + 3];
+		done += 4;
+	}
+	return done;
+}
+
+#if defined(OMR_UTF8_X86_ACCELERATED)
+
+/*
+ * A byte is rejected if its top bit is set or it compares equal to zero;
+ * or-ing the two lets a single movemask test the whole block.  Each vector
+ * routine passes what is left to the next narrower one.
+ */
+static uintptr_t
+asciiPrefixSse2(const uint8_t *input, uintptr_t length)
+{
+	const __m128i zero = _mm_setzero_si128();
+	uintptr_t done = 0;
+
+	while ((done + 16) <= length) {
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(input + done));
+
+		if (0 != _mm_movemask_epi8(_mm_or_si128(bytes, _mm_cmpeq_epi8(bytes, zero)))) {
+			break;
+		}
+		done += 16;
+	}
+	return done + asciiPrefixWord(input + done, length - done);
+}
+
+static uintptr_t
+widenAsciiSse2(const uint8_t *input, uintptr_t length, uint16_t *output)
+{
+	const __m128i zero = _mm_setzero_si128();
+	uintptr_t done = 0;
+
+	while ((done + 16) <= length) {
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(input + done));
+
+		if (0 != _mm_movemask_epi8(_mm_or_si128(bytes, _mm_cmpeq_epi8(bytes, zero)))) {
+			break;
+		}
+		_mm_storeu_si128((__m128i *)(output + done), _mm_unpacklo_epi8(bytes, zero));
+		_mm_storeu_si128((__m128i *)(output + done + 8), _mm_unpackhi_epi8(bytes, zero));
+		done += 16;
+	}
+	return done + widenAsciiWord(input + done, length - done, output + done);
+}
+
+/* A unit is ASCII if none of the bits in 0xFF80 are set and it is not zero */
+static uintptr_t
+narrowAsciiSse2(const uint16_t *input, uintptr_t length, uint8_t *output)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+	uintptr_t done = 0;
+
+	while ((done + 16) <= length) {
+		__m128i low = _mm_loadu_si128((const __m128i *)(input + done));
+		__m128i high = _mm_loadu_si128((const __m128i *)(input + done + 8));
+		__m128i lowBad = _mm_or_si128(_mm_and_si128(low, nonAscii), _mm_cmpeq_epi16(low, zero));
+		__m128i highBad = _mm_or_si128(_mm_and_si128(high, nonAscii), _mm_cmpeq_epi16(high, zero));
+
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_or_si128(lowBad, highBad), zero))) {
+			break;
+		}
+		_mm_storeu_si128((__m128i *)(output + done), _mm_packus_epi16(low, high));
+		done += 16;
+	}
+	return done + narrowAsciiWord(input + done, length - done, output + done);
+}
+
+/*
+ * The SSE2 routines that finish each AVX2 routine are not VEX encoded, so the
+ * upper halves of the ymm registers are cleared first to avoid the penalty
+ * for mixing the two encodings.
+ */
+OMR_UTF8_TARGET("avx2") static uintptr_t
+asciiPrefixAvx2(const uint8_t *input, uintptr_t length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	uintptr_t done = 0;
+
+	while ((done + 32) <= length) {
+		__m256i bytes = _mm256_loadu_si256((const __m256i *)(input + done));
+
+		if (0 != _mm256_movemask_epi8(_mm256_or_si256(bytes, _mm256_cmpeq_epi8(bytes, zero)))) {
+			break;
+		}
+		done += 32;
+	}
+	_mm256_zeroupper();
+	return done + asciiPrefixSse2(input + done, length - done);
+}
+
+OMR_UTF8_TARGET("avx2") static uintptr_t
+widenAsciiAvx2(const uint8_t *input, uintptr_t length, uint16_t *output)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	uintptr_t done = 0;
+
+	while ((done + 32) <= length) {
+		__m256i bytes = _mm256_loadu_si256((const __m256i *)(input + done));
+
+		if (0 != _mm256_movemask_epi8(_mm256_or_si256(bytes, _mm256_cmpeq_epi8(bytes, zero)))) {
+			break;
+		}
+		_mm256_storeu_si256((__m256i *)(output + done), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+		_mm256_storeu_si256((__m256i *)(output + done + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+		done += 32;
+	}
+	_mm256_zeroupper();
+	return done + widenAsciiSse2(input + done, length - done, output + done);
+}
+
+OMR_UTF8_TARGET("avx2") static uintptr_t
+narrowAsciiAvx2(const uint16_t *input, uintptr_t length, uint8_t *output)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i nonAscii = _mm256_set1_epi16((short)0xFF80);
+	uintptr_t done = 0;
+
+	while ((done + 32) <= length) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)(input + done));
+		__m256i high = _mm256_loadu_si256((const __m256i *)(input + done + 16));
+		__m256i lowBad = _mm256_or_si256(_mm256_and_si256(low, nonAscii), _mm256_cmpeq_epi16(low, zero));
+		__m256i highBad = _mm256_or_si256(_mm256_and_si256(high, nonAscii), _mm256_cmpeq_epi16(high, zero));
+		__m256i bad = _mm256_or_si256(lowBad, highBad);
+
+		if (!_mm256_testz_si256(bad, bad)) {
+			break;
+		}
+		/* packus works within 128-bit lanes, so put the 64-bit quarters back in order */
+		_mm256_storeu_si256((__m256i *)(output + done),
+			_mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8));
+		done += 32;
+	}
+	_mm256_zeroupper();
+	return done + narrowAsciiSse2(input + done, length - done, output + done);
+}
+
+#endif /* defined(OMR_UTF8_X86_ACCELERATED) */
+
+void
+selectUTF8StringImplementation(OMRPortLibrary *portLibrary)
+{
+	utf8AsciiPrefixFunction prefix = UTF8_DEFAULT_ASCII_PREFIX;
+	utf8WidenAsciiFunction widen = UTF8_DEFAULT_WIDEN_ASCII;
+	utf8NarrowAsciiFunction narrow = UTF8_DEFAULT_NARROW_ASCII;
+
+#if defined(OMR_UTF8_X86_ACCELERATED)
+	if (NULL != portLibrary) {
+		OMRProcessorDesc desc;
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+		/* AVX2 also needs the operating system to preserve the ymm registers */
+		if ((0 == omrsysinfo_get_processor_description(&desc))
+			&& omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_AVX2)
+			&& omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_XSAVE_AVX)
+		) {
+			prefix = asciiPrefixAvx2;
+			widen = widenAsciiAvx2;
+			narrow = narrowAsciiAvx2;
+		}
+	}
+#endif /* defined(OMR_UTF8_X86_ACCELERATED) */
+
+	asciiPrefix = prefix;
+	widenAscii = widen;
+	narrowAscii = narrow;
+}
+
+/**
+ * Validate a buffer of modified UTF-8.
+ *
+ * @param[in] input The UTF-8 bytes
+ * @param[in] inputLength The number of bytes in input
+ *
+ * @return The number of UTF-16 units the buffer decodes to, or -1 if any
+ * character would be rejected by decodeUTF8CharN
+ */
+intptr_t
+validateUTF8String(const uint8_t *input, uintptr_t inputLength)
+{
+	const uint8_t *cursor = input;
+	const uint8_t *end = input + inputLength;
+	uintptr_t units = 0;
+
+	while (cursor < end) {
+		if (UTF8_IS_ASCII(*cursor)) {
+			uintptr_t run = asciiPrefix(cursor, (uintptr_t)(end - cursor));
+
+			if (0 == run) {
+				run = 1;
+			}
+			cursor += run;
+			units += run;
+		} else {
+			uint16_t unicode = 0;
+			uint32_t consumed = decodeUTF8CharN(cursor, &unicode, (uintptr_t)(end - cursor));
+
+			if (0 == consumed) {
+				return -1;
+			}
+			cursor += consumed;
+			units += 1;
+		}
+	}
+	return (intptr_t)units;
+}
+
+/**
+ * Decode a buffer of modified UTF-8 into UTF-16.
+ *
+ * @param[in] input The UTF-8 bytes
+ * @param[in] inputLength The number of bytes in input
+ * @param[out] output buffer for the UTF-16 units
+ * @param[in] outputLength The number of units available in output
+ *
+ * @return The number of UTF-16 units written, or -1 if the input is not valid
+ * or output is too small
+ * @note The contents of output are undefined on failure
+ */
+intptr_t
+decodeUTF8String(const uint8_t *input, uintptr_t inputLength, uint16_t *output, uintptr_t outputLength)
+{
+	const uint8_t *cursor = input;
+	const uint8_t *end = input + inputLength;
+	uint16_t *outCursor = output;
+	uint16_t *outEnd = output + outputLength;
+
+	while (cursor < end) {
+		if (outCursor == outEnd) {
+			return -1;
+		}
+		if (UTF8_IS_ASCII(*cursor)) {
+			uintptr_t inputLeft = (uintptr_t)(end - cursor);
+			uintptr_t outputLeft = (uintptr_t)(outEnd - outCursor);
+			uintptr_t run = widenAscii(cursor, OMR_MIN(inputLeft, outputLeft), outCursor);
+
+			if (0 == run) {
+				*outCursor = *cursor;
+				run = 1;
+			}
+			cursor += run;
+			outCursor += run;
+		} else {
+			uint32_t consumed = decodeUTF8CharN(cursor, outCursor, (uintptr_t)(end - cursor));
+
+			if (0 == consumed) {
+				return -1;
+			}
+			cursor += consumed;
+			outCursor += 1;
+		}
+	}
+	return (intptr_t)(outCursor - output);
+}
+
+/**
+ * Encode a buffer of UTF-16 as modified UTF-8.
+ *
+ * @param[in] input The UTF-16 units
+ * @param[in] inputLength The number of units in input
+ * @param[out] output buffer for the UTF-8 bytes
+ * @param[in] outputLength The number of bytes available in output
+ *
+ * @return The number of bytes written, or -1 if output is too small
+ * @note If output is NULL then outputLength is ignored and the number of
+ * bytes required to encode the input is returned.
+ * @note The contents of output are undefined on failure
+ */
+intptr_t
+encodeUTF8String(const uint16_t *input, uintptr_t inputLength, uint8_t *output, uintptr_t outputLength)
+{
+	const uint16_t *cursor = input;
+	const uint16_t *end = input + inputLength;
+	uintptr_t written = 0;
+
+	if (NULL == output) {
+		while (cursor < end) {
+			written += encodeUTF8CharN(*cursor++, NULL, 0);
+		}
+		return (intptr_t)written;
+	}
+
+	while (cursor < end) {
+		uintptr_t outputLeft = outputLength - written;
+
+		if (UTF8_IS_ASCII(*cursor)) {
+			uintptr_t inputLeft = (uintptr_t)(end - cursor);
+			uintptr_t run = 0;
+
+			if (0 == outputLeft) {
+				return -1;
+			}
+			run = narrowAscii(cursor, OMR_MIN(inputLeft, outputLeft), output + written);
+			if (0 == run) {
+				output[written] = (uint8_t)*cursor;
+				run = 1;
+			}
+			cursor += run;
+			written += run;
+		} else {
+			uint32_t size = encodeUTF8CharN(*cursor, output + written, (uint32_t)OMR_MIN(outputLeft, (uintptr_t)3));
+
+			if (0 == size) {
+				return -1;
+			}
+			cursor += 1;
+			written += size;
+		}
+	}
+	return (intptr_t)written;
+}
@@ -38,9 +38,6 @@
 #define LINK_TO_FREE_LIST(prev, toAdd) SRP_PTR_SET((uintptr_t *)prev, toAdd)
 #define LINK_TO_NULL(prev) SRP_PTR_SET_TO_NULL(prev)
 
-#define PUDDLE_BITS(puddle) ((uint32_t *) ((J9PoolPuddle *) (puddle) + 1))
-#define POOL_PUDDLE_BITS_LEN(pool) (((pool)->elementsPerPuddle+31) / 32)
-#define PUDDLE_SLOT_FREE(puddle, sindex) (*(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) & (1 << (31 - (((uint32_t)(sindex)) & 31))))
 #define MARK_SLOT_FREE(puddle, sindex) do { *(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) |=  (1 << (31 - (((uint32_t)(sindex)) & 31))); } while (0)
 #define MARK_SLOT_USED(puddle, sindex) do { *(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) &= ~(1 << (31 - (((uint32_t)(sindex)) & 31))); } while (0)
 
@@ -58,7 +55,7 @@
  *
  * @return A pointer to the SRP to the puddle containing the specified element.
  */
-static J9SRP *
+J9SRP *
 pool_getElementPuddleSRP(J9Pool *pool, void *element)
 {
 	J9SRP *puddleSRP;
@@ -83,7 +80,7 @@ pool_getElementPuddleSRP(J9Pool *pool, void *element)
  *
  * @return The element's index in the puddle, or -1 if the element is not in the puddle.
  */
-static int32_t
+int32_t
 pool_getElementPuddleSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element)
 {
 	int32_t returnValue = -1;
@@ -152,6 +149,11 @@ poolPuddle_init(J9Pool *pool, J9PoolPuddle *puddle)
 		}
 	}
 	LINK_TO_NULL(freeLocation);
+
+	puddle->freeSlotStack = 0;
+	if (pool->flags & POOL_THREAD_SAFE) {
+		poolPuddle_initFreeSlotStack(pool, puddle);
+	}
 }
 
 /**
@@ -264,6 +266,11 @@ poolPuddle_delete(J9Pool *pool, J9PoolPuddle *puddle)
  *
  * @return pointer to a new pool, or NULL if the pool could not be created.
  *
+ * With POOL_THREAD_SAFE, pool_newElement and pool_removeElement may be called from any number
+ * of threads at once, and threads may cache elements through pool_threadCacheNew. The pool then
+ * implies POOL_NEVER_FREE_PUDDLES. pool_startDo, pool_nextDo, pool_numElements,
+ * pool_clear and pool_ensureCapacity must not run concurrently with other operations.
+ *
  */
 J9Pool *
 pool_new(uintptr_t structSizeArg,
@@ -309,6 +316,11 @@ pool_new(uintptr_t structSizeArg,
 
 	poolFlags &= ~POOL_USES_HOLES;
 
+	if (poolFlags & POOL_THREAD_SAFE) {
+		/* Puddles of a thread safe pool may be read by racing threads at any time. */
+		poolFlags |= POOL_NEVER_FREE_PUDDLES;
+	}
+
 	switch (roundedStructSize) {
 	case 4:
 	case 8:
@@ -392,6 +404,7 @@ pool_new(uintptr_t structSizeArg,
 		pool->memFree = memFree;
 		pool->userData = userData;
 		pool->memoryCategory = memoryCategory;
+		memset(&pool->contentionStats, 0, sizeof(pool->contentionStats));
 
 		doInit = 1;
 		puddleList = memAlloc(userData, sizeof(J9PoolPuddleList), poolCreatorCallsite, memoryCategory, POOL_ALLOC_TYPE_PUDDLE_LIST, &doInit);
@@ -490,6 +503,12 @@ pool_newElement(J9Pool *pool)
 		return NULL;
 	}
 
+	if (pool->flags & POOL_THREAD_SAFE) {
+		newElement = pool_newElementConcurrent(pool);
+		Trc_pool_newElement_Exit(newElement);
+		return newElement;
+	}
+
 	/* Check if there is a puddle with free slots - if so use it. */
 	puddleList = J9POOL_PUDDLELIST(pool);
 
@@ -581,6 +600,12 @@ pool_removeElement(J9Pool *pool, void *anElement)
 		return;
 	}
 
+	if (pool->flags & POOL_THREAD_SAFE) {
+		pool_removeElementConcurrent(pool, anElement);
+		Trc_pool_removeElement_Exit();
+		return;
+	}
+
 	puddleList = J9POOL_PUDDLELIST(pool);
 	puddleSRP = pool_getElementPuddleSRP(pool, anElement);
 	puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
@@ -670,6 +695,16 @@ pool_numElements(J9Pool *pool)
 	Trc_pool_numElements_Entry(pool);
 
 	puddleList = J9POOL_PUDDLELIST(pool);
+	if (pool->flags & POOL_THREAD_SAFE) {
+		/* Thread safe pools only keep the count in the puddle bits */
+		J9PoolPuddle *walk = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList);
+
+		puddleList->numElements = 0;
+		while (NULL != walk) {
+			puddleList->numElements += poolPuddle_countUsedElements(pool, walk);
+			walk = J9POOLPUDDLE_NEXTPUDDLE(walk);
+		}
+	}
 	numElements = puddleList->numElements;
 
 	Trc_pool_numElements_Exit(numElements);
@@ -707,6 +742,11 @@ poolPuddle_startDo(J9Pool *pool, J9PoolPuddle *currentPuddle, pool_state *state,
 		return NULL;
 	}
 
+	if (pool->flags & POOL_THREAD_SAFE) {
+		/* Thread safe pools only keep the count in the puddle bits */
+		currentPuddle->usedElements = poolPuddle_countUsedElements(pool, currentPuddle);
+	}
+
 	if (0 == currentPuddle->usedElements) {	/* this puddle is empty */
 		Trc_poolPuddle_startDo_EmptyExit();
 		if ((currentPuddle->nextPuddle != 0) && (followNextPointers != 0)) {
@@ -0,0 +1,563 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Pool
+ * @brief Lock-free element management and thread caches for POOL_THREAD_SAFE pools
+ */
+
+#include <string.h>
+
+#include "pool_internal.h"
+#include "AtomicSupport.hpp"
+#include "ut_pool.h"
+
+extern "C" {
+
+/* A puddle's free slot stack holds a slot reference (slot index + 1, 0 when empty) in its low
+ * 32 bits and a tag in its high 32 bits. Every push and pop bumps the tag, so a pop that raced
+ * with a pop and re-push of the same head slot fails its compare and swap instead of installing
+ * a stale link. Free elements link to the next free slot reference through their first 4 bytes.
+ */
+#define STACK_REF(stack) ((uint32_t)(stack))
+#define STACK_TAG(stack) ((uint32_t)((stack) >> 32))
+#define STACK_MAKE(tag, ref) ((((uint64_t)(tag)) << 32) | (uint64_t)(ref))
+#define SLOT_LINK(element) (*(volatile uint32_t *)(element))
+#define SLOT_BIT(slot) ((uint32_t)1 << (31 - ((slot) & 31)))
+#define SLOT_WORD(puddle, slot) ((volatile uint32_t *)(PUDDLE_BITS(puddle) + ((slot) >> 5)))
+#define COUNT_CONTENTION(pool, counter) VM_AtomicSupport::add(&(pool)->contentionStats.counter, 1)
+
+static VMINLINE void *
+poolPuddle_slotElement(J9Pool *pool, J9PoolPuddle *puddle, uint32_t ref)
+{
+	return (void *)((uintptr_t)J9POOLPUDDLE_FIRSTELEMENTADDRESS(puddle) + (pool->elementSize * (ref - 1)));
+}
+
+/**
+ * Pop the top free slot of a puddle.
+ *
+ * Puddles of a thread safe pool are never freed while the pool is alive, so the link of an
+ * element that another thread has already taken may safely be read; the compare and swap
+ * then fails on the tag.
+ *
+ * @param[in] pool   The pool containing the puddle.
+ * @param[in] puddle The puddle to pop from.
+ *
+ * @return The reference of the popped slot, or 0 if the puddle had no free slots.
+ */
+static uint32_t
+poolPuddle_popFreeSlot(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	volatile uint64_t *stack = &puddle->freeSlotStack;
+	uint64_t oldStack = VM_AtomicSupport::getU64(stack);
+
+	while (0 != STACK_REF(oldStack)) {
+		uint32_t ref = STACK_REF(oldStack);
+		uint32_t nextRef = SLOT_LINK(poolPuddle_slotElement(pool, puddle, ref));
+		uint64_t newStack = STACK_MAKE(STACK_TAG(oldStack) + 1, nextRef);
+		uint64_t seenStack = VM_AtomicSupport::lockCompareExchangeU64(stack, oldStack, newStack);
+
+		if (seenStack == oldStack) {
+			return ref;
+		}
+		COUNT_CONTENTION(pool, casRetries);
+		oldStack = seenStack;
+	}
+
+	return 0;
+}
+
+/**
+ * Take every free slot of a puddle at once.
+ *
+ * @param[in] pool   The pool containing the puddle.
+ * @param[in] puddle The puddle to empty.
+ *
+ * @return The reference of the first slot of the taken chain, or 0 if the puddle had no free slots.
+ */
+static uint32_t
+poolPuddle_takeFreeSlots(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	volatile uint64_t *stack = &puddle->freeSlotStack;
+	uint64_t oldStack = VM_AtomicSupport::getU64(stack);
+
+	while (0 != STACK_REF(oldStack)) {
+		uint64_t newStack = STACK_MAKE(STACK_TAG(oldStack) + 1, 0);
+		uint64_t seenStack = VM_AtomicSupport::lockCompareExchangeU64(stack, oldStack, newStack);
+
+		if (seenStack == oldStack) {
+			return STACK_REF(oldStack);
+		}
+		COUNT_CONTENTION(pool, casRetries);
+		oldStack = seenStack;
+	}
+
+	return 0;
+}
+
+/**
+ * Push a chain of free slots onto a puddle's free slot stack.
+ *
+ * @param[in] pool        The pool containing the puddle.
+ * @param[in] puddle      The puddle owning every slot of the chain.
+ * @param[in] firstRef    The reference of the first slot of the chain.
+ * @param[in] lastElement The element of the last slot of the chain; its link is overwritten.
+ */
+static void
+poolPuddle_pushFreeSlots(J9Pool *pool, J9PoolPuddle *puddle, uint32_t firstRef, void *lastElement)
+{
+	volatile uint64_t *stack = &puddle->freeSlotStack;
+	uint64_t oldStack = VM_AtomicSupport::getU64(stack);
+
+	for (;;) {
+		uint64_t newStack = STACK_MAKE(STACK_TAG(oldStack) + 1, firstRef);
+		uint64_t seenStack = 0;
+
+		SLOT_LINK(lastElement) = STACK_REF(oldStack);
+		VM_AtomicSupport::writeBarrier();
+		seenStack = VM_AtomicSupport::lockCompareExchangeU64(stack, oldStack, newStack);
+		if (seenStack == oldStack) {
+			break;
+		}
+		COUNT_CONTENTION(pool, casRetries);
+		oldStack = seenStack;
+	}
+}
+
+/**
+ * Mark a slot allocated and prepare its element for the caller.
+ *
+ * @param[in] pool   The pool containing the puddle.
+ * @param[in] puddle The puddle containing the slot.
+ * @param[in] ref    The reference of the slot, already unlinked from any free chain.
+ *
+ * @return The element.
+ */
+static void *
+poolPuddle_allocateSlot(J9Pool *pool, J9PoolPuddle *puddle, uint32_t ref)
+{
+	uint32_t slot = ref - 1;
+	void *element = poolPuddle_slotElement(pool, puddle, ref);
+	J9SRP *puddleSRP = NULL;
+
+	VM_AtomicSupport::bitAndU32(SLOT_WORD(puddle, slot), ~SLOT_BIT(slot));
+	if (!(pool->flags & POOL_NO_ZERO)) {
+		memset(element, 0, pool->elementSize);
+	}
+	puddleSRP = pool_getElementPuddleSRP(pool, element);
+	NNSRP_SET(*puddleSRP, puddle);
+
+	return element;
+}
+
+/**
+ * Mark the slot of an allocated element free. The slot is not linked into any free chain.
+ *
+ * @param[in]  pool      The pool containing the element.
+ * @param[in]  anElement The element being freed.
+ * @param[out] puddleOut The puddle containing the element.
+ *
+ * @return The reference of the element's slot, or 0 if the element is not allocated from the pool.
+ */
+static uint32_t
+pool_releaseSlot(J9Pool *pool, void *anElement, J9PoolPuddle **puddleOut)
+{
+	J9SRP *puddleSRP = pool_getElementPuddleSRP(pool, anElement);
+	J9PoolPuddle *puddle = NNSRP_GET(*puddleSRP, J9PoolPuddle *);
+	int32_t slot = pool_getElementPuddleSlot(pool, puddle, anElement);
+	uint32_t oldBits = 0;
+
+	if (slot < 0) {
+		Trc_pool_removeElement_NotFound(anElement, J9POOLPUDDLELIST_NEXTPUDDLE(J9POOL_PUDDLELIST(pool)));
+		return 0;
+	}
+
+	oldBits = VM_AtomicSupport::bitOrU32(SLOT_WORD(puddle, slot), SLOT_BIT(slot));
+	if (0 != (oldBits & SLOT_BIT(slot))) {
+		/* The slot was already free. */
+		Trc_pool_removeElement_NotFound(anElement, puddle);
+		return 0;
+	}
+
+	*puddleOut = puddle;
+	return (uint32_t)slot + 1;
+}
+
+/**
+ * Find a puddle with free slots, starting with the puddle that last had some, and pop
+ * one free slot or take all of them.
+ *
+ * @param[in]  pool      The pool to search.
+ * @param[in]  takeAll   If true, take the puddle's whole free slot chain.
+ * @param[out] puddleOut The puddle the slots were taken from.
+ *
+ * @return The reference of the first slot taken, or 0 if no puddle had free slots.
+ */
+static uint32_t
+pool_findFreeSlots(J9Pool *pool, bool takeAll, J9PoolPuddle **puddleOut)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	J9PoolPuddle *hint = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
+	J9PoolPuddle *walk = NULL;
+	uint32_t ref = 0;
+
+	if (NULL != hint) {
+		ref = takeAll ? poolPuddle_takeFreeSlots(pool, hint) : poolPuddle_popFreeSlot(pool, hint);
+		if (0 != ref) {
+			*puddleOut = hint;
+			return ref;
+		}
+	}
+
+	COUNT_CONTENTION(pool, puddleScans);
+	for (walk = J9POOLPUDDLELIST_NEXTPUDDLE(puddleList); NULL != walk; walk = J9POOLPUDDLE_NEXTPUDDLE(walk)) {
+		if (walk != hint) {
+			ref = takeAll ? poolPuddle_takeFreeSlots(pool, walk) : poolPuddle_popFreeSlot(pool, walk);
+			if (0 != ref) {
+				/* The hint is only advisory, so racing updates are harmless. */
+				NNWSRP_SET(puddleList->nextAvailablePuddle, walk);
+				*puddleOut = walk;
+				return ref;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Allocate a new puddle, take free slots from it before it is published, and push it
+ * onto the head of the pool's puddle list.
+ *
+ * @param[in]  pool    The pool to grow.
+ * @param[in]  takeAll If true, take the whole free slot chain of the new puddle, otherwise one slot.
+ * @param[out] refOut  The reference of the first slot taken.
+ *
+ * @return The new puddle, or NULL if it could not be allocated.
+ */
+static J9PoolPuddle *
+pool_addPuddleConcurrent(J9Pool *pool, bool takeAll, uint32_t *refOut)
+{
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	J9PoolPuddle *puddle = poolPuddle_new(pool);
+
+	if (NULL != puddle) {
+		volatile uintptr_t *headSRP = (volatile uintptr_t *)&puddleList->nextPuddle;
+		uintptr_t oldValue = *headSRP;
+
+		*refOut = takeAll ? poolPuddle_takeFreeSlots(pool, puddle) : poolPuddle_popFreeSlot(pool, puddle);
+
+		for (;;) {
+			/* puddleList->nextPuddle is a wide self relative pointer, never NULL. */
+			J9PoolPuddle *head = (J9PoolPuddle *)((uintptr_t)headSRP + oldValue);
+			uintptr_t newValue = (uintptr_t)puddle - (uintptr_t)headSRP;
+			uintptr_t seenValue = 0;
+
+			NNWSRP_SET(puddle->nextPuddle, head);
+			VM_AtomicSupport::writeBarrier();
+			seenValue = VM_AtomicSupport::lockCompareExchange(headSRP, oldValue, newValue);
+			if (seenValue == oldValue) {
+				NNWSRP_SET(head->prevPuddle, puddle);
+				break;
+			}
+			COUNT_CONTENTION(pool, casRetries);
+			oldValue = seenValue;
+		}
+
+		if (!takeAll) {
+			NNWSRP_SET(puddleList->nextAvailablePuddle, puddle);
+		}
+		COUNT_CONTENTION(pool, puddlesAdded);
+	}
+
+	return puddle;
+}
+
+void
+poolPuddle_initFreeSlotStack(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	uintptr_t *element = J9POOLPUDDLE_FIRSTFREESLOT(puddle);
+	uint32_t firstRef = 0;
+
+	if (NULL != element) {
+		firstRef = (uint32_t)pool_getElementPuddleSlot(pool, puddle, element) + 1;
+	}
+
+	/* Rewrite the SRP free list as a chain of slot references, in the same order. */
+	while (NULL != element) {
+		uintptr_t *next = SRP_PTR_GET(element, uintptr_t *);
+		uint32_t nextRef = 0;
+
+		if (NULL != next) {
+			nextRef = (uint32_t)pool_getElementPuddleSlot(pool, puddle, next) + 1;
+		}
+		SLOT_LINK(element) = nextRef;
+		element = next;
+	}
+
+	SRP_SET_TO_NULL(puddle->firstFreeSlot);
+	puddle->freeSlotStack = STACK_MAKE(0, firstRef);
+}
+
+uintptr_t
+poolPuddle_countUsedElements(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	uint32_t *bits = PUDDLE_BITS(puddle);
+	uintptr_t bitLength = POOL_PUDDLE_BITS_LEN(pool);
+	uintptr_t usedElements = 0;
+	uintptr_t i = 0;
+
+	/* Holes and the slots past the end of the last word are always marked free. */
+	for (i = 0; i < bitLength; i++) {
+		uint32_t usedBits = ~bits[i];
+
+		while (0 != usedBits) {
+			usedBits &= usedBits - 1;
+			usedElements += 1;
+		}
+	}
+
+	return usedElements;
+}
+
+void *
+pool_newElementConcurrent(J9Pool *pool)
+{
+	J9PoolPuddle *puddle = NULL;
+	uint32_t ref = pool_findFreeSlots(pool, false, &puddle);
+
+	if (0 == ref) {
+		puddle = pool_addPuddleConcurrent(pool, false, &ref);
+		if (NULL == puddle) {
+			return NULL;
+		}
+	}
+
+	return poolPuddle_allocateSlot(pool, puddle, ref);
+}
+
+void
+pool_removeElementConcurrent(J9Pool *pool, void *anElement)
+{
+	J9PoolPuddle *puddle = NULL;
+	uint32_t ref = pool_releaseSlot(pool, anElement, &puddle);
+
+	if (0 != ref) {
+		poolPuddle_pushFreeSlots(pool, puddle, ref, anElement);
+	}
+}
+
+/**
+ * Push the slots of a return batch back onto their puddle and empty the batch.
+ *
+ * @param[in] pool  The pool owning the batch's puddle.
+ * @param[in] batch The batch to flush.
+ */
+static void
+pool_flushReturnBatch(J9Pool *pool, J9PoolReturnBatch *batch)
+{
+	if (NULL != batch->puddle) {
+		void *lastElement = poolPuddle_slotElement(pool, batch->puddle, batch->lastSlot);
+
+		poolPuddle_pushFreeSlots(pool, batch->puddle, batch->firstSlot, lastElement);
+		COUNT_CONTENTION(pool, batchReturns);
+		memset(batch, 0, sizeof(*batch));
+	}
+}
+
+/**
+ * Refill an empty thread cache: take back the free slots of the puddle it is working from,
+ * or else all free slots of some other puddle, or else a new puddle.
+ *
+ * @param[in] cache The empty thread cache.
+ *
+ * @return The reference of the first free slot of the cache, or 0 if the pool could not grow.
+ */
+static uint32_t
+pool_refillThreadCache(J9PoolThreadCache *cache)
+{
+	J9Pool *pool = cache->pool;
+	J9PoolPuddle *puddle = cache->puddle;
+	uint32_t ref = 0;
+
+	COUNT_CONTENTION(pool, refills);
+	if (NULL != puddle) {
+		ref = poolPuddle_takeFreeSlots(pool, puddle);
+	}
+	if (0 == ref) {
+		ref = pool_findFreeSlots(pool, true, &puddle);
+		if (0 == ref) {
+			puddle = pool_addPuddleConcurrent(pool, true, &ref);
+			if (NULL == puddle) {
+				return 0;
+			}
+		}
+	}
+
+	cache->puddle = puddle;
+	cache->freeSlots = ref;
+	return ref;
+}
+
+J9PoolThreadCache *
+pool_threadCacheNew(J9Pool *pool)
+{
+	J9PoolThreadCache *cache = NULL;
+	uint32_t doInit = 1;
+
+	if ((NULL != pool) && (pool->flags & POOL_THREAD_SAFE)) {
+		cache = (J9PoolThreadCache *)pool->memAlloc(pool->userData, sizeof(J9PoolThreadCache), pool->poolCreatorCallsite, pool->memoryCategory, POOL_ALLOC_TYPE_THREAD_CACHE, &doInit);
+		if (NULL != cache) {
+			memset(cache, 0, sizeof(*cache));
+			cache->pool = pool;
+		}
+	}
+
+	return cache;
+}
+
+void
+pool_threadCacheFlush(J9PoolThreadCache *cache)
+{
+	J9Pool *pool = cache->pool;
+	uintptr_t i = 0;
+
+	for (i = 0; i < POOL_THREAD_CACHE_RETURN_PUDDLES; i++) {
+		pool_flushReturnBatch(pool, &cache->batches[i]);
+	}
+	cache->nextBatchToFlush = 0;
+
+	if (0 != cache->freeSlots) {
+		uint32_t lastRef = cache->freeSlots;
+		uint32_t nextRef = SLOT_LINK(poolPuddle_slotElement(pool, cache->puddle, lastRef));
+
+		while (0 != nextRef) {
+			lastRef = nextRef;
+			nextRef = SLOT_LINK(poolPuddle_slotElement(pool, cache->puddle, lastRef));
+		}
+		poolPuddle_pushFreeSlots(pool, cache->puddle, cache->freeSlots, poolPuddle_slotElement(pool, cache->puddle, lastRef));
+		cache->freeSlots = 0;
+	}
+	cache->puddle = NULL;
+}
+
+void
+pool_threadCacheKill(J9PoolThreadCache *cache)
+{
+	if (NULL != cache) {
+		J9Pool *pool = cache->pool;
+
+		pool_threadCacheFlush(cache);
+		pool->memFree(pool->userData, cache, POOL_ALLOC_TYPE_THREAD_CACHE);
+	}
+}
+
+void *
+pool_newElementCached(J9PoolThreadCache *cache)
+{
+	J9Pool *pool = cache->pool;
+	void *newElement = NULL;
+	uint32_t ref = cache->freeSlots;
+
+	Trc_pool_newElement_Entry(pool);
+
+	if (0 == ref) {
+		ref = pool_refillThreadCache(cache);
+	}
+	if (0 != ref) {
+		cache->freeSlots = SLOT_LINK(poolPuddle_slotElement(pool, cache->puddle, ref));
+		newElement = poolPuddle_allocateSlot(pool, cache->puddle, ref);
+	}
+
+	Trc_pool_newElement_Exit(newElement);
+
+	return newElement;
+}
+
+void
+pool_removeElementCached(J9PoolThreadCache *cache, void *anElement)
+{
+	J9Pool *pool = cache->pool;
+	J9PoolPuddle *puddle = NULL;
+	uint32_t ref = 0;
+
+	Trc_pool_removeElement_Entry(pool, anElement);
+
+	if (NULL == anElement) {
+		Trc_pool_removeElement_ExitNoop();
+		return;
+	}
+
+	ref = pool_releaseSlot(pool, anElement, &puddle);
+	if (0 == ref) {
+		/* Not allocated from this pool; already traced. */
+	} else if (puddle == cache->puddle) {
+		SLOT_LINK(anElement) = cache->freeSlots;
+		cache->freeSlots = ref;
+	} else {
+		/* Gather elements of other puddles into per-puddle batches, so that returning
+		 * them to their puddle costs one compare and swap per batch.
+		 */
+		J9PoolReturnBatch *batch = NULL;
+		J9PoolReturnBatch *emptyBatch = NULL;
+		uintptr_t i = 0;
+
+		for (i = 0; i < POOL_THREAD_CACHE_RETURN_PUDDLES; i++) {
+			if (puddle == cache->batches[i].puddle) {
+				batch = &cache->batches[i];
+				break;
+			}
+			if ((NULL == emptyBatch) && (NULL == cache->batches[i].puddle)) {
+				emptyBatch = &cache->batches[i];
+			}
+		}
+
+		if (NULL == batch) {
+			batch = emptyBatch;
+			if (NULL == batch) {
+				batch = &cache->batches[cache->nextBatchToFlush];
+				cache->nextBatchToFlush = (cache->nextBatchToFlush + 1) % POOL_THREAD_CACHE_RETURN_PUDDLES;
+				pool_flushReturnBatch(pool, batch);
+			}
+			batch->puddle = puddle;
+			batch->lastSlot = ref;
+		}
+
+		SLOT_LINK(anElement) = batch->firstSlot;
+		batch->firstSlot = ref;
+		batch->count += 1;
+		if (batch->count >= POOL_THREAD_CACHE_BATCH_SIZE) {
+			pool_flushReturnBatch(pool, batch);
+		}
+	}
+
+	Trc_pool_removeElement_Exit();
+}
+
+void
+pool_getContentionStats(J9Pool *pool, J9PoolContentionStats *stats)
+{
+	memcpy(stats, &pool->contentionStats, sizeof(*stats));
+}
+
+} /* extern "C" */
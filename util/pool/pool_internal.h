@@ -39,6 +39,67 @@
 extern "C" {
 #endif
 
+#define PUDDLE_BITS(puddle) ((uint32_t *) ((J9PoolPuddle *) (puddle) + 1))
+#define POOL_PUDDLE_BITS_LEN(pool) (((pool)->elementsPerPuddle+31) / 32)
+#define PUDDLE_SLOT_FREE(puddle, sindex) (*(PUDDLE_BITS(puddle) + (((uint32_t)(sindex)) >> 5)) & (1 << (31 - (((uint32_t)(sindex)) & 31))))
+
+/* ---------------- pool.c ---------------- */
+
+/**
+ * Get a pointer to the SRP to the puddle, given a puddle element.
+ * @param[in] pool The pool containing the element
+ * @param[in] element The element
+ * @return A pointer to the SRP to the puddle containing the element
+ */
+J9SRP *
+pool_getElementPuddleSRP(J9Pool *pool, void *element);
+
+/**
+ * Get the slot (index) of an element in a puddle.
+ * @param[in] pool The pool containing the puddle
+ * @param[in] puddle The puddle
+ * @param[in] element The element
+ * @return The element's index in the puddle, or -1 if the element is not in the puddle
+ */
+int32_t
+pool_getElementPuddleSlot(J9Pool *pool, J9PoolPuddle *puddle, void *element);
+
+/* ---------------- pool_concurrent.cpp ---------------- */
+
+/**
+ * Relink the free slots of a freshly initialized puddle of a POOL_THREAD_SAFE pool
+ * into its lock-free free slot stack.
+ * @param[in] pool The pool
+ * @param[in] puddle The puddle
+ */
+void
+poolPuddle_initFreeSlotStack(J9Pool *pool, J9PoolPuddle *puddle);
+
+/**
+ * Count the allocated elements of a puddle of a POOL_THREAD_SAFE pool from its bits.
+ * @param[in] pool The pool
+ * @param[in] puddle The puddle
+ * @return The number of allocated elements
+ */
+uintptr_t
+poolPuddle_countUsedElements(J9Pool *pool, J9PoolPuddle *puddle);
+
+/**
+ * pool_newElement() for a POOL_THREAD_SAFE pool.
+ * @param[in] pool The pool
+ * @return A new element, or NULL
+ */
+void *
+pool_newElementConcurrent(J9Pool *pool);
+
+/**
+ * pool_removeElement() for a POOL_THREAD_SAFE pool.
+ * @param[in] pool The pool
+ * @param[in] anElement The element to free
+ */
+void
+pool_removeElementConcurrent(J9Pool *pool, void *anElement);
+
 
 #ifdef __cplusplus
 }